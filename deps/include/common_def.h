@@ -29,6 +29,14 @@ typedef enum
   kErrorCode_NullDoubleLPointer = -9,
   kErrorCode_NullStackPointer = -10,
   kErrorCode_NullQueuePointer = -11,
+  kErrorCode_NullDequePointer = -12,
+  kErrorCode_NullSkipListPointer = -13,
+  kErrorCode_NullUnrolledListPointer = -14,
+  kErrorCode_NullHeapPointer = -15,
+  kErrorCode_NullSchedulerPointer = -16,
+  kErrorCode_QueueClosed = -17,
+  kErrorCode_NullTimingWheelPointer = -18,
+  kErrorCode_NullArenaPointer = -19,
   kErrorCode_File = -20
 } ErrorCode;
 
@@ -45,7 +53,15 @@ static const char* kErrorCodeText[] = {
   "Null double list pointer",
   "Null stack pointer",
   "Null queue pointer",
-  "NULL file"
+  "Null deque pointer",
+  "Null skip list pointer",
+  "Null unrolled list pointer",
+  "Null heap pointer",
+  "Null scheduler pointer",
+  "Queue closed",
+  "Null timing wheel pointer",
+  "Null arena pointer",
+  [-kErrorCode_File] = "File error"
 };
 
 #endif // __COMMON_DEF_H__
@@ -0,0 +1,103 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Atomic operations shared by the lock-free data types
+*
+* C11 atomics everywhere but Windows, where MSVC builds use the Interlocked
+* functions. Every operation is sequentially consistent.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_ATOMIC_H__
+#define __ADT_ATOMIC_H__ 1
+
+#include "ABGS_MemoryManager/abgs_platform_types.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#ifndef ADT_INLINE
+#define ADT_INLINE __inline
+#endif
+#define ADT_THREAD_LOCAL __declspec(thread)
+#else
+#include <stdatomic.h>
+#ifndef ADT_INLINE
+#define ADT_INLINE inline
+#endif
+#define ADT_THREAD_LOCAL _Thread_local
+#endif
+
+// Reads a pointer shared between threads
+static ADT_INLINE void* ATOMIC_loadPtr(void* volatile* ptr) {
+#ifdef _WIN32
+	return InterlockedCompareExchangePointer(ptr, NULL, NULL);
+#else
+	return atomic_load((_Atomic(void*)*)ptr);
+#endif
+}
+
+// Writes a pointer shared between threads
+static ADT_INLINE void ATOMIC_storePtr(void* volatile* ptr, void* value) {
+#ifdef _WIN32
+	InterlockedExchangePointer(ptr, value);
+#else
+	atomic_store((_Atomic(void*)*)ptr, value);
+#endif
+}
+
+// Replaces *ptr with desired if it still holds expected, returns true when it did
+static ADT_INLINE bool ATOMIC_casPtr(void* volatile* ptr, void* expected, void* desired) {
+#ifdef _WIN32
+	return expected == InterlockedCompareExchangePointer(ptr, desired, expected);
+#else
+	return atomic_compare_exchange_strong((_Atomic(void*)*)ptr, &expected, desired);
+#endif
+}
+
+// Reads a counter shared between threads
+static ADT_INLINE u32 ATOMIC_loadU32(volatile u32* value) {
+#ifdef _WIN32
+	return (u32)InterlockedCompareExchange((volatile LONG*)value, 0, 0);
+#else
+	return atomic_load((_Atomic(u32)*)value);
+#endif
+}
+
+// Adds delta to a counter shared between threads, returns the previous value
+static ADT_INLINE u32 ATOMIC_addU32(volatile u32* value, s32 delta) {
+#ifdef _WIN32
+	return (u32)InterlockedExchangeAdd((volatile LONG*)value, (LONG)delta);
+#else
+	return atomic_fetch_add((_Atomic(u32)*)value, (u32)delta);
+#endif
+}
+
+// Replaces *value with desired if it still holds expected, returns true when it did
+static ADT_INLINE bool ATOMIC_casU32(volatile u32* value, u32 expected, u32 desired) {
+#ifdef _WIN32
+	return expected == (u32)InterlockedCompareExchange((volatile LONG*)value, (LONG)desired, (LONG)expected);
+#else
+	return atomic_compare_exchange_strong((_Atomic(u32)*)value, &expected, desired);
+#endif
+}
+
+// Writes a counter shared between threads
+static ADT_INLINE void ATOMIC_storeU32(volatile u32* value, u32 desired) {
+#ifdef _WIN32
+	InterlockedExchange((volatile LONG*)value, (LONG)desired);
+#else
+	atomic_store((_Atomic(u32)*)value, desired);
+#endif
+}
+
+// Full barrier, no read or write crosses it
+static ADT_INLINE void ATOMIC_fence() {
+#ifdef _WIN32
+	MemoryBarrier();
+#else
+	atomic_thread_fence(memory_order_seq_cst);
+#endif
+}
+#endif //__ADT_ATOMIC_H__
@@ -0,0 +1,206 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Blocking Queue" data type
+*
+* Bounded queue shared by producer and consumer threads. It keeps a Queue on a
+* ring buffer behind a lock; a producer that finds it full or a consumer that
+* finds it empty spins for a while and then sleeps on a condition variable, so
+* idle threads don't burn CPU. close() wakes everyone up.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_BLOCKING_QUEUE_H__
+#define __ADT_BLOCKING_QUEUE_H__ 1
+
+#include "adt_atomic.h"
+#include "adt_queue.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+// Timeout of dequeueWait and drain that waits until there's an element or the queue is closed
+#define kBlockingQueueWaitForever 0xFFFFFFFF
+// Times a waiting thread checks the queue before it goes to sleep, on more than one processor
+#define kBlockingQueueDefaultSpins 1000
+
+/**
+* @brief Structure representing a BlockingQueue with variables and callbacks.
+* Everything but length_ and closed_ is only touched with lock_ held
+*/
+typedef struct adt_blocking_queue_s {
+ // @brief Elements, kept in a Queue on a ring buffer
+	Queue* queue_;
+ // @brief Lock of queue_ and of the waiter counts
+#ifdef _WIN32
+	SRWLOCK lock_;
+#else
+	pthread_mutex_t lock_;
+#endif
+ // @brief Where the consumers sleep while the queue is empty
+#ifdef _WIN32
+	CONDITION_VARIABLE not_empty_;
+#else
+	pthread_cond_t not_empty_;
+#endif
+ // @brief Where the producers sleep while the queue is full
+#ifdef _WIN32
+	CONDITION_VARIABLE not_full_;
+#else
+	pthread_cond_t not_full_;
+#endif
+ // @brief Copy of the length of queue_ the spinning threads read without the lock
+	volatile u32 length_;
+ // @brief 1 once the queue is closed
+	volatile u32 closed_;
+ // @brief Consumers sleeping on not_empty_, nobody is woken up when it's 0
+	u16 consumers_waiting_;
+ // @brief Producers sleeping on not_full_, nobody is woken up when it's 0
+	u16 producers_waiting_;
+ // @brief Times a waiting thread checks length_ before it sleeps
+	u32 spins_;
+ // @brief Pointer to callback functions
+	struct blocking_queue_ops_s *ops_;
+} BlockingQueue;
+
+/**
+* @brief Struct that contains all functions attached to the BlockingQueue. Every
+* function but destroy, setSpins and print can be called from several threads at
+* the same time. Only the data pointer of an element comes back out of the queue
+*/
+struct blocking_queue_ops_s {
+/**
+* @brief Destroys the queue and the data of the elements left. No other thread may be using it
+* @param *BlockingQueue queue Pointer to the queue
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullQueuePointer When the queue pointer is NULL
+*/
+	s16 (*destroy)(BlockingQueue *queue);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *BlockingQueue queue Pointer to the queue
+* @return u16 Capacity, 0 if the queue pointer is NULL
+*/
+	u16 (*capacity)(BlockingQueue *queue);
+
+/**
+* @brief Current number of elements, it may be out of date as soon as it is read
+* @param *BlockingQueue queue Pointer to the queue
+* @return u16 Length, 0 if the queue pointer is NULL
+*/
+	u16 (*length)(BlockingQueue *queue);
+
+/**
+* @brief Verifies if the queue is empty
+* @param *BlockingQueue queue Pointer to the queue
+* @return bool true if it is empty, false otherwise or if the queue pointer is NULL
+*/
+	bool (*isEmpty)(BlockingQueue *queue);
+
+/**
+* @brief Verifies if the queue is full
+* @param *BlockingQueue queue Pointer to the queue
+* @return bool true if it is full, false otherwise or if the queue pointer is NULL
+*/
+	bool (*isFull)(BlockingQueue *queue);
+
+/**
+* @brief Verifies if the queue has been closed
+* @param *BlockingQueue queue Pointer to the queue
+* @return bool true if it is closed, false otherwise or if the queue pointer is NULL
+*/
+	bool (*isClosed)(BlockingQueue *queue);
+
+/**
+* @brief Sets how many times a waiting thread checks the queue before it sleeps.
+* 0 sleeps at once, which saves CPU; more spins wake up faster when the other side
+* is quick. No other thread may be using the queue
+* @param *BlockingQueue queue Pointer to the queue
+* @param u32 spins Checks before sleeping
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullQueuePointer When the queue pointer is NULL
+*/
+	s16 (*setSpins)(BlockingQueue *queue, u32 spins);
+
+	// Insertion
+/**
+* @brief Inserts an element at the back, waiting while the queue is full
+* @param *BlockingQueue queue Pointer to the queue
+* @param void* data pointer
+* @param u16 bytes Size of the data
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullQueuePointer When the queue pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When the bytes value is 0
+* @return s16 kErrorCode_QueueClosed When the queue is closed, before or while waiting
+*/
+	s16 (*enqueueWait)(BlockingQueue *queue, void *data, u16 bytes);
+
+/**
+* @brief Inserts an element at the back if there's room, without waiting
+* @param *BlockingQueue queue Pointer to the queue
+* @param void* data pointer
+* @param u16 bytes Size of the data
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullQueuePointer When the queue pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When the bytes value is 0
+* @return s16 kErrorCode_InsertionFailed When the queue is full
+* @return s16 kErrorCode_QueueClosed When the queue is closed
+*/
+	s16 (*tryEnqueue)(BlockingQueue *queue, void *data, u16 bytes);
+
+	// Extraction
+/**
+* @brief Extracts the front element, waiting up to timeout milliseconds while the queue is empty.
+* The elements left in a closed queue are still handed out
+* @param *BlockingQueue queue Pointer to the queue
+* @param u32 timeout Milliseconds to wait, 0 doesn't wait and kBlockingQueueWaitForever
+* waits until there's an element or the queue is closed
+* @return void* Data pointer, NULL if the queue pointer is NULL, the time ran out or the queue is closed and empty
+*/
+	void* (*dequeueWait)(BlockingQueue *queue, u32 timeout);
+
+/**
+* @brief Extracts up to max elements from the front with one pass through the lock,
+* waiting up to timeout milliseconds for the first one
+* @param *BlockingQueue queue Pointer to the queue
+* @param void** out Array that gets the data pointers, from the front, at least max long
+* @param u16 max Largest number of elements to extract
+* @param u32 timeout Milliseconds to wait, like dequeueWait
+* @return u16 Elements extracted, 0 if the queue or out pointer is NULL, max is 0, the time
+* ran out or the queue is closed and empty
+*/
+	u16 (*drain)(BlockingQueue *queue, void **out, u16 max, u32 timeout);
+
+/**
+* @brief Closes the queue: enqueues fail from now on and every waiting thread wakes
+* up. Consumers keep getting the elements left until it is empty
+* @param *BlockingQueue queue Pointer to the queue
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullQueuePointer When the queue pointer is NULL
+*/
+	s16 (*close)(BlockingQueue *queue);
+
+	// Miscellaneous
+/**
+* @brief Prints the features and content of the queue. No other thread may be using it
+* @param *BlockingQueue queue Pointer to the queue
+*/
+	void (*print)(BlockingQueue *queue);
+};
+
+/**
+* @brief Creates a new blocking queue that spins kBlockingQueueDefaultSpins times before sleeping,
+* or doesn't spin at all on a single processor
+* @param u16 capacity Maximum length that the queue can possibly have
+* @return BlockingQueue* Return a queue pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+BlockingQueue* BLOCKINGQUEUE_create(u16 capacity);
+#endif //__ADT_BLOCKING_QUEUE_H__
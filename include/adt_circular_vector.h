@@ -15,6 +15,16 @@
 
 #include "adt_memory_node.h"
 
+/**
+* @brief Behaviour of the vector when it is full, chosen at creation time
+*/
+typedef enum {
+  // insertLast fails with kErrorCode_InsertionFailed when the vector is full
+  kCircularVectorMode_Bounded = 0,
+  // insertLast replaces the oldest element when the vector is full (telemetry ring)
+  kCircularVectorMode_Overwrite = 1
+} CircularVectorMode;
+
 /**
 * @brief Structure representing a Vector with variables and callbacks.
 */
@@ -23,14 +33,40 @@ typedef struct adt_circular_vector_s {
 	u16 head_;
  // @brief Corresponds to the first free place of the vector
 	u16 tail_; 
+ // @brief Current number of elements, needed to tell full from empty when head_ == tail_
+	u16 length_;
  // @brief Maximum length that the list can possibly have, cannot be 0
 	u16 capacity_; 
  // @brief Container of all elements of the vector
 	MemoryNode *storage_;
+ // @brief What insertLast does when the vector is full
+	CircularVectorMode mode_;
+ // @brief Number of elements overwritten since creation, lets iterators skip the lost ones
+	u32 evictions_;
  // @brief Pointer to callback functions 
 	struct circular_vector_ops_s *ops_;
 } CircularVector;
 
+/**
+* @brief Read cursor that walks the vector from the oldest to the newest element.
+* It keeps the head and length of the moment it was started, so it never copies
+* the elements nor sees the ones inserted after it started. Elements overwritten
+* by insertLast/insertLastEvict in the meantime are skipped; any other insertion
+* or extraction invalidates the iterator.
+*/
+typedef struct circular_vector_iterator_s {
+ // @brief Vector being walked
+	CircularVector *vector_;
+ // @brief Head of the vector when the iterator was started
+	u16 head_;
+ // @brief Length of the vector when the iterator was started
+	u16 length_;
+ // @brief Next logical position to return
+	u16 position_;
+ // @brief Evictions of the vector when the iterator was started
+	u32 evictions_;
+} CircularVectorIterator;
+
 /**
 * @brief Struct that contains all functions attached to the Vector
 */
@@ -236,12 +272,100 @@ struct circular_vector_ops_s {
 * @return s16 kErrorCode_NullMemoryNode When the new node is NULL
 */
  s16 (*traverse)(CircularVector *vector, void (*callback)(MemoryNode *)); 
+
+ /**
+* @brief Calls a function on the elements of the vector, from the first to the last, handing it ctx,
+* until it returns kTraverse_Stop
+* @param *CircularVector vector Pointer to the vector
+* @param callback Function that returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullVectorPointer When the vector pointer is NULL
+* @return s16 kErrorCode_NullMemoryNode When the storage is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseEx)(CircularVector *vector, s16 (*callback)(MemoryNode *node, void *ctx), void *ctx);
+
+ /**
+* @brief Like traverseEx, but hands the callback spans of up to kTraverseBatchLength
+* nodes in the same order, so the cost of a call is shared by the whole span.
+* The vector must not change while the callback runs
+* @param *CircularVector vector Pointer to the vector
+* @param callback Function that gets the nodes of a span and their count, and
+* returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullVectorPointer When the vector pointer is NULL
+* @return s16 kErrorCode_NullMemoryNode When the storage is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseBatch)(CircularVector *vector, s16 (*callback)(MemoryNode **nodes, u16 count, void *ctx), void *ctx);
 	
  /**
 * @brief Prints the features and content of the vector
 * @param *Vector pointer to the vector
 */
  void (*print)(CircularVector *vector); 
+
+	// Bulk operations
+ /**
+* @brief Inserts up to count elements at the end of the vector in one call
+* @param *Vector pointer to the vector
+* @param MemoryNode* src Array of nodes whose data is moved into the vector
+* @param u16 count Number of nodes in src
+* @return u16 Number of elements actually inserted (limited by the free slots)
+* @return u16 0 If Vector pointer, storage or src is NULL
+* @details The copy is done in at most two contiguous segments (before and after
+* the wraparound) and the ownership of every data pointer goes to the vector
+*/
+ u16 (*pushMany)(CircularVector *vector, MemoryNode *src, u16 count);
+
+ /**
+* @brief Extracts up to max elements from the front of the vector in one call
+* @param *Vector pointer to the vector
+* @param MemoryNode* dst Array of nodes that receives the extracted data
+* @param u16 max Number of nodes available in dst
+* @return u16 Number of elements actually extracted (limited by the length)
+* @return u16 0 If Vector pointer, storage or dst is NULL
+* @details The copy is done in at most two contiguous segments (before and after
+* the wraparound) and the ownership of every data pointer goes to the caller
+*/
+ u16 (*popMany)(CircularVector *vector, MemoryNode *dst, u16 max);
+
+	// Overwrite mode
+ /**
+* @brief Inserts an element in the last position, evicting the oldest one if the vector is full
+* @param *Vector pointer to the vector
+* @param void* data pointer
+* @param u16 bytes size
+* @param MemoryNode* evicted Receives the evicted data and size so it can be recycled, can be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullVectorPointer When the Vector pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_NullMemoryNode When the vector's storage is NULL
+* @details Works in both modes. If nothing is evicted the evicted node is soft reset.
+* If evicted is NULL the oldest data is freed. No memory is allocated.
+*/
+ s16 (*insertLastEvict)(CircularVector *vector, void *data, u16 bytes, MemoryNode *evicted);
+
+	// Iteration
+ /**
+* @brief Starts a snapshot iterator on the oldest element of the vector
+* @param *Vector pointer to the vector
+* @param CircularVectorIterator* iterator Cursor to initialize, owned by the caller
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullVectorPointer When the Vector pointer is NULL
+* @return s16 kErrorCode_NullPointer When the iterator pointer is NULL
+*/
+ s16 (*iteratorBegin)(CircularVector *vector, CircularVectorIterator *iterator);
+
+ /**
+* @brief Returns the next node of the snapshot, from oldest to newest
+* @param CircularVectorIterator* iterator Cursor started with iteratorBegin
+* @return MemoryNode* Node stored in the vector (not a copy)
+* @return NULL When the iterator is NULL or the snapshot has been walked completely
+*/
+ MemoryNode* (*iteratorNext)(CircularVectorIterator *iterator);
 };
 /**
 * @brief Creates a new vector
@@ -250,4 +374,13 @@ struct circular_vector_ops_s {
 * @return NULL If capacity parameter is 0 or theres no space in memory
 */
 CircularVector* CIRCULAR_VECTOR_create(u16 capacity); 
+
+/**
+* @brief Creates a new vector with the given full behaviour
+* @param u16 capacity Maximum length that the list can possibly have
+* @param CircularVectorMode mode kCircularVectorMode_Overwrite makes insertLast never fail on full
+* @return Vector* Return a vector pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+CircularVector* CIRCULAR_VECTOR_createWithMode(u16 capacity, CircularVectorMode mode);
 #endif //__ADT_CIRCULAR_VECTOR_H__
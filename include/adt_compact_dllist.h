@@ -0,0 +1,250 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Compact Double List" data type
+*
+* Doubly linked list whose nodes live in one growable array and link by index.
+* The array holds no pointers into itself, so it can be moved with memcpy or
+* written to disk as is.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_COMPACT_DLLIST_H__
+#define __ADT_COMPACT_DLLIST_H__ 1
+
+#include "adt_memory_node.h"
+
+// Index meaning "no node"
+#define kCompactDListNull 0xFFFFFFFF
+// Nodes of the pool of a new list (or its capacity, if smaller)
+#define kCompactDListInitialPool 16
+
+/**
+* @brief Node of the pool: the element's data plus the indices of its neighbours.
+* Free nodes are chained through next_
+*/
+typedef struct compact_dlist_node_s {
+ // @brief Data of the element
+	void *data_;
+ // @brief Index of the next node, kCompactDListNull for the last one
+	u32 next_;
+ // @brief Index of the previous node, kCompactDListNull for the first one
+	u32 prev_;
+ // @brief Size of the data
+	u16 size_;
+} CompactDListNode;
+
+/**
+* @brief Structure representing a CompactDList with variables and callbacks.
+*/
+typedef struct adt_compact_dlist_s {
+ // @brief Pool of nodes, pool_size_ entries
+	CompactDListNode *nodes_;
+ // @brief Index of the first node
+	u32 head_;
+ // @brief Index of the last node
+	u32 tail_;
+ // @brief Index of the first free node of the pool
+	u32 free_;
+ // @brief Number of nodes allocated in the pool
+	u32 pool_size_;
+ // @brief Maximum length that the list can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Current number of elements in the list
+	u16 length_;
+ // @brief Pointer to callback functions
+	struct compact_dlist_ops_s *ops_;
+} CompactDList;
+
+/**
+* @brief Struct that contains all functions attached to the CompactDList. It has
+* the shape of struct dlist_ops_s without the cursor functions
+*/
+struct compact_dlist_ops_s {
+/**
+* @brief Destroys the list and its data
+* @param *CompactDList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+*/
+	s16 (*destroy)(CompactDList *list);
+
+/**
+* @brief Soft resets list's data, the elements' data is not freed
+* @param *CompactDList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+*/
+	s16 (*softReset)(CompactDList *list);
+
+/**
+* @brief Resets list's data. The pool is kept for the next elements
+* @param *CompactDList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+*/
+	s16 (*reset)(CompactDList *list);
+
+/**
+* @brief Changes the capacity of the list. Elements over the new capacity are
+* lost from the end
+* @param *CompactDList list Pointer to the list
+* @param u16 new_size New capacity
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+* @return s16 kErrorCode_InvalidValue When new_size is 0
+*/
+	s16 (*resize)(CompactDList *list, u16 new_size);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *CompactDList list Pointer to the list
+* @return u16 Capacity, 0 if the list pointer is NULL
+*/
+	u16 (*capacity)(CompactDList *list);
+
+/**
+* @brief Current number of elements (<= capacity)
+* @param *CompactDList list Pointer to the list
+* @return u16 Length, 0 if the list pointer is NULL
+*/
+	u16 (*length)(CompactDList *list);
+
+/**
+* @brief Verifies if the list is empty
+* @param *CompactDList list Pointer to the list
+* @return bool true if it is empty, false otherwise or if the list pointer is NULL
+*/
+	bool (*isEmpty)(CompactDList *list);
+
+/**
+* @brief Verifies if the list is full
+* @param *CompactDList list Pointer to the list
+* @return bool true if it is full, false otherwise or if the list pointer is NULL
+*/
+	bool (*isFull)(CompactDList *list);
+
+	// Data queries
+/**
+* @brief Returns a reference to the first element of the list
+* @param *CompactDList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*first)(CompactDList *list);
+
+/**
+* @brief Returns a reference to the last element of the list
+* @param *CompactDList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*last)(CompactDList *list);
+
+/**
+* @brief Returns a reference to the element at a given position, walking from the nearest end
+* @param *CompactDList list Pointer to the list
+* @param u16 position Position of the element
+* @return void* Data pointer, NULL if the list pointer is NULL or position is out of range
+*/
+	void* (*at)(CompactDList *list, u16 position);
+
+	// Insertion
+/**
+* @brief Inserts an element in the first position of the list
+* @param *CompactDList list Pointer to the list
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the list is full
+* @return s16 kErrorCode_NullMemoryAllocation When the pool can't grow
+*/
+	s16 (*insertFirst)(CompactDList *list, void *data, u16 bytes);
+
+/**
+* @brief Inserts an element in the last position of the list
+* @param *CompactDList list Pointer to the list
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertLast)(CompactDList *list, void *data, u16 bytes);
+
+/**
+* @brief Inserts an element at the given position of the list. Positions over
+* the length insert at the end
+* @param *CompactDList list Pointer to the list
+* @param void* data pointer
+* @param u16 bytes size
+* @param u16 position Position of the new element
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertAt)(CompactDList *list, void *data, u16 bytes, u16 position);
+
+	// Extraction
+/**
+* @brief Extracts the first element of the list
+* @param *CompactDList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*extractFirst)(CompactDList *list);
+
+/**
+* @brief Extracts the last element of the list
+* @param *CompactDList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*extractLast)(CompactDList *list);
+
+/**
+* @brief Extracts the element at the given position
+* @param *CompactDList list Pointer to the list
+* @param u16 position Position of the element
+* @return void* Data pointer, NULL if the list pointer is NULL or position is out of range
+*/
+	void* (*extractAt)(CompactDList *list, u16 position);
+
+	// Miscellaneous
+/**
+* @brief Concatenates two lists, copying the data of the second one at the end of the first.
+* The capacity of the first list grows by the capacity of the second one
+* @param *CompactDList list Pointer to the list
+* @param *CompactDList list_src Pointer to the second list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When any of the list pointers is NULL
+* @return s16 kErrorCode_InvalidValue When both pointers are the same list
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for the copies
+*/
+	s16 (*concat)(CompactDList *list, CompactDList *list_src);
+
+/**
+* @brief Calls to a function from all elements of the list. The callback gets
+* a MemoryNode holding the element's data; changes to its data and size are
+* kept in the list
+* @param *CompactDList list Pointer to the list
+* @param *Void Pointer to MemoryNode's callback
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverse)(CompactDList *list, void (*callback)(MemoryNode *));
+
+/**
+* @brief Prints the features and content of the list
+* @param *CompactDList list Pointer to the list
+*/
+	void (*print)(CompactDList *list);
+};
+
+/**
+* @brief Creates a new compact list. The pool starts small and doubles up to the capacity
+* @param u16 capacity Maximum length that the list can possibly have
+* @return CompactDList* Return a list pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+CompactDList* COMPACTDLIST_create(u16 capacity);
+#endif //__ADT_COMPACT_DLLIST_H__
@@ -0,0 +1,262 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Deque" data type
+*
+* Elements live in fixed-size blocks of MemoryNodes reached through a block map,
+* so both ends grow without copying the elements and at() stays O(1).
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_DEQUE_H__
+#define __ADT_DEQUE_H__ 1
+
+#include "adt_memory_node.h"
+
+// MemoryNodes per block
+#define kDequeBlockSize 16
+// Block map slots of a new deque, the map doubles when an end runs out of slots
+#define kDequeInitialMapSize 8
+
+/**
+* @brief Structure representing a Deque with variables and callbacks.
+* Element i lives in blocks_[(head_ + i) / kDequeBlockSize], at slot
+* (head_ + i) % kDequeBlockSize. Only the blocks holding elements are allocated.
+*/
+typedef struct adt_deque_s {
+ // @brief Offset of the first element from the start of the first map slot
+	u32 head_;
+ // @brief Current number of elements
+	u16 length_;
+ // @brief Maximum length that the deque can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Number of slots of the block map
+	u16 map_size_;
+ // @brief Block map, NULL slots have no block allocated
+	MemoryNode **blocks_;
+ // @brief Pointer to callback functions
+	struct deque_ops_s *ops_;
+} Deque;
+
+/**
+* @brief Struct that contains all functions attached to the Deque. It has the
+* shape of struct vector_ops_s, so it can back any ADT built on top of a Vector
+*/
+struct deque_ops_s {
+/**
+* @brief Destroys the deque and its data
+* @param *Deque deque Pointer to the deque
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+*/
+	s16 (*destroy)(Deque *deque);
+
+/**
+* @brief Soft resets deque's data, the elements' data is not freed
+* @param *Deque deque Pointer to the deque
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+*/
+	s16 (*softReset)(Deque *deque);
+
+/**
+* @brief Resets deque's data
+* @param *Deque deque Pointer to the deque
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+*/
+	s16 (*reset)(Deque *deque);
+
+/**
+* @brief Changes the capacity of the deque. Elements over the new capacity are
+* lost from the end, the rest are not copied
+* @param *Deque deque Pointer to the deque
+* @param u16 new_size New capacity
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+* @return s16 kErrorCode_InvalidValue When new_size is 0
+*/
+	s16 (*resize)(Deque *deque, u16 new_size);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *Deque deque Pointer to the deque
+* @return u16 Capacity, 0 if the deque pointer is NULL
+*/
+	u16 (*capacity)(Deque *deque);
+
+/**
+* @brief Current number of elements (<= capacity)
+* @param *Deque deque Pointer to the deque
+* @return u16 Length, 0 if the deque pointer is NULL
+*/
+	u16 (*length)(Deque *deque);
+
+/**
+* @brief Verifies if the deque is empty
+* @param *Deque deque Pointer to the deque
+* @return bool true if it is empty, false otherwise or if the deque pointer is NULL
+*/
+	bool (*isEmpty)(Deque *deque);
+
+/**
+* @brief Verifies if the deque is full
+* @param *Deque deque Pointer to the deque
+* @return bool true if it is full, false otherwise or if the deque pointer is NULL
+*/
+	bool (*isFull)(Deque *deque);
+
+	// Data queries
+/**
+* @brief Returns a reference to the first element of the deque
+* @param *Deque deque Pointer to the deque
+* @return void* Data pointer, NULL if the deque pointer is NULL or the deque is empty
+*/
+	void* (*first)(Deque *deque);
+
+/**
+* @brief Returns a reference to the last element of the deque
+* @param *Deque deque Pointer to the deque
+* @return void* Data pointer, NULL if the deque pointer is NULL or the deque is empty
+*/
+	void* (*last)(Deque *deque);
+
+/**
+* @brief Returns a reference to the element at a given position, in O(1)
+* @param *Deque deque Pointer to the deque
+* @param u16 position Position of the element
+* @return void* Data pointer, NULL if the deque pointer is NULL or position is out of range
+*/
+	void* (*at)(Deque *deque, u16 position);
+
+	// Insertion
+/**
+* @brief Inserts an element in the first position of the deque in O(1).
+* No other element moves
+* @param *Deque deque Pointer to the deque
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the deque is full
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for a new block
+*/
+	s16 (*insertFirst)(Deque *deque, void *data, u16 bytes);
+
+/**
+* @brief Inserts an element in the last position of the deque in O(1).
+* No other element moves
+* @param *Deque deque Pointer to the deque
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the deque is full
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for a new block
+*/
+	s16 (*insertLast)(Deque *deque, void *data, u16 bytes);
+
+/**
+* @brief Inserts an element at the given position of the deque, moving the
+* elements of the shorter side. Positions over the length insert at the end
+* @param *Deque deque Pointer to the deque
+* @param void* data pointer
+* @param u16 bytes size
+* @param u16 position Position of the new element
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertAt)(Deque *deque, void *data, u16 bytes, u16 position);
+
+	// Extraction
+/**
+* @brief Extracts the first element of the deque in O(1)
+* @param *Deque deque Pointer to the deque
+* @return void* Data pointer, NULL if the deque pointer is NULL or the deque is empty
+*/
+	void* (*extractFirst)(Deque *deque);
+
+/**
+* @brief Extracts the last element of the deque in O(1)
+* @param *Deque deque Pointer to the deque
+* @return void* Data pointer, NULL if the deque pointer is NULL or the deque is empty
+*/
+	void* (*extractLast)(Deque *deque);
+
+/**
+* @brief Extracts the element at the given position, moving the elements of the shorter side
+* @param *Deque deque Pointer to the deque
+* @param u16 position Position of the element
+* @return void* Data pointer, NULL if the deque pointer is NULL or position is out of range
+*/
+	void* (*extractAt)(Deque *deque, u16 position);
+
+	// Miscellaneous
+/**
+* @brief Concatenates two deques, copying the data of the second one at the end of the first.
+* The capacity of the first deque grows by the capacity of the second one
+* @param *Deque deque Pointer to the deque
+* @param *Deque deque_src Pointer to the second deque
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDequePointer When any of the deque pointers is NULL
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for the copies
+*/
+	s16 (*concat)(Deque *deque, Deque *deque_src);
+
+/**
+* @brief Calls to a function from all elements of the deque
+* @param *Deque deque Pointer to the deque
+* @param *Void Pointer to MemoryNode's callback
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverse)(Deque *deque, void (*callback)(MemoryNode *));
+
+/**
+* @brief Calls a function on the elements of the deque, from the first to the last, handing it ctx,
+* until it returns kTraverse_Stop
+* @param *Deque deque Pointer to the deque
+* @param callback Function that returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseEx)(Deque *deque, s16 (*callback)(MemoryNode *node, void *ctx), void *ctx);
+
+/**
+* @brief Like traverseEx, but hands the callback spans of up to kTraverseBatchLength
+* nodes in the same order. A span never crosses a block, so its nodes are contiguous
+* in memory. The deque must not change while the callback runs
+* @param *Deque deque Pointer to the deque
+* @param callback Function that gets the nodes of a span and their count, and
+* returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseBatch)(Deque *deque, s16 (*callback)(MemoryNode **nodes, u16 count, void *ctx), void *ctx);
+
+/**
+* @brief Prints the features and content of the deque
+* @param *Deque deque Pointer to the deque
+*/
+	void (*print)(Deque *deque);
+};
+
+/**
+* @brief Creates a new deque. Blocks are only allocated when elements arrive
+* @param u16 capacity Maximum length that the deque can possibly have
+* @return Deque* Return a deque pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+Deque* DEQUE_create(u16 capacity);
+#endif //__ADT_DEQUE_H__
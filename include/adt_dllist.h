@@ -15,6 +15,11 @@
 
 #include "adt_vector.h"
 
+// Retired nodes a new list keeps for its next insertions
+#define kDListSpareLimit 16
+// Nodes ahead of the visited one that the walks of a new list prefetch
+#define kDListPrefetchDistance 4
+
 /**
 * @brief Structure representing a DList with variables and callbacks.
 */
@@ -27,10 +32,37 @@ typedef struct adt_dlist_s {
  u16 capacity_;
   // @brief Current number of elements in the list
  u16 length_;
+  // @brief Last node reached by a positional operation, NULL when unknown.
+  // Sequential or nearby at/insertAt/extractAt start walking from here
+ MemoryNode *finger_;
+  // @brief Position of finger_
+ u16 finger_position_;
+  // @brief Retired nodes kept to be reused by the next insertions, chained through next_
+ MemoryNode *spare_;
+  // @brief Number of nodes in spare_
+ u16 spare_length_;
+  // @brief Maximum number of nodes in spare_, 0 frees every retired node
+ u16 spare_limit_;
+  // @brief Nodes ahead that traverse, destroy, reset and concat prefetch, 0 disables it
+ u16 prefetch_distance_;
   // @brief Pointer to callback functions
  struct dlist_ops_s *ops_;
 } DList;
 
+/**
+* @brief Position inside a DList. Stepping in both directions, inserting and
+* erasing at the cursor are O(1). Any list operation other than the cursor
+* ones invalidates it.
+*/
+typedef struct dlist_cursor_s {
+ // @brief List being walked
+	DList *list_;
+ // @brief Node under the cursor, NULL once it has gone past the last element
+	MemoryNode *node_;
+ // @brief Logical position of node_
+	u16 position_;
+} DListCursor;
+
 /**
 * @brief Struct that contains all functions attached to the List
 */
@@ -211,6 +243,34 @@ struct dlist_ops_s {
 * @return s16 kErrorCode_NullMemoryNode When the new node is NULL
 */
 	s16 (*traverse)(DList *list, void (*callback)(MemoryNode *));
+
+ /**
+* @brief Calls a function on the elements of the list, from the head to the tail, handing it ctx,
+* until it returns kTraverse_Stop
+* @param *DList list Pointer to the list
+* @param callback Function that returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullMemoryNode When the list is empty
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseEx)(DList *list, s16 (*callback)(MemoryNode *node, void *ctx), void *ctx);
+
+ /**
+* @brief Like traverseEx, but hands the callback spans of up to kTraverseBatchLength
+* nodes in the same order, so the cost of a call is shared by the whole span.
+* The list must not change while the callback runs
+* @param *DList list Pointer to the list
+* @param callback Function that gets the nodes of a span and their count, and
+* returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullMemoryNode When the list is empty
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseBatch)(DList *list, s16 (*callback)(MemoryNode **nodes, u16 count, void *ctx), void *ctx);
 	
  /**
 * @brief Prints the features and content of the list
@@ -218,6 +278,104 @@ struct dlist_ops_s {
 */
 	void (*print)(DList *list);
 
+	// Cursor
+ /**
+* @brief Places the cursor on the first element of the list
+* @param *List pointer to the list
+* @param *DListCursor pointer to the cursor to initialize
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the cursor pointer is NULL
+*/
+	s16 (*cursorBegin)(DList *list, DListCursor *cursor);
+
+ /**
+* @brief Places the cursor on the last element of the list
+* @param *List pointer to the list
+* @param *DListCursor pointer to the cursor to initialize
+* @return s16 Same values as cursorBegin
+*/
+	s16 (*cursorEnd)(DList *list, DListCursor *cursor);
+
+ /**
+* @brief Returns the data under the cursor
+* @param *DListCursor pointer to the cursor
+* @return Returns nodes's data pointer, NULL if the cursor is NULL or past the end
+*/
+	void* (*cursorGet)(DListCursor *cursor);
+
+ /**
+* @brief Moves the cursor to the next element, O(1)
+* @param *DListCursor pointer to the cursor
+* @return Returns the data of the new position, NULL once the cursor goes past the end
+*/
+	void* (*cursorNext)(DListCursor *cursor);
+
+ /**
+* @brief Moves the cursor to the previous element, O(1). Past the end it goes to the last one
+* @param *DListCursor pointer to the cursor
+* @return Returns the data of the new position, NULL if the cursor was at the first element
+*/
+	void* (*cursorPrev)(DListCursor *cursor);
+
+ /**
+* @brief Inserts an element after the cursor, O(1). The cursor does not move.
+* Past the end it appends, like cursorInsertBefore
+* @param *DListCursor pointer to the cursor
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullPointer When the cursor or data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the list is full
+* @return s16 kErrorCode_NullMemoryNode When the new node is NULL
+*/
+	s16 (*cursorInsertAfter)(DListCursor *cursor, void *data, u16 bytes);
+
+ /**
+* @brief Inserts an element before the cursor, O(1). The cursor stays on the same element
+* @param *DListCursor pointer to the cursor
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 Same values as cursorInsertAfter
+*/
+	s16 (*cursorInsertBefore)(DListCursor *cursor, void *data, u16 bytes);
+
+ /**
+* @brief Extracts the element under the cursor, O(1). The cursor moves to the next one
+* @param *DListCursor pointer to the cursor
+* @return Returns nodes's data pointer, NULL if the cursor is NULL or past the end
+*/
+	void* (*cursorErase)(DListCursor *cursor);
+
+	// Spare nodes
+ /**
+* @brief Frees every spare node. The elements of the list are not touched
+* @param *DList pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+*/
+	s16 (*trim)(DList *list);
+
+ /**
+* @brief Sets how many retired nodes the list keeps for the next insertions.
+* Spare nodes over the new limit are freed
+* @param *DList pointer to the list
+* @param u16 limit Maximum number of spare nodes, 0 to free every retired node
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+*/
+	s16 (*setSpareLimit)(DList *list, u16 limit);
+
+ /**
+* @brief Sets how many nodes ahead of the visited one the walks of traverse,
+* destroy, reset and concat prefetch. Worth it when the nodes are scattered in memory
+* @param *DList pointer to the list
+* @param u16 distance Nodes ahead, 0 to disable the prefetch
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+*/
+	s16 (*setPrefetchDistance)(DList *list, u16 distance);
 };
 
 /**
@@ -0,0 +1,144 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Elimination Stack" data type
+*
+* Treiber stack with an elimination array. A thread that loses the race on the
+* top goes to a random slot of the array instead of trying again: a push leaves
+* its node there for a while and a pop that comes by takes it, so the pair
+* cancels out without touching the top. Every thread widens the part of the
+* array it uses while it finds partners and narrows it while it doesn't.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_ELIMINATION_STACK_H__
+#define __ADT_ELIMINATION_STACK_H__ 1
+
+#include "adt_memory_node.h"
+
+// Slots of the elimination array
+#define kEliminationSlots 16
+// Times a thread checks its slot for a partner before giving up
+#define kEliminationSpins 128
+
+/**
+* @brief Slot of the elimination array, alone in its cache line
+*/
+typedef struct elimination_slot_s {
+ // @brief Node a push is offering, NULL when nobody waits in the slot
+	MemoryNode* volatile offer_;
+ // @brief Keeps the next slot out of the cache line
+	u8 padding_[64 - sizeof(MemoryNode*)];
+} EliminationSlot;
+
+/**
+* @brief Structure representing an EliminationStack with variables and callbacks.
+* Nodes are linked from the top through next_
+*/
+typedef struct adt_elimination_stack_s {
+ // @brief Node on the top, NULL when the stack is empty
+	MemoryNode* volatile top_;
+ // @brief Current number of elements, it may lag behind while other threads work
+	volatile u32 length_;
+ // @brief Maximum length that the stack can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Push and pop pairs that met in the elimination array
+	volatile u32 eliminated_;
+ // @brief Elimination array
+	EliminationSlot slots_[kEliminationSlots];
+ // @brief Pointer to callback functions
+	struct elimination_stack_ops_s *ops_;
+} EliminationStack;
+
+/**
+* @brief Struct that contains all functions attached to the EliminationStack. It
+* has the functions of struct lockfree_stack_ops_s. Every function but destroy
+* and print can be called from several threads at the same time; a thread must
+* call HAZARD_release() before it ends
+*/
+struct elimination_stack_ops_s {
+/**
+* @brief Destroys the stack and its data. No other thread may be using it
+* @param *EliminationStack stack Pointer to the stack
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullStackPointer When the stack pointer is NULL
+*/
+	s16 (*destroy)(EliminationStack *stack);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *EliminationStack stack Pointer to the stack
+* @return u16 Capacity, 0 if the stack pointer is NULL
+*/
+	u16 (*capacity)(EliminationStack *stack);
+
+/**
+* @brief Current number of elements (<= capacity)
+* @param *EliminationStack stack Pointer to the stack
+* @return u16 Length, 0 if the stack pointer is NULL
+*/
+	u16 (*length)(EliminationStack *stack);
+
+/**
+* @brief Verifies if the stack is empty
+* @param *EliminationStack stack Pointer to the stack
+* @return bool true if it is empty, false otherwise or if the stack pointer is NULL
+*/
+	bool (*isEmpty)(EliminationStack *stack);
+
+/**
+* @brief Verifies if the stack is full
+* @param *EliminationStack stack Pointer to the stack
+* @return bool true if it is full, false otherwise or if the stack pointer is NULL
+*/
+	bool (*isFull)(EliminationStack *stack);
+
+/**
+* @brief Number of push and pop pairs that cancelled out in the elimination array
+* @param *EliminationStack stack Pointer to the stack
+* @return u32 Eliminated pairs, 0 if the stack pointer is NULL
+*/
+	u32 (*eliminated)(EliminationStack *stack);
+
+	// Insertion
+/**
+* @brief Inserts an element on the top of the stack, or hands it straight to a pop
+* @param *EliminationStack stack Pointer to the stack
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullStackPointer When the stack pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the stack is full or too many threads use lock-free types
+* @return s16 kErrorCode_NullMemoryNode When there's no memory for the node
+*/
+	s16 (*push)(EliminationStack *stack, void *data, u16 bytes);
+
+	// Extraction
+/**
+* @brief Extracts the element on the top of the stack, or the one of a push that meets it
+* @param *EliminationStack stack Pointer to the stack
+* @return void* Data pointer, NULL if the stack pointer is NULL or the stack is empty
+*/
+	void* (*pop)(EliminationStack *stack);
+
+	// Miscellaneous
+/**
+* @brief Prints the features and content of the stack. No other thread may be using it
+* @param *EliminationStack stack Pointer to the stack
+*/
+	void (*print)(EliminationStack *stack);
+};
+
+/**
+* @brief Creates a new elimination stack
+* @param u16 capacity Maximum length that the stack can possibly have
+* @return EliminationStack* Return a stack pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+EliminationStack* ELIMINATIONSTACK_create(u16 capacity);
+#endif //__ADT_ELIMINATION_STACK_H__
@@ -0,0 +1,93 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the hazard pointers
+* used by the lock-free data types
+*
+* A thread publishes in its record the nodes it is about to read. Nodes taken
+* out of a lock-free structure are retired instead of freed, and a retired node
+* is only reused once no record points to it. Reclaimed nodes stay in a cache
+* of the thread, so steady pushes and pops don't call MM.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_HAZARD_H__
+#define __ADT_HAZARD_H__ 1
+
+#include "adt_memory_node.h"
+
+// Threads that can use the lock-free data types at the same time
+#define kHazardMaxThreads 64
+// Hazard pointers of every thread
+#define kHazardPointers 2
+// Retired nodes of a thread that trigger a scan of the hazard pointers
+#define kHazardScanThreshold 64
+// Reclaimed nodes a thread keeps for its next insertions
+#define kHazardCacheLimit 256
+
+/**
+* @brief Hazard pointers and reclamation state of one thread. Retired and
+* cached nodes are chained through prev_, which the lock-free structures don't use
+*/
+typedef struct hazard_record_s {
+ // @brief 1 while a thread owns the record
+	volatile u32 active_;
+ // @brief Nodes the owner is reading, NULL when unused
+	void* volatile hazard_[kHazardPointers];
+ // @brief Nodes waiting for no hazard pointer to point at them
+	MemoryNode *retired_;
+ // @brief Number of nodes in retired_
+	u16 retired_length_;
+ // @brief Reclaimed nodes ready for the owner's next insertions
+	MemoryNode *cache_;
+ // @brief Number of nodes in cache_
+	u16 cache_length_;
+} HazardRecord;
+
+/**
+* @brief Returns the record of the calling thread, claiming a free one the first time
+* @return HazardRecord* Record of the thread
+* @return NULL If kHazardMaxThreads threads already own a record
+*/
+HazardRecord* HAZARD_acquire();
+
+/**
+* @brief Publishes the node the thread is about to read. The caller must read
+* the shared pointer again afterwards, the node is only safe if it didn't change
+* @param *HazardRecord record Record of the calling thread
+* @param u8 slot Hazard pointer to use, lower than kHazardPointers
+* @param void* node Node to protect, NULL to clear the slot
+*/
+void HAZARD_protect(HazardRecord *record, u8 slot, void *node);
+
+/**
+* @brief Returns a node for a new element: a reclaimed one when the thread has any,
+* a new one otherwise
+* @param *HazardRecord record Record of the calling thread
+* @return MemoryNode* Node with no data and no links
+* @return NULL If there's no space in memory
+*/
+MemoryNode* HAZARD_takeNode(HazardRecord *record);
+
+/**
+* @brief Hands over a node taken out of a lock-free structure. It is reused once
+* no hazard pointer points at it. The node's data is not touched
+* @param *HazardRecord record Record of the calling thread
+* @param *MemoryNode node Node that no longer belongs to any structure
+*/
+void HAZARD_retire(HazardRecord *record, MemoryNode *node);
+
+/**
+* @brief Gives back the record of the calling thread. Call it before the thread
+* ends; nodes still in use by other threads stay in the record for its next owner
+*/
+void HAZARD_release();
+
+/**
+* @brief Frees every retired and cached node of every record. Only valid when
+* no thread is using a lock-free data type
+*/
+void HAZARD_destroy();
+#endif //__ADT_HAZARD_H__
@@ -0,0 +1,197 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Heap" data type
+*
+* Priority queue kept as a d-ary heap (d = 2 or 4) in one contiguous array of
+* nodes, like Vector. The element on the top is the one with the lowest key,
+* or the first one according to the comparator.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_HEAP_H__
+#define __ADT_HEAP_H__ 1
+
+#include "adt_memory_node.h"
+
+/**
+* @brief Structure representing a Heap with variables and callbacks.
+* Children of position i are at arity_ * i + 1 ... arity_ * i + arity_
+*/
+typedef struct adt_heap_s {
+ // @brief Elements in heap order, capacity_ entries
+	MemoryNode *storage_;
+ // @brief Key of every element of storage_, NULL when the heap uses a comparator
+	s32 *keys_;
+ // @brief Orders two elements, < 0 when a goes before b. NULL when the heap uses keys_
+	s16 (*compare_)(MemoryNode *a, MemoryNode *b);
+ // @brief Current number of elements
+	u16 length_;
+ // @brief Maximum length that the heap can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Children of every element, 2 or 4
+	u8 arity_;
+ // @brief Pointer to callback functions
+	struct heap_ops_s *ops_;
+} Heap;
+
+/**
+* @brief Struct that contains all functions attached to the Heap
+*/
+struct heap_ops_s {
+/**
+* @brief Destroys the heap and its data
+* @param *Heap heap Pointer to the heap
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+*/
+	s16 (*destroy)(Heap *heap);
+
+/**
+* @brief Soft resets heap's data, the elements' data is not freed
+* @param *Heap heap Pointer to the heap
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+*/
+	s16 (*softReset)(Heap *heap);
+
+/**
+* @brief Resets heap's data, the elements' data is freed
+* @param *Heap heap Pointer to the heap
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+*/
+	s16 (*reset)(Heap *heap);
+
+/**
+* @brief Resizes the capacity of the heap. When it shrinks below the length the
+* last elements of the array are freed, which keeps the heap order
+* @param *Heap heap Pointer to the heap
+* @param u16 new_size New capacity
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+* @return s16 kErrorCode_InvalidValue When new_size is 0
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for the new storage
+*/
+	s16 (*resize)(Heap *heap, u16 new_size);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *Heap heap Pointer to the heap
+* @return u16 Capacity, 0 if the heap pointer is NULL
+*/
+	u16 (*capacity)(Heap *heap);
+
+/**
+* @brief Current number of elements (<= capacity)
+* @param *Heap heap Pointer to the heap
+* @return u16 Length, 0 if the heap pointer is NULL
+*/
+	u16 (*length)(Heap *heap);
+
+/**
+* @brief Verifies if the heap is empty
+* @param *Heap heap Pointer to the heap
+* @return bool true if it is empty, false otherwise or if the heap pointer is NULL
+*/
+	bool (*isEmpty)(Heap *heap);
+
+/**
+* @brief Verifies if the heap is full
+* @param *Heap heap Pointer to the heap
+* @return bool true if it is full, false otherwise or if the heap pointer is NULL
+*/
+	bool (*isFull)(Heap *heap);
+
+	// Data queries
+/**
+* @brief Returns a reference to the element on the top, the next one pop returns
+* @param *Heap heap Pointer to the heap
+* @return void* Data pointer, NULL if the heap pointer is NULL or the heap is empty
+*/
+	void* (*top)(Heap *heap);
+
+/**
+* @brief Returns the key of the element on the top
+* @param *Heap heap Pointer to the heap
+* @return s32 Key, 0 if the heap pointer is NULL, the heap is empty or it uses a comparator
+*/
+	s32 (*topKey)(Heap *heap);
+
+	// Insertion
+/**
+* @brief Inserts an element and moves it up to its place
+* @param *Heap heap Pointer to the heap
+* @param void* data pointer
+* @param u16 bytes size
+* @param s32 key Priority of the element, lowest first. Ignored when the heap uses a comparator
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the heap is full
+*/
+	s16 (*push)(Heap *heap, void *data, u16 bytes, s32 key);
+
+/**
+* @brief Inserts count elements at once and restores the heap order from the bottom
+* up, which costs O(length + count) instead of count pushes
+* @param *Heap heap Pointer to the heap
+* @param *MemoryNode nodes Array with the data and size of the elements
+* @param s32* keys Array with the key of every element. Ignored, and it may be NULL, when the heap uses a comparator
+* @param u16 count Number of elements in the arrays
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+* @return s16 kErrorCode_NullPointer When an array the heap needs is NULL or an element has no data
+* @return s16 kErrorCode_InsertionFailed When the elements don't fit in the heap
+*/
+	s16 (*heapify)(Heap *heap, MemoryNode *nodes, s32 *keys, u16 count);
+
+	// Extraction
+/**
+* @brief Extracts the element on the top
+* @param *Heap heap Pointer to the heap
+* @return void* Data pointer, NULL if the heap pointer is NULL or the heap is empty
+*/
+	void* (*pop)(Heap *heap);
+
+	// Miscellaneous
+/**
+* @brief Calls to a function from all elements of the heap, in array order
+* @param *Heap heap Pointer to the heap
+* @param *Void pointer to MemoryNode's callback
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+*/
+	s16 (*traverse)(Heap *heap, void (*callback)(MemoryNode *));
+
+/**
+* @brief Prints the features and content of the heap
+* @param *Heap heap Pointer to the heap
+*/
+	void (*print)(Heap *heap);
+};
+
+/**
+* @brief Creates a new heap ordered by a comparator
+* @param u16 capacity Maximum length that the heap can possibly have
+* @param u8 arity Children of every element, 2 or 4
+* @param compare Returns < 0 when a goes before b (closer to the top)
+* @return Heap* Return a heap pointer with all variables initialized
+* @return NULL If capacity is 0, arity is not 2 or 4, compare is NULL or there's no space in memory
+*/
+Heap* HEAP_create(u16 capacity, u8 arity, s16 (*compare)(MemoryNode *a, MemoryNode *b));
+
+/**
+* @brief Creates a new heap ordered by the key given to push, lowest first. Keys
+* are compared in place, so there's no call per comparison
+* @param u16 capacity Maximum length that the heap can possibly have
+* @param u8 arity Children of every element, 2 or 4
+* @return Heap* Return a heap pointer with all variables initialized
+* @return NULL If capacity is 0, arity is not 2 or 4 or there's no space in memory
+*/
+Heap* HEAP_createWithKeys(u16 capacity, u8 arity);
+#endif //__ADT_HEAP_H__
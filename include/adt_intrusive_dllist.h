@@ -0,0 +1,222 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Intrusive Double List" data type
+*
+* Doubly linked version of IntrusiveList: with a record at hand it can be
+* unlinked in O(1), and both ends insert and extract in O(1).
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_INTRUSIVE_DLLIST_H__
+#define __ADT_INTRUSIVE_DLLIST_H__ 1
+
+#include "adt_intrusive_list.h"
+
+/**
+* @brief Structure representing an IntrusiveDList with variables and callbacks.
+* The list never owns the records
+*/
+typedef struct adt_intrusive_dlist_s {
+ // @brief First record of the list
+	IntrusiveLink *head_;
+ // @brief Last record of the list
+	IntrusiveLink *tail_;
+ // @brief Maximum length that the list can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Current number of records in the list
+	u16 length_;
+ // @brief Pointer to callback functions
+	struct intrusive_dlist_ops_s *ops_;
+} IntrusiveDList;
+
+/**
+* @brief Struct that contains all functions attached to the IntrusiveDList.
+* It follows struct dlist_ops_s, with links in place of data and bytes
+*/
+struct intrusive_dlist_ops_s {
+/**
+* @brief Destroys the list. The records are not touched
+* @param *IntrusiveDList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+*/
+	s16 (*destroy)(IntrusiveDList *list);
+
+/**
+* @brief Unlinks every record, leaving the list empty
+* @param *IntrusiveDList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+*/
+	s16 (*reset)(IntrusiveDList *list);
+
+/**
+* @brief Changes the capacity of the list. Records over the new capacity are
+* unlinked from the end
+* @param *IntrusiveDList list Pointer to the list
+* @param u16 new_size New capacity
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+* @return s16 kErrorCode_InvalidValue When new_size is 0
+*/
+	s16 (*resize)(IntrusiveDList *list, u16 new_size);
+
+	// State queries
+/**
+* @brief Returns the maximum number of records that can be linked
+* @param *IntrusiveDList list Pointer to the list
+* @return u16 Capacity, 0 if the list pointer is NULL
+*/
+	u16 (*capacity)(IntrusiveDList *list);
+
+/**
+* @brief Current number of records (<= capacity)
+* @param *IntrusiveDList list Pointer to the list
+* @return u16 Length, 0 if the list pointer is NULL
+*/
+	u16 (*length)(IntrusiveDList *list);
+
+/**
+* @brief Verifies if the list is empty
+* @param *IntrusiveDList list Pointer to the list
+* @return bool true if it is empty, false otherwise or if the list pointer is NULL
+*/
+	bool (*isEmpty)(IntrusiveDList *list);
+
+/**
+* @brief Verifies if the list is full
+* @param *IntrusiveDList list Pointer to the list
+* @return bool true if it is full, false otherwise or if the list pointer is NULL
+*/
+	bool (*isFull)(IntrusiveDList *list);
+
+	// Data queries
+/**
+* @brief Returns the link of the first record
+* @param *IntrusiveDList list Pointer to the list
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	IntrusiveLink* (*first)(IntrusiveDList *list);
+
+/**
+* @brief Returns the link of the last record
+* @param *IntrusiveDList list Pointer to the list
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	IntrusiveLink* (*last)(IntrusiveDList *list);
+
+/**
+* @brief Returns the link of the record at a given position, walking from the nearest end
+* @param *IntrusiveDList list Pointer to the list
+* @param u16 position Position of the record
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or position is out of range
+*/
+	IntrusiveLink* (*at)(IntrusiveDList *list, u16 position);
+
+	// Insertion
+/**
+* @brief Links a record in the first position of the list, O(1)
+* @param *IntrusiveDList list Pointer to the list
+* @param *IntrusiveLink link Link of the record, it must not be in another list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the link pointer is NULL
+* @return s16 kErrorCode_InsertionFailed When the list is full
+*/
+	s16 (*insertFirst)(IntrusiveDList *list, IntrusiveLink *link);
+
+/**
+* @brief Links a record in the last position of the list, O(1)
+* @param *IntrusiveDList list Pointer to the list
+* @param *IntrusiveLink link Link of the record, it must not be in another list
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertLast)(IntrusiveDList *list, IntrusiveLink *link);
+
+/**
+* @brief Links a record at the given position of the list. Positions over the
+* length insert at the end
+* @param *IntrusiveDList list Pointer to the list
+* @param *IntrusiveLink link Link of the record, it must not be in another list
+* @param u16 position Position of the record
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertAt)(IntrusiveDList *list, IntrusiveLink *link, u16 position);
+
+	// Extraction
+/**
+* @brief Unlinks the first record, O(1)
+* @param *IntrusiveDList list Pointer to the list
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	IntrusiveLink* (*extractFirst)(IntrusiveDList *list);
+
+/**
+* @brief Unlinks the last record, O(1)
+* @param *IntrusiveDList list Pointer to the list
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	IntrusiveLink* (*extractLast)(IntrusiveDList *list);
+
+/**
+* @brief Unlinks the record at the given position
+* @param *IntrusiveDList list Pointer to the list
+* @param u16 position Position of the record
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or position is out of range
+*/
+	IntrusiveLink* (*extractAt)(IntrusiveDList *list, u16 position);
+
+/**
+* @brief Unlinks a record of the list given its link, O(1)
+* @param *IntrusiveDList list Pointer to the list holding the record
+* @param *IntrusiveLink link Link of the record
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the link pointer is NULL
+* @return s16 kErrorCode_ExtractionFailed When the list is empty or the link is not
+* linked in the list, e.g. it was already extracted
+*/
+	s16 (*extract)(IntrusiveDList *list, IntrusiveLink *link);
+
+	// Miscellaneous
+/**
+* @brief Moves every record of the second list to the end of the first one,
+* O(1). The capacity of the first list grows by the capacity of the second
+* one, which is left empty
+* @param *IntrusiveDList list Pointer to the list
+* @param *IntrusiveDList list_src Pointer to the second list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When any of the list pointers is NULL
+* @return s16 kErrorCode_InvalidValue When both pointers are the same list
+*/
+	s16 (*concat)(IntrusiveDList *list, IntrusiveDList *list_src);
+
+/**
+* @brief Calls to a function from all records of the list, in order. The
+* callback must not unlink the record it gets
+* @param *IntrusiveDList list Pointer to the list
+* @param *Void Pointer to the link's callback
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDoubleLPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverse)(IntrusiveDList *list, void (*callback)(IntrusiveLink *));
+
+/**
+* @brief Prints the features of the list and the address of every record's link
+* @param *IntrusiveDList list Pointer to the list
+*/
+	void (*print)(IntrusiveDList *list);
+};
+
+/**
+* @brief Creates a new intrusive list
+* @param u16 capacity Maximum length that the list can possibly have
+* @return IntrusiveDList* Return a list pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+IntrusiveDList* INTRUSIVEDLIST_create(u16 capacity);
+#endif //__ADT_INTRUSIVE_DLLIST_H__
@@ -0,0 +1,227 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Intrusive List" data type
+*
+* The caller's records carry their own IntrusiveLink and the list links them
+* directly: no node is allocated or freed, and the records are never copied.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_INTRUSIVE_LIST_H__
+#define __ADT_INTRUSIVE_LIST_H__ 1
+
+#include <stddef.h>
+
+#include "ABGS_MemoryManager/abgs_platform_types.h"
+
+/**
+* @brief Link header embedded in the caller's records. A record can be in one
+* list per IntrusiveLink it embeds. IntrusiveList only uses next_
+*/
+typedef struct intrusive_link_s {
+ // @brief Next record of the list, NULL for the last one
+	struct intrusive_link_s *next_;
+ // @brief Previous record of the list, NULL for the first one (IntrusiveDList use only)
+	struct intrusive_link_s *prev_;
+} IntrusiveLink;
+
+// Record of the given type that embeds link as its member field
+#define INTRUSIVE_ENTRY(link, type, member) ((type *)((u8 *)(link) - offsetof(type, member)))
+
+/**
+* @brief Structure representing an IntrusiveList with variables and callbacks.
+* The list never owns the records
+*/
+typedef struct adt_intrusive_list_s {
+ // @brief First record of the list
+	IntrusiveLink *head_;
+ // @brief Last record of the list
+	IntrusiveLink *tail_;
+ // @brief Maximum length that the list can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Current number of records in the list
+	u16 length_;
+ // @brief Pointer to callback functions
+	struct intrusive_list_ops_s *ops_;
+} IntrusiveList;
+
+/**
+* @brief Struct that contains all functions attached to the IntrusiveList.
+* It follows struct list_ops_s, with links in place of data and bytes
+*/
+struct intrusive_list_ops_s {
+/**
+* @brief Destroys the list. The records are not touched
+* @param *IntrusiveList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+*/
+	s16 (*destroy)(IntrusiveList *list);
+
+/**
+* @brief Unlinks every record, leaving the list empty
+* @param *IntrusiveList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+*/
+	s16 (*reset)(IntrusiveList *list);
+
+/**
+* @brief Changes the capacity of the list. Records over the new capacity are
+* unlinked from the end
+* @param *IntrusiveList list Pointer to the list
+* @param u16 new_size New capacity
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+* @return s16 kErrorCode_InvalidValue When new_size is 0
+*/
+	s16 (*resize)(IntrusiveList *list, u16 new_size);
+
+	// State queries
+/**
+* @brief Returns the maximum number of records that can be linked
+* @param *IntrusiveList list Pointer to the list
+* @return u16 Capacity, 0 if the list pointer is NULL
+*/
+	u16 (*capacity)(IntrusiveList *list);
+
+/**
+* @brief Current number of records (<= capacity)
+* @param *IntrusiveList list Pointer to the list
+* @return u16 Length, 0 if the list pointer is NULL
+*/
+	u16 (*length)(IntrusiveList *list);
+
+/**
+* @brief Verifies if the list is empty
+* @param *IntrusiveList list Pointer to the list
+* @return bool true if it is empty, false otherwise or if the list pointer is NULL
+*/
+	bool (*isEmpty)(IntrusiveList *list);
+
+/**
+* @brief Verifies if the list is full
+* @param *IntrusiveList list Pointer to the list
+* @return bool true if it is full, false otherwise or if the list pointer is NULL
+*/
+	bool (*isFull)(IntrusiveList *list);
+
+	// Data queries
+/**
+* @brief Returns the link of the first record
+* @param *IntrusiveList list Pointer to the list
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	IntrusiveLink* (*first)(IntrusiveList *list);
+
+/**
+* @brief Returns the link of the last record
+* @param *IntrusiveList list Pointer to the list
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	IntrusiveLink* (*last)(IntrusiveList *list);
+
+/**
+* @brief Returns the link of the record at a given position
+* @param *IntrusiveList list Pointer to the list
+* @param u16 position Position of the record
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or position is out of range
+*/
+	IntrusiveLink* (*at)(IntrusiveList *list, u16 position);
+
+	// Insertion
+/**
+* @brief Links a record in the first position of the list, O(1)
+* @param *IntrusiveList list Pointer to the list
+* @param *IntrusiveLink link Link of the record, it must not be in another list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the link pointer is NULL
+* @return s16 kErrorCode_InsertionFailed When the list is full
+*/
+	s16 (*insertFirst)(IntrusiveList *list, IntrusiveLink *link);
+
+/**
+* @brief Links a record in the last position of the list, O(1)
+* @param *IntrusiveList list Pointer to the list
+* @param *IntrusiveLink link Link of the record, it must not be in another list
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertLast)(IntrusiveList *list, IntrusiveLink *link);
+
+/**
+* @brief Links a record at the given position of the list. Positions over the
+* length insert at the end
+* @param *IntrusiveList list Pointer to the list
+* @param *IntrusiveLink link Link of the record, it must not be in another list
+* @param u16 position Position of the record
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertAt)(IntrusiveList *list, IntrusiveLink *link, u16 position);
+
+	// Extraction
+/**
+* @brief Unlinks the first record, O(1)
+* @param *IntrusiveList list Pointer to the list
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	IntrusiveLink* (*extractFirst)(IntrusiveList *list);
+
+/**
+* @brief Unlinks the last record. The list is singly linked, so it walks from
+* the head: use IntrusiveDList when extracting from the back is frequent
+* @param *IntrusiveList list Pointer to the list
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	IntrusiveLink* (*extractLast)(IntrusiveList *list);
+
+/**
+* @brief Unlinks the record at the given position
+* @param *IntrusiveList list Pointer to the list
+* @param u16 position Position of the record
+* @return IntrusiveLink* Link pointer, NULL if the list pointer is NULL or position is out of range
+*/
+	IntrusiveLink* (*extractAt)(IntrusiveList *list, u16 position);
+
+	// Miscellaneous
+/**
+* @brief Moves every record of the second list to the end of the first one,
+* O(1). The capacity of the first list grows by the capacity of the second
+* one, which is left empty
+* @param *IntrusiveList list Pointer to the list
+* @param *IntrusiveList list_src Pointer to the second list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullListPointer When any of the list pointers is NULL
+* @return s16 kErrorCode_InvalidValue When both pointers are the same list
+*/
+	s16 (*concat)(IntrusiveList *list, IntrusiveList *list_src);
+
+/**
+* @brief Calls to a function from all records of the list, in order. The
+* callback must not unlink the record it gets
+* @param *IntrusiveList list Pointer to the list
+* @param *Void Pointer to the link's callback
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverse)(IntrusiveList *list, void (*callback)(IntrusiveLink *));
+
+/**
+* @brief Prints the features of the list and the address of every record's link
+* @param *IntrusiveList list Pointer to the list
+*/
+	void (*print)(IntrusiveList *list);
+};
+
+/**
+* @brief Creates a new intrusive list
+* @param u16 capacity Maximum length that the list can possibly have
+* @return IntrusiveList* Return a list pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+IntrusiveList* INTRUSIVELIST_create(u16 capacity);
+#endif //__ADT_INTRUSIVE_LIST_H__
@@ -15,6 +15,11 @@
 
 #include "adt_vector.h"
 
+// Retired nodes a new list keeps for its next insertions
+#define kListSpareLimit 16
+// Nodes ahead of the visited one that the walks of a new list prefetch
+#define kListPrefetchDistance 4
+
 /**
 * @brief Structure representing a List with variables and callbacks.
 */
@@ -27,10 +32,34 @@ typedef struct adt_list_s {
   u16 capacity_;
   // @brief Current number of elements in the list
   u16 length_;
+  // @brief Retired nodes kept to be reused by the next insertions, chained through next_
+  MemoryNode *spare_;
+  // @brief Number of nodes in spare_
+  u16 spare_length_;
+  // @brief Maximum number of nodes in spare_, 0 frees every retired node
+  u16 spare_limit_;
+  // @brief Nodes ahead that traverse, destroy, reset and concat prefetch, 0 disables it
+  u16 prefetch_distance_;
   // @brief Pointer to callback functions
   struct list_ops_s *ops_;
 } List;
 
+/**
+* @brief Position inside a List. It remembers the node before the current one,
+* so stepping forward, inserting and erasing at the cursor are O(1).
+* Any list operation other than the cursor ones invalidates it.
+*/
+typedef struct list_cursor_s {
+  // @brief List being walked
+  List *list_;
+  // @brief Node under the cursor, NULL once it has gone past the last element
+  MemoryNode *node_;
+  // @brief Node before node_, NULL at the first element
+  MemoryNode *prev_;
+  // @brief Logical position of node_
+  u16 position_;
+} ListCursor;
+
 /**
 * @brief Struct that contains all functions attached to the List
 */
@@ -212,12 +241,157 @@ struct list_ops_s {
  */
   s16(*traverse)(List *list, void(*callback)(MemoryNode *));
 
+  /**
+  * @brief Calls a function on the elements of the list, from the head to the tail, handing it ctx,
+  * until it returns kTraverse_Stop
+  * @param *List list Pointer to the list
+  * @param callback Function that returns kTraverse_Continue or kTraverse_Stop
+  * @param void* ctx Pointer handed to every call of the callback, it may be NULL
+  * @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+  * @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+  * @return s16 kErrorCode_NullMemoryNode When the list is empty
+  * @return s16 kErrorCode_NullPointer When the callback is NULL
+  */
+  s16(*traverseEx)(List *list, s16 (*callback)(MemoryNode *node, void *ctx), void *ctx);
+
+  /**
+  * @brief Like traverseEx, but hands the callback spans of up to kTraverseBatchLength
+  * nodes in the same order, so the cost of a call is shared by the whole span.
+  * The list must not change while the callback runs
+  * @param *List list Pointer to the list
+  * @param callback Function that gets the nodes of a span and their count, and
+  * returns kTraverse_Continue or kTraverse_Stop
+  * @param void* ctx Pointer handed to every call of the callback, it may be NULL
+  * @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+  * @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+  * @return s16 kErrorCode_NullMemoryNode When the list is empty
+  * @return s16 kErrorCode_NullPointer When the callback is NULL
+  */
+  s16(*traverseBatch)(List *list, s16 (*callback)(MemoryNode **nodes, u16 count, void *ctx), void *ctx);
+
   /**
  * @brief Prints the features and content of the list
  * @param *List pointer to the list
  */
   void(*print)(List *list);
 
+  // Cursor
+  /**
+  * @brief Places the cursor on the first element of the list
+  * @param *List pointer to the list
+  * @param *ListCursor pointer to the cursor to initialize
+  * @return s16 kErrorCode_Ok When the function has exited successfully
+  * @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+  * @return s16 kErrorCode_NullPointer When the cursor pointer is NULL
+  */
+  s16(*cursorBegin)(List *list, ListCursor *cursor);
+
+  /**
+  * @brief Returns the data under the cursor
+  * @param *ListCursor pointer to the cursor
+  * @return Returns nodes's data pointer, NULL if the cursor is NULL or past the end
+  */
+  void* (*cursorGet)(ListCursor *cursor);
+
+  /**
+  * @brief Moves the cursor to the next element, O(1)
+  * @param *ListCursor pointer to the cursor
+  * @return Returns the data of the new position, NULL once the cursor goes past the end
+  */
+  void* (*cursorNext)(ListCursor *cursor);
+
+  /**
+  * @brief Moves the cursor to the previous element. The list is singly linked,
+  * so it walks from the head: use DList when stepping back is frequent
+  * @param *ListCursor pointer to the cursor
+  * @return Returns the data of the new position, NULL if the cursor was at the first element
+  */
+  void* (*cursorPrev)(ListCursor *cursor);
+
+  /**
+  * @brief Inserts an element after the cursor, O(1). The cursor does not move.
+  * Past the end it appends, like cursorInsertBefore
+  * @param *ListCursor pointer to the cursor
+  * @param void* data pointer
+  * @param u16 bytes size
+  * @return s16 kErrorCode_Ok When the function has exited successfully
+  * @return s16 kErrorCode_NullPointer When the cursor or data pointer is NULL
+  * @return s16 kErrorCode_InvalidValue When bytes is 0
+  * @return s16 kErrorCode_InsertionFailed When the list is full
+  * @return s16 kErrorCode_NullMemoryNode When the new node is NULL
+  */
+  s16(*cursorInsertAfter)(ListCursor *cursor, void *data, u16 bytes);
+
+  /**
+  * @brief Inserts an element before the cursor, O(1). The cursor stays on the same element
+  * @param *ListCursor pointer to the cursor
+  * @param void* data pointer
+  * @param u16 bytes size
+  * @return s16 Same values as cursorInsertAfter
+  */
+  s16(*cursorInsertBefore)(ListCursor *cursor, void *data, u16 bytes);
+
+  /**
+  * @brief Extracts the element under the cursor, O(1). The cursor moves to the next one
+  * @param *ListCursor pointer to the cursor
+  * @return Returns nodes's data pointer, NULL if the cursor is NULL or past the end
+  */
+  void* (*cursorErase)(ListCursor *cursor);
+
+  // Bulk operations
+  /**
+  * @brief Inserts up to count elements at the end of the list in one call. The new
+  * nodes are chained apart and hung from the tail at once
+  * @param *List pointer to the list
+  * @param void** data Data pointers of the elements, in order
+  * @param u16* sizes Size of every element of data
+  * @param u16 count Number of elements in data
+  * @return u16 Number of elements actually inserted, limited by the free places and the
+  * memory; it stops before the first NULL data or 0 size
+  * @return u16 0 If List pointer, data or sizes is NULL
+  */
+  u16(*insertLastMany)(List *list, void **data, u16 *sizes, u16 count);
+
+  /**
+  * @brief Extracts up to max elements from the front of the list in one walk, the
+  * run of nodes is cut from the list at once
+  * @param *List pointer to the list
+  * @param void** out Array that receives the data pointers, at least max long
+  * @param u16* out_sizes Array that receives the sizes, at least max long, it may be NULL
+  * @param u16 max Largest number of elements to extract
+  * @return u16 Number of elements actually extracted (limited by the length)
+  * @return u16 0 If List pointer or out is NULL
+  */
+  u16(*extractFirstMany)(List *list, void **out, u16 *out_sizes, u16 max);
+
+  // Spare nodes
+  /**
+  * @brief Frees every spare node. The elements of the list are not touched
+  * @param *List pointer to the list
+  * @return s16 kErrorCode_Ok When the function has exited successfully
+  * @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+  */
+  s16(*trim)(List *list);
+
+  /**
+  * @brief Sets how many retired nodes the list keeps for the next insertions.
+  * Spare nodes over the new limit are freed
+  * @param *List pointer to the list
+  * @param u16 limit Maximum number of spare nodes, 0 to free every retired node
+  * @return s16 kErrorCode_Ok When the function has exited successfully
+  * @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+  */
+  s16(*setSpareLimit)(List *list, u16 limit);
+
+  /**
+  * @brief Sets how many nodes ahead of the visited one the walks of traverse,
+  * destroy, reset and concat prefetch. Worth it when the nodes are scattered in memory
+  * @param *List pointer to the list
+  * @param u16 distance Nodes ahead, 0 to disable the prefetch
+  * @return s16 kErrorCode_Ok When the function has exited successfully
+  * @return s16 kErrorCode_NullListPointer When the list pointer is NULL
+  */
+  s16(*setPrefetchDistance)(List *list, u16 distance);
 };
 
 /**
@@ -0,0 +1,119 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Lock-Free Queue" data type
+*
+* Michael-Scott queue: several threads enqueue and dequeue at the same time.
+* The head is a dummy node, so producers only touch the tail and consumers the
+* head. Dequeued nodes go through the hazard pointers of adt_hazard.h before
+* they are reused.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_LOCKFREE_QUEUE_H__
+#define __ADT_LOCKFREE_QUEUE_H__ 1
+
+#include "adt_memory_node.h"
+
+/**
+* @brief Structure representing a LockFreeQueue with variables and callbacks.
+* Nodes are linked from the head through next_
+*/
+typedef struct adt_lockfree_queue_s {
+ // @brief Dummy node, the first element is the one after it
+	MemoryNode* volatile head_;
+ // @brief Last node or, while an enqueue is halfway, the one before it
+	MemoryNode* volatile tail_;
+ // @brief Current number of elements, it may lag behind while other threads work
+	volatile u32 length_;
+ // @brief Maximum length that the queue can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Pointer to callback functions
+	struct lockfree_queue_ops_s *ops_;
+} LockFreeQueue;
+
+/**
+* @brief Struct that contains all functions attached to the LockFreeQueue. enqueue
+* has the signature of struct queue_ops_s and dequeue always takes the front
+* element. Every function but destroy and print can be called from several
+* threads at the same time; a thread must call HAZARD_release() before it ends
+*/
+struct lockfree_queue_ops_s {
+/**
+* @brief Destroys the queue and its data. No other thread may be using it
+* @param *LockFreeQueue queue Pointer to the queue
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullQueuePointer When the queue pointer is NULL
+*/
+	s16 (*destroy)(LockFreeQueue *queue);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *LockFreeQueue queue Pointer to the queue
+* @return u16 Capacity, 0 if the queue pointer is NULL
+*/
+	u16 (*capacity)(LockFreeQueue *queue);
+
+/**
+* @brief Current number of elements (<= capacity)
+* @param *LockFreeQueue queue Pointer to the queue
+* @return u16 Length, 0 if the queue pointer is NULL
+*/
+	u16 (*length)(LockFreeQueue *queue);
+
+/**
+* @brief Verifies if the queue is empty
+* @param *LockFreeQueue queue Pointer to the queue
+* @return bool true if it is empty, false otherwise or if the queue pointer is NULL
+*/
+	bool (*isEmpty)(LockFreeQueue *queue);
+
+/**
+* @brief Verifies if the queue is full
+* @param *LockFreeQueue queue Pointer to the queue
+* @return bool true if it is full, false otherwise or if the queue pointer is NULL
+*/
+	bool (*isFull)(LockFreeQueue *queue);
+
+	// Insertion
+/**
+* @brief Inserts an element at the back of the queue
+* @param *LockFreeQueue queue Pointer to the queue
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullQueuePointer When the queue pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the queue is full or too many threads use lock-free types
+* @return s16 kErrorCode_NullMemoryNode When there's no memory for the node
+*/
+	s16 (*enqueue)(LockFreeQueue *queue, void *data, u16 bytes);
+
+	// Extraction
+/**
+* @brief Extracts the element at the front of the queue
+* @param *LockFreeQueue queue Pointer to the queue
+* @return void* Data pointer, NULL if the queue pointer is NULL or the queue is empty
+*/
+	void* (*dequeue)(LockFreeQueue *queue);
+
+	// Miscellaneous
+/**
+* @brief Prints the features and content of the queue. No other thread may be using it
+* @param *LockFreeQueue queue Pointer to the queue
+*/
+	void (*print)(LockFreeQueue *queue);
+};
+
+/**
+* @brief Creates a new lock-free queue
+* @param u16 capacity Maximum length that the queue can possibly have
+* @return LockFreeQueue* Return a queue pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+LockFreeQueue* LOCKFREEQUEUE_create(u16 capacity);
+#endif //__ADT_LOCKFREE_QUEUE_H__
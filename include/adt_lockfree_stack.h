@@ -0,0 +1,116 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Lock-Free Stack" data type
+*
+* Treiber stack: several threads push and pop at the same time, each one
+* swapping the top with a compare-and-swap. Popped nodes go through the
+* hazard pointers of adt_hazard.h before they are reused.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_LOCKFREE_STACK_H__
+#define __ADT_LOCKFREE_STACK_H__ 1
+
+#include "adt_memory_node.h"
+
+/**
+* @brief Structure representing a LockFreeStack with variables and callbacks.
+* Nodes are linked from the top through next_
+*/
+typedef struct adt_lockfree_stack_s {
+ // @brief Node on the top, NULL when the stack is empty
+	MemoryNode* volatile top_;
+ // @brief Current number of elements, it may lag behind while other threads work
+	volatile u32 length_;
+ // @brief Maximum length that the stack can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Pointer to callback functions
+	struct lockfree_stack_ops_s *ops_;
+} LockFreeStack;
+
+/**
+* @brief Struct that contains all functions attached to the LockFreeStack. push
+* and pop have the signatures of struct stack_ops_s. Every function but destroy
+* and print can be called from several threads at the same time; a thread must
+* call HAZARD_release() before it ends
+*/
+struct lockfree_stack_ops_s {
+/**
+* @brief Destroys the stack and its data. No other thread may be using it
+* @param *LockFreeStack stack Pointer to the stack
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullStackPointer When the stack pointer is NULL
+*/
+	s16 (*destroy)(LockFreeStack *stack);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *LockFreeStack stack Pointer to the stack
+* @return u16 Capacity, 0 if the stack pointer is NULL
+*/
+	u16 (*capacity)(LockFreeStack *stack);
+
+/**
+* @brief Current number of elements (<= capacity)
+* @param *LockFreeStack stack Pointer to the stack
+* @return u16 Length, 0 if the stack pointer is NULL
+*/
+	u16 (*length)(LockFreeStack *stack);
+
+/**
+* @brief Verifies if the stack is empty
+* @param *LockFreeStack stack Pointer to the stack
+* @return bool true if it is empty, false otherwise or if the stack pointer is NULL
+*/
+	bool (*isEmpty)(LockFreeStack *stack);
+
+/**
+* @brief Verifies if the stack is full
+* @param *LockFreeStack stack Pointer to the stack
+* @return bool true if it is full, false otherwise or if the stack pointer is NULL
+*/
+	bool (*isFull)(LockFreeStack *stack);
+
+	// Insertion
+/**
+* @brief Inserts an element on the top of the stack
+* @param *LockFreeStack stack Pointer to the stack
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullStackPointer When the stack pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the stack is full or too many threads use lock-free types
+* @return s16 kErrorCode_NullMemoryNode When there's no memory for the node
+*/
+	s16 (*push)(LockFreeStack *stack, void *data, u16 bytes);
+
+	// Extraction
+/**
+* @brief Extracts the element on the top of the stack
+* @param *LockFreeStack stack Pointer to the stack
+* @return void* Data pointer, NULL if the stack pointer is NULL or the stack is empty
+*/
+	void* (*pop)(LockFreeStack *stack);
+
+	// Miscellaneous
+/**
+* @brief Prints the features and content of the stack. No other thread may be using it
+* @param *LockFreeStack stack Pointer to the stack
+*/
+	void (*print)(LockFreeStack *stack);
+};
+
+/**
+* @brief Creates a new lock-free stack
+* @param u16 capacity Maximum length that the stack can possibly have
+* @return LockFreeStack* Return a stack pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+LockFreeStack* LOCKFREESTACK_create(u16 capacity);
+#endif //__ADT_LOCKFREE_STACK_H__
@@ -31,6 +31,20 @@ typedef struct memory_node_s {
   struct memory_node_s *prev_;
 } MemoryNode;
 
+/**
+* @brief Answers of the callbacks given to traverseEx and traverseBatch
+*/
+typedef enum
+{
+  // Keep visiting the next elements
+  kTraverse_Continue = 0,
+  // Stop the traversal, the remaining elements are not visited
+  kTraverse_Stop = 1
+} TraverseAnswer;
+
+// Maximum number of nodes handed at once to a traverseBatch callback
+#define kTraverseBatchLength 32
+
 // Memory Node's API Declarations
 /**
 * @brief Struct that contains all functions attached to the Memory Node
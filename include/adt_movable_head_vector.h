@@ -15,6 +15,16 @@
 
 #include "adt_memory_node.h"
 
+/**
+* @brief Storage layout of the vector, chosen at creation time
+*/
+typedef enum {
+  // Elements live in [head_, tail_), both ends can move
+  kMovableHeadVectorMode_Contiguous = 0,
+  // Elements live around a gap [gap_start_, gap_end_) that follows the edit cursor
+  kMovableHeadVectorMode_GapBuffer = 1
+} MovableHeadVectorMode;
+
 /**
 * @brief Structure representing a MHVector with variables and callbacks.
 */
@@ -27,6 +37,12 @@ typedef struct adt_movable_head_vector_s {
 	u16 capacity_;
  // @brief Container of all elements of the vector
 	MemoryNode *storage_;
+ // @brief Storage layout used by the vector
+	MovableHeadVectorMode mode_;
+ // @brief Gap buffer mode only: first free slot, it is also the edit cursor
+	u16 gap_start_;
+ // @brief Gap buffer mode only: first element after the free slots
+	u16 gap_end_;
  // @brief Pointer to callback functions
 	struct movable_head_vector_ops_s *ops_;
 } MovableHeadVector;
@@ -234,12 +250,61 @@ struct movable_head_vector_ops_s {
 * @return s16 kErrorCode_NullMemoryNode When the new node is NULL
 */
  s16 (*traverse)(MovableHeadVector *vector, void (*callback)(MemoryNode *)); 
+
+ /**
+* @brief Calls a function on the elements of the vector, from the first to the last, handing it ctx,
+* until it returns kTraverse_Stop
+* @param *MovableHeadVector vector Pointer to the vector
+* @param callback Function that returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullVectorPointer When the vector pointer is NULL
+* @return s16 kErrorCode_NullMemoryNode When the storage is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseEx)(MovableHeadVector *vector, s16 (*callback)(MemoryNode *node, void *ctx), void *ctx);
+
+ /**
+* @brief Like traverseEx, but hands the callback spans of up to kTraverseBatchLength
+* nodes in the same order, so the cost of a call is shared by the whole span.
+* The vector must not change while the callback runs
+* @param *MovableHeadVector vector Pointer to the vector
+* @param callback Function that gets the nodes of a span and their count, and
+* returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullVectorPointer When the vector pointer is NULL
+* @return s16 kErrorCode_NullMemoryNode When the storage is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseBatch)(MovableHeadVector *vector, s16 (*callback)(MemoryNode **nodes, u16 count, void *ctx), void *ctx);
 	
  /**
 * @brief Prints the features and content of the vector
 * @param *Vector pointer to the vector
 */
  void (*print)(MovableHeadVector *vector);
+
+	// Gap buffer
+ /**
+* @brief Moves the edit cursor (the gap) in front of the given position
+* @param *Vector pointer to the vector
+* @param u16 position Logical position, values over the length move it to the end
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullVectorPointer When the Vector pointer is NULL
+* @return s16 kErrorCode_NullMemoryNode When the vector's storage is NULL
+* @return s16 kErrorCode_InvalidValue When the vector is not in gap buffer mode
+* @details Costs the distance moved. insertAt/extractAt move the cursor by
+* themselves, so edits clustered around it are O(1)
+*/
+ s16 (*moveCursor)(MovableHeadVector *vector, u16 position);
+
+ /**
+* @brief Returns the logical position of the edit cursor
+* @param *Vector pointer to the vector
+* @return u16 Cursor position, 0 if the Vector pointer is NULL or not in gap buffer mode
+*/
+ u16 (*cursor)(MovableHeadVector *vector);
 };
 /**
 * @brief Creates a new vector
@@ -248,4 +313,13 @@ struct movable_head_vector_ops_s {
 * @return NULL If capacity parameter is 0 or theres no space in memory
 */
 MovableHeadVector* MOVABLE_HEAD_VECTOR_create(u16 capacity); // Creates a new vector
+
+/**
+* @brief Creates a new vector with the given storage layout
+* @param u16 capacity Maximum length that the list can possibly have
+* @param MovableHeadVectorMode mode kMovableHeadVectorMode_GapBuffer for cursor-centred editing
+* @return Vector* Return a vector pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+MovableHeadVector* MOVABLE_HEAD_VECTOR_createWithMode(u16 capacity, MovableHeadVectorMode mode);
 #endif //__ADT_MOVABLE_HEAD_VECTOR_H__
@@ -0,0 +1,227 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Pairing Heap" data type
+*
+* Addressable priority queue: insert hands back the node of the element, which
+* stays valid until the element leaves the heap, so its key can be decreased or
+* the element erased later. Nodes come from blocks that are never moved nor
+* freed until the heap is destroyed.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_PAIRING_HEAP_H__
+#define __ADT_PAIRING_HEAP_H__ 1
+
+#include "adt_memory_node.h"
+
+// Nodes allocated at once when the pool runs out
+#define kPairingHeapBlockLength 64
+
+/**
+* @brief Node of the heap, also used as the handle of its element. The children
+* of a node are chained through sibling_; free nodes are chained through sibling_
+* too and have no data
+*/
+typedef struct pairing_heap_node_s {
+ // @brief Data of the element, NULL while the node is free
+	void *data_;
+ // @brief First child
+	struct pairing_heap_node_s *child_;
+ // @brief Next sibling, or next free node
+	struct pairing_heap_node_s *sibling_;
+ // @brief Previous sibling, or the parent for the first child. NULL for the root
+	struct pairing_heap_node_s *prev_;
+ // @brief Priority of the element, lowest first
+	s32 key_;
+ // @brief Size of the data
+	u16 size_;
+} PairingHeapNode;
+
+/**
+* @brief Block of nodes of the pool
+*/
+typedef struct pairing_heap_block_s {
+ // @brief Next block of the pool
+	struct pairing_heap_block_s *next_;
+ // @brief Nodes of the block
+	PairingHeapNode nodes_[kPairingHeapBlockLength];
+} PairingHeapBlock;
+
+/**
+* @brief Structure representing a PairingHeap with variables and callbacks.
+*/
+typedef struct adt_pairing_heap_s {
+ // @brief Node with the lowest key, NULL when the heap is empty
+	PairingHeapNode *root_;
+ // @brief Blocks of the pool
+	PairingHeapBlock *blocks_;
+ // @brief First free node of the pool
+	PairingHeapNode *free_;
+ // @brief Last free node of the pool, so meld can append another pool
+	PairingHeapNode *free_last_;
+ // @brief Current number of elements
+	u16 length_;
+ // @brief Maximum length that the heap can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Pointer to callback functions
+	struct pairing_heap_ops_s *ops_;
+} PairingHeap;
+
+/**
+* @brief Struct that contains all functions attached to the PairingHeap
+*/
+struct pairing_heap_ops_s {
+/**
+* @brief Destroys the heap, its pool and its data
+* @param *PairingHeap heap Pointer to the heap
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+*/
+	s16 (*destroy)(PairingHeap *heap);
+
+/**
+* @brief Soft resets heap's data, the elements' data is not freed. The pool is kept
+* @param *PairingHeap heap Pointer to the heap
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+*/
+	s16 (*softReset)(PairingHeap *heap);
+
+/**
+* @brief Resets heap's data, the elements' data is freed. The pool is kept
+* @param *PairingHeap heap Pointer to the heap
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+*/
+	s16 (*reset)(PairingHeap *heap);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *PairingHeap heap Pointer to the heap
+* @return u16 Capacity, 0 if the heap pointer is NULL
+*/
+	u16 (*capacity)(PairingHeap *heap);
+
+/**
+* @brief Current number of elements (<= capacity)
+* @param *PairingHeap heap Pointer to the heap
+* @return u16 Length, 0 if the heap pointer is NULL
+*/
+	u16 (*length)(PairingHeap *heap);
+
+/**
+* @brief Verifies if the heap is empty
+* @param *PairingHeap heap Pointer to the heap
+* @return bool true if it is empty, false otherwise or if the heap pointer is NULL
+*/
+	bool (*isEmpty)(PairingHeap *heap);
+
+/**
+* @brief Verifies if the heap is full
+* @param *PairingHeap heap Pointer to the heap
+* @return bool true if it is full, false otherwise or if the heap pointer is NULL
+*/
+	bool (*isFull)(PairingHeap *heap);
+
+	// Data queries
+/**
+* @brief Returns a reference to the element with the lowest key
+* @param *PairingHeap heap Pointer to the heap
+* @return void* Data pointer, NULL if the heap pointer is NULL or the heap is empty
+*/
+	void* (*top)(PairingHeap *heap);
+
+/**
+* @brief Returns the lowest key of the heap
+* @param *PairingHeap heap Pointer to the heap
+* @return s32 Key, 0 if the heap pointer is NULL or the heap is empty
+*/
+	s32 (*topKey)(PairingHeap *heap);
+
+	// Insertion
+/**
+* @brief Inserts an element, O(1)
+* @param *PairingHeap heap Pointer to the heap
+* @param void* data pointer
+* @param u16 bytes size
+* @param s32 key Priority of the element, lowest first
+* @param **PairingHeapNode handle Where the node of the element is written, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the heap is full
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for a new block of nodes
+*/
+	s16 (*insert)(PairingHeap *heap, void *data, u16 bytes, s32 key, PairingHeapNode **handle);
+
+/**
+* @brief Lowers the key of an element, O(1) (amortized O(log n) on the next pop)
+* @param *PairingHeap heap Pointer to the heap
+* @param *PairingHeapNode handle Node of the element, given by insert
+* @param s32 key New key, not greater than the current one
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+* @return s16 kErrorCode_NullPointer When the handle is NULL or its element already left the heap
+* @return s16 kErrorCode_InvalidValue When the key is greater than the current one
+*/
+	s16 (*decreaseKey)(PairingHeap *heap, PairingHeapNode *handle, s32 key);
+
+/**
+* @brief Moves every element of heap_src to the heap, O(1) plus one step per block
+* of the pool of heap_src. The handles of heap_src stay valid and belong to the heap
+* @param *PairingHeap heap Pointer to the heap
+* @param *PairingHeap heap_src Pointer to the heap to empty, it can be used again
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When any heap pointer is NULL
+* @return s16 kErrorCode_InvalidValue When both pointers are the same heap
+* @return s16 kErrorCode_InsertionFailed When the elements don't fit in the heap
+*/
+	s16 (*meld)(PairingHeap *heap, PairingHeap *heap_src);
+
+	// Extraction
+/**
+* @brief Extracts the element with the lowest key, amortized O(log n)
+* @param *PairingHeap heap Pointer to the heap
+* @return void* Data pointer, NULL if the heap pointer is NULL or the heap is empty
+*/
+	void* (*pop)(PairingHeap *heap);
+
+/**
+* @brief Extracts any element, amortized O(log n). Its handle is no longer valid
+* @param *PairingHeap heap Pointer to the heap
+* @param *PairingHeapNode handle Node of the element, given by insert
+* @return void* Data pointer, NULL if the heap pointer or the handle is NULL or the element already left the heap
+*/
+	void* (*erase)(PairingHeap *heap, PairingHeapNode *handle);
+
+	// Miscellaneous
+/**
+* @brief Calls to a function from all elements of the heap, in no particular order
+* @param *PairingHeap heap Pointer to the heap
+* @param *Void pointer to MemoryNode's callback
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullHeapPointer When the heap pointer is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverse)(PairingHeap *heap, void (*callback)(MemoryNode *));
+
+/**
+* @brief Prints the features and content of the heap
+* @param *PairingHeap heap Pointer to the heap
+*/
+	void (*print)(PairingHeap *heap);
+};
+
+/**
+* @brief Creates a new pairing heap. The pool grows one block at a time, up to the capacity
+* @param u16 capacity Maximum length that the heap can possibly have
+* @return PairingHeap* Return a heap pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+PairingHeap* PAIRINGHEAP_create(u16 capacity);
+#endif //__ADT_PAIRING_HEAP_H__
@@ -0,0 +1,261 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Persistent Log" data type
+*
+* File-backed circular vector of fixed-size records. The file is memory mapped,
+* so records survive process restarts. The operations follow the ones of the
+* circular vector (insertLast, extractFirst, first, last, at, traverse) but the
+* records live in the mapping rather than in MemoryNodes, so there's no
+* insertion at the front or in the middle and no resize. flush, recordSize and
+* next are the file specific operations.
+*
+* One process writes, any number of readers follow it with next, which copies
+* the records out. Pointers into the mapping (first, last, at, extractFirst,
+* traverse) are only safe in the writer process or while the writer is stopped,
+* the writer overwrites the oldest slot once the log is full.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_PERSISTENT_LOG_H__
+#define __ADT_PERSISTENT_LOG_H__ 1
+
+#include "ABGS_MemoryManager/abgs_platform_types.h"
+#include "adt_memory_node.h"
+
+// Records start after the header page, so they are page aligned in the mapping
+#define kPersistentLogHeaderSize 4096
+#define kPersistentLogMagic 0x474C5041 // "APLG"
+
+/**
+* @brief Layout of the first page of the file. head_ and tail_ are sequence
+* numbers that never wrap in practice, the slot of a record is sequence % capacity_.
+* They are shared with the readers, so they are only read and written in one
+* piece, with acquire loads and release stores
+*/
+typedef struct persistent_log_header_s {
+ // @brief kPersistentLogMagic, tells a log file from any other file
+	u32 magic_;
+ // @brief Bytes reserved for every record
+	u16 record_size_;
+ // @brief Maximum number of records kept, older ones are overwritten
+	u16 capacity_;
+ // @brief Sequence of the oldest record, moved before its slot is written again
+	u64 head_;
+ // @brief Sequence the next record will get, written after the record itself
+	u64 tail_;
+} PersistentLogHeader;
+
+/**
+* @brief Structure representing a Persistent Log with variables and callbacks.
+* Only one process may write the file; any number may follow it with a reader.
+*/
+typedef struct adt_persistent_log_s {
+ // @brief Header page of the mapping
+	volatile PersistentLogHeader *header_;
+ // @brief First record of the mapping
+	u8 *records_;
+ // @brief Bytes mapped, header page included
+	u32 mapping_size_;
+ // @brief Insertions between two flushes, 0 flushes only on flush/destroy
+	u16 flush_interval_;
+ // @brief Insertions since the last flush
+	u16 pending_;
+ // @brief Readers cannot insert, extract or reset
+	bool read_only_;
+#ifdef _WIN32
+ // @brief File and mapping handles
+	void *file_;
+	void *mapping_;
+#else
+ // @brief File descriptor
+	int file_;
+#endif
+ // @brief Pointer to callback functions
+	struct persistent_log_ops_s *ops_;
+} PersistentLog;
+
+/**
+* @brief Struct that contains all functions attached to the Persistent Log
+*/
+struct persistent_log_ops_s {
+  /**
+* @brief Flushes the log, unmaps and closes the file. The file is kept
+* @param *PersistentLog pointer to the log
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullPointer When the log pointer is NULL
+* @return s16 kErrorCode_File When the last flush failed, the log is closed anyway
+*/
+	s16 (*destroy)(PersistentLog *log);
+
+  /**
+* @brief Drops every record, the sequence numbers keep growing
+* @param *PersistentLog pointer to the log
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullPointer When the log pointer is NULL
+* @return s16 kErrorCode_File When the log was opened as a reader or the flush failed
+*/
+	s16 (*reset)(PersistentLog *log);
+
+	// State queries
+  /**
+* @brief Returns the maximum number of records of the log
+* @param *PersistentLog pointer to the log
+* @return u16 Capacity, 0 if the log pointer is NULL
+*/
+	u16 (*capacity)(PersistentLog *log);
+
+  /**
+* @brief Returns the current number of records of the log
+* @param *PersistentLog pointer to the log
+* @return u16 Length, 0 if the log pointer is NULL
+*/
+	u16 (*length)(PersistentLog *log);
+
+  /**
+* @brief Checks whether the log is empty
+* @param *PersistentLog pointer to the log
+* @return bool true if it is empty, false otherwise or if the log pointer is NULL
+*/
+	bool (*isEmpty)(PersistentLog *log);
+
+  /**
+* @brief Checks whether the next insertion overwrites the oldest record
+* @param *PersistentLog pointer to the log
+* @return bool true if it is full, false otherwise or if the log pointer is NULL
+*/
+	bool (*isFull)(PersistentLog *log);
+
+	// Data queries
+  /**
+* @brief Returns the oldest record, in place inside the mapping. Only valid
+* while the writer doesn't overwrite it, use next from a reader process
+* @param *PersistentLog pointer to the log
+* @return void* Record pointer, NULL if the log pointer is NULL or the log is empty
+*/
+	void* (*first)(PersistentLog *log);
+
+  /**
+* @brief Returns the newest record, in place inside the mapping. Only valid
+* while the writer doesn't overwrite it, use next from a reader process
+* @param *PersistentLog pointer to the log
+* @return void* Record pointer, NULL if the log pointer is NULL or the log is empty
+*/
+	void* (*last)(PersistentLog *log);
+
+  /**
+* @brief Returns the record at the given position, 0 being the oldest one, in place
+* inside the mapping. Only valid while the writer doesn't overwrite it
+* @param *PersistentLog pointer to the log
+* @param u16 position Position of the record
+* @return void* Record pointer, NULL if the log pointer is NULL or position is out of range
+*/
+	void* (*at)(PersistentLog *log, u16 position);
+
+	// Insertion
+  /**
+* @brief Appends a record, overwriting the oldest one when the log is full.
+* The record is zero padded up to the record size
+* @param *PersistentLog pointer to the log
+* @param *data Bytes to copy into the record
+* @param u16 bytes Number of bytes to copy, cannot exceed the record size
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullPointer When the log or data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is bigger than the record size
+* @return s16 kErrorCode_File When the log was opened as a reader or the periodic flush failed
+*/
+	s16 (*insertLast)(PersistentLog *log, void *data, u16 bytes);
+
+	// Extraction
+  /**
+* @brief Removes the oldest record
+* @param *PersistentLog pointer to the log
+* @return void* The record, in place inside the mapping, valid until the next insertLast
+* @return NULL if the log pointer is NULL, the log is empty or it was opened as a reader
+*/
+	void* (*extractFirst)(PersistentLog *log);
+
+	// Miscellaneous
+  /**
+* @brief Calls a function on the records of the log, from the oldest to the newest.
+* The node handed to it points into the mapping and has the record size
+* @param *PersistentLog pointer to the log
+* @param callback Function called with every record
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullPointer When the log pointer or the callback is NULL
+*/
+	s16 (*traverse)(PersistentLog *log, void (*callback)(MemoryNode *));
+
+  /**
+* @brief Calls a function on the records of the log, from the oldest to the newest, handing it ctx,
+* until it returns kTraverse_Stop
+* @param *PersistentLog pointer to the log
+* @param callback Function that returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullPointer When the log pointer or the callback is NULL
+*/
+	s16 (*traverseEx)(PersistentLog *log, s16 (*callback)(MemoryNode *node, void *ctx), void *ctx);
+
+  /**
+* @brief Prints the features of the log
+* @param *PersistentLog pointer to the log
+*/
+	void (*print)(PersistentLog *log);
+
+	// File
+  /**
+* @brief Writes the dirty pages of the mapping to the file
+* @param *PersistentLog pointer to the log
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullPointer When the log pointer is NULL
+* @return s16 kErrorCode_File When the system fails to sync the mapping
+*/
+	s16 (*flush)(PersistentLog *log);
+
+  /**
+* @brief Returns the bytes reserved for every record
+* @param *PersistentLog pointer to the log
+* @return u16 Record size, 0 if the log pointer is NULL
+*/
+	u16 (*recordSize)(PersistentLog *log);
+
+  /**
+* @brief Follows the log: copies the record with the given sequence and advances it.
+* A sequence older than the oldest record (0 included) jumps to the oldest one,
+* so a reader that falls behind the writer skips the overwritten records
+* @param *PersistentLog pointer to the log
+* @param *sequence Cursor of the caller
+* @param *dst Receives a copy of the record, record size bytes
+* @return s16 kErrorCode_Ok When a record was copied
+* @return s16 kErrorCode_NullPointer When a pointer is NULL
+* @return s16 kErrorCode_ExtractionFailed When there is nothing new
+* @details A copy the writer overwrote while it was being taken is thrown away
+* and the next oldest record is read instead, so dst never holds a torn record
+*/
+	s16 (*next)(PersistentLog *log, u64 *sequence, void *dst);
+};
+
+/**
+* @brief Opens the log for writing, creating the file if it does not exist.
+* An existing file is reused as is, so the records survive process restarts
+* @param *path File name
+* @param u16 record_size Bytes reserved for every record, cannot be 0
+* @param u16 capacity Maximum number of records, cannot be 0
+* @param u16 flush_interval Insertions between two flushes, 0 flushes only on flush/destroy
+* @return PersistentLog* Return a log pointer with all variables initialized
+* @return NULL If a parameter is 0, there's no space in memory, the file cannot be
+* mapped or it holds a log with a different record size or capacity
+*/
+PersistentLog* PERSISTENT_LOG_open(const char *path, u16 record_size, u16 capacity, u16 flush_interval);
+
+/**
+* @brief Opens an existing log read only, to follow it from another process
+* @param *path File name
+* @return PersistentLog* Return a log pointer with all variables initialized
+* @return NULL If there's no space in memory or the file is not a log
+*/
+PersistentLog* PERSISTENT_LOG_openReader(const char *path);
+#endif //__ADT_PERSISTENT_LOG_H__
@@ -0,0 +1,26 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Software prefetch used by the walks of the linked data types
+*
+* A walk keeps a pointer some nodes ahead of the one it is visiting and asks
+* the cache for that node and its data, so they are loaded by the time the
+* walk gets there.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_PREFETCH_H__
+#define __ADT_PREFETCH_H__ 1
+
+#ifdef _MSC_VER
+#include <xmmintrin.h>
+// Loads the cache line of address without waiting for it
+#define ADT_PREFETCH(address) _mm_prefetch((const char *)(address), _MM_HINT_T0)
+#else
+// Loads the cache line of address without waiting for it
+#define ADT_PREFETCH(address) __builtin_prefetch(address)
+#endif
+
+#endif //__ADT_PREFETCH_H__
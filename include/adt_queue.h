@@ -14,13 +14,28 @@
 #define __ADT_QUEUE_H__ 1
 
 #include "adt_list.h"
+#include "adt_circular_vector.h"
+
+/**
+* @brief Container that holds the elements of the queue, chosen at creation time
+*/
+typedef enum {
+  // Elements live in a List, every enqueue allocates a node and every dequeue frees it
+  kQueueStorage_List = 0,
+  // Elements live in a CircularVector allocated once, enqueue and dequeue never call MM
+  kQueueStorage_Ring = 1
+} QueueStorage;
 
 /**
 * @brief Structure representing a Queue with variables and callbacks.
 */
 typedef struct adt_queue_s {
-  // @brief Pointer that will contain all information
+  // @brief Pointer that will contain all information, NULL with kQueueStorage_Ring
 	List* storage_;
+  // @brief Ring buffer that contains all information with kQueueStorage_Ring, NULL otherwise
+	CircularVector* ring_;
+  // @brief Container chosen when the queue was created
+	QueueStorage kind_;
   // @brief Pointer to callbacks functions
 	struct queue_ops_s *ops_;
 } Queue;
@@ -123,7 +138,7 @@ struct queue_ops_s {
  /**
 * @brief Extracts the first element of the queue
 * @param *Queue queue Pointer to the queue
-* @param u16 position Position of the element to extract
+* @param u16 position Unused, the first element is always the one extracted; dequeueMany takes several
 * @return void* data Returns storage nodess data pointer
 * @return NULL If the queue pointer is NULL
 * @return NULL If the queue is empty
@@ -131,6 +146,33 @@ struct queue_ops_s {
 */
 	void* (*dequeue)(Queue *queue, u16 position);
 
+ /**
+* @brief Inserts up to count elements at the back of the queue in one call: the list
+* hangs the whole run of new nodes from its tail at once, the ring buffer copies them
+* in at most two contiguous segments
+* @param *Queue queue Pointer to the queue
+* @param void** data Data pointers of the elements, from the first to go in
+* @param u16* sizes Size of every element of data
+* @param u16 count Number of elements in data
+* @return u16 Number of elements actually inserted, limited by the free places; it stops
+* before the first NULL data or 0 size
+* @return u16 0 If the queue, its storage, data or sizes pointer is NULL
+*/
+	u16(*enqueueMany)(Queue *queue, void **data, u16 *sizes, u16 count);
+
+ /**
+* @brief Extracts up to max elements from the front of the queue in one call: the list
+* cuts the run of nodes in one walk, the ring buffer copies them out in at most two
+* contiguous segments
+* @param *Queue queue Pointer to the queue
+* @param void** out_ptrs Array that receives the data pointers, at least max long
+* @param u16* out_sizes Array that receives the sizes, at least max long, it may be NULL
+* @param u16 max Largest number of elements to extract
+* @return u16 Number of elements actually extracted (limited by the length)
+* @return u16 0 If the queue, its storage or out_ptrs pointer is NULL
+*/
+	u16(*dequeueMany)(Queue *queue, void **out_ptrs, u16 *out_sizes, u16 max);
+
  /**
 * @brief Concatenates two queues
 * @param *Queue queue Pointer to the queue
@@ -141,6 +183,36 @@ struct queue_ops_s {
 */
 	s16(*concat)(Queue *queue, Queue *queue_src);
 
+ /**
+* @brief Calls a function on the elements of the queue, from the front to the back, handing it ctx,
+* until it returns kTraverse_Stop
+* @param *Queue queue Pointer to the queue
+* @param callback Function that returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullQueuePointer When the queue pointer is NULL
+* @return s16 kErrorCode_NullListPointer When the storage is NULL
+* @return s16 kErrorCode_NullMemoryNode When the queue is empty
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseEx)(Queue *queue, s16 (*callback)(MemoryNode *node, void *ctx), void *ctx);
+
+ /**
+* @brief Like traverseEx, but hands the callback spans of up to kTraverseBatchLength
+* nodes in the same order, so the cost of a call is shared by the whole span.
+* The queue must not change while the callback runs
+* @param *Queue queue Pointer to the queue
+* @param callback Function that gets the nodes of a span and their count, and
+* returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullQueuePointer When the queue pointer is NULL
+* @return s16 kErrorCode_NullListPointer When the storage is NULL
+* @return s16 kErrorCode_NullMemoryNode When the queue is empty
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseBatch)(Queue *queue, s16 (*callback)(MemoryNode **nodes, u16 count, void *ctx), void *ctx);
+
  /**
 * @brief Prints the features and content of the stack
 * @param *Queue queue Pointer to the queue
@@ -156,4 +228,17 @@ struct queue_ops_s {
 * @return NULL If there is not enough memory available
 */
 Queue* QUEUE_create(u16 capacity); // Creates a new queue
+
+/**
+* @brief Creates a new queue on the given container. Both share struct queue_ops_s,
+* the functions that mention the list pointer(storage) report kErrorCode_NullVectorPointer
+* for a NULL ring buffer
+* @param u16 capacity Maximum length that the queue can possibly have
+* @param QueueStorage storage kQueueStorage_Ring keeps the elements in a contiguous ring
+* buffer, so a bounded queue runs with no allocations
+* @return Queue* queue Returns a queue pointer with all variables initialized
+* @return NULL If capacity parameter is 0
+* @return NULL If there is not enough memory available
+*/
+Queue* QUEUE_createWithStorage(u16 capacity, QueueStorage storage);
 #endif //__ADT_QUEUE_H__
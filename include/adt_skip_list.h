@@ -0,0 +1,261 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Skip List" data type
+*
+* Indexable skip list: every link counts the positions it skips, so at(),
+* insertAt() and extractAt() find their place in O(log n) expected steps.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_SKIP_LIST_H__
+#define __ADT_SKIP_LIST_H__ 1
+
+#include "adt_memory_node.h"
+
+// Highest number of levels of a node, enough for 4^16 elements
+#define kSkipListMaxLevel 16
+
+/**
+* @brief Forward link of one level of a skip list node
+*/
+typedef struct skip_list_link_s {
+ // @brief Next node in this level, NULL at the end
+	struct skip_list_node_s *next_;
+ // @brief Number of positions the link moves forward
+	u32 span_;
+} SkipListLink;
+
+/**
+* @brief Element of the skip list. The payload is a MemoryNode, followed by
+* one link for each of its levels
+*/
+typedef struct skip_list_node_s {
+ // @brief Payload of the element
+	MemoryNode node_;
+ // @brief Number of entries of links_
+	u8 level_;
+ // @brief Links of every level, level 0 visits every element
+	SkipListLink links_[];
+} SkipListNode;
+
+/**
+* @brief Structure representing a SkipList with variables and callbacks.
+*/
+typedef struct adt_skip_list_s {
+ // @brief Sentinel before the first element, it has kSkipListMaxLevel links
+	SkipListNode *head_;
+ // @brief Last element, NULL when the list is empty
+	SkipListNode *tail_;
+ // @brief Current number of elements
+	u16 length_;
+ // @brief Maximum length that the list can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Number of levels in use
+	u8 level_;
+ // @brief State of the generator that picks the level of new nodes
+	u32 seed_;
+ // @brief Pointer to callback functions
+	struct skip_list_ops_s *ops_;
+} SkipList;
+
+/**
+* @brief Struct that contains all functions attached to the SkipList. It has
+* the shape of struct list_ops_s without the cursor functions
+*/
+struct skip_list_ops_s {
+/**
+* @brief Destroys the list and its data
+* @param *SkipList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSkipListPointer When the list pointer is NULL
+*/
+	s16 (*destroy)(SkipList *list);
+
+/**
+* @brief Soft resets list's data, the elements' data is not freed
+* @param *SkipList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSkipListPointer When the list pointer is NULL
+*/
+	s16 (*softReset)(SkipList *list);
+
+/**
+* @brief Resets list's data
+* @param *SkipList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSkipListPointer When the list pointer is NULL
+*/
+	s16 (*reset)(SkipList *list);
+
+/**
+* @brief Changes the capacity of the list. Elements over the new capacity are
+* lost from the end
+* @param *SkipList list Pointer to the list
+* @param u16 new_size New capacity
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSkipListPointer When the list pointer is NULL
+* @return s16 kErrorCode_InvalidValue When new_size is 0
+*/
+	s16 (*resize)(SkipList *list, u16 new_size);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *SkipList list Pointer to the list
+* @return u16 Capacity, 0 if the list pointer is NULL
+*/
+	u16 (*capacity)(SkipList *list);
+
+/**
+* @brief Current number of elements (<= capacity)
+* @param *SkipList list Pointer to the list
+* @return u16 Length, 0 if the list pointer is NULL
+*/
+	u16 (*length)(SkipList *list);
+
+/**
+* @brief Verifies if the list is empty
+* @param *SkipList list Pointer to the list
+* @return bool true if it is empty, false otherwise or if the list pointer is NULL
+*/
+	bool (*isEmpty)(SkipList *list);
+
+/**
+* @brief Verifies if the list is full
+* @param *SkipList list Pointer to the list
+* @return bool true if it is full, false otherwise or if the list pointer is NULL
+*/
+	bool (*isFull)(SkipList *list);
+
+	// Data queries
+/**
+* @brief Returns a reference to the first element of the list
+* @param *SkipList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*first)(SkipList *list);
+
+/**
+* @brief Returns a reference to the last element of the list
+* @param *SkipList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*last)(SkipList *list);
+
+/**
+* @brief Returns a reference to the element at a given position, in O(log n)
+* @param *SkipList list Pointer to the list
+* @param u16 position Position of the element
+* @return void* Data pointer, NULL if the list pointer is NULL or position is out of range
+*/
+	void* (*at)(SkipList *list, u16 position);
+
+	// Insertion
+/**
+* @brief Inserts an element in the first position of the list
+* @param *SkipList list Pointer to the list
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSkipListPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the list is full
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for the node
+*/
+	s16 (*insertFirst)(SkipList *list, void *data, u16 bytes);
+
+/**
+* @brief Inserts an element in the last position of the list
+* @param *SkipList list Pointer to the list
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertLast)(SkipList *list, void *data, u16 bytes);
+
+/**
+* @brief Inserts an element at the given position of the list, in O(log n).
+* Positions over the length insert at the end
+* @param *SkipList list Pointer to the list
+* @param void* data pointer
+* @param u16 bytes size
+* @param u16 position Position of the new element
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertAt)(SkipList *list, void *data, u16 bytes, u16 position);
+
+	// Extraction
+/**
+* @brief Extracts the first element of the list
+* @param *SkipList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*extractFirst)(SkipList *list);
+
+/**
+* @brief Extracts the last element of the list
+* @param *SkipList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*extractLast)(SkipList *list);
+
+/**
+* @brief Extracts the element at the given position, in O(log n)
+* @param *SkipList list Pointer to the list
+* @param u16 position Position of the element
+* @return void* Data pointer, NULL if the list pointer is NULL or position is out of range
+*/
+	void* (*extractAt)(SkipList *list, u16 position);
+
+	// Miscellaneous
+/**
+* @brief Concatenates two lists, copying the data of the second one at the end of the first.
+* The capacity of the first list grows by the capacity of the second one
+* @param *SkipList list Pointer to the list
+* @param *SkipList list_src Pointer to the second list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSkipListPointer When any of the list pointers is NULL
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for the copies
+*/
+	s16 (*concat)(SkipList *list, SkipList *list_src);
+
+/**
+* @brief Calls to a function from all elements of the list, in order
+* @param *SkipList list Pointer to the list
+* @param *Void Pointer to MemoryNode's callback
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSkipListPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverse)(SkipList *list, void (*callback)(MemoryNode *));
+
+/**
+* @brief Prints the features and content of the list
+* @param *SkipList list Pointer to the list
+*/
+	void (*print)(SkipList *list);
+};
+
+/**
+* @brief Creates a new skip list. The levels of its nodes come from a seed
+* taken from the clock
+* @param u16 capacity Maximum length that the list can possibly have
+* @return SkipList* Return a list pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+SkipList* SKIPLIST_create(u16 capacity);
+
+/**
+* @brief Creates a new skip list whose node levels come from the given seed,
+* so the same sequence of operations always builds the same list
+* @param u16 capacity Maximum length that the list can possibly have
+* @param u32 seed Seed of the level generator
+* @return SkipList* Return a list pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+SkipList* SKIPLIST_createWithSeed(u16 capacity, u32 seed);
+#endif //__ADT_SKIP_LIST_H__
@@ -13,7 +13,17 @@
 #ifndef __ADT_STACK_H__
 #define __ADT_STACK_H__ 1
 
+#include "common_def.h"
 #include "adt_vector.h"
+
+#ifndef ADT_INLINE
+#ifdef _WIN32
+#define ADT_INLINE __inline
+#else
+#define ADT_INLINE inline
+#endif
+#endif
+
 /**
 * @brief Structure representing a Stack with variables and callbacks.
 */
@@ -145,6 +155,34 @@ struct stack_ops_s {
 */
  s16* (*concat)(Stack *stack, Stack *stack_src);
 
+ /**
+* @brief Calls a function on the elements of the stack, from the bottom to the top, handing it ctx,
+* until it returns kTraverse_Stop
+* @param *Stack stack Pointer to the stack
+* @param callback Function that returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullStackPointer When the stack pointer is NULL
+* @return s16 kErrorCode_NullVectorPointer When the storage is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseEx)(Stack *stack, s16 (*callback)(MemoryNode *node, void *ctx), void *ctx);
+
+ /**
+* @brief Like traverseEx, but hands the callback spans of up to kTraverseBatchLength
+* nodes in the same order, so the cost of a call is shared by the whole span.
+* The stack must not change while the callback runs
+* @param *Stack stack Pointer to the stack
+* @param callback Function that gets the nodes of a span and their count, and
+* returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullStackPointer When the stack pointer is NULL
+* @return s16 kErrorCode_NullVectorPointer When the storage is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseBatch)(Stack *stack, s16 (*callback)(MemoryNode **nodes, u16 count, void *ctx), void *ctx);
+
 	// Miscellaneous
 /**
 * @brief Prints the features and content of the stack
@@ -161,4 +199,56 @@ struct stack_ops_s {
 * @return NULL If there is not enough memory available
 */
 Stack* STACK_create(u16 capacity); // Creates a new stack
+
+// Fast path for hot loops, such as an interpreter's operand stack. The top of the
+// stack is the tail_ of its vector, so every call is a bounds check plus a load or
+// a store. There's no NULL check: the stack must come from STACK_create
+/**
+* @brief Inserts an element on the top of the stack, like push without the checks
+* @param *Stack stack Pointer to a valid stack
+* @param void* data Pointer to the data, must not be NULL
+* @param u16 bytes Size of the data
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_InsertionFailed When the stack is full
+*/
+static ADT_INLINE s16 STACK_pushFast(Stack *stack, void *data, u16 bytes) {
+	Vector *vector = stack->storage_;
+	if (vector->tail_ >= vector->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	MemoryNode *node = &vector->storage_[vector->tail_++];
+	node->data_ = data;
+	node->size_ = bytes;
+	return kErrorCode_Ok;
+}
+
+/**
+* @brief Extracts the element on the top of the stack, like pop without the checks
+* @param *Stack stack Pointer to a valid stack
+* @return void* Data pointer, NULL if the stack is empty
+*/
+static ADT_INLINE void* STACK_popFast(Stack *stack) {
+	Vector *vector = stack->storage_;
+	if (0 == vector->tail_) {
+		return NULL;
+	}
+	MemoryNode *node = &vector->storage_[--vector->tail_];
+	void *data = node->data_;
+	node->data_ = NULL;
+	node->size_ = 0;
+	return data;
+}
+
+/**
+* @brief Returns the element on the top of the stack, like top without the checks
+* @param *Stack stack Pointer to a valid stack
+* @return void* Data pointer, NULL if the stack is empty
+*/
+static ADT_INLINE void* STACK_topFast(Stack *stack) {
+	Vector *vector = stack->storage_;
+	if (0 == vector->tail_) {
+		return NULL;
+	}
+	return vector->storage_[vector->tail_ - 1].data_;
+}
 #endif //__ADT_STACK_H__
@@ -0,0 +1,167 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Stack Arena" data type
+*
+* Memory handed out like a stack. Allocations bump an offset inside large
+* blocks; mark() remembers where the top is and release() goes back to a mark,
+* dropping everything allocated after it at once. Blocks left behind are kept
+* for the next allocations, so a frame or a request that marks at its start and
+* releases at its end doesn't call the memory manager once it is warm.
+*
+* Data allocated here can be given to the other ADTs, like the payloads of
+* insertLast or push, as long as they are emptied with softReset, which
+* doesn't free the data, before the arena is released.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_STACK_ARENA_H__
+#define __ADT_STACK_ARENA_H__ 1
+
+#include "ABGS_MemoryManager/abgs_platform_types.h"
+
+// Alignment of every allocation, a power of 2
+#define kStackArenaAlignment 16
+
+/**
+* @brief Block of memory of the arena. Its memory comes right after the structure
+*/
+typedef struct stack_arena_block_s {
+ // @brief Next block, allocated later
+	struct stack_arena_block_s *next_;
+ // @brief Bytes of memory_
+	u32 size_;
+ // @brief Bytes of the blocks before this one, where it starts in the arena
+	u32 start_;
+ // @brief Memory of the allocations
+	u8 *memory_;
+} StackArenaBlock;
+
+/**
+* @brief Position of the top of the arena, given by mark to go back to it later
+*/
+typedef struct stack_arena_mark_s {
+ // @brief Block of the top
+	StackArenaBlock *block_;
+ // @brief Bytes used of the block
+	u32 offset_;
+} StackArenaMark;
+
+/**
+* @brief Structure representing a StackArena with variables and callbacks.
+* Blocks after current_ are empty and wait to be used again
+*/
+typedef struct adt_stack_arena_s {
+ // @brief First block
+	StackArenaBlock *first_;
+ // @brief Block allocations come from
+	StackArenaBlock *current_;
+ // @brief Bytes used of current_
+	u32 offset_;
+ // @brief Bytes of a new block, unless an allocation needs more
+	u32 block_size_;
+ // @brief Pointer to callback functions
+	struct stack_arena_ops_s *ops_;
+} StackArena;
+
+/**
+* @brief Struct that contains all functions attached to the StackArena
+*/
+struct stack_arena_ops_s {
+/**
+* @brief Destroys the arena and all its blocks, so every allocation too
+* @param *StackArena arena Pointer to the arena
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullArenaPointer When the arena pointer is NULL
+*/
+	s16 (*destroy)(StackArena *arena);
+
+/**
+* @brief Releases every allocation, O(1). The blocks are kept. Every mark is no longer valid
+* @param *StackArena arena Pointer to the arena
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullArenaPointer When the arena pointer is NULL
+*/
+	s16 (*reset)(StackArena *arena);
+
+/**
+* @brief Frees the blocks after the top, which hold no allocations
+* @param *StackArena arena Pointer to the arena
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullArenaPointer When the arena pointer is NULL
+*/
+	s16 (*trim)(StackArena *arena);
+
+	// State queries
+/**
+* @brief Bytes from the start of the arena to the top, counting the ends of the blocks left behind
+* @param *StackArena arena Pointer to the arena
+* @return u32 Bytes used, 0 if the arena pointer is NULL
+*/
+	u32 (*used)(StackArena *arena);
+
+/**
+* @brief Bytes of all the blocks of the arena
+* @param *StackArena arena Pointer to the arena
+* @return u32 Bytes reserved, 0 if the arena pointer is NULL
+*/
+	u32 (*reserved)(StackArena *arena);
+
+	// Insertion
+/**
+* @brief Allocates bytes on the top of the arena, aligned to kStackArenaAlignment, O(1)
+* unless a new block is needed
+* @param *StackArena arena Pointer to the arena
+* @param u16 bytes Size of the allocation
+* @return void* Memory allocated, NULL if the arena pointer is NULL, bytes is 0 or there's no memory for a new block
+*/
+	void* (*alloc)(StackArena *arena, u16 bytes);
+
+/**
+* @brief Allocates bytes on the top of the arena and copies src into them
+* @param *StackArena arena Pointer to the arena
+* @param void* src Data to copy
+* @param u16 bytes Size of the data
+* @return void* Copy of the data, NULL if the arena or src pointer is NULL, bytes is 0 or there's no memory for a new block
+*/
+	void* (*copy)(StackArena *arena, void *src, u16 bytes);
+
+/**
+* @brief Returns the current top of the arena, to release back to it later
+* @param *StackArena arena Pointer to the arena
+* @return StackArenaMark Mark of the top, an empty mark if the arena pointer is NULL
+*/
+	StackArenaMark (*mark)(StackArena *arena);
+
+	// Extraction
+/**
+* @brief Releases every allocation made after mark, O(blocks in use). The marks taken after it
+* are no longer valid, and neither is this one once the arena is released to an
+* older mark, reset or trimmed
+* @param *StackArena arena Pointer to the arena
+* @param StackArenaMark mark Mark given by mark
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullArenaPointer When the arena pointer is NULL
+* @return s16 kErrorCode_InvalidValue When the mark is empty, above the top or in a
+* block that is no longer in use
+*/
+	s16 (*release)(StackArena *arena, StackArenaMark mark);
+
+	// Miscellaneous
+/**
+* @brief Prints the features and blocks of the arena
+* @param *StackArena arena Pointer to the arena
+*/
+	void (*print)(StackArena *arena);
+};
+
+/**
+* @brief Creates a new arena with its first block
+* @param u32 block_size Bytes of every block, an allocation larger than this gets a block of its own size
+* @return StackArena* Return an arena pointer with all variables initialized
+* @return NULL If block_size parameter is 0 or there's no space in memory
+*/
+StackArena* STACKARENA_create(u32 block_size);
+#endif //__ADT_STACK_ARENA_H__
@@ -0,0 +1,200 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Task Scheduler"
+*
+* Fixed set of workers, each one with a WorkStealingDeque. A task spawned by a
+* worker goes to the bottom of its own deque; a worker with nothing to do steals
+* from the top of another one. The thread that creates the scheduler is worker 0,
+* so it can spawn tasks and wait for them like any other worker. The other
+* workers sleep once they fail to find a task for a while, and every new task
+* wakes one of them up.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_TASK_SCHEDULER_H__
+#define __ADT_TASK_SCHEDULER_H__ 1
+
+#include "adt_atomic.h"
+#include "adt_work_stealing_deque.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+// Workers a scheduler can have
+#define kSchedulerMaxWorkers 64
+// Tasks waiting in the deque of every worker, more are run on the spot
+#define kSchedulerDequeCapacity 1024
+// Finished tasks a worker keeps for its next spawns
+#define kSchedulerTaskCacheLimit 256
+// Rounds of failed steals before an idle worker goes to sleep
+#define kSchedulerIdleRounds 64
+
+/**
+* @brief Tasks that are waited for together. It must be zeroed before the first spawn
+*/
+typedef struct scheduler_task_group_s {
+ // @brief Tasks spawned in the group that didn't finish yet
+	volatile u32 pending_;
+} TaskGroup;
+
+/**
+* @brief Work of a task: a function with its argument, or a range of a parallelFor
+*/
+typedef struct scheduler_task_s {
+ // @brief Function of a spawned task, NULL for a range
+	void (*function_)(void *arg);
+ // @brief Argument of function_
+	void *arg_;
+ // @brief Body of a parallelFor, called with [begin, end) and ctx
+	void (*body_)(u32 begin, u32 end, void *ctx);
+ // @brief Context of body_
+	void *ctx_;
+ // @brief First index of the range
+	u32 begin_;
+ // @brief Index after the range
+	u32 end_;
+ // @brief Ranges up to this length are not split
+	u32 grain_;
+ // @brief Group the task belongs to
+	TaskGroup *group_;
+ // @brief Next task of the cache of a worker
+	struct scheduler_task_s *next_;
+} SchedulerTask;
+
+/**
+* @brief State of one worker. Only the worker touches its cache
+*/
+typedef struct scheduler_worker_s {
+ // @brief Tasks spawned by the worker
+	WorkStealingDeque *deque_;
+ // @brief Finished tasks ready to be reused
+	SchedulerTask *cache_;
+ // @brief Number of tasks in cache_
+	u16 cache_length_;
+ // @brief Position of the worker in the scheduler
+	u16 index_;
+ // @brief State of the random victim choice
+	u32 seed_;
+ // @brief Scheduler of the worker
+	struct adt_task_scheduler_s *scheduler_;
+ // @brief Thread running the worker, unused for worker 0
+#ifdef _WIN32
+	HANDLE thread_;
+#else
+	pthread_t thread_;
+#endif
+} SchedulerWorker;
+
+/**
+* @brief Structure representing a TaskScheduler with variables and callbacks.
+*/
+typedef struct adt_task_scheduler_s {
+ // @brief Workers, worker 0 is the thread that created the scheduler
+	SchedulerWorker *workers_;
+ // @brief Number of workers
+	u16 workers_length_;
+ // @brief 1 while the workers look for tasks, 0 tells them to finish
+	volatile u32 running_;
+ // @brief Lock the idle workers sleep with
+#ifdef _WIN32
+	SRWLOCK lock_;
+#else
+	pthread_mutex_t lock_;
+#endif
+ // @brief Where the idle workers sleep until a task is queued or the scheduler is destroyed
+#ifdef _WIN32
+	CONDITION_VARIABLE wake_;
+#else
+	pthread_cond_t wake_;
+#endif
+ // @brief Workers sleeping on wake_, nobody is woken up when it's 0
+	volatile u32 sleepers_;
+ // @brief Pointer to callback functions
+	struct task_scheduler_ops_s *ops_;
+} TaskScheduler;
+
+/**
+* @brief Struct that contains all functions attached to the TaskScheduler. Every
+* function but destroy and print can only be called from a worker: the thread
+* that created the scheduler or a running task
+*/
+struct task_scheduler_ops_s {
+/**
+* @brief Stops the workers and destroys the scheduler. Every group must have been synced
+* @param *TaskScheduler scheduler Pointer to the scheduler
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSchedulerPointer When the scheduler pointer is NULL
+*/
+	s16 (*destroy)(TaskScheduler *scheduler);
+
+/**
+* @brief Returns the number of workers, including the thread that created the scheduler
+* @param *TaskScheduler scheduler Pointer to the scheduler
+* @return u16 Workers, 0 if the scheduler pointer is NULL
+*/
+	u16 (*workers)(TaskScheduler *scheduler);
+
+/**
+* @brief Queues function(arg) in the deque of the calling worker. When the deque is
+* full the task runs before spawn returns
+* @param *TaskScheduler scheduler Pointer to the scheduler
+* @param *TaskGroup group Group to wait for the task with
+* @param function Work of the task
+* @param void* arg Argument of function
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSchedulerPointer When the scheduler pointer is NULL
+* @return s16 kErrorCode_NullPointer When the group or the function is NULL
+* @return s16 kErrorCode_InvalidValue When the calling thread is not a worker of the scheduler
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for the task
+*/
+	s16 (*spawn)(TaskScheduler *scheduler, TaskGroup *group, void (*function)(void *arg), void *arg);
+
+/**
+* @brief Returns once every task of the group has finished. Meanwhile the calling
+* worker runs its own tasks or steals from the others
+* @param *TaskScheduler scheduler Pointer to the scheduler
+* @param *TaskGroup group Group to wait for
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSchedulerPointer When the scheduler pointer is NULL
+* @return s16 kErrorCode_NullPointer When the group is NULL
+* @return s16 kErrorCode_InvalidValue When the calling thread is not a worker of the scheduler
+*/
+	s16 (*sync)(TaskScheduler *scheduler, TaskGroup *group);
+
+/**
+* @brief Calls body over [begin, end) in pieces of at most grain indices, on every
+* worker, and waits for all of them. The range is split in halves so idle workers
+* steal big pieces first. Without memory for a task the rest of a range runs unsplit
+* @param *TaskScheduler scheduler Pointer to the scheduler
+* @param u32 begin First index
+* @param u32 end Index after the last one
+* @param u32 grain Largest piece given to one call of body, 0 is taken as 1
+* @param body Work of a piece, called with its [begin, end) and ctx
+* @param void* ctx Context of body
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullSchedulerPointer When the scheduler pointer is NULL
+* @return s16 kErrorCode_NullPointer When body is NULL
+* @return s16 kErrorCode_InvalidValue When the calling thread is not a worker of the scheduler
+*/
+	s16 (*parallelFor)(TaskScheduler *scheduler, u32 begin, u32 end, u32 grain, void (*body)(u32 begin, u32 end, void *ctx), void *ctx);
+
+/**
+* @brief Prints the features of the scheduler and the tasks waiting in every worker
+* @param *TaskScheduler scheduler Pointer to the scheduler
+*/
+	void (*print)(TaskScheduler *scheduler);
+};
+
+/**
+* @brief Creates a new scheduler and starts workers - 1 threads. The calling thread is worker 0
+* @param u16 workers Number of workers, up to kSchedulerMaxWorkers
+* @return TaskScheduler* Return a scheduler pointer with all variables initialized
+* @return NULL If workers is 0 or greater than kSchedulerMaxWorkers, the calling thread
+* is already a worker, or there's no space in memory or threads
+*/
+TaskScheduler* TASKSCHEDULER_create(u16 workers);
+#endif //__ADT_TASK_SCHEDULER_H__
@@ -0,0 +1,191 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Timing Wheel" data type
+*
+* Hierarchical timing wheel. Time goes in ticks; a timer waits in a bucket of
+* the level that fits how far away it is, level 0 holding the next
+* kTimingWheelSlots ticks one per bucket and every level above covering
+* kTimingWheelSlots times as much. Every tick fires the one bucket of level 0
+* that is due and, once per turn of a level, moves the due bucket of the level
+* above down, so the work per tick doesn't grow with the pending timers.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_TIMING_WHEEL_H__
+#define __ADT_TIMING_WHEEL_H__ 1
+
+#include "adt_memory_node.h"
+
+// Levels of the wheel
+#define kTimingWheelLevels 4
+// Buckets of every level, a power of 2
+#define kTimingWheelSlotBits 6
+#define kTimingWheelSlots (1 << kTimingWheelSlotBits)
+// Timers allocated at once when the pool runs out
+#define kTimingWheelBlockLength 64
+
+/**
+* @brief Timer of the wheel, also used as its handle. node_ keeps the data and
+* the links of the bucket; free timers have no data
+*/
+typedef struct timing_wheel_timer_s {
+ // @brief Data of the timer and links of its bucket
+	MemoryNode node_;
+ // @brief Tick the timer fires at
+	u32 expires_;
+} TimingWheelTimer;
+
+/**
+* @brief Block of timers of the pool
+*/
+typedef struct timing_wheel_block_s {
+ // @brief Next block of the pool
+	struct timing_wheel_block_s *next_;
+ // @brief Timers of the block
+	TimingWheelTimer timers_[kTimingWheelBlockLength];
+} TimingWheelBlock;
+
+/**
+* @brief Structure representing a TimingWheel with variables and callbacks.
+* Every bucket is a circular list of timers around its own node, which is empty
+* when it points to itself
+*/
+typedef struct adt_timing_wheel_s {
+ // @brief Buckets of every level
+	MemoryNode buckets_[kTimingWheelLevels][kTimingWheelSlots];
+ // @brief Current tick
+	u32 now_;
+ // @brief Blocks of the pool
+	TimingWheelBlock *blocks_;
+ // @brief First free timer of the pool, chained through node_.next_
+	TimingWheelTimer *free_;
+ // @brief Current number of timers
+	u32 length_;
+ // @brief Maximum number of timers that the wheel can possibly have, cannot be 0
+	u32 capacity_;
+ // @brief Pointer to callback functions
+	struct timing_wheel_ops_s *ops_;
+} TimingWheel;
+
+/**
+* @brief Struct that contains all functions attached to the TimingWheel
+*/
+struct timing_wheel_ops_s {
+/**
+* @brief Destroys the wheel, its pool and the data of the pending timers
+* @param *TimingWheel wheel Pointer to the wheel
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullTimingWheelPointer When the wheel pointer is NULL
+*/
+	s16 (*destroy)(TimingWheel *wheel);
+
+/**
+* @brief Soft resets wheel's data, the timers' data is not freed. The pool and the current tick are kept
+* @param *TimingWheel wheel Pointer to the wheel
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullTimingWheelPointer When the wheel pointer is NULL
+*/
+	s16 (*softReset)(TimingWheel *wheel);
+
+/**
+* @brief Resets wheel's data, the timers' data is freed. The pool and the current tick are kept
+* @param *TimingWheel wheel Pointer to the wheel
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullTimingWheelPointer When the wheel pointer is NULL
+*/
+	s16 (*reset)(TimingWheel *wheel);
+
+	// State queries
+/**
+* @brief Returns the maximum number of timers that can be pending
+* @param *TimingWheel wheel Pointer to the wheel
+* @return u32 Capacity, 0 if the wheel pointer is NULL
+*/
+	u32 (*capacity)(TimingWheel *wheel);
+
+/**
+* @brief Current number of pending timers (<= capacity)
+* @param *TimingWheel wheel Pointer to the wheel
+* @return u32 Length, 0 if the wheel pointer is NULL
+*/
+	u32 (*length)(TimingWheel *wheel);
+
+/**
+* @brief Verifies if there are no pending timers
+* @param *TimingWheel wheel Pointer to the wheel
+* @return bool true if it is empty, false otherwise or if the wheel pointer is NULL
+*/
+	bool (*isEmpty)(TimingWheel *wheel);
+
+/**
+* @brief Verifies if no more timers can be scheduled
+* @param *TimingWheel wheel Pointer to the wheel
+* @return bool true if it is full, false otherwise or if the wheel pointer is NULL
+*/
+	bool (*isFull)(TimingWheel *wheel);
+
+/**
+* @brief Returns the current tick, 0 when the wheel is created
+* @param *TimingWheel wheel Pointer to the wheel
+* @return u32 Current tick, 0 if the wheel pointer is NULL
+*/
+	u32 (*now)(TimingWheel *wheel);
+
+	// Insertion
+/**
+* @brief Schedules a timer that fires delay ticks from now, O(1)
+* @param *TimingWheel wheel Pointer to the wheel
+* @param void* data pointer
+* @param u16 bytes size
+* @param u32 delay Ticks to wait, 0 fires on the next tick like 1
+* @param **TimingWheelTimer handle Where the timer is written, it may be NULL. It is
+* valid until the timer fires or is cancelled
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullTimingWheelPointer When the wheel pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the wheel is full
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for a new block of timers
+*/
+	s16 (*schedule)(TimingWheel *wheel, void *data, u16 bytes, u32 delay, TimingWheelTimer **handle);
+
+	// Extraction
+/**
+* @brief Cancels a pending timer, O(1). Its handle is no longer valid
+* @param *TimingWheel wheel Pointer to the wheel
+* @param *TimingWheelTimer handle Timer given by schedule
+* @return void* Data pointer, NULL if the wheel pointer or the handle is NULL or the timer is not pending
+*/
+	void* (*cancel)(TimingWheel *wheel, TimingWheelTimer *handle);
+
+/**
+* @brief Moves the wheel ticks ticks forward and fires every timer that comes due,
+* in order of tick. The callback gets a node with the data of the timer, which
+* belongs to it from then on; it may schedule and cancel timers
+* @param *TimingWheel wheel Pointer to the wheel
+* @param u32 ticks Ticks to move forward
+* @param callback Function called for every timer that fires, with ctx
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return u32 Timers fired, 0 if the wheel or callback pointer is NULL
+*/
+	u32 (*advance)(TimingWheel *wheel, u32 ticks, void (*callback)(MemoryNode *node, void *ctx), void *ctx);
+
+	// Miscellaneous
+/**
+* @brief Prints the features and pending timers of the wheel
+* @param *TimingWheel wheel Pointer to the wheel
+*/
+	void (*print)(TimingWheel *wheel);
+};
+
+/**
+* @brief Creates a new timing wheel at tick 0
+* @param u32 capacity Maximum number of timers that can be pending
+* @return TimingWheel* Return a wheel pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+TimingWheel* TIMINGWHEEL_create(u32 capacity);
+#endif //__ADT_TIMING_WHEEL_H__
@@ -0,0 +1,254 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Unrolled List" data type
+*
+* Linked list of chunks, each one holding up to chunk_size_ MemoryNodes side by
+* side, so walking the list touches one allocation per chunk instead of per element.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_UNROLLED_LIST_H__
+#define __ADT_UNROLLED_LIST_H__ 1
+
+#include "adt_memory_node.h"
+
+// MemoryNodes per chunk used by UNROLLEDLIST_create
+#define kUnrolledListChunkSize 16
+
+/**
+* @brief Chunk of the unrolled list. Its elements are slots_[0 .. count_ - 1]
+*/
+typedef struct unrolled_list_chunk_s {
+ // @brief Next chunk, NULL for the last one
+	struct unrolled_list_chunk_s *next_;
+ // @brief Previous chunk, NULL for the first one
+	struct unrolled_list_chunk_s *prev_;
+ // @brief Number of slots in use, a linked chunk is never empty
+	u16 count_;
+ // @brief Elements of the chunk, the list's chunk_size_ slots are allocated
+	MemoryNode slots_[];
+} UnrolledListChunk;
+
+/**
+* @brief Structure representing an UnrolledList with variables and callbacks.
+*/
+typedef struct adt_unrolled_list_s {
+ // @brief First chunk, NULL when the list is empty
+	UnrolledListChunk *head_;
+ // @brief Last chunk, NULL when the list is empty
+	UnrolledListChunk *tail_;
+ // @brief Current number of elements
+	u16 length_;
+ // @brief Maximum length that the list can possibly have, cannot be 0
+	u16 capacity_;
+ // @brief Slots of every chunk
+	u16 chunk_size_;
+ // @brief Number of chunks linked
+	u16 chunks_;
+ // @brief Pointer to callback functions
+	struct unrolled_list_ops_s *ops_;
+} UnrolledList;
+
+/**
+* @brief Struct that contains all functions attached to the UnrolledList. It has
+* the shape of struct list_ops_s without the cursor functions
+*/
+struct unrolled_list_ops_s {
+/**
+* @brief Destroys the list and its data
+* @param *UnrolledList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullUnrolledListPointer When the list pointer is NULL
+*/
+	s16 (*destroy)(UnrolledList *list);
+
+/**
+* @brief Soft resets list's data, the elements' data is not freed
+* @param *UnrolledList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullUnrolledListPointer When the list pointer is NULL
+*/
+	s16 (*softReset)(UnrolledList *list);
+
+/**
+* @brief Resets list's data
+* @param *UnrolledList list Pointer to the list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullUnrolledListPointer When the list pointer is NULL
+*/
+	s16 (*reset)(UnrolledList *list);
+
+/**
+* @brief Changes the capacity of the list. Elements over the new capacity are
+* lost from the end
+* @param *UnrolledList list Pointer to the list
+* @param u16 new_size New capacity
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullUnrolledListPointer When the list pointer is NULL
+* @return s16 kErrorCode_InvalidValue When new_size is 0
+*/
+	s16 (*resize)(UnrolledList *list, u16 new_size);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *UnrolledList list Pointer to the list
+* @return u16 Capacity, 0 if the list pointer is NULL
+*/
+	u16 (*capacity)(UnrolledList *list);
+
+/**
+* @brief Current number of elements (<= capacity)
+* @param *UnrolledList list Pointer to the list
+* @return u16 Length, 0 if the list pointer is NULL
+*/
+	u16 (*length)(UnrolledList *list);
+
+/**
+* @brief Verifies if the list is empty
+* @param *UnrolledList list Pointer to the list
+* @return bool true if it is empty, false otherwise or if the list pointer is NULL
+*/
+	bool (*isEmpty)(UnrolledList *list);
+
+/**
+* @brief Verifies if the list is full
+* @param *UnrolledList list Pointer to the list
+* @return bool true if it is full, false otherwise or if the list pointer is NULL
+*/
+	bool (*isFull)(UnrolledList *list);
+
+	// Data queries
+/**
+* @brief Returns a reference to the first element of the list
+* @param *UnrolledList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*first)(UnrolledList *list);
+
+/**
+* @brief Returns a reference to the last element of the list
+* @param *UnrolledList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*last)(UnrolledList *list);
+
+/**
+* @brief Returns a reference to the element at a given position. The walk
+* starts at the nearest end and skips whole chunks
+* @param *UnrolledList list Pointer to the list
+* @param u16 position Position of the element
+* @return void* Data pointer, NULL if the list pointer is NULL or position is out of range
+*/
+	void* (*at)(UnrolledList *list, u16 position);
+
+	// Insertion
+/**
+* @brief Inserts an element in the first position of the list
+* @param *UnrolledList list Pointer to the list
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullUnrolledListPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InvalidValue When bytes is 0
+* @return s16 kErrorCode_InsertionFailed When the list is full
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for a new chunk
+*/
+	s16 (*insertFirst)(UnrolledList *list, void *data, u16 bytes);
+
+/**
+* @brief Inserts an element in the last position of the list
+* @param *UnrolledList list Pointer to the list
+* @param void* data pointer
+* @param u16 bytes size
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertLast)(UnrolledList *list, void *data, u16 bytes);
+
+/**
+* @brief Inserts an element at the given position of the list. Only the slots
+* of one chunk move; a full chunk is split in two halves first.
+* Positions over the length insert at the end
+* @param *UnrolledList list Pointer to the list
+* @param void* data pointer
+* @param u16 bytes size
+* @param u16 position Position of the new element
+* @return s16 Same values as insertFirst
+*/
+	s16 (*insertAt)(UnrolledList *list, void *data, u16 bytes, u16 position);
+
+	// Extraction
+/**
+* @brief Extracts the first element of the list
+* @param *UnrolledList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*extractFirst)(UnrolledList *list);
+
+/**
+* @brief Extracts the last element of the list
+* @param *UnrolledList list Pointer to the list
+* @return void* Data pointer, NULL if the list pointer is NULL or the list is empty
+*/
+	void* (*extractLast)(UnrolledList *list);
+
+/**
+* @brief Extracts the element at the given position. The chunk is merged with
+* a neighbour when both fit in one
+* @param *UnrolledList list Pointer to the list
+* @param u16 position Position of the element
+* @return void* Data pointer, NULL if the list pointer is NULL or position is out of range
+*/
+	void* (*extractAt)(UnrolledList *list, u16 position);
+
+	// Miscellaneous
+/**
+* @brief Concatenates two lists, copying the data of the second one at the end of the first.
+* The capacity of the first list grows by the capacity of the second one
+* @param *UnrolledList list Pointer to the list
+* @param *UnrolledList list_src Pointer to the second list
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullUnrolledListPointer When any of the list pointers is NULL
+* @return s16 kErrorCode_NullMemoryAllocation When there's no memory for the copies
+*/
+	s16 (*concat)(UnrolledList *list, UnrolledList *list_src);
+
+/**
+* @brief Calls to a function from all elements of the list, in order
+* @param *UnrolledList list Pointer to the list
+* @param *Void Pointer to MemoryNode's callback
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullUnrolledListPointer When the list pointer is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverse)(UnrolledList *list, void (*callback)(MemoryNode *));
+
+/**
+* @brief Prints the features and content of the list
+* @param *UnrolledList list Pointer to the list
+*/
+	void (*print)(UnrolledList *list);
+};
+
+/**
+* @brief Creates a new unrolled list with kUnrolledListChunkSize slots per chunk
+* @param u16 capacity Maximum length that the list can possibly have
+* @return UnrolledList* Return a list pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+UnrolledList* UNROLLEDLIST_create(u16 capacity);
+
+/**
+* @brief Creates a new unrolled list with the given slots per chunk, e.g. the
+* MemoryNodes that fill a cache line or a page
+* @param u16 capacity Maximum length that the list can possibly have
+* @param u16 chunk_size Slots per chunk, at least 2
+* @return UnrolledList* Return a list pointer with all variables initialized
+* @return NULL If capacity is 0, chunk_size is under 2 or there's no space in memory
+*/
+UnrolledList* UNROLLEDLIST_createWithChunkSize(u16 capacity, u16 chunk_size);
+#endif //__ADT_UNROLLED_LIST_H__
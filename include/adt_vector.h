@@ -247,6 +247,34 @@ struct vector_ops_s {
 */
 	s16 (*traverse)(Vector *vector, void (*callback)(MemoryNode *));
 
+ /**
+* @brief Calls a function on the elements of the vector, from the first to the last, handing it ctx,
+* until it returns kTraverse_Stop
+* @param *Vector vector Pointer to the vector
+* @param callback Function that returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullVectorPointer When the vector pointer is NULL
+* @return s16 kErrorCode_NullMemoryNode When the storage is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseEx)(Vector *vector, s16 (*callback)(MemoryNode *node, void *ctx), void *ctx);
+
+ /**
+* @brief Like traverseEx, but hands the callback spans of up to kTraverseBatchLength
+* nodes in the same order, so the cost of a call is shared by the whole span.
+* The vector must not change while the callback runs
+* @param *Vector vector Pointer to the vector
+* @param callback Function that gets the nodes of a span and their count, and
+* returns kTraverse_Continue or kTraverse_Stop
+* @param void* ctx Pointer handed to every call of the callback, it may be NULL
+* @return s16 kErrorCode_Ok When the function has exited successfully, stopped or not
+* @return s16 kErrorCode_NullVectorPointer When the vector pointer is NULL
+* @return s16 kErrorCode_NullMemoryNode When the storage is NULL
+* @return s16 kErrorCode_NullPointer When the callback is NULL
+*/
+	s16 (*traverseBatch)(Vector *vector, s16 (*callback)(MemoryNode **nodes, u16 count, void *ctx), void *ctx);
+
  /**
 * @brief Prints the features and content of the vector
 * @param *Vector vector Pointer to the vector
@@ -0,0 +1,125 @@
+/**********************************************************************************
+* Copyright ***. All rights reserved.
+*
+* Contains all essential declaration functions required for the "Work-Stealing Deque" data type
+*
+* Chase-Lev deque: the thread that owns it pushes and pops at the bottom with no
+* lock, and any other thread steals from the top with a compare-and-swap. The
+* elements live in a circular array whose capacity is a power of two.
+*
+* Code by Yossef Rubalcava & Davide Pietro
+* Code Maintained by Yossef R.
+**********************************************************************************/
+
+#ifndef __ADT_WORK_STEALING_DEQUE_H__
+#define __ADT_WORK_STEALING_DEQUE_H__ 1
+
+#include "adt_memory_node.h"
+
+// Largest power of two a u16 capacity can hold
+#define kWorkStealingDequeMaxCapacity 32768
+
+/**
+* @brief Structure representing a WorkStealingDeque with variables and callbacks.
+* top_ and bottom_ only grow, the slot of an index is index & mask_
+*/
+typedef struct adt_work_stealing_deque_s {
+ // @brief Circular array of data pointers, mask_ + 1 entries
+	void* volatile *slots_;
+ // @brief Capacity minus one
+	u32 mask_;
+ // @brief Index of the oldest element, moved by the thieves and by the last pop
+	volatile u32 top_;
+ // @brief Index after the newest element, only written by the owner
+	volatile u32 bottom_;
+ // @brief Pointer to callback functions
+	struct work_stealing_deque_ops_s *ops_;
+} WorkStealingDeque;
+
+/**
+* @brief Struct that contains all functions attached to the WorkStealingDeque.
+* push and pop may only be called by the owner thread, steal by any thread. Only
+* the data pointer of an element is kept
+*/
+struct work_stealing_deque_ops_s {
+/**
+* @brief Destroys the deque, the data of its elements is not freed. No other thread may be using it
+* @param *WorkStealingDeque deque Pointer to the deque
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+*/
+	s16 (*destroy)(WorkStealingDeque *deque);
+
+	// State queries
+/**
+* @brief Returns the maximum number of elements that can be stored
+* @param *WorkStealingDeque deque Pointer to the deque
+* @return u16 Capacity, 0 if the deque pointer is NULL
+*/
+	u16 (*capacity)(WorkStealingDeque *deque);
+
+/**
+* @brief Current number of elements, it may be out of date as soon as it is read
+* @param *WorkStealingDeque deque Pointer to the deque
+* @return u16 Length, 0 if the deque pointer is NULL
+*/
+	u16 (*length)(WorkStealingDeque *deque);
+
+/**
+* @brief Verifies if the deque is empty
+* @param *WorkStealingDeque deque Pointer to the deque
+* @return bool true if it is empty, false otherwise or if the deque pointer is NULL
+*/
+	bool (*isEmpty)(WorkStealingDeque *deque);
+
+/**
+* @brief Verifies if the deque is full
+* @param *WorkStealingDeque deque Pointer to the deque
+* @return bool true if it is full, false otherwise or if the deque pointer is NULL
+*/
+	bool (*isFull)(WorkStealingDeque *deque);
+
+	// Insertion
+/**
+* @brief Inserts an element at the bottom. Owner thread only
+* @param *WorkStealingDeque deque Pointer to the deque
+* @param void* data pointer
+* @return s16 kErrorCode_Ok When the function has exited successfully
+* @return s16 kErrorCode_NullDequePointer When the deque pointer is NULL
+* @return s16 kErrorCode_NullPointer When the data pointer is NULL
+* @return s16 kErrorCode_InsertionFailed When the deque is full
+*/
+	s16 (*push)(WorkStealingDeque *deque, void *data);
+
+	// Extraction
+/**
+* @brief Extracts the newest element, from the bottom. Owner thread only
+* @param *WorkStealingDeque deque Pointer to the deque
+* @return void* Data pointer, NULL if the deque pointer is NULL, the deque is empty or a thief took the last element
+*/
+	void* (*pop)(WorkStealingDeque *deque);
+
+/**
+* @brief Extracts the oldest element, from the top. Any thread
+* @param *WorkStealingDeque deque Pointer to the deque
+* @return void* Data pointer, NULL if the deque pointer is NULL, the deque is empty or another thread took the element first
+*/
+	void* (*steal)(WorkStealingDeque *deque);
+
+	// Miscellaneous
+/**
+* @brief Prints the features and content of the deque. No other thread may be using it
+* @param *WorkStealingDeque deque Pointer to the deque
+*/
+	void (*print)(WorkStealingDeque *deque);
+};
+
+/**
+* @brief Creates a new work-stealing deque owned by the calling thread
+* @param u16 capacity Maximum length that the deque can possibly have, rounded up to a power of two
+* no greater than kWorkStealingDequeMaxCapacity
+* @return WorkStealingDeque* Return a deque pointer with all variables initialized
+* @return NULL If capacity parameter is 0 or there's no space in memory
+*/
+WorkStealingDeque* WORKSTEALINGDEQUE_create(u16 capacity);
+#endif //__ADT_WORK_STEALING_DEQUE_H__
@@ -0,0 +1,411 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_atomic.h"
+#include "adt_blocking_queue.h"
+
+#ifndef _WIN32
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//BlockingQueue Declarations
+static s16 BLOCKINGQUEUE_destroy(BlockingQueue* queue);
+static u16 BLOCKINGQUEUE_capacity(BlockingQueue* queue);
+static u16 BLOCKINGQUEUE_length(BlockingQueue* queue);
+static bool BLOCKINGQUEUE_isEmpty(BlockingQueue* queue);
+static bool BLOCKINGQUEUE_isFull(BlockingQueue* queue);
+static bool BLOCKINGQUEUE_isClosed(BlockingQueue* queue);
+static s16 BLOCKINGQUEUE_setSpins(BlockingQueue* queue, u32 spins);
+static s16 BLOCKINGQUEUE_enqueueWait(BlockingQueue* queue, void* data, u16 bytes);
+static s16 BLOCKINGQUEUE_tryEnqueue(BlockingQueue* queue, void* data, u16 bytes);
+static void* BLOCKINGQUEUE_dequeueWait(BlockingQueue* queue, u32 timeout);
+static u16 BLOCKINGQUEUE_drain(BlockingQueue* queue, void** out, u16 max, u32 timeout);
+static s16 BLOCKINGQUEUE_close(BlockingQueue* queue);
+static void BLOCKINGQUEUE_print(BlockingQueue* queue);
+
+struct blocking_queue_ops_s blocking_queue_ops = { .destroy = BLOCKINGQUEUE_destroy,
+													.capacity = BLOCKINGQUEUE_capacity,
+													.length = BLOCKINGQUEUE_length,
+													.isEmpty = BLOCKINGQUEUE_isEmpty,
+													.isFull = BLOCKINGQUEUE_isFull,
+													.isClosed = BLOCKINGQUEUE_isClosed,
+													.setSpins = BLOCKINGQUEUE_setSpins,
+													.enqueueWait = BLOCKINGQUEUE_enqueueWait,
+													.tryEnqueue = BLOCKINGQUEUE_tryEnqueue,
+													.dequeueWait = BLOCKINGQUEUE_dequeueWait,
+													.drain = BLOCKINGQUEUE_drain,
+													.close = BLOCKINGQUEUE_close,
+													.print = BLOCKINGQUEUE_print
+};
+
+// Moment a timed wait gives up
+#ifdef _WIN32
+typedef ULONGLONG BlockingQueueDeadline;
+#else
+typedef struct timespec BlockingQueueDeadline;
+// Clock of the condition variables, macOS only has the wall clock
+#ifdef __APPLE__
+#define BLOCKINGQUEUE_CLOCK CLOCK_REALTIME
+#else
+#define BLOCKINGQUEUE_CLOCK CLOCK_MONOTONIC
+#endif
+#endif
+
+static void BLOCKINGQUEUE_lock(BlockingQueue* queue) {
+#ifdef _WIN32
+	AcquireSRWLockExclusive(&queue->lock_);
+#else
+	pthread_mutex_lock(&queue->lock_);
+#endif
+}
+
+static void BLOCKINGQUEUE_unlock(BlockingQueue* queue) {
+#ifdef _WIN32
+	ReleaseSRWLockExclusive(&queue->lock_);
+#else
+	pthread_mutex_unlock(&queue->lock_);
+#endif
+}
+
+#ifdef _WIN32
+static void BLOCKINGQUEUE_wake(CONDITION_VARIABLE* condition, bool all) {
+	if (all) {
+		WakeAllConditionVariable(condition);
+	}
+	else {
+		WakeConditionVariable(condition);
+	}
+}
+#else
+static void BLOCKINGQUEUE_wake(pthread_cond_t* condition, bool all) {
+	if (all) {
+		pthread_cond_broadcast(condition);
+	}
+	else {
+		pthread_cond_signal(condition);
+	}
+}
+#endif
+
+// Computes the moment timeout milliseconds from now
+static void BLOCKINGQUEUE_deadline(u32 timeout, BlockingQueueDeadline* deadline) {
+#ifdef _WIN32
+	*deadline = GetTickCount64() + timeout;
+#else
+	clock_gettime(BLOCKINGQUEUE_CLOCK, deadline);
+	deadline->tv_sec += timeout / 1000;
+	deadline->tv_nsec += (long)(timeout % 1000) * 1000000;
+	if (deadline->tv_nsec >= 1000000000) {
+		deadline->tv_sec++;
+		deadline->tv_nsec -= 1000000000;
+	}
+#endif
+}
+
+// Sleeps on condition with the lock held until it is woken up or the deadline
+// passes. Returns false once the deadline has passed
+#ifdef _WIN32
+static bool BLOCKINGQUEUE_sleep(BlockingQueue* queue, CONDITION_VARIABLE* condition, u32 timeout, const BlockingQueueDeadline* deadline) {
+	if (kBlockingQueueWaitForever == timeout) {
+		SleepConditionVariableSRW(condition, &queue->lock_, INFINITE, 0);
+		return true;
+	}
+	ULONGLONG now = GetTickCount64();
+	if (now >= *deadline) {
+		return false;
+	}
+	SleepConditionVariableSRW(condition, &queue->lock_, (DWORD)(*deadline - now), 0);
+	return true;
+}
+#else
+static bool BLOCKINGQUEUE_sleep(BlockingQueue* queue, pthread_cond_t* condition, u32 timeout, const BlockingQueueDeadline* deadline) {
+	if (kBlockingQueueWaitForever == timeout) {
+		pthread_cond_wait(condition, &queue->lock_);
+		return true;
+	}
+	return ETIMEDOUT != pthread_cond_timedwait(condition, &queue->lock_, deadline);
+}
+#endif
+
+// Spins a new queue starts with: none on a single processor, where the other
+// side can't run while this thread spins
+static u32 BLOCKINGQUEUE_defaultSpins() {
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors > 1 ? kBlockingQueueDefaultSpins : 0;
+#else
+	return sysconf(_SC_NPROCESSORS_ONLN) > 1 ? kBlockingQueueDefaultSpins : 0;
+#endif
+}
+
+// Checks length_ up to spins_ times while it stays at busy_length, so a thread
+// the other side is about to serve doesn't pay for going to sleep
+static void BLOCKINGQUEUE_spin(BlockingQueue* queue, u32 busy_length) {
+	for (u32 i = 0; i < queue->spins_; ++i) {
+		if (ATOMIC_loadU32(&queue->length_) != busy_length || ATOMIC_loadU32(&queue->closed_)) {
+			return;
+		}
+#ifdef _WIN32
+		YieldProcessor();
+#elif defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#endif
+	}
+}
+
+// Waits with the lock held while the queue is empty and open. Returns false if
+// it is still empty when the time runs out or the queue is closed
+static bool BLOCKINGQUEUE_waitElement(BlockingQueue* queue, u32 timeout) {
+	BlockingQueueDeadline deadline;
+	if (0 != timeout && kBlockingQueueWaitForever != timeout) {
+		BLOCKINGQUEUE_deadline(timeout, &deadline);
+	}
+	while (0 == queue->length_ && !queue->closed_ && 0 != timeout) {
+		queue->consumers_waiting_++;
+		bool in_time = BLOCKINGQUEUE_sleep(queue, &queue->not_empty_, timeout, &deadline);
+		queue->consumers_waiting_--;
+		if (!in_time) {
+			break;
+		}
+	}
+	return 0 != queue->length_;
+}
+
+// Enqueues with the lock held and wakes up a sleeping consumer
+static s16 BLOCKINGQUEUE_push(BlockingQueue* queue, void* data, u16 bytes) {
+	s16 error_type = queue->queue_->ops_->enqueue(queue->queue_, data, bytes);
+	if (kErrorCode_Ok != error_type) {
+		return error_type;
+	}
+	ATOMIC_addU32(&queue->length_, 1);
+	if (0 != queue->consumers_waiting_) {
+		BLOCKINGQUEUE_wake(&queue->not_empty_, false);
+	}
+	return kErrorCode_Ok;
+}
+
+// Dequeues up to max elements with the lock held and wakes up as many sleeping producers
+static u16 BLOCKINGQUEUE_pop(BlockingQueue* queue, void** out, u16 max) {
+	u16 count = queue->queue_->ops_->dequeueMany(queue->queue_, out, NULL, max);
+	ATOMIC_addU32(&queue->length_, -(s32)count);
+	if (0 != count && 0 != queue->producers_waiting_) {
+		BLOCKINGQUEUE_wake(&queue->not_full_, count > 1);
+	}
+	return count;
+}
+
+BlockingQueue* BLOCKINGQUEUE_create(u16 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	BlockingQueue* queue = (BlockingQueue*)MM->malloc(sizeof(BlockingQueue));
+	if (NULL == queue) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	// the ring buffer is allocated once, enqueue and dequeue never call MM under the lock
+	queue->queue_ = QUEUE_createWithStorage(capacity, kQueueStorage_Ring);
+	if (NULL == queue->queue_) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		MM->free(queue);
+		return NULL;
+	}
+#ifdef _WIN32
+	InitializeSRWLock(&queue->lock_);
+	InitializeConditionVariable(&queue->not_empty_);
+	InitializeConditionVariable(&queue->not_full_);
+#else
+	pthread_condattr_t attributes;
+	pthread_condattr_init(&attributes);
+#ifndef __APPLE__
+	pthread_condattr_setclock(&attributes, BLOCKINGQUEUE_CLOCK);
+#endif
+	pthread_mutex_init(&queue->lock_, NULL);
+	pthread_cond_init(&queue->not_empty_, &attributes);
+	pthread_cond_init(&queue->not_full_, &attributes);
+	pthread_condattr_destroy(&attributes);
+#endif
+	queue->length_ = 0;
+	queue->closed_ = 0;
+	queue->consumers_waiting_ = 0;
+	queue->producers_waiting_ = 0;
+	queue->spins_ = BLOCKINGQUEUE_defaultSpins();
+	queue->ops_ = &blocking_queue_ops;
+	return queue;
+}
+
+s16 BLOCKINGQUEUE_destroy(BlockingQueue* queue) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	queue->queue_->ops_->destroy(queue->queue_);
+#ifndef _WIN32
+	pthread_cond_destroy(&queue->not_full_);
+	pthread_cond_destroy(&queue->not_empty_);
+	pthread_mutex_destroy(&queue->lock_);
+#endif
+	MM->free(queue);
+	return kErrorCode_Ok;
+}
+
+u16 BLOCKINGQUEUE_capacity(BlockingQueue* queue) {
+	if (NULL == queue) {
+		return 0;
+	}
+	// the capacity never changes, no lock needed
+	return queue->queue_->ops_->capacity(queue->queue_);
+}
+
+u16 BLOCKINGQUEUE_length(BlockingQueue* queue) {
+	if (NULL == queue) {
+		return 0;
+	}
+	return (u16)ATOMIC_loadU32(&queue->length_);
+}
+
+bool BLOCKINGQUEUE_isEmpty(BlockingQueue* queue) {
+	if (NULL == queue) {
+		return false;
+	}
+	return 0 == BLOCKINGQUEUE_length(queue);
+}
+
+bool BLOCKINGQUEUE_isFull(BlockingQueue* queue) {
+	if (NULL == queue) {
+		return false;
+	}
+	return BLOCKINGQUEUE_length(queue) >= BLOCKINGQUEUE_capacity(queue);
+}
+
+bool BLOCKINGQUEUE_isClosed(BlockingQueue* queue) {
+	if (NULL == queue) {
+		return false;
+	}
+	return 0 != ATOMIC_loadU32(&queue->closed_);
+}
+
+s16 BLOCKINGQUEUE_setSpins(BlockingQueue* queue, u32 spins) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	queue->spins_ = spins;
+	return kErrorCode_Ok;
+}
+
+s16 BLOCKINGQUEUE_enqueueWait(BlockingQueue* queue, void* data, u16 bytes) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	u16 capacity = BLOCKINGQUEUE_capacity(queue);
+	BLOCKINGQUEUE_spin(queue, capacity);
+	BLOCKINGQUEUE_lock(queue);
+	while (queue->length_ >= capacity && !queue->closed_) {
+		queue->producers_waiting_++;
+		BLOCKINGQUEUE_sleep(queue, &queue->not_full_, kBlockingQueueWaitForever, NULL);
+		queue->producers_waiting_--;
+	}
+	s16 error_type = kErrorCode_QueueClosed;
+	if (!queue->closed_) {
+		error_type = BLOCKINGQUEUE_push(queue, data, bytes);
+	}
+	BLOCKINGQUEUE_unlock(queue);
+	return error_type;
+}
+
+s16 BLOCKINGQUEUE_tryEnqueue(BlockingQueue* queue, void* data, u16 bytes) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	s16 error_type = kErrorCode_QueueClosed;
+	BLOCKINGQUEUE_lock(queue);
+	if (!queue->closed_) {
+		error_type = BLOCKINGQUEUE_push(queue, data, bytes);
+	}
+	BLOCKINGQUEUE_unlock(queue);
+	return error_type;
+}
+
+void* BLOCKINGQUEUE_dequeueWait(BlockingQueue* queue, u32 timeout) {
+	if (NULL == queue) {
+		return NULL;
+	}
+	void* data = NULL;
+	if (0 != timeout) {
+		BLOCKINGQUEUE_spin(queue, 0);
+	}
+	BLOCKINGQUEUE_lock(queue);
+	if (BLOCKINGQUEUE_waitElement(queue, timeout)) {
+		BLOCKINGQUEUE_pop(queue, &data, 1);
+	}
+	BLOCKINGQUEUE_unlock(queue);
+	return data;
+}
+
+u16 BLOCKINGQUEUE_drain(BlockingQueue* queue, void** out, u16 max, u32 timeout) {
+	if (NULL == queue) {
+		return 0;
+	}
+	if (NULL == out) {
+		return 0;
+	}
+	if (0 == max) {
+		return 0;
+	}
+	u16 count = 0;
+	if (0 != timeout) {
+		BLOCKINGQUEUE_spin(queue, 0);
+	}
+	BLOCKINGQUEUE_lock(queue);
+	if (BLOCKINGQUEUE_waitElement(queue, timeout)) {
+		count = BLOCKINGQUEUE_pop(queue, out, max);
+	}
+	BLOCKINGQUEUE_unlock(queue);
+	return count;
+}
+
+s16 BLOCKINGQUEUE_close(BlockingQueue* queue) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	BLOCKINGQUEUE_lock(queue);
+	ATOMIC_storeU32(&queue->closed_, 1);
+	BLOCKINGQUEUE_wake(&queue->not_empty_, true);
+	BLOCKINGQUEUE_wake(&queue->not_full_, true);
+	BLOCKINGQUEUE_unlock(queue);
+	return kErrorCode_Ok;
+}
+
+void BLOCKINGQUEUE_print(BlockingQueue* queue) {
+	printf("	[BlockingQueue Info] Address: ");
+	if (NULL == queue) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", queue);
+	printf("	[BlockingQueue Info] Length: %u\n", queue->length_);
+	printf("	[BlockingQueue Info] Closed: %s\n", queue->closed_ ? "yes" : "no");
+	printf("	[BlockingQueue Info] Spins before sleeping: %u\n", queue->spins_);
+	queue->queue_->ops_->print(queue->queue_);
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "common_def.h"
 #include "adt_circular_vector.h"
@@ -8,28 +9,35 @@
 #include "ABGS_MemoryManager/abgs_memory_manager.h"
 
 //CircularVector Declarations
-static s16 CIRCULAR_VECTOR_destroy(CircularVector* vector);            
-static s16 CIRCULAR_VECTOR_softReset(CircularVector* vector);          
-static s16 CIRCULAR_VECTOR_reset(CircularVector* vector);              
-static s16 CIRCULAR_VECTOR_resize(CircularVector* vector, u16 new_size)
-static s16 CIRCULAR_VECTOR_capacity(CircularVector* vector);           
-static s16 CIRCULAR_VECTOR_length(CircularVector* vector);             
+static s16 CIRCULAR_VECTOR_destroy(CircularVector* vector);
+static s16 CIRCULAR_VECTOR_softReset(CircularVector* vector);
+static s16 CIRCULAR_VECTOR_reset(CircularVector* vector);
+static s16 CIRCULAR_VECTOR_resize(CircularVector* vector, u16 new_size);
+static u16 CIRCULAR_VECTOR_capacity(CircularVector* vector);
+static u16 CIRCULAR_VECTOR_length(CircularVector* vector);
 static bool CIRCULAR_VECTOR_isEmpty(CircularVector* vector);
 static bool CIRCULAR_VECTOR_isFull(CircularVector* vector);
 static void* CIRCULAR_VECTOR_first(CircularVector* vector);
-static void* CIRCULAR_VECTOR_last(CircularVector* vector); 
-static void* CIRCULAR_VECTOR_at(CircularVector* vector, u16 position);   
-static s16 CIRCULAR_VECTOR_insertFirst(CircularVector* vector, void* data, u16 bytes);           
-static s16 CIRCULAR_VECTOR_insertLast(CircularVector* vector, void* data, u16 bytes);            
+static void* CIRCULAR_VECTOR_last(CircularVector* vector);
+static void* CIRCULAR_VECTOR_at(CircularVector* vector, u16 position);
+static s16 CIRCULAR_VECTOR_insertFirst(CircularVector* vector, void* data, u16 bytes);
+static s16 CIRCULAR_VECTOR_insertLast(CircularVector* vector, void* data, u16 bytes);
 static s16 CIRCULAR_VECTOR_insertAt(CircularVector* vector, void* data, u16 bytes, u16 position);
-static void* CIRCULAR_VECTOR_extractFirst(CircularVector* vector);             
-static void* CIRCULAR_VECTOR_extractLast(CircularVector* vector);              
-static void* CIRCULAR_VECTOR_extractAt(CircularVector* vector, u16 position);  
-static s16 CIRCULAR_VECTOR_concat(CircularVector* vector, CircularVector* vector_src); 
-static s16 CIRCULAR_VECTOR_traverse(CircularVector* vector, void(*callback)(MemoryNode*)); 
+static void* CIRCULAR_VECTOR_extractFirst(CircularVector* vector);
+static void* CIRCULAR_VECTOR_extractLast(CircularVector* vector);
+static void* CIRCULAR_VECTOR_extractAt(CircularVector* vector, u16 position);
+static s16 CIRCULAR_VECTOR_concat(CircularVector* vector, CircularVector* vector_src);
+static s16 CIRCULAR_VECTOR_traverse(CircularVector* vector, void(*callback)(MemoryNode*));
+static s16 CIRCULAR_VECTOR_traverseEx(CircularVector* vector, s16(*callback)(MemoryNode*, void*), void* ctx);
+static s16 CIRCULAR_VECTOR_traverseBatch(CircularVector* vector, s16(*callback)(MemoryNode**, u16, void*), void* ctx);
 static void CIRCULAR_VECTOR_print(CircularVector* vector);
+static u16 CIRCULAR_VECTOR_pushMany(CircularVector* vector, MemoryNode* src, u16 count);
+static u16 CIRCULAR_VECTOR_popMany(CircularVector* vector, MemoryNode* dst, u16 max);
+static s16 CIRCULAR_VECTOR_insertLastEvict(CircularVector* vector, void* data, u16 bytes, MemoryNode* evicted);
+static s16 CIRCULAR_VECTOR_iteratorBegin(CircularVector* vector, CircularVectorIterator* iterator);
+static MemoryNode* CIRCULAR_VECTOR_iteratorNext(CircularVectorIterator* iterator);
 
-struct circular_vector_ops_s vector_ops = { .destroy = CIRCULAR_VECTOR_destroy,
+struct circular_vector_ops_s circular_vector_ops = { .destroy = CIRCULAR_VECTOR_destroy,
 								  .softReset = CIRCULAR_VECTOR_softReset,
 								  .reset = CIRCULAR_VECTOR_reset,
 								  .resize = CIRCULAR_VECTOR_resize,
@@ -48,15 +56,31 @@ struct circular_vector_ops_s vector_ops = { .destroy = CIRCULAR_VECTOR_destroy,
 								  .extractAt = CIRCULAR_VECTOR_extractAt,
 								  .concat = CIRCULAR_VECTOR_concat,
 								  .traverse = CIRCULAR_VECTOR_traverse,
-								  .print = CIRCULAR_VECTOR_print
+								  .traverseEx = CIRCULAR_VECTOR_traverseEx,
+								  .traverseBatch = CIRCULAR_VECTOR_traverseBatch,
+								  .print = CIRCULAR_VECTOR_print,
+								  .pushMany = CIRCULAR_VECTOR_pushMany,
+								  .popMany = CIRCULAR_VECTOR_popMany,
+								  .insertLastEvict = CIRCULAR_VECTOR_insertLastEvict,
+								  .iteratorBegin = CIRCULAR_VECTOR_iteratorBegin,
+								  .iteratorNext = CIRCULAR_VECTOR_iteratorNext
 
 };
 
+// Translates a logical position (0 = head_) into a slot of the storage
+static u16 CIRCULAR_VECTOR_slot(CircularVector* vector, u16 position) {
+	return (u16)(((u32)vector->head_ + position) % vector->capacity_);
+}
+
 CircularVector* CIRCULAR_VECTOR_create(u16 capacity) {
+	return CIRCULAR_VECTOR_createWithMode(capacity, kCircularVectorMode_Bounded);
+}
+
+CircularVector* CIRCULAR_VECTOR_createWithMode(u16 capacity, CircularVectorMode mode) {
 	if (capacity == 0) {
 		return NULL;
 	}
- CircularVector* new_vector = (CircularVector*)MM->malloc(sizeof(CircularVector));
+	CircularVector* new_vector = (CircularVector*)MM->malloc(sizeof(CircularVector));
 	if (NULL == new_vector) {
 #ifdef VERBOSE_
 		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
@@ -68,14 +92,17 @@ CircularVector* CIRCULAR_VECTOR_create(u16 capacity) {
 #ifdef VERBOSE_
 		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
 #endif
-  MM->free(new_vector);
+		MM->free(new_vector);
 		return NULL;
 	}
 	new_vector->storage_ = node;
 	new_vector->head_ = 0;
 	new_vector->tail_ = 0;
+	new_vector->length_ = 0;
 	new_vector->capacity_ = capacity;
-	new_vector->ops_ = &vector_ops;
+	new_vector->mode_ = mode;
+	new_vector->evictions_ = 0;
+	new_vector->ops_ = &circular_vector_ops;
 	for (u16 i = 0; i < capacity; ++i) {
 		MEMNODE_createLite(&new_vector->storage_[i]);
 	}
@@ -86,15 +113,13 @@ s16 CIRCULAR_VECTOR_destroy(CircularVector* vector) {
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-
-	if (vector->storage_ == NULL) {
-		return kErrorCode_NullMemoryNode;
-	}
-	for (u16 i = 0; i < CIRCULAR_VECTOR_capacity(vector); ++i) {
-		vector->storage_->ops_->reset(&vector->storage_[i]);
+	if (vector->storage_ != NULL) {
+		for (u16 i = 0; i < vector->length_; ++i) {
+			u16 slot = CIRCULAR_VECTOR_slot(vector, i);
+			vector->storage_[slot].ops_->reset(&vector->storage_[slot]);
+		}
+		MM->free(vector->storage_);
 	}
-
-	MM->free(vector->storage_);
 	MM->free(vector);
 
 	return kErrorCode_Ok;
@@ -104,33 +129,39 @@ s16 CIRCULAR_VECTOR_softReset(CircularVector* vector) {
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-	if (vector->storage_) {
+	if (vector->storage_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-	for (u16 i = 0; i < vector->ops_->length(vector); ++i) {
-		vector->storage_[i].ops_->softReset(&vector->storage_[i]);
+	for (u16 i = 0; i < vector->length_; ++i) {
+		u16 slot = CIRCULAR_VECTOR_slot(vector, i);
+		vector->storage_[slot].ops_->softReset(&vector->storage_[slot]);
 	}
+	vector->head_ = 0;
+	vector->tail_ = 0;
+	vector->length_ = 0;
 	return kErrorCode_Ok;
 }
 
-u16 CIRCULAR_VECTOR_reset(CircularVector* vector) {
+s16 CIRCULAR_VECTOR_reset(CircularVector* vector) {
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
 	if (vector->storage_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-	for (u16 i = 0; i < vector->tail_; ++i) {
-		vector->storage_[i].ops_->softReset(&vector->storage_[i]);
+	for (u16 i = 0; i < vector->length_; ++i) {
+		u16 slot = CIRCULAR_VECTOR_slot(vector, i);
+		vector->storage_[slot].ops_->reset(&vector->storage_[slot]);
 	}
+	vector->head_ = 0;
 	vector->tail_ = 0;
+	vector->length_ = 0;
 
 	return kErrorCode_Ok;
 }
 
-/* START DIABOLIK DEVELOPMENT */
 s16 CIRCULAR_VECTOR_resize(CircularVector* vector, u16 new_size) {
-  // parameter control
+	// parameter control
 	if (NULL == vector) {
 		return kErrorCode_NullVectorPointer;
 	}
@@ -140,60 +171,71 @@ s16 CIRCULAR_VECTOR_resize(CircularVector* vector, u16 new_size) {
 	if (0 == new_size) {
 		return kErrorCode_InvalidValue;
 	}
- // new node and reserved memory check
- MemoryNode* node = (MemoryNode*)MM->malloc(sizeof(MemoryNode) * new_size);
- if (node == NULL) {
+	if (new_size == vector->capacity_) {
+		return kErrorCode_Ok;
+	}
+	// new node and reserved memory check
+	MemoryNode* node = (MemoryNode*)MM->malloc(sizeof(MemoryNode) * new_size);
+	if (node == NULL) {
 #ifdef VERBOSE_
-   printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
 #endif
-   return kErrorCode_NullMemoryAllocation;
-}
- //data copied to the new node
- for (u16 i = 0; i < new_size; ++i) {
-   if (i < vector->ops_->length(vector)) {
-     *(node + i) = vector->storage_[i];
-   }
-   else {
-     MEMNODE_createLite(&*(node + i));
-   }
- }
- // free excess data
- if (vector->ops_->length(vector) > new_size) {
-   for (u16 i = new_size; i < vector->ops_->length(vector); ++i) {
-     vector->storage_[i].ops_->reset(&vector->storage_[i]);
-   }
-   vector->tail_ = new_size;
- }
-
- vector->capacity_ = new_size;
- MM->free(vector->storage_);
- vector->storage_ = node;
- return kErrorCode_Ok;
+		return kErrorCode_NullMemoryAllocation;
+	}
+	// data copied to the new node, unrolling the ring so head_ starts at 0
+	u16 new_length = vector->length_ < new_size ? vector->length_ : new_size;
+	for (u16 i = 0; i < new_size; ++i) {
+		if (i < new_length) {
+			*(node + i) = vector->storage_[CIRCULAR_VECTOR_slot(vector, i)];
+		}
+		else {
+			MEMNODE_createLite(&*(node + i));
+		}
+	}
+	// free excess data
+	for (u16 i = new_length; i < vector->length_; ++i) {
+		u16 slot = CIRCULAR_VECTOR_slot(vector, i);
+		vector->storage_[slot].ops_->reset(&vector->storage_[slot]);
+	}
+
+	MM->free(vector->storage_);
+	vector->storage_ = node;
+	vector->capacity_ = new_size;
+	vector->length_ = new_length;
+	vector->head_ = 0;
+	vector->tail_ = new_length % new_size;
+	return kErrorCode_Ok;
 }
 
-s16 CIRCULAR_VECTOR_capacity(CircularVector* vector) {
+u16 CIRCULAR_VECTOR_capacity(CircularVector* vector) {
 	if (NULL == vector) {
-		return kErrorCode_NullVectorPointer;
+		return 0;
 	}
 	return vector->capacity_;
 }
 
-s16 CIRCULAR_VECTOR_length(CircularVector* vector) {
+u16 CIRCULAR_VECTOR_length(CircularVector* vector) {
 	if (NULL == vector) {
-		return kErrorCode_NullVectorPointer;
+		return 0;
 	}
-	return vector->tail_;
+	return vector->length_;
 }
 
 bool CIRCULAR_VECTOR_isEmpty(CircularVector* vector) {
 	if (vector != NULL) {
-		return vector->tail_ == 0;
+		return vector->length_ == 0;
+	}
+	else {
+		return false;
 	}
 }
 
 bool CIRCULAR_VECTOR_isFull(CircularVector* vector) {
 	if (NULL != vector) {
-		return CIRCULAR_VECTOR_capacity(vector) == CIRCULAR_VECTOR_length(vector);
+		return vector->length_ == vector->capacity_;
+	}
+	else {
+		return false;
 	}
 }
 //////////////////////////////
@@ -204,10 +246,10 @@ void* CIRCULAR_VECTOR_first(CircularVector* vector) {
 	if (vector->storage_ == NULL) {
 		return NULL;
 	}
-	if (vector->storage_[0].ops_->data(&vector->storage_[0]) == NULL) {
+	if (vector->ops_->isEmpty(vector)) {
 		return NULL;
 	}
-	return vector->storage_[0].ops_->data(&vector->storage_[0]);
+	return vector->storage_[vector->head_].ops_->data(&vector->storage_[vector->head_]);
 }
 
 void* CIRCULAR_VECTOR_last(CircularVector* vector) {
@@ -217,15 +259,11 @@ void* CIRCULAR_VECTOR_last(CircularVector* vector) {
 	if (vector->storage_ == NULL) {
 		return NULL;
 	}
-	if (VECTOR_length(vector) < 1) {
-		return NULL;
-	}
-	u16 i = CIRCULAR_VECTOR_length(vector) - 1;
-	if (vector->storage_[i].ops_->data(&vector->storage_[i]) == NULL) {
+	if (vector->ops_->isEmpty(vector)) {
 		return NULL;
 	}
-	return vector->storage_[i].ops_->data(&vector->storage_[i]);
-
+	u16 slot = CIRCULAR_VECTOR_slot(vector, vector->length_ - 1);
+	return vector->storage_[slot].ops_->data(&vector->storage_[slot]);
 }
 
 void* CIRCULAR_VECTOR_at(CircularVector* vector, u16 position) {
@@ -235,20 +273,18 @@ void* CIRCULAR_VECTOR_at(CircularVector* vector, u16 position) {
 	if (vector->storage_ == NULL) {
 		return NULL;
 	}
-	if (vector->storage_[position].ops_->data(&vector->storage_[position]) == NULL) {
-		return NULL;
-	}
-	if (position >= CIRCULAR_VECTOR_length(vector)) {
+	if (position >= vector->length_) {
 		return NULL;
 	}
-	return vector->storage_[position].ops_->data(&vector->storage_[position]);
+	u16 slot = CIRCULAR_VECTOR_slot(vector, position);
+	return vector->storage_[slot].ops_->data(&vector->storage_[slot]);
 }
 
 s16 CIRCULAR_VECTOR_insertFirst(CircularVector* vector, void* data, u16 bytes) {
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-	if (CIRCULAR_VECTOR_isFull(vector)) {
+	if (vector->ops_->isFull(vector)) {
 		return kErrorCode_InsertionFailed;
 	}
 	if (data == NULL) {
@@ -257,16 +293,10 @@ s16 CIRCULAR_VECTOR_insertFirst(CircularVector* vector, void* data, u16 bytes) {
 	if (vector->storage_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-
-	for (u16 i = CIRCULAR_VECTOR_length(vector); i > 0; --i) {
-		vector->storage_[i].ops_->setData(&vector->storage_[i],
-			vector->storage_[i - 1].data_,
-			vector->storage_[i - 1].size_);
-
-	}
-	vector->storage_[0].ops_->setData(&vector->storage_[0], data, bytes);
-
-	vector->tail_++;
+	// the head moves one slot backwards, no element is shifted
+	vector->head_ = (vector->head_ == 0) ? (vector->capacity_ - 1) : (vector->head_ - 1);
+	vector->storage_[vector->head_].ops_->setData(&vector->storage_[vector->head_], data, bytes);
+	vector->length_++;
 	return kErrorCode_Ok;
 }
 
@@ -274,7 +304,10 @@ s16 CIRCULAR_VECTOR_insertLast(CircularVector* vector, void* data, u16 bytes) {
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-	if (CIRCULAR_VECTOR_isFull(vector)) {
+	if (vector->ops_->isFull(vector)) {
+		if (kCircularVectorMode_Overwrite == vector->mode_) {
+			return vector->ops_->insertLastEvict(vector, data, bytes, NULL);
+		}
 		return kErrorCode_InsertionFailed;
 	}
 	if (data == NULL) {
@@ -283,9 +316,9 @@ s16 CIRCULAR_VECTOR_insertLast(CircularVector* vector, void* data, u16 bytes) {
 	if (vector->storage_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-	u16 i = CIRCULAR_VECTOR_length(vector);
-	vector->storage_[i].ops_->setData(&vector->storage_[i], data, bytes);
-	vector->tail_++;
+	vector->storage_[vector->tail_].ops_->setData(&vector->storage_[vector->tail_], data, bytes);
+	vector->tail_ = (vector->tail_ + 1) % vector->capacity_;
+	vector->length_++;
 	return kErrorCode_Ok;
 }
 
@@ -293,24 +326,33 @@ s16 CIRCULAR_VECTOR_insertAt(CircularVector* vector, void* data, u16 bytes, u16
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-	if (CIRCULAR_VECTOR_isFull(vector)) {
+	if (vector->ops_->isFull(vector)) {
 		return kErrorCode_InsertionFailed;
 	}
 	if (data == NULL) {
-		return kErrorCode_NullMemoryNode;
+		return kErrorCode_NullPointer;
 	}
 	if (vector->storage_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-
-	for (u16 i = CIRCULAR_VECTOR_length(vector); i > position; --i) {
-		vector->storage_[i].ops_->setData(&vector->storage_[i],
-			vector->storage_[i - 1].data_,
-			vector->storage_[i - 1].size_);
-
+	if (position >= vector->length_) {
+		return vector->ops_->insertLast(vector, data, bytes);
+	}
+	if (position == 0) {
+		return vector->ops_->insertFirst(vector, data, bytes);
 	}
-	vector->storage_[position].ops_->setData(&vector->storage_[position], data, bytes);
-	vector->tail_++;
+	// elements from position onwards move one slot towards the tail
+	for (u16 i = vector->length_; i > position; --i) {
+		u16 slot = CIRCULAR_VECTOR_slot(vector, i);
+		u16 prev = CIRCULAR_VECTOR_slot(vector, i - 1);
+		vector->storage_[slot].ops_->setData(&vector->storage_[slot],
+			vector->storage_[prev].data_,
+			vector->storage_[prev].size_);
+	}
+	u16 slot = CIRCULAR_VECTOR_slot(vector, position);
+	vector->storage_[slot].ops_->setData(&vector->storage_[slot], data, bytes);
+	vector->tail_ = (vector->tail_ + 1) % vector->capacity_;
+	vector->length_++;
 	return kErrorCode_Ok;
 }
 
@@ -318,45 +360,33 @@ void* CIRCULAR_VECTOR_extractFirst(CircularVector* vector) {
 	if (vector == NULL) {
 		return NULL;
 	}
- if (vector->ops_->isEmpty(&vector)) {
-   return NULL;
- }
-	if (vector->storage_ == NULL) {
+	if (vector->ops_->isEmpty(vector)) {
 		return NULL;
 	}
-	if (vector->storage_[0].ops_->data(&vector->storage_[0]) == NULL) {
+	if (vector->storage_ == NULL) {
 		return NULL;
 	}
-	void* tmp_data_ = vector->storage_[0].ops_->data(&vector->storage_[0]);
-	u16 j = CIRCULAR_VECTOR_length(vector) - 1;
-	for (u16 i = 0; i < j; ++i) {
-		vector->storage_[i].ops_->setData(&vector->storage_[i],
-			vector->storage_[i + 1].ops_->data(&vector->storage_[i + 1]),
-			vector->storage_[i + 1].ops_->size(&vector->storage_[i + 1]));
-	}
-	vector->storage_[j + 1].ops_->softReset(&vector->storage_[j + 1]);
-	vector->tail_--;
-	return tmp_data_;
+	void* tmp_data = vector->storage_[vector->head_].ops_->data(&vector->storage_[vector->head_]);
+	vector->storage_[vector->head_].ops_->softReset(&vector->storage_[vector->head_]);
+	vector->head_ = (vector->head_ + 1) % vector->capacity_;
+	vector->length_--;
+	return tmp_data;
 }
 
 void* CIRCULAR_VECTOR_extractLast(CircularVector* vector) {
 	if (vector == NULL) {
 		return NULL;
 	}
- if (vector->ops_->isEmpty(&vector)) {
-   return NULL;
- }
-	if (vector->storage_ == NULL) {
+	if (vector->ops_->isEmpty(vector)) {
 		return NULL;
 	}
-	u16 i = CIRCULAR_VECTOR_length(vector) - 1;
-	if (vector->storage_[i].ops_->data(&vector->storage_[i]) == NULL) {
+	if (vector->storage_ == NULL) {
 		return NULL;
 	}
-	void* tmp_data = vector->storage_[i].ops_->data(&vector->storage_[i]);
-
-	vector->storage_[i].ops_->softReset(&vector->storage_[i]);
-	vector->tail_--;
+	vector->tail_ = (vector->tail_ == 0) ? (vector->capacity_ - 1) : (vector->tail_ - 1);
+	void* tmp_data = vector->storage_[vector->tail_].ops_->data(&vector->storage_[vector->tail_]);
+	vector->storage_[vector->tail_].ops_->softReset(&vector->storage_[vector->tail_]);
+	vector->length_--;
 	return tmp_data;
 }
 
@@ -365,62 +395,66 @@ void* CIRCULAR_VECTOR_extractAt(CircularVector* vector, u16 position) {
 	if (vector == NULL) {
 		return NULL;
 	}
- if (vector->ops_->isEmpty(&vector)) {
-   return NULL;
- }
+	if (vector->ops_->isEmpty(vector)) {
+		return NULL;
+	}
 	if (vector->storage_ == NULL) {
 		return NULL;
 	}
-	if (vector->storage_[position].ops_->data(&vector->storage_[position]) == NULL) {
+	if (position >= vector->length_) {
 		return NULL;
 	}
-	void* tmp_data = vector->storage_[position].ops_->data(&vector->storage_[position]);
-	u16 j = CIRCULAR_VECTOR_length(vector) - 1;
-	for (u16 i = position; i < j; ++i) {
-		vector->storage_[i].ops_->setData(&vector->storage_[i],
-			vector->storage_[i + 1].ops_->data(&vector->storage_[i + 1]),
-			vector->storage_[i + 1].ops_->size(&vector->storage_[i + 1]));
+	if (position == 0) {
+		return vector->ops_->extractFirst(vector);
+	}
+	if (position == vector->length_ - 1) {
+		return vector->ops_->extractLast(vector);
 	}
-	vector->storage_[j + 1].ops_->softReset(&vector->storage_[j + 1]);
-	vector->tail_--;
+	u16 slot = CIRCULAR_VECTOR_slot(vector, position);
+	void* tmp_data = vector->storage_[slot].ops_->data(&vector->storage_[slot]);
+	// elements after position move one slot towards the head
+	u16 j = vector->length_ - 1;
+	for (u16 i = position; i < j; ++i) {
+		u16 current = CIRCULAR_VECTOR_slot(vector, i);
+		u16 next = CIRCULAR_VECTOR_slot(vector, i + 1);
+		vector->storage_[current].ops_->setData(&vector->storage_[current],
+			vector->storage_[next].data_,
+			vector->storage_[next].size_);
+	}
+	vector->tail_ = (vector->tail_ == 0) ? (vector->capacity_ - 1) : (vector->tail_ - 1);
+	vector->storage_[vector->tail_].ops_->softReset(&vector->storage_[vector->tail_]);
+	vector->length_--;
 	return tmp_data;
 }
 
 s16 CIRCULAR_VECTOR_concat(CircularVector* vector, CircularVector* vector_src) {
-  // parameter control
+	// parameter control
 	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector->storage_) {
 		return kErrorCode_NullMemoryNode;
 	}
- if (NULL == vector->storage_) {
-   return kErrorCode_NullMemoryNode;
- }
 	if (NULL == vector_src) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector_src->storage_) {
 		return kErrorCode_NullMemoryNode;
 	}
- if (NULL == vector_src->storage_) {
-   return kErrorCode_NullMemoryNode;
- }
- // change tail vector and capacity
- u16 new_tail = vector->ops_->length(vector) + vector_src->ops_->length(vector_src);
- u16 new_capacity = vector->ops_->capacity(vector) + vector_src->ops_->capacity(vector_src);
- vector->ops_->resize(vector, new_capacity);
- // if the second vector is empty there is nothing to copy
- if (vector_src->ops_->isEmpty(&vector_src)) {
-   if (vector->ops_->isEmpty(&vector)) {
-     return kErrorCode_Ok;
-   }
-   return kErrorCode_Ok;
- }
- // data from the second vector copied to the first
- u16 j = 0;
- for (u16 i = vector->ops_->length(vector); i < new_tail; ++i) {
-   vector->storage_->ops_->memCopy(vector->storage_ + i,
-     vector_src->storage_[j].ops_->data(vector_src->storage_ + j),
-     vector_src->storage_[j].ops_->size(vector_src->storage_ + j));
-   j++;
- }
- vector->tail_ = new_tail;
- vector->capacity_ = new_capacity;
+	// change capacity, resize also unrolls the ring so tail_ == length_
+	u16 new_capacity = vector->capacity_ + vector_src->capacity_;
+	s16 error_type = vector->ops_->resize(vector, new_capacity);
+	if (kErrorCode_Ok != error_type) {
+		return error_type;
+	}
+	// data from the second vector copied to the first
+	for (u16 i = 0; i < vector_src->length_; ++i) {
+		MemoryNode* src_node = &vector_src->storage_[CIRCULAR_VECTOR_slot(vector_src, i)];
+		MemoryNode* dst_node = &vector->storage_[vector->tail_];
+		dst_node->ops_->memCopy(dst_node, src_node->ops_->data(src_node), src_node->ops_->size(src_node));
+		vector->tail_ = (vector->tail_ + 1) % vector->capacity_;
+		vector->length_++;
+	}
 
 	return kErrorCode_Ok;
 }
@@ -429,38 +463,194 @@ s16 CIRCULAR_VECTOR_traverse(CircularVector* vector, void(*callback)(MemoryNode*
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-
 	if (vector->storage_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-	for (u16 i = 0; i < vector->tail_; ++i) {
-		callback(&vector->storage_[i]);
+	for (u16 i = 0; i < vector->length_; ++i) {
+		callback(&vector->storage_[CIRCULAR_VECTOR_slot(vector, i)]);
+	}
+
+	return kErrorCode_Ok;
+}
+
+s16 CIRCULAR_VECTOR_traverseEx(CircularVector* vector, s16(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector->storage_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	for (u16 i = 0; i < vector->length_; ++i) {
+		if (kTraverse_Stop == callback(&vector->storage_[CIRCULAR_VECTOR_slot(vector, i)], ctx)) {
+			break;
+		}
 	}
+	return kErrorCode_Ok;
+}
 
+s16 CIRCULAR_VECTOR_traverseBatch(CircularVector* vector, s16(*callback)(MemoryNode**, u16, void*), void* ctx) {
+	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector->storage_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode* batch[kTraverseBatchLength];
+	u16 count = 0;
+	for (u16 i = 0; i < vector->length_; ++i) {
+		batch[count++] = &vector->storage_[CIRCULAR_VECTOR_slot(vector, i)];
+		if (kTraverseBatchLength == count || i + 1 == vector->length_) {
+			if (kTraverse_Stop == callback(batch, count, ctx)) {
+				break;
+			}
+			count = 0;
+		}
+	}
 	return kErrorCode_Ok;
 }
 
 void CIRCULAR_VECTOR_print(CircularVector* vector) {
 	printf("	[Vector Info] Address: ");
 	if (NULL == vector) {
-		return printf(" NULL");
+		printf(" NULL\n");
+		return;
 	}
 	printf("%p\n", vector);
 
 	printf("	[Vector Info] Head: %d\n", vector->head_);
 	printf("	[Vector Info] Tail: %d\n", vector->tail_);
-	printf("	[Vector Info] Length: %d\n", vector->tail_);
+	printf("	[Vector Info] Length: %d\n", vector->length_);
 	printf("	[Vector Info] Capacity: %d\n", vector->capacity_);
 
 	printf("	[Vector Info] Address: ");
 	if (NULL == vector->storage_) {
-		return printf(" NULL");
+		printf(" NULL\n");
+		return;
 	}
 	printf("%p\n", vector->storage_);
 
-	for (int i = 0; i < vector->tail_; ++i) {
+	for (u16 i = 0; i < vector->length_; ++i) {
 		printf("	[Vector Info] Storage #%d\n", i);
-		vector->storage_->ops_->print(&vector->storage_[i]);
+		vector->storage_->ops_->print(&vector->storage_[CIRCULAR_VECTOR_slot(vector, i)]);
 	}
 	printf("\n");
-}
\ No newline at end of file
+}
+
+u16 CIRCULAR_VECTOR_pushMany(CircularVector* vector, MemoryNode* src, u16 count) {
+	if (NULL == vector) {
+		return 0;
+	}
+	if (NULL == vector->storage_ || NULL == src) {
+		return 0;
+	}
+	u16 free_slots = vector->capacity_ - vector->length_;
+	if (count > free_slots) {
+		count = free_slots;
+	}
+	// first segment runs from tail_ to the end of the storage, the second one wraps to 0
+	u16 first_segment = vector->capacity_ - vector->tail_;
+	if (first_segment > count) {
+		first_segment = count;
+	}
+	memcpy(&vector->storage_[vector->tail_], src, sizeof(MemoryNode) * first_segment);
+	memcpy(&vector->storage_[0], src + first_segment, sizeof(MemoryNode) * (count - first_segment));
+	vector->tail_ = (u16)(((u32)vector->tail_ + count) % vector->capacity_);
+	vector->length_ += count;
+	return count;
+}
+
+u16 CIRCULAR_VECTOR_popMany(CircularVector* vector, MemoryNode* dst, u16 max) {
+	if (NULL == vector) {
+		return 0;
+	}
+	if (NULL == vector->storage_ || NULL == dst) {
+		return 0;
+	}
+	u16 count = vector->length_ < max ? vector->length_ : max;
+	// first segment runs from head_ to the end of the storage, the second one wraps to 0
+	u16 first_segment = vector->capacity_ - vector->head_;
+	if (first_segment > count) {
+		first_segment = count;
+	}
+	memcpy(dst, &vector->storage_[vector->head_], sizeof(MemoryNode) * first_segment);
+	memcpy(dst + first_segment, &vector->storage_[0], sizeof(MemoryNode) * (count - first_segment));
+	// the slots are left as they are, length_ is what tells which ones are alive
+	vector->head_ = (u16)(((u32)vector->head_ + count) % vector->capacity_);
+	vector->length_ -= count;
+	return count;
+}
+
+s16 CIRCULAR_VECTOR_insertLastEvict(CircularVector* vector, void* data, u16 bytes, MemoryNode* evicted) {
+	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (NULL == vector->storage_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL != evicted) {
+		MEMNODE_createLite(evicted);
+	}
+	if (false == vector->ops_->isFull(vector)) {
+		vector->storage_[vector->tail_].ops_->setData(&vector->storage_[vector->tail_], data, bytes);
+		vector->tail_ = (vector->tail_ + 1) % vector->capacity_;
+		vector->length_++;
+		return kErrorCode_Ok;
+	}
+	// full: head_ == tail_, the oldest slot is reused for the new element
+	MemoryNode* oldest = &vector->storage_[vector->head_];
+	if (NULL != evicted) {
+		evicted->ops_->setData(evicted, oldest->data_, oldest->size_);
+	}
+	else {
+		oldest->ops_->reset(oldest);
+	}
+	oldest->ops_->setData(oldest, data, bytes);
+	vector->head_ = (vector->head_ + 1) % vector->capacity_;
+	vector->tail_ = vector->head_;
+	vector->evictions_++;
+	return kErrorCode_Ok;
+}
+
+s16 CIRCULAR_VECTOR_iteratorBegin(CircularVector* vector, CircularVectorIterator* iterator) {
+	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == iterator) {
+		return kErrorCode_NullPointer;
+	}
+	iterator->vector_ = vector;
+	iterator->head_ = vector->head_;
+	iterator->length_ = vector->length_;
+	iterator->position_ = 0;
+	iterator->evictions_ = vector->evictions_;
+	return kErrorCode_Ok;
+}
+
+MemoryNode* CIRCULAR_VECTOR_iteratorNext(CircularVectorIterator* iterator) {
+	if (NULL == iterator) {
+		return NULL;
+	}
+	if (NULL == iterator->vector_ || NULL == iterator->vector_->storage_) {
+		return NULL;
+	}
+	// the oldest elements of the snapshot may have been overwritten since it started
+	u32 lost = iterator->vector_->evictions_ - iterator->evictions_;
+	if (iterator->position_ < lost) {
+		iterator->position_ = (lost < iterator->length_) ? (u16)lost : iterator->length_;
+	}
+	if (iterator->position_ >= iterator->length_) {
+		return NULL;
+	}
+	u16 slot = (u16)(((u32)iterator->head_ + iterator->position_) % iterator->vector_->capacity_);
+	iterator->position_++;
+	return &iterator->vector_->storage_[slot];
+}
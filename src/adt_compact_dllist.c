@@ -0,0 +1,411 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_compact_dllist.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//CompactDList Declarations
+static s16 COMPACTDLIST_destroy(CompactDList* list);
+static s16 COMPACTDLIST_softReset(CompactDList* list);
+static s16 COMPACTDLIST_reset(CompactDList* list);
+static s16 COMPACTDLIST_resize(CompactDList* list, u16 new_size);
+static u16 COMPACTDLIST_capacity(CompactDList* list);
+static u16 COMPACTDLIST_length(CompactDList* list);
+static bool COMPACTDLIST_isEmpty(CompactDList* list);
+static bool COMPACTDLIST_isFull(CompactDList* list);
+static void* COMPACTDLIST_first(CompactDList* list);
+static void* COMPACTDLIST_last(CompactDList* list);
+static void* COMPACTDLIST_at(CompactDList* list, u16 position);
+static s16 COMPACTDLIST_insertFirst(CompactDList* list, void* data, u16 bytes);
+static s16 COMPACTDLIST_insertLast(CompactDList* list, void* data, u16 bytes);
+static s16 COMPACTDLIST_insertAt(CompactDList* list, void* data, u16 bytes, u16 position);
+static void* COMPACTDLIST_extractFirst(CompactDList* list);
+static void* COMPACTDLIST_extractLast(CompactDList* list);
+static void* COMPACTDLIST_extractAt(CompactDList* list, u16 position);
+static s16 COMPACTDLIST_concat(CompactDList* list, CompactDList* list_src);
+static s16 COMPACTDLIST_traverse(CompactDList* list, void(*callback)(MemoryNode*));
+static void COMPACTDLIST_print(CompactDList* list);
+
+struct compact_dlist_ops_s compact_dlist_ops = { .destroy = COMPACTDLIST_destroy,
+												  .softReset = COMPACTDLIST_softReset,
+												  .reset = COMPACTDLIST_reset,
+												  .resize = COMPACTDLIST_resize,
+												  .capacity = COMPACTDLIST_capacity,
+												  .length = COMPACTDLIST_length,
+												  .isEmpty = COMPACTDLIST_isEmpty,
+												  .isFull = COMPACTDLIST_isFull,
+												  .first = COMPACTDLIST_first,
+												  .last = COMPACTDLIST_last,
+												  .at = COMPACTDLIST_at,
+												  .insertFirst = COMPACTDLIST_insertFirst,
+												  .insertLast = COMPACTDLIST_insertLast,
+												  .insertAt = COMPACTDLIST_insertAt,
+												  .extractFirst = COMPACTDLIST_extractFirst,
+												  .extractLast = COMPACTDLIST_extractLast,
+												  .extractAt = COMPACTDLIST_extractAt,
+												  .concat = COMPACTDLIST_concat,
+												  .traverse = COMPACTDLIST_traverse,
+												  .print = COMPACTDLIST_print
+};
+
+// Chains the nodes [from, pool_size_) in front of the free list
+static void COMPACTDLIST_chainFree(CompactDList* list, u32 from) {
+	for (u32 i = list->pool_size_; i > from; --i) {
+		list->nodes_[i - 1].data_ = NULL;
+		list->nodes_[i - 1].size_ = 0;
+		list->nodes_[i - 1].prev_ = kCompactDListNull;
+		list->nodes_[i - 1].next_ = list->free_;
+		list->free_ = i - 1;
+	}
+}
+
+// Doubles the pool, up to the capacity. Nodes link by index, so moving them
+// to the new pool is a single memcpy
+static s16 COMPACTDLIST_grow(CompactDList* list) {
+	u32 new_size = list->pool_size_ * 2;
+	if (new_size > list->capacity_) {
+		new_size = list->capacity_;
+	}
+	CompactDListNode* nodes = (CompactDListNode*)MM->malloc(sizeof(CompactDListNode) * new_size);
+	if (NULL == nodes) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return kErrorCode_NullMemoryAllocation;
+	}
+	memcpy(nodes, list->nodes_, sizeof(CompactDListNode) * list->pool_size_);
+	MM->free(list->nodes_);
+	list->nodes_ = nodes;
+	u32 old_size = list->pool_size_;
+	list->pool_size_ = new_size;
+	COMPACTDLIST_chainFree(list, old_size);
+	return kErrorCode_Ok;
+}
+
+// Index of the node at position (< length), walking from the nearest end
+static u32 COMPACTDLIST_node(CompactDList* list, u16 position) {
+	u32 index = 0;
+	if (position < list->length_ / 2) {
+		index = list->head_;
+		for (u16 i = 0; i < position; ++i) {
+			index = list->nodes_[index].next_;
+		}
+	}
+	else {
+		index = list->tail_;
+		for (u16 i = list->length_ - 1; i > position; --i) {
+			index = list->nodes_[index].prev_;
+		}
+	}
+	return index;
+}
+
+// Unlinks a node, returns it to the free list and gives back its data
+static void* COMPACTDLIST_unlink(CompactDList* list, u32 index) {
+	CompactDListNode* node = &list->nodes_[index];
+	if (kCompactDListNull == node->prev_) {
+		list->head_ = node->next_;
+	}
+	else {
+		list->nodes_[node->prev_].next_ = node->next_;
+	}
+	if (kCompactDListNull == node->next_) {
+		list->tail_ = node->prev_;
+	}
+	else {
+		list->nodes_[node->next_].prev_ = node->prev_;
+	}
+	void* data = node->data_;
+	node->data_ = NULL;
+	node->size_ = 0;
+	node->prev_ = kCompactDListNull;
+	node->next_ = list->free_;
+	list->free_ = index;
+	list->length_--;
+	return data;
+}
+
+// Frees the data of every element when hard is true, and empties the list
+static void COMPACTDLIST_clear(CompactDList* list, bool hard) {
+	while (kCompactDListNull != list->head_) {
+		void* data = COMPACTDLIST_unlink(list, list->head_);
+		if (hard) {
+			MM->free(data);
+		}
+	}
+}
+
+CompactDList* COMPACTDLIST_create(u16 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	CompactDList* list = (CompactDList*)MM->malloc(sizeof(CompactDList));
+	if (NULL == list) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	list->pool_size_ = capacity < kCompactDListInitialPool ? capacity : kCompactDListInitialPool;
+	list->nodes_ = (CompactDListNode*)MM->malloc(sizeof(CompactDListNode) * list->pool_size_);
+	if (NULL == list->nodes_) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		MM->free(list);
+		return NULL;
+	}
+	list->head_ = kCompactDListNull;
+	list->tail_ = kCompactDListNull;
+	list->free_ = kCompactDListNull;
+	list->capacity_ = capacity;
+	list->length_ = 0;
+	list->ops_ = &compact_dlist_ops;
+	COMPACTDLIST_chainFree(list, 0);
+	return list;
+}
+
+s16 COMPACTDLIST_destroy(CompactDList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	COMPACTDLIST_clear(list, true);
+	MM->free(list->nodes_);
+	MM->free(list);
+	return kErrorCode_Ok;
+}
+
+s16 COMPACTDLIST_softReset(CompactDList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	COMPACTDLIST_clear(list, false);
+	return kErrorCode_Ok;
+}
+
+s16 COMPACTDLIST_reset(CompactDList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	COMPACTDLIST_clear(list, true);
+	return kErrorCode_Ok;
+}
+
+s16 COMPACTDLIST_resize(CompactDList* list, u16 new_size) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (0 == new_size) {
+		return kErrorCode_InvalidValue;
+	}
+	while (list->length_ > new_size) {
+		MM->free(COMPACTDLIST_unlink(list, list->tail_));
+	}
+	// the pool keeps its size, it only grows while it is under the capacity
+	list->capacity_ = new_size;
+	return kErrorCode_Ok;
+}
+
+u16 COMPACTDLIST_capacity(CompactDList* list) {
+	if (NULL == list) {
+		return 0;
+	}
+	return list->capacity_;
+}
+
+u16 COMPACTDLIST_length(CompactDList* list) {
+	if (NULL == list) {
+		return 0;
+	}
+	return list->length_;
+}
+
+bool COMPACTDLIST_isEmpty(CompactDList* list) {
+	if (NULL == list) {
+		return false;
+	}
+	return 0 == list->length_;
+}
+
+bool COMPACTDLIST_isFull(CompactDList* list) {
+	if (NULL == list) {
+		return false;
+	}
+	return list->length_ >= list->capacity_;
+}
+
+void* COMPACTDLIST_first(CompactDList* list) {
+	if (NULL == list || kCompactDListNull == list->head_) {
+		return NULL;
+	}
+	return list->nodes_[list->head_].data_;
+}
+
+void* COMPACTDLIST_last(CompactDList* list) {
+	if (NULL == list || kCompactDListNull == list->tail_) {
+		return NULL;
+	}
+	return list->nodes_[list->tail_].data_;
+}
+
+void* COMPACTDLIST_at(CompactDList* list, u16 position) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (position >= list->length_) {
+		return NULL;
+	}
+	return list->nodes_[COMPACTDLIST_node(list, position)].data_;
+}
+
+s16 COMPACTDLIST_insertFirst(CompactDList* list, void* data, u16 bytes) {
+	return COMPACTDLIST_insertAt(list, data, bytes, 0);
+}
+
+s16 COMPACTDLIST_insertLast(CompactDList* list, void* data, u16 bytes) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	return COMPACTDLIST_insertAt(list, data, bytes, list->length_);
+}
+
+s16 COMPACTDLIST_insertAt(CompactDList* list, void* data, u16 bytes, u16 position) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	if (list->length_ >= list->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	if (position > list->length_) {
+		position = list->length_;
+	}
+	if (kCompactDListNull == list->free_) {
+		s16 error_type = COMPACTDLIST_grow(list);
+		if (kErrorCode_Ok != error_type) {
+			return error_type;
+		}
+	}
+	u32 index = list->free_;
+	CompactDListNode* node = &list->nodes_[index];
+	list->free_ = node->next_;
+	node->data_ = data;
+	node->size_ = bytes;
+	// the node goes between prev_ and next_
+	node->next_ = position == list->length_ ? kCompactDListNull : COMPACTDLIST_node(list, position);
+	node->prev_ = kCompactDListNull == node->next_ ? list->tail_ : list->nodes_[node->next_].prev_;
+	if (kCompactDListNull == node->prev_) {
+		list->head_ = index;
+	}
+	else {
+		list->nodes_[node->prev_].next_ = index;
+	}
+	if (kCompactDListNull == node->next_) {
+		list->tail_ = index;
+	}
+	else {
+		list->nodes_[node->next_].prev_ = index;
+	}
+	list->length_++;
+	return kErrorCode_Ok;
+}
+
+void* COMPACTDLIST_extractFirst(CompactDList* list) {
+	if (NULL == list || kCompactDListNull == list->head_) {
+		return NULL;
+	}
+	return COMPACTDLIST_unlink(list, list->head_);
+}
+
+void* COMPACTDLIST_extractLast(CompactDList* list) {
+	if (NULL == list || kCompactDListNull == list->tail_) {
+		return NULL;
+	}
+	return COMPACTDLIST_unlink(list, list->tail_);
+}
+
+void* COMPACTDLIST_extractAt(CompactDList* list, u16 position) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (position >= list->length_) {
+		return NULL;
+	}
+	return COMPACTDLIST_unlink(list, COMPACTDLIST_node(list, position));
+}
+
+s16 COMPACTDLIST_concat(CompactDList* list, CompactDList* list_src) {
+	if (NULL == list || NULL == list_src) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (list == list_src) {
+		return kErrorCode_InvalidValue;
+	}
+	list->capacity_ += list_src->capacity_;
+	MemoryNode copy;
+	MEMNODE_createLite(&copy);
+	for (u32 index = list_src->head_; kCompactDListNull != index; index = list_src->nodes_[index].next_) {
+		copy.data_ = NULL;
+		s16 error_type = copy.ops_->memCopy(&copy, list_src->nodes_[index].data_, list_src->nodes_[index].size_);
+		if (kErrorCode_Ok != error_type) {
+			return error_type;
+		}
+		error_type = COMPACTDLIST_insertAt(list, copy.data_, copy.size_, list->length_);
+		if (kErrorCode_Ok != error_type) {
+			MM->free(copy.data_);
+			return error_type;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 COMPACTDLIST_traverse(CompactDList* list, void(*callback)(MemoryNode*)) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+	for (u32 index = list->head_; kCompactDListNull != index; index = list->nodes_[index].next_) {
+		node.data_ = list->nodes_[index].data_;
+		node.size_ = list->nodes_[index].size_;
+		callback(&node);
+		list->nodes_[index].data_ = node.data_;
+		list->nodes_[index].size_ = node.size_;
+	}
+	return kErrorCode_Ok;
+}
+
+void COMPACTDLIST_print(CompactDList* list) {
+	printf("	[CompactDList Info] Address: ");
+	if (NULL == list) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", list);
+	printf("	[CompactDList Info] Length: %d\n", list->length_);
+	printf("	[CompactDList Info] Capacity: %d\n", list->capacity_);
+	printf("	[CompactDList Info] Pool: %u nodes at %p\n", list->pool_size_, list->nodes_);
+
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+	u16 i = 0;
+	for (u32 index = list->head_; kCompactDListNull != index; index = list->nodes_[index].next_) {
+		printf("		[CompactDList Info] Storage #%d (node %u)\n", i++, index);
+		node.data_ = list->nodes_[index].data_;
+		node.size_ = list->nodes_[index].size_;
+		node.ops_->print(&node);
+	}
+	printf("\n");
+}
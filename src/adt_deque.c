@@ -0,0 +1,539 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_deque.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//Deque Declarations
+static s16 DEQUE_destroy(Deque* deque);
+static s16 DEQUE_softReset(Deque* deque);
+static s16 DEQUE_reset(Deque* deque);
+static s16 DEQUE_resize(Deque* deque, u16 new_size);
+static u16 DEQUE_capacity(Deque* deque);
+static u16 DEQUE_length(Deque* deque);
+static bool DEQUE_isEmpty(Deque* deque);
+static bool DEQUE_isFull(Deque* deque);
+static void* DEQUE_first(Deque* deque);
+static void* DEQUE_last(Deque* deque);
+static void* DEQUE_at(Deque* deque, u16 position);
+static s16 DEQUE_insertFirst(Deque* deque, void* data, u16 bytes);
+static s16 DEQUE_insertLast(Deque* deque, void* data, u16 bytes);
+static s16 DEQUE_insertAt(Deque* deque, void* data, u16 bytes, u16 position);
+static void* DEQUE_extractFirst(Deque* deque);
+static void* DEQUE_extractLast(Deque* deque);
+static void* DEQUE_extractAt(Deque* deque, u16 position);
+static s16 DEQUE_concat(Deque* deque, Deque* deque_src);
+static s16 DEQUE_traverse(Deque* deque, void(*callback)(MemoryNode*));
+static s16 DEQUE_traverseEx(Deque* deque, s16(*callback)(MemoryNode*, void*), void* ctx);
+static s16 DEQUE_traverseBatch(Deque* deque, s16(*callback)(MemoryNode**, u16, void*), void* ctx);
+static void DEQUE_print(Deque* deque);
+
+struct deque_ops_s deque_ops = { .destroy = DEQUE_destroy,
+								  .softReset = DEQUE_softReset,
+								  .reset = DEQUE_reset,
+								  .resize = DEQUE_resize,
+								  .capacity = DEQUE_capacity,
+								  .length = DEQUE_length,
+								  .isEmpty = DEQUE_isEmpty,
+								  .isFull = DEQUE_isFull,
+								  .first = DEQUE_first,
+								  .last = DEQUE_last,
+								  .at = DEQUE_at,
+								  .insertFirst = DEQUE_insertFirst,
+								  .insertLast = DEQUE_insertLast,
+								  .insertAt = DEQUE_insertAt,
+								  .extractFirst = DEQUE_extractFirst,
+								  .extractLast = DEQUE_extractLast,
+								  .extractAt = DEQUE_extractAt,
+								  .concat = DEQUE_concat,
+								  .traverse = DEQUE_traverse,
+								  .traverseEx = DEQUE_traverseEx,
+								  .traverseBatch = DEQUE_traverseBatch,
+								  .print = DEQUE_print
+};
+
+// Node holding the element at the given position
+static MemoryNode* DEQUE_node(Deque* deque, u16 position) {
+	u32 offset = deque->head_ + position;
+	return &deque->blocks_[offset / kDequeBlockSize][offset % kDequeBlockSize];
+}
+
+// An empty deque starts again from the middle of the map, so both ends have room
+static void DEQUE_center(Deque* deque) {
+	deque->head_ = (u32)(deque->map_size_ / 2) * kDequeBlockSize;
+}
+
+// Frees the block of the given map slot
+static void DEQUE_freeBlock(Deque* deque, u32 block) {
+	MM->free(deque->blocks_[block]);
+	deque->blocks_[block] = NULL;
+}
+
+// Makes sure the map slot holding offset has a block
+static s16 DEQUE_allocBlock(Deque* deque, u32 offset) {
+	u32 block = offset / kDequeBlockSize;
+	if (NULL != deque->blocks_[block]) {
+		return kErrorCode_Ok;
+	}
+	MemoryNode* new_block = (MemoryNode*)MM->malloc(sizeof(MemoryNode) * kDequeBlockSize);
+	if (NULL == new_block) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return kErrorCode_NullMemoryAllocation;
+	}
+	for (u16 i = 0; i < kDequeBlockSize; ++i) {
+		MEMNODE_createLite(&new_block[i]);
+	}
+	deque->blocks_[block] = new_block;
+	return kErrorCode_Ok;
+}
+
+// Centers the used blocks in the map, doubling it when they fill half of it.
+// Only block pointers move, the elements stay where they are
+static s16 DEQUE_remap(Deque* deque) {
+	u32 first_block = deque->head_ / kDequeBlockSize;
+	u32 used = 0;
+	if (deque->length_ > 0) {
+		used = (deque->head_ + deque->length_ - 1) / kDequeBlockSize - first_block + 1;
+	}
+	u32 new_map_size = deque->map_size_;
+	if ((used + 1) * 2 > new_map_size) {
+		new_map_size = new_map_size * 2;
+	}
+	u32 new_first_block = (new_map_size - used) / 2;
+
+	if (new_map_size != deque->map_size_) {
+		MemoryNode** new_map = (MemoryNode**)MM->malloc(sizeof(MemoryNode*) * new_map_size);
+		if (NULL == new_map) {
+#ifdef VERBOSE_
+			printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+			return kErrorCode_NullMemoryAllocation;
+		}
+		memset(new_map, 0, sizeof(MemoryNode*) * new_map_size);
+		memcpy(&new_map[new_first_block], &deque->blocks_[first_block], sizeof(MemoryNode*) * used);
+		MM->free(deque->blocks_);
+		deque->blocks_ = new_map;
+		deque->map_size_ = (u16)new_map_size;
+	}
+	else {
+		memmove(&deque->blocks_[new_first_block], &deque->blocks_[first_block], sizeof(MemoryNode*) * used);
+		memset(deque->blocks_, 0, sizeof(MemoryNode*) * new_first_block);
+		memset(&deque->blocks_[new_first_block + used], 0, sizeof(MemoryNode*) * (new_map_size - new_first_block - used));
+	}
+	deque->head_ = new_first_block * kDequeBlockSize + deque->head_ % kDequeBlockSize;
+	return kErrorCode_Ok;
+}
+
+// Opens a slot before the first element, which becomes position 0
+static s16 DEQUE_growFront(Deque* deque) {
+	if (0 == deque->head_) {
+		s16 error_type = DEQUE_remap(deque);
+		if (kErrorCode_Ok != error_type) {
+			return error_type;
+		}
+	}
+	s16 error_type = DEQUE_allocBlock(deque, deque->head_ - 1);
+	if (kErrorCode_Ok != error_type) {
+		return error_type;
+	}
+	deque->head_--;
+	deque->length_++;
+	return kErrorCode_Ok;
+}
+
+// Opens a slot after the last element, which becomes position length - 1
+static s16 DEQUE_growBack(Deque* deque) {
+	if ((deque->head_ + deque->length_) / kDequeBlockSize >= deque->map_size_) {
+		s16 error_type = DEQUE_remap(deque);
+		if (kErrorCode_Ok != error_type) {
+			return error_type;
+		}
+	}
+	s16 error_type = DEQUE_allocBlock(deque, deque->head_ + deque->length_);
+	if (kErrorCode_Ok != error_type) {
+		return error_type;
+	}
+	deque->length_++;
+	return kErrorCode_Ok;
+}
+
+// Drops the slot of the first element, its node must be already reset
+static void DEQUE_shrinkFront(Deque* deque) {
+	u32 block = deque->head_ / kDequeBlockSize;
+	deque->head_++;
+	deque->length_--;
+	if (0 == deque->length_ || 0 == deque->head_ % kDequeBlockSize) {
+		DEQUE_freeBlock(deque, block);
+	}
+	if (0 == deque->length_) {
+		DEQUE_center(deque);
+	}
+}
+
+// Drops the slot of the last element, its node must be already reset
+static void DEQUE_shrinkBack(Deque* deque) {
+	deque->length_--;
+	u32 offset = deque->head_ + deque->length_;
+	if (0 == deque->length_ || 0 == offset % kDequeBlockSize) {
+		DEQUE_freeBlock(deque, offset / kDequeBlockSize);
+	}
+	if (0 == deque->length_) {
+		DEQUE_center(deque);
+	}
+}
+
+// Frees every block, resetting the data of the nodes when hard is true
+static void DEQUE_clear(Deque* deque, bool hard) {
+	for (u16 i = 0; i < deque->length_; ++i) {
+		MemoryNode* node = DEQUE_node(deque, i);
+		if (hard) {
+			node->ops_->reset(node);
+		}
+		else {
+			node->ops_->softReset(node);
+		}
+	}
+	for (u16 i = 0; i < deque->map_size_; ++i) {
+		if (NULL != deque->blocks_[i]) {
+			DEQUE_freeBlock(deque, i);
+		}
+	}
+	deque->length_ = 0;
+	DEQUE_center(deque);
+}
+
+Deque* DEQUE_create(u16 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	Deque* new_deque = (Deque*)MM->malloc(sizeof(Deque));
+	if (NULL == new_deque) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	MemoryNode** map = (MemoryNode**)MM->malloc(sizeof(MemoryNode*) * kDequeInitialMapSize);
+	if (NULL == map) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		MM->free(new_deque);
+		return NULL;
+	}
+	memset(map, 0, sizeof(MemoryNode*) * kDequeInitialMapSize);
+	new_deque->blocks_ = map;
+	new_deque->map_size_ = kDequeInitialMapSize;
+	new_deque->length_ = 0;
+	new_deque->capacity_ = capacity;
+	new_deque->ops_ = &deque_ops;
+	DEQUE_center(new_deque);
+	return new_deque;
+}
+
+s16 DEQUE_destroy(Deque* deque) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	DEQUE_clear(deque, true);
+	MM->free(deque->blocks_);
+	MM->free(deque);
+	return kErrorCode_Ok;
+}
+
+s16 DEQUE_softReset(Deque* deque) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	DEQUE_clear(deque, false);
+	return kErrorCode_Ok;
+}
+
+s16 DEQUE_reset(Deque* deque) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	DEQUE_clear(deque, true);
+	return kErrorCode_Ok;
+}
+
+s16 DEQUE_resize(Deque* deque, u16 new_size) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	if (0 == new_size) {
+		return kErrorCode_InvalidValue;
+	}
+	// only the lost elements are touched, there is no storage to copy
+	while (deque->length_ > new_size) {
+		MemoryNode* node = DEQUE_node(deque, deque->length_ - 1);
+		node->ops_->reset(node);
+		DEQUE_shrinkBack(deque);
+	}
+	deque->capacity_ = new_size;
+	return kErrorCode_Ok;
+}
+
+u16 DEQUE_capacity(Deque* deque) {
+	if (NULL == deque) {
+		return 0;
+	}
+	return deque->capacity_;
+}
+
+u16 DEQUE_length(Deque* deque) {
+	if (NULL == deque) {
+		return 0;
+	}
+	return deque->length_;
+}
+
+bool DEQUE_isEmpty(Deque* deque) {
+	if (NULL == deque) {
+		return false;
+	}
+	return 0 == deque->length_;
+}
+
+bool DEQUE_isFull(Deque* deque) {
+	if (NULL == deque) {
+		return false;
+	}
+	return deque->length_ == deque->capacity_;
+}
+
+void* DEQUE_first(Deque* deque) {
+	return DEQUE_at(deque, 0);
+}
+
+void* DEQUE_last(Deque* deque) {
+	if (NULL == deque) {
+		return NULL;
+	}
+	if (0 == deque->length_) {
+		return NULL;
+	}
+	return DEQUE_at(deque, deque->length_ - 1);
+}
+
+void* DEQUE_at(Deque* deque, u16 position) {
+	if (NULL == deque) {
+		return NULL;
+	}
+	if (position >= deque->length_) {
+		return NULL;
+	}
+	MemoryNode* node = DEQUE_node(deque, position);
+	return node->ops_->data(node);
+}
+
+s16 DEQUE_insertFirst(Deque* deque, void* data, u16 bytes) {
+	return DEQUE_insertAt(deque, data, bytes, 0);
+}
+
+s16 DEQUE_insertLast(Deque* deque, void* data, u16 bytes) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	return DEQUE_insertAt(deque, data, bytes, deque->length_);
+}
+
+s16 DEQUE_insertAt(Deque* deque, void* data, u16 bytes, u16 position) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	if (deque->length_ == deque->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	if (position > deque->length_) {
+		position = deque->length_;
+	}
+	s16 error_type = kErrorCode_Ok;
+	// open a slot at the nearest end and move the elements in between towards it
+	if (position < deque->length_ - position) {
+		error_type = DEQUE_growFront(deque);
+		if (kErrorCode_Ok != error_type) {
+			return error_type;
+		}
+		for (u16 i = 0; i < position; ++i) {
+			*DEQUE_node(deque, i) = *DEQUE_node(deque, i + 1);
+		}
+	}
+	else {
+		error_type = DEQUE_growBack(deque);
+		if (kErrorCode_Ok != error_type) {
+			return error_type;
+		}
+		for (u16 i = deque->length_ - 1; i > position; --i) {
+			*DEQUE_node(deque, i) = *DEQUE_node(deque, i - 1);
+		}
+	}
+	MemoryNode* node = DEQUE_node(deque, position);
+	MEMNODE_createLite(node);
+	return node->ops_->setData(node, data, bytes);
+}
+
+void* DEQUE_extractFirst(Deque* deque) {
+	return DEQUE_extractAt(deque, 0);
+}
+
+void* DEQUE_extractLast(Deque* deque) {
+	if (NULL == deque) {
+		return NULL;
+	}
+	if (0 == deque->length_) {
+		return NULL;
+	}
+	return DEQUE_extractAt(deque, deque->length_ - 1);
+}
+
+void* DEQUE_extractAt(Deque* deque, u16 position) {
+	if (NULL == deque) {
+		return NULL;
+	}
+	if (position >= deque->length_) {
+		return NULL;
+	}
+	void* data = DEQUE_at(deque, position);
+	// close the hole moving the elements of the shorter side
+	if (position < deque->length_ - position - 1) {
+		for (u16 i = position; i > 0; --i) {
+			*DEQUE_node(deque, i) = *DEQUE_node(deque, i - 1);
+		}
+		MemoryNode* node = DEQUE_node(deque, 0);
+		node->ops_->softReset(node);
+		DEQUE_shrinkFront(deque);
+	}
+	else {
+		for (u16 i = position; i < deque->length_ - 1; ++i) {
+			*DEQUE_node(deque, i) = *DEQUE_node(deque, i + 1);
+		}
+		MemoryNode* node = DEQUE_node(deque, deque->length_ - 1);
+		node->ops_->softReset(node);
+		DEQUE_shrinkBack(deque);
+	}
+	return data;
+}
+
+s16 DEQUE_concat(Deque* deque, Deque* deque_src) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	if (NULL == deque_src) {
+		return kErrorCode_NullDequePointer;
+	}
+	deque->capacity_ += deque_src->capacity_;
+	for (u16 i = 0; i < deque_src->length_; ++i) {
+		MemoryNode* src_node = DEQUE_node(deque_src, i);
+		s16 error_type = DEQUE_growBack(deque);
+		if (kErrorCode_Ok != error_type) {
+			return error_type;
+		}
+		MemoryNode* node = DEQUE_node(deque, deque->length_ - 1);
+		error_type = node->ops_->memCopy(node, src_node->ops_->data(src_node), src_node->ops_->size(src_node));
+		if (kErrorCode_Ok != error_type) {
+			// leave no empty node at the end
+			DEQUE_shrinkBack(deque);
+			return error_type;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 DEQUE_traverse(Deque* deque, void(*callback)(MemoryNode*)) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	for (u16 i = 0; i < deque->length_; ++i) {
+		callback(DEQUE_node(deque, i));
+	}
+	return kErrorCode_Ok;
+}
+
+s16 DEQUE_traverseEx(Deque* deque, s16(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	// block by block, so the map is only looked up once per block
+	u32 offset = deque->head_;
+	u32 end = deque->head_ + deque->length_;
+	while (offset < end) {
+		MemoryNode* block = deque->blocks_[offset / kDequeBlockSize];
+		u32 block_end = (offset / kDequeBlockSize + 1) * kDequeBlockSize;
+		if (block_end > end) {
+			block_end = end;
+		}
+		for (; offset < block_end; ++offset) {
+			if (kTraverse_Stop == callback(&block[offset % kDequeBlockSize], ctx)) {
+				return kErrorCode_Ok;
+			}
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 DEQUE_traverseBatch(Deque* deque, s16(*callback)(MemoryNode**, u16, void*), void* ctx) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode* batch[kTraverseBatchLength];
+	u32 offset = deque->head_;
+	u32 end = deque->head_ + deque->length_;
+	while (offset < end) {
+		// a span ends with its block or once the batch is full
+		MemoryNode* block = deque->blocks_[offset / kDequeBlockSize];
+		u32 block_end = (offset / kDequeBlockSize + 1) * kDequeBlockSize;
+		if (block_end > end) {
+			block_end = end;
+		}
+		u16 count = 0;
+		for (; offset < block_end && count < kTraverseBatchLength; ++offset) {
+			batch[count++] = &block[offset % kDequeBlockSize];
+		}
+		if (kTraverse_Stop == callback(batch, count, ctx)) {
+			break;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+void DEQUE_print(Deque* deque) {
+	printf("	[Deque Info] Address: ");
+	if (NULL == deque) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", deque);
+	printf("	[Deque Info] Head: %u\n", deque->head_);
+	printf("	[Deque Info] Length: %d\n", deque->length_);
+	printf("	[Deque Info] Capacity: %d\n", deque->capacity_);
+	printf("	[Deque Info] Map size: %d blocks of %d\n", deque->map_size_, kDequeBlockSize);
+
+	for (u16 i = 0; i < deque->length_; ++i) {
+		printf("	[Deque Info] Storage #%d\n", i);
+		MemoryNode* node = DEQUE_node(deque, i);
+		node->ops_->print(node);
+	}
+	printf("\n");
+}
@@ -3,6 +3,7 @@
 
 #include "common_def.h"
 #include "adt_dllist.h"
+#include "adt_prefetch.h"
 
 
 #include "ABGS_MemoryManager/abgs_memory_manager.h"
@@ -27,7 +28,21 @@ static void* LIST_extractLast(DList* list);
 static void* LIST_extractAt(DList* list, u16 position);  
 static s16 LIST_concat(DList* list, DList* list_src); 
 static s16 LIST_traverse(DList* list, void(*callback)(MemoryNode*)); 
+static s16 LIST_traverseEx(DList* list, s16(*callback)(MemoryNode*, void*), void* ctx);
+static s16 LIST_traverseBatch(DList* list, s16(*callback)(MemoryNode**, u16, void*), void* ctx);
 static void LIST_print(DList* list);
+static MemoryNode* LIST_nodeAt(DList* list, u16 position);
+static s16 LIST_cursorBegin(DList* list, DListCursor* cursor);
+static s16 LIST_cursorEnd(DList* list, DListCursor* cursor);
+static void* LIST_cursorGet(DListCursor* cursor);
+static void* LIST_cursorNext(DListCursor* cursor);
+static void* LIST_cursorPrev(DListCursor* cursor);
+static s16 LIST_cursorInsertAfter(DListCursor* cursor, void* data, u16 bytes);
+static s16 LIST_cursorInsertBefore(DListCursor* cursor, void* data, u16 bytes);
+static void* LIST_cursorErase(DListCursor* cursor);
+static s16 LIST_trim(DList* list);
+static s16 LIST_setSpareLimit(DList* list, u16 limit);
+static s16 LIST_setPrefetchDistance(DList* list, u16 distance);
 
 struct dlist_ops_s dlist_ops = { .destroy = LIST_destroy,
 								  .softReset = LIST_softReset,
@@ -48,10 +63,73 @@ struct dlist_ops_s dlist_ops = { .destroy = LIST_destroy,
 								  .extractAt = LIST_extractAt,
 								  .concat = LIST_concat,
 								  .traverse = LIST_traverse,
-								  .print = LIST_print
-
+								  .traverseEx = LIST_traverseEx,
+								  .traverseBatch = LIST_traverseBatch,
+								  .print = LIST_print,
+								  .cursorBegin = LIST_cursorBegin,
+								  .cursorEnd = LIST_cursorEnd,
+								  .cursorGet = LIST_cursorGet,
+								  .cursorNext = LIST_cursorNext,
+								  .cursorPrev = LIST_cursorPrev,
+								  .cursorInsertAfter = LIST_cursorInsertAfter,
+								  .cursorInsertBefore = LIST_cursorInsertBefore,
+								  .cursorErase = LIST_cursorErase,
+								  .trim = LIST_trim,
+								  .setSpareLimit = LIST_setSpareLimit,
+								  .setPrefetchDistance = LIST_setPrefetchDistance
 };
 
+// Takes a spare node for a new element, or creates one when there are none
+static MemoryNode* LIST_takeNode(DList* list) {
+	MemoryNode* node = list->spare_;
+	if (NULL == node) {
+		return MEMNODE_create();
+	}
+	list->spare_ = node->ops_->getNext(node);
+	list->spare_length_--;
+	MEMNODE_createLite(node);
+	return node;
+}
+
+// Keeps a node whose data has been taken for the next insertions, or frees it
+// once the list holds as many spare nodes as its limit
+static void LIST_retireNode(DList* list, MemoryNode* node) {
+	if (list->spare_length_ >= list->spare_limit_) {
+		node->ops_->softFree(node);
+		return;
+	}
+	node->ops_->softReset(node);
+	node->ops_->setNext(node, list->spare_);
+	list->spare_ = node;
+	list->spare_length_++;
+}
+
+// Node distance places after node, where the prefetches of a walk start.
+// NULL when prefetching is disabled
+static MemoryNode* LIST_prefetchStart(MemoryNode* node, u16 distance) {
+	if (0 == distance) {
+		return NULL;
+	}
+	for (u16 i = 0; i < distance && NULL != node; ++i) {
+		node = node->next_;
+	}
+	return node;
+}
+
+// Prefetches the data of the node ahead of a walk and the node after it, and
+// returns that next node as the new one ahead
+static MemoryNode* LIST_prefetchAdvance(MemoryNode* ahead) {
+	if (NULL == ahead) {
+		return NULL;
+	}
+	ADT_PREFETCH(ahead->data_);
+	ahead = ahead->next_;
+	if (NULL != ahead) {
+		ADT_PREFETCH(ahead);
+	}
+	return ahead;
+}
+
 DList* DLIST_create(u16 capacity) {
 	if (capacity == 0) {
 		return NULL;
@@ -67,6 +145,12 @@ DList* DLIST_create(u16 capacity) {
 	list->tail_ = NULL;
 	list->capacity_ = capacity;
 	list->length_ = 0;
+	list->spare_ = NULL;
+	list->spare_length_ = 0;
+	list->spare_limit_ = kDListSpareLimit;
+	list->prefetch_distance_ = kDListPrefetchDistance;
+	list->finger_ = NULL;
+	list->finger_position_ = 0;
 	list->ops_ = &dlist_ops;
 	return list;
 }
@@ -75,13 +159,16 @@ s16 LIST_destroy(DList* list) {
 	if (list == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
+	LIST_trim(list);
 	if (list->ops_->isEmpty(list)) {
 		MM->free(list);
 		return kErrorCode_Ok;
 	}
 	MemoryNode* tmp = list->head_;
 	MemoryNode* tmp_next = NULL;
-	for (u16 i = 0; i < list->ops_->length(list); ++i) {
+	MemoryNode* ahead = LIST_prefetchStart(tmp, list->prefetch_distance_);
+	while (NULL != tmp) {
+		ahead = LIST_prefetchAdvance(ahead);
 		tmp_next = tmp->ops_->getNext(tmp);
 		tmp->ops_->free(tmp);
 		tmp = tmp_next;
@@ -99,14 +186,17 @@ s16 LIST_softReset(DList* list) {
 	}
 	if (NULL != list->head_) {
 		MemoryNode* tmp = list->head_;
-		for (u16 i = 0; i < list->ops_->length(list); ++i) {
-			tmp->ops_->softFree(tmp);
-			tmp = tmp->next_;
+		MemoryNode* tmp_next = NULL;
+		while (NULL != tmp) {
+			tmp_next = tmp->ops_->getNext(tmp);
+			LIST_retireNode(list, tmp);
+			tmp = tmp_next;
 		}
 		list->head_ = NULL;
 	}
 	list->length_ = 0;
 	list->tail_ = NULL;
+	list->finger_ = NULL;
 	return kErrorCode_Ok;
 }
 
@@ -120,15 +210,19 @@ s16 LIST_reset(DList* list) {
 	if (NULL != list->head_) {
 		MemoryNode* tmp = list->head_;
 		MemoryNode* tmp_next = NULL;
-		for (u16 i = 0; i < list->ops_->length(list); ++i) {
+		MemoryNode* ahead = LIST_prefetchStart(tmp, list->prefetch_distance_);
+		while (NULL != tmp) {
+			ahead = LIST_prefetchAdvance(ahead);
 			tmp_next = tmp->ops_->getNext(tmp);
-			tmp->ops_->free(tmp);
+			tmp->ops_->reset(tmp);
+			LIST_retireNode(list, tmp);
 			tmp = tmp_next;
 		}
 		list->head_ = NULL;
 	}
 	list->length_ = 0;
 	list->tail_ = NULL;
+	list->finger_ = NULL;
 	return kErrorCode_Ok;
 }
 
@@ -157,13 +251,17 @@ s16 LIST_resize(DList* list, u16 new_size) {
 		MemoryNode* tmp_node = list->tail_;
 		for (u16 i = list->ops_->length(list); i > new_size; i--) {
 			tmp_other = tmp_node->ops_->getPrev(tmp_node);
-			tmp_node->ops_->free(tmp_node);
+			tmp_node->ops_->reset(tmp_node);
+			LIST_retireNode(list, tmp_node);
 			tmp_node = tmp_other;
 		}
 		list->tail_ = tmp_node;
 		// I make sure that the next_ of the tail_ is null
 		list->tail_->ops_->setNext(list->tail_, NULL);
 		list->length_ = new_size;
+		if (list->finger_position_ >= new_size) {
+			list->finger_ = NULL;
+		}
 	}
 	list->capacity_ = new_size;
 	return kErrorCode_Ok;
@@ -237,25 +335,12 @@ void* LIST_at(DList* list, u16 position) {
 	if (position == (list->ops_->length(list) - 1)) {
 		return list->ops_->last(list);
 	}
-	MemoryNode* tmp_node = NULL;
-	if (position < (list->ops_->length(list) / 2)) {
-		tmp_node = list->head_;
-		for (u16 i = 0; i < position; i++) {
-			tmp_node = tmp_node->ops_->getNext(tmp_node);
-		}
-	}
-	else {
-		if (NULL == list->tail_) {
-			return NULL;
-		}
-		tmp_node = list->tail_;
-		for (u16 i = (list->ops_->length(list) - 1); i > position; i--) {
-			tmp_node = tmp_node->ops_->getPrev(tmp_node);
-		}
-	}
-	if (NULL == tmp_node) {
+	if (NULL == list->tail_) {
 		return NULL;        // kErrorCode_NullDoubleLPointer
 	}
+	MemoryNode* tmp_node = LIST_nodeAt(list, position);
+	list->finger_ = tmp_node;
+	list->finger_position_ = position;
 	return tmp_node->ops_->data(tmp_node);
 }
 
@@ -269,7 +354,7 @@ s16 LIST_insertFirst(DList* list, void* data, u16 bytes) {
 	if (list->ops_->isFull(list)) {
 		return kErrorCode_InsertionFailed;
 	}
-	MemoryNode* new_node = MEMNODE_create();
+	MemoryNode* new_node = LIST_takeNode(list);
 	if (new_node == NULL) {
 #ifdef VERBOSE_
 		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
@@ -289,6 +374,7 @@ s16 LIST_insertFirst(DList* list, void* data, u16 bytes) {
 		new_node->ops_->setNext(new_node, list->head_);
 	}
 	list->head_ = new_node;
+	list->finger_position_++;
 	list->length_++;
 	return kErrorCode_Ok;
 }
@@ -314,7 +400,7 @@ s16 LIST_insertLast(DList* list, void* data, u16 bytes) {
 		return kErrorCode_NullDoubleLPointer;
 	}
 	// creo el nuevo nodo
-	MemoryNode* new_node = MEMNODE_create();
+	MemoryNode* new_node = LIST_takeNode(list);
 	if (new_node == NULL) {
 #ifdef VERBOSE_
 		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
@@ -357,21 +443,9 @@ s16 LIST_insertAt(DList* list, void* data, u16 bytes, u16 position) {
 		return kErrorCode_NullDoubleLPointer;
 	}
 	// Temporary node of the position that will change
-	MemoryNode* tmp_node = NULL;
-	if (position < (list->ops_->length(list) / 2)) {
-		tmp_node = list->head_;
-		for (u16 i = 0; i < position; i++) {
-			tmp_node = tmp_node->ops_->getNext(tmp_node);
-		}
-	}
-	else {
-		tmp_node = list->tail_;
-		for (u16 i = (list->ops_->length(list) - 1); i > position; i--) {
-			tmp_node = tmp_node->ops_->getPrev(tmp_node);
-		}
-	}
+	MemoryNode* tmp_node = LIST_nodeAt(list, position);
 	// create new node
-	MemoryNode* new_node = MEMNODE_create();
+	MemoryNode* new_node = LIST_takeNode(list);
 	if (new_node == NULL) {
 #ifdef VERBOSE_
 		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
@@ -389,6 +463,8 @@ s16 LIST_insertAt(DList* list, void* data, u16 bytes, u16 position) {
 	// The new node attaches to the node that was previously in position
 	new_node->ops_->setNext(new_node, tmp_node);
 	tmp_node->ops_->setPrev(tmp_node, new_node);
+	list->finger_ = new_node;
+	list->finger_position_ = position;
 	list->length_++;
 	return kErrorCode_Ok;
 }
@@ -406,6 +482,10 @@ void* LIST_extractFirst(DList* list) {
 	// save the data_ of the first node in the list
 	void* tmp_data = list->head_->ops_->data(list->head_);
 	MemoryNode* tmp_node = list->head_;
+	if (tmp_node == list->finger_) {
+		list->finger_ = NULL;
+	}
+	list->finger_position_--;
 	list->head_ = list->head_->ops_->getNext(list->head_);
 	if (list->head_ == NULL) {
 		list->tail_ = NULL;
@@ -413,7 +493,7 @@ void* LIST_extractFirst(DList* list) {
 	else {
 		list->head_->ops_->setPrev(list->head_, NULL);
 	}
-	tmp_node->ops_->softFree(tmp_node);
+	LIST_retireNode(list, tmp_node);
 	list->length_--;
 	return tmp_data;
 }
@@ -434,9 +514,12 @@ void* LIST_extractLast(DList* list) {
 	// copio el último data que voy a devolver
 	void* tmp_data = list->tail_->ops_->data(list->tail_);
 	MemoryNode* tmp_node = list->tail_;
+	if (tmp_node == list->finger_) {
+		list->finger_ = NULL;
+	}
 	list->tail_ = list->tail_->ops_->getPrev(list->tail_);
 	list->tail_->ops_->setNext(list->tail_, NULL);
-	tmp_node->ops_->softFree(tmp_node);
+	LIST_retireNode(list, tmp_node);
 	list->length_--;
 	return tmp_data;
 }
@@ -460,23 +543,14 @@ void* LIST_extractAt(DList* list, u16 position) {
 	if (position == (list->ops_->length(list) - 1)) {
 		return list->ops_->extractLast(list);
 	}
-	MemoryNode* tmp_node = NULL;
-	if (position < (list->ops_->length(list) / 2)) {
-		tmp_node = list->head_;
-		for (u16 i = 0; i < position; i++) {
-			tmp_node = tmp_node->ops_->getNext(tmp_node);
-		}
-	}
-	else {
-		tmp_node = list->tail_;
-		for (u16 i = (list->ops_->length(list) - 1); i > position; i--) {
-			tmp_node = tmp_node->ops_->getPrev(tmp_node);
-		}
-	}
+	MemoryNode* tmp_node = LIST_nodeAt(list, position);
 	void* tmp_data = tmp_node->ops_->data(tmp_node);
 	tmp_node->ops_->setNext(tmp_node->ops_->getPrev(tmp_node), tmp_node->ops_->getNext(tmp_node));
 	tmp_node->ops_->setPrev(tmp_node->ops_->getNext(tmp_node), tmp_node->ops_->getPrev(tmp_node));
-	tmp_node->ops_->softFree(tmp_node);
+	// the following node takes over the position
+	list->finger_ = tmp_node->ops_->getNext(tmp_node);
+	list->finger_position_ = position;
+	LIST_retireNode(list, tmp_node);
 	list->length_--;
 	return tmp_data;
 }
@@ -495,14 +569,16 @@ s16 LIST_concat(DList* list, DList* list_src) {
 		return kErrorCode_NullDoubleLPointer;
 	}
 	// I copy and run through the new node
-	MemoryNode* tmp_node = MEMNODE_create();
+	MemoryNode* tmp_node = LIST_takeNode(list);
 	// I create a node that points to the head_
 	MemoryNode* head_node = tmp_node;
 	MemoryNode* prev_node = NULL;
+	MemoryNode* ahead = LIST_prefetchStart(list_src->head_, list->prefetch_distance_);
 	for (MemoryNode* node = list_src->head_; node != NULL; node = node->ops_->getNext(node)) {
+		ahead = LIST_prefetchAdvance(ahead);
 		tmp_node->ops_->memCopy(tmp_node, node->ops_->data(node), node->ops_->size(node));
 		if (NULL != node->ops_->getNext(node)) {
-			tmp_node->ops_->setNext(tmp_node, MEMNODE_create());
+			tmp_node->ops_->setNext(tmp_node, LIST_takeNode(list));
 			prev_node = tmp_node;
 			tmp_node = tmp_node->ops_->getNext(tmp_node);
 			tmp_node->ops_->setPrev(tmp_node, prev_node);
@@ -531,16 +607,61 @@ s16 LIST_traverse(DList* list, void(*callback)(MemoryNode*)) {
 	if (list->head_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-	MemoryNode* tmp = list->head_;
-	for (u16 i = 0; i < list->ops_->length(list); i++)
-	{
+	MemoryNode* ahead = LIST_prefetchStart(list->head_, list->prefetch_distance_);
+	for (MemoryNode* tmp = list->head_; NULL != tmp; tmp = tmp->next_) {
+		ahead = LIST_prefetchAdvance(ahead);
 		callback(tmp);
-		tmp = tmp->next_;
 	}
 
 	return kErrorCode_Ok;
 }
 
+s16 LIST_traverseEx(DList* list, s16(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (NULL == list->head_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode* ahead = LIST_prefetchStart(list->head_, list->prefetch_distance_);
+	for (MemoryNode* tmp = list->head_; NULL != tmp; tmp = tmp->next_) {
+		ahead = LIST_prefetchAdvance(ahead);
+		if (kTraverse_Stop == callback(tmp, ctx)) {
+			break;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 LIST_traverseBatch(DList* list, s16(*callback)(MemoryNode**, u16, void*), void* ctx) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (NULL == list->head_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode* batch[kTraverseBatchLength];
+	u16 count = 0;
+	MemoryNode* ahead = LIST_prefetchStart(list->head_, list->prefetch_distance_);
+	for (MemoryNode* tmp = list->head_; NULL != tmp; tmp = tmp->next_) {
+		ahead = LIST_prefetchAdvance(ahead);
+		batch[count++] = tmp;
+		if (kTraverseBatchLength == count || NULL == tmp->next_) {
+			if (kTraverse_Stop == callback(batch, count, ctx)) {
+				break;
+			}
+			count = 0;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
 void LIST_print(DList* list) {
 	printf("	[List Info] Address: ");
 	if (NULL == list) {
@@ -550,6 +671,7 @@ void LIST_print(DList* list) {
 	printf("%p\n", list);
 	printf("	[List Info] Length: %d\n", list->length_);
 	printf("	[List Info] Capacity: %d\n", list->capacity_);
+	printf("	[List Info] Spare nodes: %d of %d\n", list->spare_length_, list->spare_limit_);
 	printf("	[List Info] First address: ");
 	if (NULL == list->head_) {
 		printf(" NULL\n");
@@ -571,13 +693,7 @@ void LIST_print(DList* list) {
 		printf("\n");
 		return;
 	}
-	u16 listLenght = list->ops_->length(list);
-	for (u16 i = 0; i < listLenght; ++i) {
-		if (NULL == otherNode) {
-			otherNode = NULL;
-			printf("\n");
-			return;
-		}
+	for (u16 i = 0; NULL != otherNode; ++i) {
 		printf("		[List Info] Storage #%d\n", i);
 		otherNode->ops_->print(otherNode);
 		otherNode = otherNode->ops_->getNext(otherNode);
@@ -585,3 +701,229 @@ void LIST_print(DList* list) {
 	otherNode = NULL;
 	printf("\n");
 }
+
+// Walks to position from whichever of head_, tail_ or finger_ is nearest.
+// position must be a valid index of a non empty list
+MemoryNode* LIST_nodeAt(DList* list, u16 position) {
+	MemoryNode* tmp_node = list->head_;
+	u16 from = 0;
+	u16 distance = position;
+	if (list->length_ - 1 - position < distance) {
+		tmp_node = list->tail_;
+		from = list->length_ - 1;
+		distance = from - position;
+	}
+	if (NULL != list->finger_) {
+		u16 finger_distance = position > list->finger_position_ ?
+			position - list->finger_position_ : list->finger_position_ - position;
+		if (finger_distance < distance) {
+			tmp_node = list->finger_;
+			from = list->finger_position_;
+		}
+	}
+	for (; from < position; ++from) {
+		tmp_node = tmp_node->ops_->getNext(tmp_node);
+	}
+	for (; from > position; --from) {
+		tmp_node = tmp_node->ops_->getPrev(tmp_node);
+	}
+	return tmp_node;
+}
+
+s16 LIST_cursorBegin(DList* list, DListCursor* cursor) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (NULL == cursor) {
+		return kErrorCode_NullPointer;
+	}
+	cursor->list_ = list;
+	cursor->node_ = list->head_;
+	cursor->position_ = 0;
+	return kErrorCode_Ok;
+}
+
+s16 LIST_cursorEnd(DList* list, DListCursor* cursor) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (NULL == cursor) {
+		return kErrorCode_NullPointer;
+	}
+	cursor->list_ = list;
+	cursor->node_ = list->tail_;
+	cursor->position_ = list->length_ > 0 ? list->length_ - 1 : 0;
+	return kErrorCode_Ok;
+}
+
+void* LIST_cursorGet(DListCursor* cursor) {
+	if (NULL == cursor || NULL == cursor->node_) {
+		return NULL;
+	}
+	return cursor->node_->ops_->data(cursor->node_);
+}
+
+void* LIST_cursorNext(DListCursor* cursor) {
+	if (NULL == cursor || NULL == cursor->node_) {
+		return NULL;
+	}
+	cursor->node_ = cursor->node_->ops_->getNext(cursor->node_);
+	cursor->position_++;
+	return LIST_cursorGet(cursor);
+}
+
+void* LIST_cursorPrev(DListCursor* cursor) {
+	if (NULL == cursor || 0 == cursor->position_) {
+		return NULL;
+	}
+	if (NULL == cursor->node_) {
+		cursor->node_ = cursor->list_->tail_;
+	}
+	else {
+		cursor->node_ = cursor->node_->ops_->getPrev(cursor->node_);
+	}
+	cursor->position_--;
+	return LIST_cursorGet(cursor);
+}
+
+// Checks an insertion at the cursor and creates its node
+static s16 LIST_cursorNewNode(DListCursor* cursor, void* data, u16 bytes, MemoryNode** new_node) {
+	if (NULL == cursor || NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (NULL == cursor->list_) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	if (cursor->list_->ops_->isFull(cursor->list_)) {
+		return kErrorCode_InsertionFailed;
+	}
+	*new_node = LIST_takeNode(cursor->list_);
+	if (NULL == *new_node) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return kErrorCode_NullMemoryNode;
+	}
+	(*new_node)->ops_->setData(*new_node, data, bytes);
+	return kErrorCode_Ok;
+}
+
+s16 LIST_cursorInsertAfter(DListCursor* cursor, void* data, u16 bytes) {
+	if (NULL != cursor && NULL == cursor->node_) {
+		return LIST_cursorInsertBefore(cursor, data, bytes);
+	}
+	MemoryNode* new_node = NULL;
+	s16 error_type = LIST_cursorNewNode(cursor, data, bytes, &new_node);
+	if (kErrorCode_Ok != error_type) {
+		return error_type;
+	}
+	DList* list = cursor->list_;
+	MemoryNode* next_node = cursor->node_->ops_->getNext(cursor->node_);
+	new_node->ops_->setPrev(new_node, cursor->node_);
+	new_node->ops_->setNext(new_node, next_node);
+	cursor->node_->ops_->setNext(cursor->node_, new_node);
+	if (NULL == next_node) {
+		list->tail_ = new_node;
+	}
+	else {
+		next_node->ops_->setPrev(next_node, new_node);
+	}
+	list->finger_ = NULL;
+	list->length_++;
+	return kErrorCode_Ok;
+}
+
+s16 LIST_cursorInsertBefore(DListCursor* cursor, void* data, u16 bytes) {
+	MemoryNode* new_node = NULL;
+	s16 error_type = LIST_cursorNewNode(cursor, data, bytes, &new_node);
+	if (kErrorCode_Ok != error_type) {
+		return error_type;
+	}
+	DList* list = cursor->list_;
+	// past the end the element goes after the tail
+	MemoryNode* prev_node = NULL == cursor->node_ ? list->tail_ : cursor->node_->ops_->getPrev(cursor->node_);
+	new_node->ops_->setPrev(new_node, prev_node);
+	new_node->ops_->setNext(new_node, cursor->node_);
+	if (NULL == prev_node) {
+		list->head_ = new_node;
+	}
+	else {
+		prev_node->ops_->setNext(prev_node, new_node);
+	}
+	if (NULL == cursor->node_) {
+		list->tail_ = new_node;
+	}
+	else {
+		cursor->node_->ops_->setPrev(cursor->node_, new_node);
+	}
+	cursor->position_++;
+	list->finger_ = NULL;
+	list->length_++;
+	return kErrorCode_Ok;
+}
+
+void* LIST_cursorErase(DListCursor* cursor) {
+	if (NULL == cursor || NULL == cursor->node_) {
+		return NULL;
+	}
+	DList* list = cursor->list_;
+	MemoryNode* tmp_node = cursor->node_;
+	MemoryNode* prev_node = tmp_node->ops_->getPrev(tmp_node);
+	MemoryNode* next_node = tmp_node->ops_->getNext(tmp_node);
+	void* tmp_data = tmp_node->ops_->data(tmp_node);
+	if (NULL == prev_node) {
+		list->head_ = next_node;
+	}
+	else {
+		prev_node->ops_->setNext(prev_node, next_node);
+	}
+	if (NULL == next_node) {
+		list->tail_ = prev_node;
+	}
+	else {
+		next_node->ops_->setPrev(next_node, prev_node);
+	}
+	LIST_retireNode(list, tmp_node);
+	cursor->node_ = next_node;
+	list->finger_ = NULL;
+	list->length_--;
+	return tmp_data;
+}
+
+s16 LIST_trim(DList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	while (NULL != list->spare_) {
+		MemoryNode* tmp_node = list->spare_;
+		list->spare_ = tmp_node->ops_->getNext(tmp_node);
+		tmp_node->ops_->softFree(tmp_node);
+	}
+	list->spare_length_ = 0;
+	return kErrorCode_Ok;
+}
+
+s16 LIST_setSpareLimit(DList* list, u16 limit) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	list->spare_limit_ = limit;
+	while (list->spare_length_ > limit) {
+		MemoryNode* tmp_node = list->spare_;
+		list->spare_ = tmp_node->ops_->getNext(tmp_node);
+		tmp_node->ops_->softFree(tmp_node);
+		list->spare_length_--;
+	}
+	return kErrorCode_Ok;
+}
+
+s16 LIST_setPrefetchDistance(DList* list, u16 distance) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	list->prefetch_distance_ = distance;
+	return kErrorCode_Ok;
+}
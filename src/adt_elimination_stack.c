@@ -0,0 +1,282 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_atomic.h"
+#include "adt_hazard.h"
+#include "adt_elimination_stack.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//EliminationStack Declarations
+static s16 ELIMINATIONSTACK_destroy(EliminationStack* stack);
+static u16 ELIMINATIONSTACK_capacity(EliminationStack* stack);
+static u16 ELIMINATIONSTACK_length(EliminationStack* stack);
+static bool ELIMINATIONSTACK_isEmpty(EliminationStack* stack);
+static bool ELIMINATIONSTACK_isFull(EliminationStack* stack);
+static u32 ELIMINATIONSTACK_eliminated(EliminationStack* stack);
+static s16 ELIMINATIONSTACK_push(EliminationStack* stack, void* data, u16 bytes);
+static void* ELIMINATIONSTACK_pop(EliminationStack* stack);
+static void ELIMINATIONSTACK_print(EliminationStack* stack);
+
+struct elimination_stack_ops_s elimination_stack_ops = { .destroy = ELIMINATIONSTACK_destroy,
+														.capacity = ELIMINATIONSTACK_capacity,
+														.length = ELIMINATIONSTACK_length,
+														.isEmpty = ELIMINATIONSTACK_isEmpty,
+														.isFull = ELIMINATIONSTACK_isFull,
+														.eliminated = ELIMINATIONSTACK_eliminated,
+														.push = ELIMINATIONSTACK_push,
+														.pop = ELIMINATIONSTACK_pop,
+														.print = ELIMINATIONSTACK_print
+};
+
+// Shared link fields, read and written atomically
+#define TOP(stack) ((void* volatile*)&(stack)->top_)
+#define NEXT(node) ((void* volatile*)&(node)->next_)
+#define OFFER(slot) ((void* volatile*)&(slot)->offer_)
+
+// Slots of the array the calling thread picks from, 1 to kEliminationSlots
+static ADT_THREAD_LOCAL u32 elimination_range = 1;
+// State of the random slot choice of the calling thread
+static ADT_THREAD_LOCAL u32 elimination_seed = 0;
+
+// Random slot among the first elimination_range ones
+static EliminationSlot* ELIMINATIONSTACK_slot(EliminationStack* stack) {
+	if (0 == elimination_seed) {
+		// every thread has its own copy, at its own address
+		elimination_seed = (u32)(size_t)&elimination_seed | 1;
+	}
+	elimination_seed ^= elimination_seed << 13;
+	elimination_seed ^= elimination_seed >> 17;
+	elimination_seed ^= elimination_seed << 5;
+	return &stack->slots_[elimination_seed % elimination_range];
+}
+
+// A partner was found: spread over more slots, the array is busy
+static void ELIMINATIONSTACK_widen() {
+	if (elimination_range < kEliminationSlots) {
+		elimination_range <<= 1;
+	}
+}
+
+// Nobody came: gather in fewer slots so pushes and pops meet more often
+static void ELIMINATIONSTACK_narrow() {
+	if (elimination_range > 1) {
+		elimination_range >>= 1;
+	}
+}
+
+// Leaves node in a slot for a while. Returns true if a pop took it. The node is
+// protected meanwhile, so it can't be reused and offered again while this thread
+// still compares the slot with it
+static bool ELIMINATIONSTACK_offer(EliminationStack* stack, HazardRecord* record, MemoryNode* node) {
+	EliminationSlot* slot = ELIMINATIONSTACK_slot(stack);
+	HAZARD_protect(record, 1, node);
+	if (!ATOMIC_casPtr(OFFER(slot), NULL, node)) {
+		// another push waits there, the slots are crowded
+		HAZARD_protect(record, 1, NULL);
+		ELIMINATIONSTACK_widen();
+		return false;
+	}
+	for (u32 i = 0; i < kEliminationSpins; ++i) {
+		if (node != ATOMIC_loadPtr(OFFER(slot))) {
+			break;
+		}
+	}
+	// taking the node back fails if a pop got it first
+	bool taken = !ATOMIC_casPtr(OFFER(slot), node, NULL);
+	HAZARD_protect(record, 1, NULL);
+	if (taken) {
+		ELIMINATIONSTACK_widen();
+	}
+	else {
+		ELIMINATIONSTACK_narrow();
+	}
+	return taken;
+}
+
+// Waits a while in a slot for a push. Returns the node it left there, which
+// now belongs to the caller, or NULL if nobody came
+static MemoryNode* ELIMINATIONSTACK_take(EliminationStack* stack) {
+	EliminationSlot* slot = ELIMINATIONSTACK_slot(stack);
+	for (u32 i = 0; i < kEliminationSpins; ++i) {
+		MemoryNode* node = ATOMIC_loadPtr(OFFER(slot));
+		// the node is not read until the swap makes it ours
+		if (NULL != node && ATOMIC_casPtr(OFFER(slot), node, NULL)) {
+			ELIMINATIONSTACK_widen();
+			return node;
+		}
+	}
+	ELIMINATIONSTACK_narrow();
+	return NULL;
+}
+
+EliminationStack* ELIMINATIONSTACK_create(u16 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	EliminationStack* stack = (EliminationStack*)MM->malloc(sizeof(EliminationStack));
+	if (NULL == stack) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	stack->top_ = NULL;
+	stack->length_ = 0;
+	stack->capacity_ = capacity;
+	stack->eliminated_ = 0;
+	for (u16 i = 0; i < kEliminationSlots; ++i) {
+		stack->slots_[i].offer_ = NULL;
+	}
+	stack->ops_ = &elimination_stack_ops;
+	return stack;
+}
+
+s16 ELIMINATIONSTACK_destroy(EliminationStack* stack) {
+	if (NULL == stack) {
+		return kErrorCode_NullStackPointer;
+	}
+	MemoryNode* node = stack->top_;
+	while (NULL != node) {
+		MemoryNode* next = node->ops_->getNext(node);
+		node->ops_->free(node);
+		node = next;
+	}
+	MM->free(stack);
+	return kErrorCode_Ok;
+}
+
+u16 ELIMINATIONSTACK_capacity(EliminationStack* stack) {
+	if (NULL == stack) {
+		return 0;
+	}
+	return stack->capacity_;
+}
+
+u16 ELIMINATIONSTACK_length(EliminationStack* stack) {
+	if (NULL == stack) {
+		return 0;
+	}
+	return (u16)ATOMIC_loadU32(&stack->length_);
+}
+
+bool ELIMINATIONSTACK_isEmpty(EliminationStack* stack) {
+	if (NULL == stack) {
+		return false;
+	}
+	return NULL == ATOMIC_loadPtr(TOP(stack));
+}
+
+bool ELIMINATIONSTACK_isFull(EliminationStack* stack) {
+	if (NULL == stack) {
+		return false;
+	}
+	return ATOMIC_loadU32(&stack->length_) >= stack->capacity_;
+}
+
+u32 ELIMINATIONSTACK_eliminated(EliminationStack* stack) {
+	if (NULL == stack) {
+		return 0;
+	}
+	return ATOMIC_loadU32(&stack->eliminated_);
+}
+
+s16 ELIMINATIONSTACK_push(EliminationStack* stack, void* data, u16 bytes) {
+	if (NULL == stack) {
+		return kErrorCode_NullStackPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	HazardRecord* record = HAZARD_acquire();
+	if (NULL == record) {
+		return kErrorCode_InsertionFailed;
+	}
+	// the place is booked before the node is linked, so the capacity is never exceeded
+	if (ATOMIC_addU32(&stack->length_, 1) >= stack->capacity_) {
+		ATOMIC_addU32(&stack->length_, -1);
+		return kErrorCode_InsertionFailed;
+	}
+	MemoryNode* node = HAZARD_takeNode(record);
+	if (NULL == node) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		ATOMIC_addU32(&stack->length_, -1);
+		return kErrorCode_NullMemoryNode;
+	}
+	node->ops_->setData(node, data, bytes);
+	for (;;) {
+		MemoryNode* top = ATOMIC_loadPtr(TOP(stack));
+		ATOMIC_storePtr(NEXT(node), top);
+		if (ATOMIC_casPtr(TOP(stack), top, node)) {
+			return kErrorCode_Ok;
+		}
+		// lost the race on the top, a pop may take the node on the side
+		if (ELIMINATIONSTACK_offer(stack, record, node)) {
+			return kErrorCode_Ok;
+		}
+	}
+}
+
+void* ELIMINATIONSTACK_pop(EliminationStack* stack) {
+	if (NULL == stack) {
+		return NULL;
+	}
+	HazardRecord* record = HAZARD_acquire();
+	if (NULL == record) {
+		return NULL;
+	}
+	MemoryNode* node = NULL;
+	for (;;) {
+		MemoryNode* top = ATOMIC_loadPtr(TOP(stack));
+		if (NULL == top) {
+			HAZARD_protect(record, 0, NULL);
+			return NULL;
+		}
+		// the node can only be read once it is protected and still on the top
+		HAZARD_protect(record, 0, top);
+		if (top != ATOMIC_loadPtr(TOP(stack))) {
+			continue;
+		}
+		if (ATOMIC_casPtr(TOP(stack), top, ATOMIC_loadPtr(NEXT(top)))) {
+			node = top;
+			break;
+		}
+		// lost the race on the top, a push may hand its node on the side
+		node = ELIMINATIONSTACK_take(stack);
+		if (NULL != node) {
+			ATOMIC_addU32(&stack->eliminated_, 1);
+			break;
+		}
+	}
+	HAZARD_protect(record, 0, NULL);
+	void* data = node->ops_->data(node);
+	ATOMIC_addU32(&stack->length_, -1);
+	HAZARD_retire(record, node);
+	return data;
+}
+
+void ELIMINATIONSTACK_print(EliminationStack* stack) {
+	printf("	[EliminationStack Info] Address: ");
+	if (NULL == stack) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", stack);
+	printf("	[EliminationStack Info] Length: %d\n", stack->length_);
+	printf("	[EliminationStack Info] Capacity: %d\n", stack->capacity_);
+	printf("	[EliminationStack Info] Eliminated pairs: %u\n", stack->eliminated_);
+
+	u16 i = 0;
+	for (MemoryNode* node = stack->top_; NULL != node; node = node->ops_->getNext(node)) {
+		printf("		[EliminationStack Info] Storage #%d\n", i++);
+		node->ops_->print(node);
+	}
+	printf("\n");
+}
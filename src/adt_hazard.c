@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_atomic.h"
+#include "adt_hazard.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+// Records of every thread, claimed with active_
+static HazardRecord hazard_records[kHazardMaxThreads];
+// Record owned by the calling thread
+static ADT_THREAD_LOCAL HazardRecord* hazard_thread_record = NULL;
+
+// Keeps a reclaimed node in the cache of the record, or frees it once the cache is full
+static void HAZARD_reclaim(HazardRecord* record, MemoryNode* node) {
+	if (record->cache_length_ >= kHazardCacheLimit) {
+		node->ops_->softFree(node);
+		return;
+	}
+	node->ops_->softReset(node);
+	node->ops_->setPrev(node, record->cache_);
+	record->cache_ = node;
+	record->cache_length_++;
+}
+
+// Reclaims every retired node of the record that no hazard pointer points at
+static void HAZARD_scan(HazardRecord* record) {
+	void* hazards[kHazardMaxThreads * kHazardPointers];
+	u16 hazards_length = 0;
+	for (u16 i = 0; i < kHazardMaxThreads; ++i) {
+		for (u8 slot = 0; slot < kHazardPointers; ++slot) {
+			void* node = ATOMIC_loadPtr(&hazard_records[i].hazard_[slot]);
+			if (NULL != node) {
+				hazards[hazards_length++] = node;
+			}
+		}
+	}
+	MemoryNode* node = record->retired_;
+	record->retired_ = NULL;
+	record->retired_length_ = 0;
+	while (NULL != node) {
+		MemoryNode* prev = node->ops_->getPrev(node);
+		bool hazardous = false;
+		for (u16 i = 0; i < hazards_length && !hazardous; ++i) {
+			hazardous = hazards[i] == node;
+		}
+		if (hazardous) {
+			node->ops_->setPrev(node, record->retired_);
+			record->retired_ = node;
+			record->retired_length_++;
+		}
+		else {
+			HAZARD_reclaim(record, node);
+		}
+		node = prev;
+	}
+}
+
+// Frees a chain of nodes linked through prev_
+static void HAZARD_freeChain(MemoryNode* node) {
+	while (NULL != node) {
+		MemoryNode* prev = node->ops_->getPrev(node);
+		node->ops_->softFree(node);
+		node = prev;
+	}
+}
+
+HazardRecord* HAZARD_acquire() {
+	if (NULL != hazard_thread_record) {
+		return hazard_thread_record;
+	}
+	for (u16 i = 0; i < kHazardMaxThreads; ++i) {
+		if (0 == ATOMIC_loadU32(&hazard_records[i].active_) &&
+			ATOMIC_casU32(&hazard_records[i].active_, 0, 1)) {
+			hazard_thread_record = &hazard_records[i];
+			return hazard_thread_record;
+		}
+	}
+#ifdef VERBOSE_
+	printf("Error: [%s] more than %d threads are using lock-free data types\n", __FUNCTION__, kHazardMaxThreads);
+#endif
+	return NULL;
+}
+
+void HAZARD_protect(HazardRecord* record, u8 slot, void* node) {
+	ATOMIC_storePtr(&record->hazard_[slot], node);
+}
+
+MemoryNode* HAZARD_takeNode(HazardRecord* record) {
+	MemoryNode* node = record->cache_;
+	if (NULL == node) {
+		return MEMNODE_create();
+	}
+	record->cache_ = node->ops_->getPrev(node);
+	record->cache_length_--;
+	MEMNODE_createLite(node);
+	return node;
+}
+
+void HAZARD_retire(HazardRecord* record, MemoryNode* node) {
+	node->ops_->setPrev(node, record->retired_);
+	record->retired_ = node;
+	record->retired_length_++;
+	if (record->retired_length_ >= kHazardScanThreshold) {
+		HAZARD_scan(record);
+	}
+}
+
+void HAZARD_release() {
+	HazardRecord* record = hazard_thread_record;
+	if (NULL == record) {
+		return;
+	}
+	for (u8 slot = 0; slot < kHazardPointers; ++slot) {
+		HAZARD_protect(record, slot, NULL);
+	}
+	HAZARD_scan(record);
+	HAZARD_freeChain(record->cache_);
+	record->cache_ = NULL;
+	record->cache_length_ = 0;
+	hazard_thread_record = NULL;
+	ATOMIC_storeU32(&record->active_, 0);
+}
+
+void HAZARD_destroy() {
+	for (u16 i = 0; i < kHazardMaxThreads; ++i) {
+		HazardRecord* record = &hazard_records[i];
+		HAZARD_freeChain(record->retired_);
+		HAZARD_freeChain(record->cache_);
+		record->retired_ = NULL;
+		record->retired_length_ = 0;
+		record->cache_ = NULL;
+		record->cache_length_ = 0;
+	}
+}
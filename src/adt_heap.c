@@ -0,0 +1,406 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_heap.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//Heap Declarations
+static s16 HEAP_destroy(Heap* heap);
+static s16 HEAP_softReset(Heap* heap);
+static s16 HEAP_reset(Heap* heap);
+static s16 HEAP_resize(Heap* heap, u16 new_size);
+static u16 HEAP_capacity(Heap* heap);
+static u16 HEAP_length(Heap* heap);
+static bool HEAP_isEmpty(Heap* heap);
+static bool HEAP_isFull(Heap* heap);
+static void* HEAP_top(Heap* heap);
+static s32 HEAP_topKey(Heap* heap);
+static s16 HEAP_push(Heap* heap, void* data, u16 bytes, s32 key);
+static s16 HEAP_heapify(Heap* heap, MemoryNode* nodes, s32* keys, u16 count);
+static void* HEAP_pop(Heap* heap);
+static s16 HEAP_traverse(Heap* heap, void(*callback)(MemoryNode*));
+static void HEAP_print(Heap* heap);
+
+struct heap_ops_s heap_ops = { .destroy = HEAP_destroy,
+								.softReset = HEAP_softReset,
+								.reset = HEAP_reset,
+								.resize = HEAP_resize,
+								.capacity = HEAP_capacity,
+								.length = HEAP_length,
+								.isEmpty = HEAP_isEmpty,
+								.isFull = HEAP_isFull,
+								.top = HEAP_top,
+								.topKey = HEAP_topKey,
+								.push = HEAP_push,
+								.heapify = HEAP_heapify,
+								.pop = HEAP_pop,
+								.traverse = HEAP_traverse,
+								.print = HEAP_print
+};
+
+// Allocates a heap, with a key per element when compare is NULL
+static Heap* HEAP_createInternal(u16 capacity, u8 arity, s16(*compare)(MemoryNode*, MemoryNode*)) {
+	if (0 == capacity || (2 != arity && 4 != arity)) {
+		return NULL;
+	}
+	Heap* heap = (Heap*)MM->malloc(sizeof(Heap));
+	if (NULL == heap) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	heap->storage_ = (MemoryNode*)MM->malloc(sizeof(MemoryNode) * capacity);
+	heap->keys_ = NULL;
+	if (NULL == compare) {
+		heap->keys_ = (s32*)MM->malloc(sizeof(s32) * capacity);
+	}
+	if (NULL == heap->storage_ || (NULL == compare && NULL == heap->keys_)) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		if (NULL != heap->storage_) {
+			MM->free(heap->storage_);
+		}
+		if (NULL != heap->keys_) {
+			MM->free(heap->keys_);
+		}
+		MM->free(heap);
+		return NULL;
+	}
+	for (u16 i = 0; i < capacity; ++i) {
+		MEMNODE_createLite(&heap->storage_[i]);
+	}
+	heap->compare_ = compare;
+	heap->length_ = 0;
+	heap->capacity_ = capacity;
+	heap->arity_ = arity;
+	heap->ops_ = &heap_ops;
+	return heap;
+}
+
+Heap* HEAP_create(u16 capacity, u8 arity, s16(*compare)(MemoryNode*, MemoryNode*)) {
+	if (NULL == compare) {
+		return NULL;
+	}
+	return HEAP_createInternal(capacity, arity, compare);
+}
+
+Heap* HEAP_createWithKeys(u16 capacity, u8 arity) {
+	return HEAP_createInternal(capacity, arity, NULL);
+}
+
+// True when the element a goes before the element b
+static bool HEAP_before(Heap* heap, u32 a, u32 b) {
+	if (NULL != heap->keys_) {
+		return heap->keys_[a] < heap->keys_[b];
+	}
+	return heap->compare_(&heap->storage_[a], &heap->storage_[b]) < 0;
+}
+
+// Moves the element at position up until its parent goes before it
+static void HEAP_siftUp(Heap* heap, u32 position) {
+	MemoryNode node = heap->storage_[position];
+	s32 key = NULL != heap->keys_ ? heap->keys_[position] : 0;
+	while (position > 0) {
+		u32 parent = (position - 1) / heap->arity_;
+		bool parent_after = NULL != heap->keys_ ? key < heap->keys_[parent] :
+			heap->compare_(&node, &heap->storage_[parent]) < 0;
+		if (!parent_after) {
+			break;
+		}
+		// the parent drops into the hole, the element is written once at the end
+		heap->storage_[position] = heap->storage_[parent];
+		if (NULL != heap->keys_) {
+			heap->keys_[position] = heap->keys_[parent];
+		}
+		position = parent;
+	}
+	heap->storage_[position] = node;
+	if (NULL != heap->keys_) {
+		heap->keys_[position] = key;
+	}
+}
+
+// Moves the element at position down until every child goes after it
+static void HEAP_siftDown(Heap* heap, u32 position) {
+	u32 length = heap->length_;
+	u32 arity = heap->arity_;
+	MemoryNode node = heap->storage_[position];
+	s32 key = NULL != heap->keys_ ? heap->keys_[position] : 0;
+	for (;;) {
+		u32 first_child = arity * position + 1;
+		if (first_child >= length) {
+			break;
+		}
+		u32 last_child = first_child + arity;
+		if (last_child > length) {
+			last_child = length;
+		}
+		u32 best = first_child;
+		for (u32 child = first_child + 1; child < last_child; ++child) {
+			if (HEAP_before(heap, child, best)) {
+				best = child;
+			}
+		}
+		bool child_before = NULL != heap->keys_ ? heap->keys_[best] < key :
+			heap->compare_(&heap->storage_[best], &node) < 0;
+		if (!child_before) {
+			break;
+		}
+		heap->storage_[position] = heap->storage_[best];
+		if (NULL != heap->keys_) {
+			heap->keys_[position] = heap->keys_[best];
+		}
+		position = best;
+	}
+	heap->storage_[position] = node;
+	if (NULL != heap->keys_) {
+		heap->keys_[position] = key;
+	}
+}
+
+s16 HEAP_destroy(Heap* heap) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	for (u16 i = 0; i < heap->length_; ++i) {
+		heap->storage_[i].ops_->reset(&heap->storage_[i]);
+	}
+	MM->free(heap->storage_);
+	if (NULL != heap->keys_) {
+		MM->free(heap->keys_);
+	}
+	MM->free(heap);
+	return kErrorCode_Ok;
+}
+
+s16 HEAP_softReset(Heap* heap) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	for (u16 i = 0; i < heap->length_; ++i) {
+		heap->storage_[i].ops_->softReset(&heap->storage_[i]);
+	}
+	heap->length_ = 0;
+	return kErrorCode_Ok;
+}
+
+s16 HEAP_reset(Heap* heap) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	for (u16 i = 0; i < heap->length_; ++i) {
+		heap->storage_[i].ops_->reset(&heap->storage_[i]);
+	}
+	heap->length_ = 0;
+	return kErrorCode_Ok;
+}
+
+s16 HEAP_resize(Heap* heap, u16 new_size) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	if (0 == new_size) {
+		return kErrorCode_InvalidValue;
+	}
+	if (new_size == heap->capacity_) {
+		return kErrorCode_Ok;
+	}
+	MemoryNode* storage = (MemoryNode*)MM->malloc(sizeof(MemoryNode) * new_size);
+	s32* keys = NULL;
+	if (NULL != heap->keys_) {
+		keys = (s32*)MM->malloc(sizeof(s32) * new_size);
+	}
+	if (NULL == storage || (NULL != heap->keys_ && NULL == keys)) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		if (NULL != storage) {
+			MM->free(storage);
+		}
+		if (NULL != keys) {
+			MM->free(keys);
+		}
+		return kErrorCode_NullMemoryAllocation;
+	}
+	// the tail of the array are leaves, dropping them keeps the heap order
+	u16 kept = heap->length_ < new_size ? heap->length_ : new_size;
+	for (u16 i = kept; i < heap->length_; ++i) {
+		heap->storage_[i].ops_->reset(&heap->storage_[i]);
+	}
+	for (u16 i = 0; i < new_size; ++i) {
+		if (i < kept) {
+			storage[i] = heap->storage_[i];
+			if (NULL != keys) {
+				keys[i] = heap->keys_[i];
+			}
+		}
+		else {
+			MEMNODE_createLite(&storage[i]);
+		}
+	}
+	MM->free(heap->storage_);
+	if (NULL != heap->keys_) {
+		MM->free(heap->keys_);
+	}
+	heap->storage_ = storage;
+	heap->keys_ = keys;
+	heap->length_ = kept;
+	heap->capacity_ = new_size;
+	return kErrorCode_Ok;
+}
+
+u16 HEAP_capacity(Heap* heap) {
+	if (NULL == heap) {
+		return 0;
+	}
+	return heap->capacity_;
+}
+
+u16 HEAP_length(Heap* heap) {
+	if (NULL == heap) {
+		return 0;
+	}
+	return heap->length_;
+}
+
+bool HEAP_isEmpty(Heap* heap) {
+	if (NULL == heap) {
+		return false;
+	}
+	return 0 == heap->length_;
+}
+
+bool HEAP_isFull(Heap* heap) {
+	if (NULL == heap) {
+		return false;
+	}
+	return heap->length_ >= heap->capacity_;
+}
+
+void* HEAP_top(Heap* heap) {
+	if (NULL == heap || 0 == heap->length_) {
+		return NULL;
+	}
+	return heap->storage_[0].ops_->data(&heap->storage_[0]);
+}
+
+s32 HEAP_topKey(Heap* heap) {
+	if (NULL == heap || 0 == heap->length_ || NULL == heap->keys_) {
+		return 0;
+	}
+	return heap->keys_[0];
+}
+
+s16 HEAP_push(Heap* heap, void* data, u16 bytes, s32 key) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	if (heap->length_ >= heap->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	u16 position = heap->length_++;
+	heap->storage_[position].ops_->setData(&heap->storage_[position], data, bytes);
+	if (NULL != heap->keys_) {
+		heap->keys_[position] = key;
+	}
+	HEAP_siftUp(heap, position);
+	return kErrorCode_Ok;
+}
+
+s16 HEAP_heapify(Heap* heap, MemoryNode* nodes, s32* keys, u16 count) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	if (NULL == nodes || (NULL != heap->keys_ && NULL == keys)) {
+		return kErrorCode_NullPointer;
+	}
+	if ((u32)heap->length_ + count > heap->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	for (u16 i = 0; i < count; ++i) {
+		if (NULL == nodes[i].data_ || 0 == nodes[i].size_) {
+			return kErrorCode_NullPointer;
+		}
+	}
+	u16 start = heap->length_;
+	for (u16 i = 0; i < count; ++i) {
+		MemoryNode* node = &heap->storage_[start + i];
+		node->ops_->setData(node, nodes[i].data_, nodes[i].size_);
+		if (NULL != heap->keys_) {
+			heap->keys_[start + i] = keys[i];
+		}
+	}
+	heap->length_ += count;
+	if (heap->length_ < 2) {
+		return kErrorCode_Ok;
+	}
+	// Floyd: sift down every parent from the last one, leaves are already heaps
+	u32 position = (heap->length_ - 2) / heap->arity_ + 1;
+	while (position > 0) {
+		HEAP_siftDown(heap, --position);
+	}
+	return kErrorCode_Ok;
+}
+
+void* HEAP_pop(Heap* heap) {
+	if (NULL == heap || 0 == heap->length_) {
+		return NULL;
+	}
+	void* data = heap->storage_[0].ops_->data(&heap->storage_[0]);
+	u16 last = --heap->length_;
+	if (last > 0) {
+		heap->storage_[0] = heap->storage_[last];
+		if (NULL != heap->keys_) {
+			heap->keys_[0] = heap->keys_[last];
+		}
+		HEAP_siftDown(heap, 0);
+	}
+	heap->storage_[last].ops_->softReset(&heap->storage_[last]);
+	return data;
+}
+
+s16 HEAP_traverse(Heap* heap, void(*callback)(MemoryNode*)) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	for (u16 i = 0; i < heap->length_; ++i) {
+		callback(&heap->storage_[i]);
+	}
+	return kErrorCode_Ok;
+}
+
+void HEAP_print(Heap* heap) {
+	printf("	[Heap Info] Address: ");
+	if (NULL == heap) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", heap);
+	printf("	[Heap Info] Arity: %d\n", heap->arity_);
+	printf("	[Heap Info] Order: %s\n", NULL != heap->keys_ ? "keys" : "comparator");
+	printf("	[Heap Info] Length: %d\n", heap->length_);
+	printf("	[Heap Info] Capacity: %d\n", heap->capacity_);
+	for (u16 i = 0; i < heap->length_; ++i) {
+		printf("		[Heap Info] Storage #%d", i);
+		if (NULL != heap->keys_) {
+			printf(" Key: %d", heap->keys_[i]);
+		}
+		printf("\n");
+		heap->storage_[i].ops_->print(&heap->storage_[i]);
+	}
+	printf("\n");
+}
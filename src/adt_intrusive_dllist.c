@@ -0,0 +1,344 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_intrusive_dllist.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//IntrusiveDList Declarations
+static s16 INTRUSIVEDLIST_destroy(IntrusiveDList* list);
+static s16 INTRUSIVEDLIST_reset(IntrusiveDList* list);
+static s16 INTRUSIVEDLIST_resize(IntrusiveDList* list, u16 new_size);
+static u16 INTRUSIVEDLIST_capacity(IntrusiveDList* list);
+static u16 INTRUSIVEDLIST_length(IntrusiveDList* list);
+static bool INTRUSIVEDLIST_isEmpty(IntrusiveDList* list);
+static bool INTRUSIVEDLIST_isFull(IntrusiveDList* list);
+static IntrusiveLink* INTRUSIVEDLIST_first(IntrusiveDList* list);
+static IntrusiveLink* INTRUSIVEDLIST_last(IntrusiveDList* list);
+static IntrusiveLink* INTRUSIVEDLIST_at(IntrusiveDList* list, u16 position);
+static s16 INTRUSIVEDLIST_insertFirst(IntrusiveDList* list, IntrusiveLink* link);
+static s16 INTRUSIVEDLIST_insertLast(IntrusiveDList* list, IntrusiveLink* link);
+static s16 INTRUSIVEDLIST_insertAt(IntrusiveDList* list, IntrusiveLink* link, u16 position);
+static IntrusiveLink* INTRUSIVEDLIST_extractFirst(IntrusiveDList* list);
+static IntrusiveLink* INTRUSIVEDLIST_extractLast(IntrusiveDList* list);
+static IntrusiveLink* INTRUSIVEDLIST_extractAt(IntrusiveDList* list, u16 position);
+static s16 INTRUSIVEDLIST_extract(IntrusiveDList* list, IntrusiveLink* link);
+static s16 INTRUSIVEDLIST_concat(IntrusiveDList* list, IntrusiveDList* list_src);
+static s16 INTRUSIVEDLIST_traverse(IntrusiveDList* list, void(*callback)(IntrusiveLink*));
+static void INTRUSIVEDLIST_print(IntrusiveDList* list);
+
+struct intrusive_dlist_ops_s intrusive_dlist_ops = { .destroy = INTRUSIVEDLIST_destroy,
+													  .reset = INTRUSIVEDLIST_reset,
+													  .resize = INTRUSIVEDLIST_resize,
+													  .capacity = INTRUSIVEDLIST_capacity,
+													  .length = INTRUSIVEDLIST_length,
+													  .isEmpty = INTRUSIVEDLIST_isEmpty,
+													  .isFull = INTRUSIVEDLIST_isFull,
+													  .first = INTRUSIVEDLIST_first,
+													  .last = INTRUSIVEDLIST_last,
+													  .at = INTRUSIVEDLIST_at,
+													  .insertFirst = INTRUSIVEDLIST_insertFirst,
+													  .insertLast = INTRUSIVEDLIST_insertLast,
+													  .insertAt = INTRUSIVEDLIST_insertAt,
+													  .extractFirst = INTRUSIVEDLIST_extractFirst,
+													  .extractLast = INTRUSIVEDLIST_extractLast,
+													  .extractAt = INTRUSIVEDLIST_extractAt,
+													  .extract = INTRUSIVEDLIST_extract,
+													  .concat = INTRUSIVEDLIST_concat,
+													  .traverse = INTRUSIVEDLIST_traverse,
+													  .print = INTRUSIVEDLIST_print
+};
+
+// Link of the record at position (< length), walking from the nearest end
+static IntrusiveLink* INTRUSIVEDLIST_node(IntrusiveDList* list, u16 position) {
+	IntrusiveLink* link = NULL;
+	if (position < list->length_ / 2) {
+		link = list->head_;
+		for (u16 i = 0; i < position; ++i) {
+			link = link->next_;
+		}
+	}
+	else {
+		link = list->tail_;
+		for (u16 i = list->length_ - 1; i > position; --i) {
+			link = link->prev_;
+		}
+	}
+	return link;
+}
+
+// Unlinks a record of the list
+static void INTRUSIVEDLIST_unlink(IntrusiveDList* list, IntrusiveLink* link) {
+	if (NULL == link->prev_) {
+		list->head_ = link->next_;
+	}
+	else {
+		link->prev_->next_ = link->next_;
+	}
+	if (NULL == link->next_) {
+		list->tail_ = link->prev_;
+	}
+	else {
+		link->next_->prev_ = link->prev_;
+	}
+	link->next_ = NULL;
+	link->prev_ = NULL;
+	list->length_--;
+}
+
+IntrusiveDList* INTRUSIVEDLIST_create(u16 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	IntrusiveDList* list = (IntrusiveDList*)MM->malloc(sizeof(IntrusiveDList));
+	if (NULL == list) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	list->head_ = NULL;
+	list->tail_ = NULL;
+	list->capacity_ = capacity;
+	list->length_ = 0;
+	list->ops_ = &intrusive_dlist_ops;
+	return list;
+}
+
+s16 INTRUSIVEDLIST_destroy(IntrusiveDList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	MM->free(list);
+	return kErrorCode_Ok;
+}
+
+s16 INTRUSIVEDLIST_reset(IntrusiveDList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	while (NULL != list->head_) {
+		INTRUSIVEDLIST_unlink(list, list->head_);
+	}
+	return kErrorCode_Ok;
+}
+
+s16 INTRUSIVEDLIST_resize(IntrusiveDList* list, u16 new_size) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (0 == new_size) {
+		return kErrorCode_InvalidValue;
+	}
+	while (list->length_ > new_size) {
+		INTRUSIVEDLIST_unlink(list, list->tail_);
+	}
+	list->capacity_ = new_size;
+	return kErrorCode_Ok;
+}
+
+u16 INTRUSIVEDLIST_capacity(IntrusiveDList* list) {
+	if (NULL == list) {
+		return 0;
+	}
+	return list->capacity_;
+}
+
+u16 INTRUSIVEDLIST_length(IntrusiveDList* list) {
+	if (NULL == list) {
+		return 0;
+	}
+	return list->length_;
+}
+
+bool INTRUSIVEDLIST_isEmpty(IntrusiveDList* list) {
+	if (NULL == list) {
+		return false;
+	}
+	return 0 == list->length_;
+}
+
+bool INTRUSIVEDLIST_isFull(IntrusiveDList* list) {
+	if (NULL == list) {
+		return false;
+	}
+	return list->length_ >= list->capacity_;
+}
+
+IntrusiveLink* INTRUSIVEDLIST_first(IntrusiveDList* list) {
+	if (NULL == list) {
+		return NULL;
+	}
+	return list->head_;
+}
+
+IntrusiveLink* INTRUSIVEDLIST_last(IntrusiveDList* list) {
+	if (NULL == list) {
+		return NULL;
+	}
+	return list->tail_;
+}
+
+IntrusiveLink* INTRUSIVEDLIST_at(IntrusiveDList* list, u16 position) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (position >= list->length_) {
+		return NULL;
+	}
+	return INTRUSIVEDLIST_node(list, position);
+}
+
+s16 INTRUSIVEDLIST_insertFirst(IntrusiveDList* list, IntrusiveLink* link) {
+	return INTRUSIVEDLIST_insertAt(list, link, 0);
+}
+
+s16 INTRUSIVEDLIST_insertLast(IntrusiveDList* list, IntrusiveLink* link) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	return INTRUSIVEDLIST_insertAt(list, link, list->length_);
+}
+
+s16 INTRUSIVEDLIST_insertAt(IntrusiveDList* list, IntrusiveLink* link, u16 position) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (NULL == link) {
+		return kErrorCode_NullPointer;
+	}
+	if (list->length_ >= list->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	if (position > list->length_) {
+		position = list->length_;
+	}
+	// the record goes between prev_ and next_
+	IntrusiveLink* next = position == list->length_ ? NULL : INTRUSIVEDLIST_node(list, position);
+	link->prev_ = NULL == next ? list->tail_ : next->prev_;
+	link->next_ = next;
+	if (NULL == link->prev_) {
+		list->head_ = link;
+	}
+	else {
+		link->prev_->next_ = link;
+	}
+	if (NULL == next) {
+		list->tail_ = link;
+	}
+	else {
+		next->prev_ = link;
+	}
+	list->length_++;
+	return kErrorCode_Ok;
+}
+
+IntrusiveLink* INTRUSIVEDLIST_extractFirst(IntrusiveDList* list) {
+	if (NULL == list || NULL == list->head_) {
+		return NULL;
+	}
+	IntrusiveLink* link = list->head_;
+	INTRUSIVEDLIST_unlink(list, link);
+	return link;
+}
+
+IntrusiveLink* INTRUSIVEDLIST_extractLast(IntrusiveDList* list) {
+	if (NULL == list || NULL == list->tail_) {
+		return NULL;
+	}
+	IntrusiveLink* link = list->tail_;
+	INTRUSIVEDLIST_unlink(list, link);
+	return link;
+}
+
+IntrusiveLink* INTRUSIVEDLIST_extractAt(IntrusiveDList* list, u16 position) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (position >= list->length_) {
+		return NULL;
+	}
+	IntrusiveLink* link = INTRUSIVEDLIST_node(list, position);
+	INTRUSIVEDLIST_unlink(list, link);
+	return link;
+}
+
+s16 INTRUSIVEDLIST_extract(IntrusiveDList* list, IntrusiveLink* link) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (NULL == link) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == list->length_) {
+		return kErrorCode_ExtractionFailed;
+	}
+	// a link without a neighbour on one side has to be that end of this list,
+	// else it was already extracted and unlinking it would break the ends
+	if ((NULL == link->prev_ && list->head_ != link) ||
+		(NULL == link->next_ && list->tail_ != link)) {
+		return kErrorCode_ExtractionFailed;
+	}
+	INTRUSIVEDLIST_unlink(list, link);
+	return kErrorCode_Ok;
+}
+
+s16 INTRUSIVEDLIST_concat(IntrusiveDList* list, IntrusiveDList* list_src) {
+	if (NULL == list || NULL == list_src) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (list == list_src) {
+		return kErrorCode_InvalidValue;
+	}
+	list->capacity_ += list_src->capacity_;
+	if (NULL == list_src->head_) {
+		return kErrorCode_Ok;
+	}
+	if (NULL == list->head_) {
+		list->head_ = list_src->head_;
+	}
+	else {
+		list->tail_->next_ = list_src->head_;
+		list_src->head_->prev_ = list->tail_;
+	}
+	list->tail_ = list_src->tail_;
+	list->length_ += list_src->length_;
+	list_src->head_ = NULL;
+	list_src->tail_ = NULL;
+	list_src->length_ = 0;
+	return kErrorCode_Ok;
+}
+
+s16 INTRUSIVEDLIST_traverse(IntrusiveDList* list, void(*callback)(IntrusiveLink*)) {
+	if (NULL == list) {
+		return kErrorCode_NullDoubleLPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	for (IntrusiveLink* link = list->head_; NULL != link; link = link->next_) {
+		callback(link);
+	}
+	return kErrorCode_Ok;
+}
+
+void INTRUSIVEDLIST_print(IntrusiveDList* list) {
+	printf("	[IntrusiveDList Info] Address: ");
+	if (NULL == list) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", list);
+	printf("	[IntrusiveDList Info] Length: %d\n", list->length_);
+	printf("	[IntrusiveDList Info] Capacity: %d\n", list->capacity_);
+	printf("	[IntrusiveDList Info] First address: %p\n", list->head_);
+	printf("	[IntrusiveDList Info] Last address: %p\n", list->tail_);
+
+	u16 i = 0;
+	for (IntrusiveLink* link = list->head_; NULL != link; link = link->next_) {
+		printf("		[IntrusiveDList Info] Record #%d: %p\n", i++, link);
+	}
+	printf("\n");
+}
@@ -0,0 +1,316 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_intrusive_list.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//IntrusiveList Declarations
+static s16 INTRUSIVELIST_destroy(IntrusiveList* list);
+static s16 INTRUSIVELIST_reset(IntrusiveList* list);
+static s16 INTRUSIVELIST_resize(IntrusiveList* list, u16 new_size);
+static u16 INTRUSIVELIST_capacity(IntrusiveList* list);
+static u16 INTRUSIVELIST_length(IntrusiveList* list);
+static bool INTRUSIVELIST_isEmpty(IntrusiveList* list);
+static bool INTRUSIVELIST_isFull(IntrusiveList* list);
+static IntrusiveLink* INTRUSIVELIST_first(IntrusiveList* list);
+static IntrusiveLink* INTRUSIVELIST_last(IntrusiveList* list);
+static IntrusiveLink* INTRUSIVELIST_at(IntrusiveList* list, u16 position);
+static s16 INTRUSIVELIST_insertFirst(IntrusiveList* list, IntrusiveLink* link);
+static s16 INTRUSIVELIST_insertLast(IntrusiveList* list, IntrusiveLink* link);
+static s16 INTRUSIVELIST_insertAt(IntrusiveList* list, IntrusiveLink* link, u16 position);
+static IntrusiveLink* INTRUSIVELIST_extractFirst(IntrusiveList* list);
+static IntrusiveLink* INTRUSIVELIST_extractLast(IntrusiveList* list);
+static IntrusiveLink* INTRUSIVELIST_extractAt(IntrusiveList* list, u16 position);
+static s16 INTRUSIVELIST_concat(IntrusiveList* list, IntrusiveList* list_src);
+static s16 INTRUSIVELIST_traverse(IntrusiveList* list, void(*callback)(IntrusiveLink*));
+static void INTRUSIVELIST_print(IntrusiveList* list);
+
+struct intrusive_list_ops_s intrusive_list_ops = { .destroy = INTRUSIVELIST_destroy,
+													.reset = INTRUSIVELIST_reset,
+													.resize = INTRUSIVELIST_resize,
+													.capacity = INTRUSIVELIST_capacity,
+													.length = INTRUSIVELIST_length,
+													.isEmpty = INTRUSIVELIST_isEmpty,
+													.isFull = INTRUSIVELIST_isFull,
+													.first = INTRUSIVELIST_first,
+													.last = INTRUSIVELIST_last,
+													.at = INTRUSIVELIST_at,
+													.insertFirst = INTRUSIVELIST_insertFirst,
+													.insertLast = INTRUSIVELIST_insertLast,
+													.insertAt = INTRUSIVELIST_insertAt,
+													.extractFirst = INTRUSIVELIST_extractFirst,
+													.extractLast = INTRUSIVELIST_extractLast,
+													.extractAt = INTRUSIVELIST_extractAt,
+													.concat = INTRUSIVELIST_concat,
+													.traverse = INTRUSIVELIST_traverse,
+													.print = INTRUSIVELIST_print
+};
+
+// Link of the record just before position (0 < position <= length)
+static IntrusiveLink* INTRUSIVELIST_prev(IntrusiveList* list, u16 position) {
+	IntrusiveLink* link = list->head_;
+	for (u16 i = 1; i < position; ++i) {
+		link = link->next_;
+	}
+	return link;
+}
+
+IntrusiveList* INTRUSIVELIST_create(u16 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	IntrusiveList* list = (IntrusiveList*)MM->malloc(sizeof(IntrusiveList));
+	if (NULL == list) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	list->head_ = NULL;
+	list->tail_ = NULL;
+	list->capacity_ = capacity;
+	list->length_ = 0;
+	list->ops_ = &intrusive_list_ops;
+	return list;
+}
+
+s16 INTRUSIVELIST_destroy(IntrusiveList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	MM->free(list);
+	return kErrorCode_Ok;
+}
+
+s16 INTRUSIVELIST_reset(IntrusiveList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	IntrusiveLink* link = list->head_;
+	while (NULL != link) {
+		IntrusiveLink* next = link->next_;
+		link->next_ = NULL;
+		link = next;
+	}
+	list->head_ = NULL;
+	list->tail_ = NULL;
+	list->length_ = 0;
+	return kErrorCode_Ok;
+}
+
+s16 INTRUSIVELIST_resize(IntrusiveList* list, u16 new_size) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	if (0 == new_size) {
+		return kErrorCode_InvalidValue;
+	}
+	if (new_size < list->length_) {
+		IntrusiveLink* new_tail = INTRUSIVELIST_prev(list, new_size);
+		IntrusiveLink* link = new_tail->next_;
+		while (NULL != link) {
+			IntrusiveLink* next = link->next_;
+			link->next_ = NULL;
+			link = next;
+		}
+		new_tail->next_ = NULL;
+		list->tail_ = new_tail;
+		list->length_ = new_size;
+	}
+	list->capacity_ = new_size;
+	return kErrorCode_Ok;
+}
+
+u16 INTRUSIVELIST_capacity(IntrusiveList* list) {
+	if (NULL == list) {
+		return 0;
+	}
+	return list->capacity_;
+}
+
+u16 INTRUSIVELIST_length(IntrusiveList* list) {
+	if (NULL == list) {
+		return 0;
+	}
+	return list->length_;
+}
+
+bool INTRUSIVELIST_isEmpty(IntrusiveList* list) {
+	if (NULL == list) {
+		return false;
+	}
+	return 0 == list->length_;
+}
+
+bool INTRUSIVELIST_isFull(IntrusiveList* list) {
+	if (NULL == list) {
+		return false;
+	}
+	return list->length_ >= list->capacity_;
+}
+
+IntrusiveLink* INTRUSIVELIST_first(IntrusiveList* list) {
+	if (NULL == list) {
+		return NULL;
+	}
+	return list->head_;
+}
+
+IntrusiveLink* INTRUSIVELIST_last(IntrusiveList* list) {
+	if (NULL == list) {
+		return NULL;
+	}
+	return list->tail_;
+}
+
+IntrusiveLink* INTRUSIVELIST_at(IntrusiveList* list, u16 position) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (position >= list->length_) {
+		return NULL;
+	}
+	if (position == list->length_ - 1) {
+		return list->tail_;
+	}
+	return INTRUSIVELIST_prev(list, position + 1);
+}
+
+s16 INTRUSIVELIST_insertFirst(IntrusiveList* list, IntrusiveLink* link) {
+	return INTRUSIVELIST_insertAt(list, link, 0);
+}
+
+s16 INTRUSIVELIST_insertLast(IntrusiveList* list, IntrusiveLink* link) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	return INTRUSIVELIST_insertAt(list, link, list->length_);
+}
+
+s16 INTRUSIVELIST_insertAt(IntrusiveList* list, IntrusiveLink* link, u16 position) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	if (NULL == link) {
+		return kErrorCode_NullPointer;
+	}
+	if (list->length_ >= list->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	if (position > list->length_) {
+		position = list->length_;
+	}
+	if (0 == position) {
+		link->next_ = list->head_;
+		list->head_ = link;
+	}
+	else {
+		IntrusiveLink* prev = position == list->length_ ? list->tail_ : INTRUSIVELIST_prev(list, position);
+		link->next_ = prev->next_;
+		prev->next_ = link;
+	}
+	if (NULL == link->next_) {
+		list->tail_ = link;
+	}
+	list->length_++;
+	return kErrorCode_Ok;
+}
+
+IntrusiveLink* INTRUSIVELIST_extractFirst(IntrusiveList* list) {
+	return INTRUSIVELIST_extractAt(list, 0);
+}
+
+IntrusiveLink* INTRUSIVELIST_extractLast(IntrusiveList* list) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (0 == list->length_) {
+		return NULL;
+	}
+	return INTRUSIVELIST_extractAt(list, list->length_ - 1);
+}
+
+IntrusiveLink* INTRUSIVELIST_extractAt(IntrusiveList* list, u16 position) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (position >= list->length_) {
+		return NULL;
+	}
+	IntrusiveLink* prev = NULL;
+	IntrusiveLink* link = list->head_;
+	if (0 == position) {
+		list->head_ = link->next_;
+	}
+	else {
+		prev = INTRUSIVELIST_prev(list, position);
+		link = prev->next_;
+		prev->next_ = link->next_;
+	}
+	if (list->tail_ == link) {
+		list->tail_ = prev;
+	}
+	link->next_ = NULL;
+	list->length_--;
+	return link;
+}
+
+s16 INTRUSIVELIST_concat(IntrusiveList* list, IntrusiveList* list_src) {
+	if (NULL == list || NULL == list_src) {
+		return kErrorCode_NullListPointer;
+	}
+	if (list == list_src) {
+		return kErrorCode_InvalidValue;
+	}
+	list->capacity_ += list_src->capacity_;
+	if (NULL == list_src->head_) {
+		return kErrorCode_Ok;
+	}
+	if (NULL == list->head_) {
+		list->head_ = list_src->head_;
+	}
+	else {
+		list->tail_->next_ = list_src->head_;
+	}
+	list->tail_ = list_src->tail_;
+	list->length_ += list_src->length_;
+	list_src->head_ = NULL;
+	list_src->tail_ = NULL;
+	list_src->length_ = 0;
+	return kErrorCode_Ok;
+}
+
+s16 INTRUSIVELIST_traverse(IntrusiveList* list, void(*callback)(IntrusiveLink*)) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	for (IntrusiveLink* link = list->head_; NULL != link; link = link->next_) {
+		callback(link);
+	}
+	return kErrorCode_Ok;
+}
+
+void INTRUSIVELIST_print(IntrusiveList* list) {
+	printf("	[IntrusiveList Info] Address: ");
+	if (NULL == list) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", list);
+	printf("	[IntrusiveList Info] Length: %d\n", list->length_);
+	printf("	[IntrusiveList Info] Capacity: %d\n", list->capacity_);
+	printf("	[IntrusiveList Info] First address: %p\n", list->head_);
+	printf("	[IntrusiveList Info] Last address: %p\n", list->tail_);
+
+	u16 i = 0;
+	for (IntrusiveLink* link = list->head_; NULL != link; link = link->next_) {
+		printf("		[IntrusiveList Info] Record #%d: %p\n", i++, link);
+	}
+	printf("\n");
+}
@@ -3,6 +3,7 @@
 
 #include "common_def.h"
 #include "adt_list.h"
+#include "adt_prefetch.h"
 
 
 #include "ABGS_MemoryManager/abgs_memory_manager.h"
@@ -27,7 +28,21 @@ static void* LIST_extractLast(List* list);
 static void* LIST_extractAt(List* list, u16 position);  
 static s16 LIST_concat(List* list, List* list_src); 
 static s16 LIST_traverse(List* list, void(*callback)(MemoryNode*)); 
+static s16 LIST_traverseEx(List* list, s16(*callback)(MemoryNode*, void*), void* ctx);
+static s16 LIST_traverseBatch(List* list, s16(*callback)(MemoryNode**, u16, void*), void* ctx);
 static void LIST_print(List* list);
+static s16 LIST_cursorBegin(List* list, ListCursor* cursor);
+static void* LIST_cursorGet(ListCursor* cursor);
+static void* LIST_cursorNext(ListCursor* cursor);
+static void* LIST_cursorPrev(ListCursor* cursor);
+static s16 LIST_cursorInsertAfter(ListCursor* cursor, void* data, u16 bytes);
+static s16 LIST_cursorInsertBefore(ListCursor* cursor, void* data, u16 bytes);
+static void* LIST_cursorErase(ListCursor* cursor);
+static u16 LIST_insertLastMany(List* list, void** data, u16* sizes, u16 count);
+static u16 LIST_extractFirstMany(List* list, void** out, u16* out_sizes, u16 max);
+static s16 LIST_trim(List* list);
+static s16 LIST_setSpareLimit(List* list, u16 limit);
+static s16 LIST_setPrefetchDistance(List* list, u16 distance);
 
 struct list_ops_s list_ops = { .destroy = LIST_destroy,
 								  .softReset = LIST_softReset,
@@ -48,10 +63,74 @@ struct list_ops_s list_ops = { .destroy = LIST_destroy,
 								  .extractAt = LIST_extractAt,
 								  .concat = LIST_concat,
 								  .traverse = LIST_traverse,
-								  .print = LIST_print
-
+								  .traverseEx = LIST_traverseEx,
+								  .traverseBatch = LIST_traverseBatch,
+								  .print = LIST_print,
+								  .cursorBegin = LIST_cursorBegin,
+								  .cursorGet = LIST_cursorGet,
+								  .cursorNext = LIST_cursorNext,
+								  .cursorPrev = LIST_cursorPrev,
+								  .cursorInsertAfter = LIST_cursorInsertAfter,
+								  .cursorInsertBefore = LIST_cursorInsertBefore,
+								  .cursorErase = LIST_cursorErase,
+								  .insertLastMany = LIST_insertLastMany,
+								  .extractFirstMany = LIST_extractFirstMany,
+								  .trim = LIST_trim,
+								  .setSpareLimit = LIST_setSpareLimit,
+								  .setPrefetchDistance = LIST_setPrefetchDistance
 };
 
+// Takes a spare node for a new element, or creates one when there are none
+static MemoryNode* LIST_takeNode(List* list) {
+	MemoryNode* node = list->spare_;
+	if (NULL == node) {
+		return MEMNODE_create();
+	}
+	list->spare_ = node->ops_->getNext(node);
+	list->spare_length_--;
+	MEMNODE_createLite(node);
+	return node;
+}
+
+// Keeps a node whose data has been taken for the next insertions, or frees it
+// once the list holds as many spare nodes as its limit
+static void LIST_retireNode(List* list, MemoryNode* node) {
+	if (list->spare_length_ >= list->spare_limit_) {
+		node->ops_->softFree(node);
+		return;
+	}
+	node->ops_->softReset(node);
+	node->ops_->setNext(node, list->spare_);
+	list->spare_ = node;
+	list->spare_length_++;
+}
+
+// Node distance places after node, where the prefetches of a walk start.
+// NULL when prefetching is disabled
+static MemoryNode* LIST_prefetchStart(MemoryNode* node, u16 distance) {
+	if (0 == distance) {
+		return NULL;
+	}
+	for (u16 i = 0; i < distance && NULL != node; ++i) {
+		node = node->next_;
+	}
+	return node;
+}
+
+// Prefetches the data of the node ahead of a walk and the node after it, and
+// returns that next node as the new one ahead
+static MemoryNode* LIST_prefetchAdvance(MemoryNode* ahead) {
+	if (NULL == ahead) {
+		return NULL;
+	}
+	ADT_PREFETCH(ahead->data_);
+	ahead = ahead->next_;
+	if (NULL != ahead) {
+		ADT_PREFETCH(ahead);
+	}
+	return ahead;
+}
+
 List* LIST_create(u16 capacity) {
 	if (capacity == 0) {
 		return NULL;
@@ -67,6 +146,10 @@ List* LIST_create(u16 capacity) {
 	list->tail_ = NULL;
 	list->capacity_ = capacity;
 	list->length_ = 0;
+	list->spare_ = NULL;
+	list->spare_length_ = 0;
+	list->spare_limit_ = kListSpareLimit;
+	list->prefetch_distance_ = kListPrefetchDistance;
 	list->ops_ = &list_ops;
 
 	return list;
@@ -76,13 +159,16 @@ s16 LIST_destroy(List* list) {
 	if (list == NULL) {
 		return kErrorCode_NullListPointer;
 	}
+	LIST_trim(list);
 	if (list->ops_->isEmpty(list)) {
 		MM->free(list);
 		return kErrorCode_Ok;
 	}
 	MemoryNode* tmp = list->head_;
 	MemoryNode* tmp_next = NULL;
-	for (u16 i = 0; i < list->ops_->length(list); ++i) {
+	MemoryNode* ahead = LIST_prefetchStart(tmp, list->prefetch_distance_);
+	while (NULL != tmp) {
+		ahead = LIST_prefetchAdvance(ahead);
 		tmp_next = tmp->ops_->getNext(tmp);
 		tmp->ops_->free(tmp);
 		tmp = tmp_next;
@@ -100,9 +186,11 @@ s16 LIST_softReset(List* list) {
 	}
 	if (NULL != list->head_) {
 		MemoryNode* tmp = list->head_;
-		for (u16 i = 0; i < list->ops_->length(list); ++i) {
-			tmp->ops_->softFree(tmp);
-			tmp = tmp->next_;
+		MemoryNode* tmp_next = NULL;
+		while (NULL != tmp) {
+			tmp_next = tmp->ops_->getNext(tmp);
+			LIST_retireNode(list, tmp);
+			tmp = tmp_next;
 		}
 		list->head_ = NULL;
 	}
@@ -121,9 +209,12 @@ s16 LIST_reset(List* list) {
 	if (NULL != list->head_) {
 		MemoryNode* tmp = list->head_;
 		MemoryNode* tmp_next = NULL;
-		for (u16 i = 0; i < list->ops_->length(list); ++i) {
+		MemoryNode* ahead = LIST_prefetchStart(tmp, list->prefetch_distance_);
+		while (NULL != tmp) {
+			ahead = LIST_prefetchAdvance(ahead);
 			tmp_next = tmp->ops_->getNext(tmp);
-			tmp->ops_->free(tmp);
+			tmp->ops_->reset(tmp);
+			LIST_retireNode(list, tmp);
 			tmp = tmp_next;
 		}
 		list->head_ = NULL;
@@ -160,7 +251,8 @@ s16 LIST_resize(List* list, u16 new_size) {
 				list->tail_ = tmp_node;
 			} else {
 				// exceeds the new capacity and is released
-				tmp_node->ops_->free(tmp_node);
+				tmp_node->ops_->reset(tmp_node);
+				LIST_retireNode(list, tmp_node);
 			}
 			tmp_node = tmp_next;
 		}
@@ -262,7 +354,7 @@ s16 LIST_insertFirst(List* list, void* data, u16 bytes) {
 	if (list->ops_->isFull(list)) {
 		return kErrorCode_InsertionFailed;
 	}
-	MemoryNode* new_node = MEMNODE_create();
+	MemoryNode* new_node = LIST_takeNode(list);
 	if (new_node == NULL) {
 #ifdef VERBOSE_
 		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
@@ -306,7 +398,7 @@ s16 LIST_insertLast(List* list, void* data, u16 bytes) {
 		return kErrorCode_NullDoubleLPointer;
 	}
 	// creo el nuevo nodo
- MemoryNode* new_node = MEMNODE_create();
+ MemoryNode* new_node = LIST_takeNode(list);
 	if (new_node == NULL) {
 #ifdef VERBOSE_
 		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
@@ -355,7 +447,7 @@ s16 LIST_insertAt(List* list, void* data, u16 bytes, u16 position) {
 		tmp_node = tmp_node->ops_->getNext(tmp_node);
 	}
 	// creo el nuevo nodo
-	MemoryNode* new_node = MEMNODE_create();
+	MemoryNode* new_node = LIST_takeNode(list);
 
 	if (new_node == NULL) {
 #ifdef VERBOSE_
@@ -391,7 +483,7 @@ void* LIST_extractFirst(List* list) {
 	if (list->head_ == NULL) {
 		list->tail_ = NULL;
 	}
-	tmp_node->ops_->softFree(tmp_node);
+	LIST_retireNode(list, tmp_node);
 	list->length_--;
 	return tmp_data;
 }
@@ -420,7 +512,7 @@ void* LIST_extractLast(List* list) {
 	// tail ahora apunta al penúltimo
 	list->tail_ = tmp_node;
 	tmp_node = tmp_node->ops_->getNext(tmp_node);
-	tmp_node->ops_->softFree(tmp_node);
+	LIST_retireNode(list, tmp_node);
 	list->tail_->ops_->setNext(list->tail_, NULL);
 	list->length_--;
 	return tmp_data;
@@ -453,7 +545,7 @@ void* LIST_extractAt(List* list, u16 position) {
 	}
 	void* tmp_data = tmp_next->ops_->data(tmp_next);
 	tmp_node->ops_->setNext(tmp_node, tmp_next->ops_->getNext(tmp_next));
-	tmp_next->ops_->softFree(tmp_next);
+	LIST_retireNode(list, tmp_next);
 	list->length_--;
 	return tmp_data;
 }
@@ -472,7 +564,7 @@ s16 LIST_concat(List* list, List* list_src) {
 		return kErrorCode_NullDoubleLPointer;
 	}
 	// I copy and run through the new node
-	MemoryNode* tmp_node = MEMNODE_create();
+	MemoryNode* tmp_node = LIST_takeNode(list);
  if (tmp_node == NULL) {
 #ifdef VERBOSE_
    printf("Error: [%s] not enough memory available\n", __FUNCTION__);
@@ -483,10 +575,12 @@ s16 LIST_concat(List* list, List* list_src) {
 	// I create a node that points to the head_
 	MemoryNode* head_node = tmp_node;
  int i = 0;
+	MemoryNode* ahead = LIST_prefetchStart(list_src->head_, list->prefetch_distance_);
 	for (MemoryNode* node = list_src->head_; node != NULL; node = node->ops_->getNext(node)) {
+		ahead = LIST_prefetchAdvance(ahead);
 		tmp_node->ops_->memCopy(tmp_node, node->ops_->data(node), node->ops_->size(node));
 		if (NULL != node->ops_->getNext(node)) {
-			tmp_node->ops_->setNext(tmp_node, MEMNODE_create());
+			tmp_node->ops_->setNext(tmp_node, LIST_takeNode(list));
 			tmp_node = tmp_node->ops_->getNext(tmp_node);
 		}
   ++i;
@@ -513,16 +607,61 @@ s16 LIST_traverse(List* list, void(*callback)(MemoryNode*)) {
 	if (list->head_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-	MemoryNode* tmp = list->head_;
-	for (u16 i = 0; i < list->ops_->length(list); i++)
-	{
+	MemoryNode* ahead = LIST_prefetchStart(list->head_, list->prefetch_distance_);
+	for (MemoryNode* tmp = list->head_; NULL != tmp; tmp = tmp->next_) {
+		ahead = LIST_prefetchAdvance(ahead);
 		callback(tmp);
-		tmp = tmp->next_;
 	}
 
 	return kErrorCode_Ok;
 }
 
+s16 LIST_traverseEx(List* list, s16(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	if (NULL == list->head_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode* ahead = LIST_prefetchStart(list->head_, list->prefetch_distance_);
+	for (MemoryNode* tmp = list->head_; NULL != tmp; tmp = tmp->next_) {
+		ahead = LIST_prefetchAdvance(ahead);
+		if (kTraverse_Stop == callback(tmp, ctx)) {
+			break;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 LIST_traverseBatch(List* list, s16(*callback)(MemoryNode**, u16, void*), void* ctx) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	if (NULL == list->head_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode* batch[kTraverseBatchLength];
+	u16 count = 0;
+	MemoryNode* ahead = LIST_prefetchStart(list->head_, list->prefetch_distance_);
+	for (MemoryNode* tmp = list->head_; NULL != tmp; tmp = tmp->next_) {
+		ahead = LIST_prefetchAdvance(ahead);
+		batch[count++] = tmp;
+		if (kTraverseBatchLength == count || NULL == tmp->next_) {
+			if (kTraverse_Stop == callback(batch, count, ctx)) {
+				break;
+			}
+			count = 0;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
 void LIST_print(List* list) {
 	printf("	[List Info] Address: ");
 	if (NULL == list) {
@@ -532,6 +671,7 @@ void LIST_print(List* list) {
 	printf("%p\n", list);
 	printf("	[List Info] Length: %d\n", list->length_);
 	printf("	[List Info] Capacity: %d\n", list->capacity_);
+	printf("	[List Info] Spare nodes: %d of %d\n", list->spare_length_, list->spare_limit_);
 	printf("	[List Info] First address: ");
 	if (NULL == list->head_) {
 		printf(" NULL\n");
@@ -553,13 +693,7 @@ void LIST_print(List* list) {
 		printf("\n");
 		return;
 	}
-	u16 listLenght = list->ops_->length(list);
-	for (u16 i = 0; i < listLenght; ++i) {
-		if (NULL == otherNode) {
-			otherNode = NULL;
-			printf("\n");
-			return;
-		}
+	for (u16 i = 0; NULL != otherNode; ++i) {
 		printf("		[List Info] Storage #%d\n", i);
 		otherNode->ops_->print(otherNode);
 		otherNode = otherNode->ops_->getNext(otherNode);
@@ -567,3 +701,249 @@ void LIST_print(List* list) {
 	otherNode = NULL;
 	printf("\n");
 }
+
+s16 LIST_cursorBegin(List* list, ListCursor* cursor) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	if (NULL == cursor) {
+		return kErrorCode_NullPointer;
+	}
+	cursor->list_ = list;
+	cursor->node_ = list->head_;
+	cursor->prev_ = NULL;
+	cursor->position_ = 0;
+	return kErrorCode_Ok;
+}
+
+void* LIST_cursorGet(ListCursor* cursor) {
+	if (NULL == cursor || NULL == cursor->node_) {
+		return NULL;
+	}
+	return cursor->node_->ops_->data(cursor->node_);
+}
+
+void* LIST_cursorNext(ListCursor* cursor) {
+	if (NULL == cursor || NULL == cursor->node_) {
+		return NULL;
+	}
+	cursor->prev_ = cursor->node_;
+	cursor->node_ = cursor->node_->ops_->getNext(cursor->node_);
+	cursor->position_++;
+	return LIST_cursorGet(cursor);
+}
+
+void* LIST_cursorPrev(ListCursor* cursor) {
+	if (NULL == cursor || NULL == cursor->prev_) {
+		return NULL;
+	}
+	cursor->node_ = cursor->prev_;
+	cursor->position_--;
+	// no back links, the new prev_ has to be found from the head
+	cursor->prev_ = NULL;
+	if (cursor->position_ > 0) {
+		cursor->prev_ = cursor->list_->head_;
+		for (u16 i = 1; i < cursor->position_; ++i) {
+			cursor->prev_ = cursor->prev_->ops_->getNext(cursor->prev_);
+		}
+	}
+	return LIST_cursorGet(cursor);
+}
+
+// Checks an insertion at the cursor and creates its node
+static s16 LIST_cursorNewNode(ListCursor* cursor, void* data, u16 bytes, MemoryNode** new_node) {
+	if (NULL == cursor || NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (NULL == cursor->list_) {
+		return kErrorCode_NullListPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	if (cursor->list_->ops_->isFull(cursor->list_)) {
+		return kErrorCode_InsertionFailed;
+	}
+	*new_node = LIST_takeNode(cursor->list_);
+	if (NULL == *new_node) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return kErrorCode_NullMemoryNode;
+	}
+	(*new_node)->ops_->setData(*new_node, data, bytes);
+	return kErrorCode_Ok;
+}
+
+s16 LIST_cursorInsertAfter(ListCursor* cursor, void* data, u16 bytes) {
+	if (NULL != cursor && NULL == cursor->node_) {
+		return LIST_cursorInsertBefore(cursor, data, bytes);
+	}
+	MemoryNode* new_node = NULL;
+	s16 error_type = LIST_cursorNewNode(cursor, data, bytes, &new_node);
+	if (kErrorCode_Ok != error_type) {
+		return error_type;
+	}
+	List* list = cursor->list_;
+	new_node->ops_->setNext(new_node, cursor->node_->ops_->getNext(cursor->node_));
+	cursor->node_->ops_->setNext(cursor->node_, new_node);
+	if (list->tail_ == cursor->node_) {
+		list->tail_ = new_node;
+	}
+	list->length_++;
+	return kErrorCode_Ok;
+}
+
+s16 LIST_cursorInsertBefore(ListCursor* cursor, void* data, u16 bytes) {
+	MemoryNode* new_node = NULL;
+	s16 error_type = LIST_cursorNewNode(cursor, data, bytes, &new_node);
+	if (kErrorCode_Ok != error_type) {
+		return error_type;
+	}
+	List* list = cursor->list_;
+	new_node->ops_->setNext(new_node, cursor->node_);
+	if (NULL == cursor->prev_) {
+		list->head_ = new_node;
+	}
+	else {
+		cursor->prev_->ops_->setNext(cursor->prev_, new_node);
+	}
+	if (NULL == cursor->node_) {
+		list->tail_ = new_node;
+	}
+	cursor->prev_ = new_node;
+	cursor->position_++;
+	list->length_++;
+	return kErrorCode_Ok;
+}
+
+void* LIST_cursorErase(ListCursor* cursor) {
+	if (NULL == cursor || NULL == cursor->node_) {
+		return NULL;
+	}
+	List* list = cursor->list_;
+	MemoryNode* tmp_node = cursor->node_;
+	void* tmp_data = tmp_node->ops_->data(tmp_node);
+	cursor->node_ = tmp_node->ops_->getNext(tmp_node);
+	if (NULL == cursor->prev_) {
+		list->head_ = cursor->node_;
+	}
+	else {
+		cursor->prev_->ops_->setNext(cursor->prev_, cursor->node_);
+	}
+	if (list->tail_ == tmp_node) {
+		list->tail_ = cursor->prev_;
+	}
+	LIST_retireNode(list, tmp_node);
+	list->length_--;
+	return tmp_data;
+}
+
+u16 LIST_insertLastMany(List* list, void** data, u16* sizes, u16 count) {
+	if (NULL == list) {
+		return 0;
+	}
+	if (NULL == data || NULL == sizes) {
+		return 0;
+	}
+	u16 free_places = list->capacity_ - list->length_;
+	if (count > free_places) {
+		count = free_places;
+	}
+	// the new nodes are chained apart, the list only changes once at the end
+	MemoryNode* first = NULL;
+	MemoryNode* last = NULL;
+	u16 inserted = 0;
+	while (inserted < count && NULL != data[inserted] && 0 != sizes[inserted]) {
+		MemoryNode* new_node = LIST_takeNode(list);
+		if (NULL == new_node) {
+#ifdef VERBOSE_
+			printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+			break;
+		}
+		new_node->ops_->setData(new_node, data[inserted], sizes[inserted]);
+		if (NULL == first) {
+			first = new_node;
+		}
+		else {
+			last->ops_->setNext(last, new_node);
+		}
+		last = new_node;
+		inserted++;
+	}
+	if (0 == inserted) {
+		return 0;
+	}
+	if (NULL == list->head_) {
+		list->head_ = first;
+	}
+	else {
+		list->tail_->ops_->setNext(list->tail_, first);
+	}
+	list->tail_ = last;
+	list->length_ += inserted;
+	return inserted;
+}
+
+u16 LIST_extractFirstMany(List* list, void** out, u16* out_sizes, u16 max) {
+	if (NULL == list) {
+		return 0;
+	}
+	if (NULL == out) {
+		return 0;
+	}
+	u16 count = list->length_ < max ? list->length_ : max;
+	// one walk takes the data and retires the nodes, head_ moves once past the run
+	MemoryNode* node = list->head_;
+	for (u16 i = 0; i < count; ++i) {
+		MemoryNode* next = node->ops_->getNext(node);
+		out[i] = node->ops_->data(node);
+		if (NULL != out_sizes) {
+			out_sizes[i] = node->ops_->size(node);
+		}
+		LIST_retireNode(list, node);
+		node = next;
+	}
+	list->head_ = node;
+	if (NULL == node) {
+		list->tail_ = NULL;
+	}
+	list->length_ -= count;
+	return count;
+}
+
+s16 LIST_trim(List* list) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	while (NULL != list->spare_) {
+		MemoryNode* tmp_node = list->spare_;
+		list->spare_ = tmp_node->ops_->getNext(tmp_node);
+		tmp_node->ops_->softFree(tmp_node);
+	}
+	list->spare_length_ = 0;
+	return kErrorCode_Ok;
+}
+
+s16 LIST_setSpareLimit(List* list, u16 limit) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	list->spare_limit_ = limit;
+	while (list->spare_length_ > limit) {
+		MemoryNode* tmp_node = list->spare_;
+		list->spare_ = tmp_node->ops_->getNext(tmp_node);
+		tmp_node->ops_->softFree(tmp_node);
+		list->spare_length_--;
+	}
+	return kErrorCode_Ok;
+}
+
+s16 LIST_setPrefetchDistance(List* list, u16 distance) {
+	if (NULL == list) {
+		return kErrorCode_NullListPointer;
+	}
+	list->prefetch_distance_ = distance;
+	return kErrorCode_Ok;
+}
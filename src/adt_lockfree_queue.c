@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_atomic.h"
+#include "adt_hazard.h"
+#include "adt_lockfree_queue.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//LockFreeQueue Declarations
+static s16 LOCKFREEQUEUE_destroy(LockFreeQueue* queue);
+static u16 LOCKFREEQUEUE_capacity(LockFreeQueue* queue);
+static u16 LOCKFREEQUEUE_length(LockFreeQueue* queue);
+static bool LOCKFREEQUEUE_isEmpty(LockFreeQueue* queue);
+static bool LOCKFREEQUEUE_isFull(LockFreeQueue* queue);
+static s16 LOCKFREEQUEUE_enqueue(LockFreeQueue* queue, void* data, u16 bytes);
+static void* LOCKFREEQUEUE_dequeue(LockFreeQueue* queue);
+static void LOCKFREEQUEUE_print(LockFreeQueue* queue);
+
+struct lockfree_queue_ops_s lockfree_queue_ops = { .destroy = LOCKFREEQUEUE_destroy,
+													.capacity = LOCKFREEQUEUE_capacity,
+													.length = LOCKFREEQUEUE_length,
+													.isEmpty = LOCKFREEQUEUE_isEmpty,
+													.isFull = LOCKFREEQUEUE_isFull,
+													.enqueue = LOCKFREEQUEUE_enqueue,
+													.dequeue = LOCKFREEQUEUE_dequeue,
+													.print = LOCKFREEQUEUE_print
+};
+
+// Shared link fields, read and written atomically
+#define HEAD(queue) ((void* volatile*)&(queue)->head_)
+#define TAIL(queue) ((void* volatile*)&(queue)->tail_)
+#define NEXT(node) ((void* volatile*)&(node)->next_)
+
+LockFreeQueue* LOCKFREEQUEUE_create(u16 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	LockFreeQueue* queue = (LockFreeQueue*)MM->malloc(sizeof(LockFreeQueue));
+	if (NULL == queue) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	MemoryNode* dummy = MEMNODE_create();
+	if (NULL == dummy) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		MM->free(queue);
+		return NULL;
+	}
+	queue->head_ = dummy;
+	queue->tail_ = dummy;
+	queue->length_ = 0;
+	queue->capacity_ = capacity;
+	queue->ops_ = &lockfree_queue_ops;
+	return queue;
+}
+
+s16 LOCKFREEQUEUE_destroy(LockFreeQueue* queue) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	// the data of the dummy node was already handed out
+	MemoryNode* node = queue->head_;
+	MemoryNode* next = node->ops_->getNext(node);
+	node->ops_->softFree(node);
+	while (NULL != next) {
+		node = next;
+		next = node->ops_->getNext(node);
+		node->ops_->free(node);
+	}
+	MM->free(queue);
+	return kErrorCode_Ok;
+}
+
+u16 LOCKFREEQUEUE_capacity(LockFreeQueue* queue) {
+	if (NULL == queue) {
+		return 0;
+	}
+	return queue->capacity_;
+}
+
+u16 LOCKFREEQUEUE_length(LockFreeQueue* queue) {
+	if (NULL == queue) {
+		return 0;
+	}
+	return (u16)ATOMIC_loadU32(&queue->length_);
+}
+
+bool LOCKFREEQUEUE_isEmpty(LockFreeQueue* queue) {
+	if (NULL == queue) {
+		return false;
+	}
+	return 0 == ATOMIC_loadU32(&queue->length_);
+}
+
+bool LOCKFREEQUEUE_isFull(LockFreeQueue* queue) {
+	if (NULL == queue) {
+		return false;
+	}
+	return ATOMIC_loadU32(&queue->length_) >= queue->capacity_;
+}
+
+s16 LOCKFREEQUEUE_enqueue(LockFreeQueue* queue, void* data, u16 bytes) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	HazardRecord* record = HAZARD_acquire();
+	if (NULL == record) {
+		return kErrorCode_InsertionFailed;
+	}
+	// the place is booked before the node is linked, so the capacity is never exceeded
+	if (ATOMIC_addU32(&queue->length_, 1) >= queue->capacity_) {
+		ATOMIC_addU32(&queue->length_, -1);
+		return kErrorCode_InsertionFailed;
+	}
+	MemoryNode* node = HAZARD_takeNode(record);
+	if (NULL == node) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		ATOMIC_addU32(&queue->length_, -1);
+		return kErrorCode_NullMemoryNode;
+	}
+	node->ops_->setData(node, data, bytes);
+	MemoryNode* tail = NULL;
+	for (;;) {
+		tail = ATOMIC_loadPtr(TAIL(queue));
+		HAZARD_protect(record, 0, tail);
+		if (tail != ATOMIC_loadPtr(TAIL(queue))) {
+			continue;
+		}
+		MemoryNode* next = ATOMIC_loadPtr(NEXT(tail));
+		if (NULL != next) {
+			// another enqueue linked its node but didn't move the tail yet: help it
+			ATOMIC_casPtr(TAIL(queue), tail, next);
+			continue;
+		}
+		if (ATOMIC_casPtr(NEXT(tail), NULL, node)) {
+			break;
+		}
+	}
+	ATOMIC_casPtr(TAIL(queue), tail, node);
+	HAZARD_protect(record, 0, NULL);
+	return kErrorCode_Ok;
+}
+
+void* LOCKFREEQUEUE_dequeue(LockFreeQueue* queue) {
+	if (NULL == queue) {
+		return NULL;
+	}
+	HazardRecord* record = HAZARD_acquire();
+	if (NULL == record) {
+		return NULL;
+	}
+	MemoryNode* head = NULL;
+	void* data = NULL;
+	for (;;) {
+		head = ATOMIC_loadPtr(HEAD(queue));
+		HAZARD_protect(record, 0, head);
+		if (head != ATOMIC_loadPtr(HEAD(queue))) {
+			continue;
+		}
+		MemoryNode* tail = ATOMIC_loadPtr(TAIL(queue));
+		MemoryNode* next = ATOMIC_loadPtr(NEXT(head));
+		HAZARD_protect(record, 1, next);
+		if (head != ATOMIC_loadPtr(HEAD(queue))) {
+			continue;
+		}
+		if (NULL == next) {
+			HAZARD_protect(record, 0, NULL);
+			HAZARD_protect(record, 1, NULL);
+			return NULL;
+		}
+		if (head == tail) {
+			// the tail fell behind the node being dequeued: move it first
+			ATOMIC_casPtr(TAIL(queue), tail, next);
+			continue;
+		}
+		// next becomes the dummy node, its data is read before anyone can reuse it
+		data = next->ops_->data(next);
+		if (ATOMIC_casPtr(HEAD(queue), head, next)) {
+			break;
+		}
+	}
+	HAZARD_protect(record, 0, NULL);
+	HAZARD_protect(record, 1, NULL);
+	ATOMIC_addU32(&queue->length_, -1);
+	HAZARD_retire(record, head);
+	return data;
+}
+
+void LOCKFREEQUEUE_print(LockFreeQueue* queue) {
+	printf("	[LockFreeQueue Info] Address: ");
+	if (NULL == queue) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", queue);
+	printf("	[LockFreeQueue Info] Length: %d\n", queue->length_);
+	printf("	[LockFreeQueue Info] Capacity: %d\n", queue->capacity_);
+
+	u16 i = 0;
+	for (MemoryNode* node = queue->head_->ops_->getNext(queue->head_); NULL != node; node = node->ops_->getNext(node)) {
+		printf("		[LockFreeQueue Info] Storage #%d\n", i++);
+		node->ops_->print(node);
+	}
+	printf("\n");
+}
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_atomic.h"
+#include "adt_hazard.h"
+#include "adt_lockfree_stack.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//LockFreeStack Declarations
+static s16 LOCKFREESTACK_destroy(LockFreeStack* stack);
+static u16 LOCKFREESTACK_capacity(LockFreeStack* stack);
+static u16 LOCKFREESTACK_length(LockFreeStack* stack);
+static bool LOCKFREESTACK_isEmpty(LockFreeStack* stack);
+static bool LOCKFREESTACK_isFull(LockFreeStack* stack);
+static s16 LOCKFREESTACK_push(LockFreeStack* stack, void* data, u16 bytes);
+static void* LOCKFREESTACK_pop(LockFreeStack* stack);
+static void LOCKFREESTACK_print(LockFreeStack* stack);
+
+struct lockfree_stack_ops_s lockfree_stack_ops = { .destroy = LOCKFREESTACK_destroy,
+													.capacity = LOCKFREESTACK_capacity,
+													.length = LOCKFREESTACK_length,
+													.isEmpty = LOCKFREESTACK_isEmpty,
+													.isFull = LOCKFREESTACK_isFull,
+													.push = LOCKFREESTACK_push,
+													.pop = LOCKFREESTACK_pop,
+													.print = LOCKFREESTACK_print
+};
+
+// Shared link fields, read and written atomically
+#define TOP(stack) ((void* volatile*)&(stack)->top_)
+#define NEXT(node) ((void* volatile*)&(node)->next_)
+
+LockFreeStack* LOCKFREESTACK_create(u16 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	LockFreeStack* stack = (LockFreeStack*)MM->malloc(sizeof(LockFreeStack));
+	if (NULL == stack) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	stack->top_ = NULL;
+	stack->length_ = 0;
+	stack->capacity_ = capacity;
+	stack->ops_ = &lockfree_stack_ops;
+	return stack;
+}
+
+s16 LOCKFREESTACK_destroy(LockFreeStack* stack) {
+	if (NULL == stack) {
+		return kErrorCode_NullStackPointer;
+	}
+	MemoryNode* node = stack->top_;
+	while (NULL != node) {
+		MemoryNode* next = node->ops_->getNext(node);
+		node->ops_->free(node);
+		node = next;
+	}
+	MM->free(stack);
+	return kErrorCode_Ok;
+}
+
+u16 LOCKFREESTACK_capacity(LockFreeStack* stack) {
+	if (NULL == stack) {
+		return 0;
+	}
+	return stack->capacity_;
+}
+
+u16 LOCKFREESTACK_length(LockFreeStack* stack) {
+	if (NULL == stack) {
+		return 0;
+	}
+	return (u16)ATOMIC_loadU32(&stack->length_);
+}
+
+bool LOCKFREESTACK_isEmpty(LockFreeStack* stack) {
+	if (NULL == stack) {
+		return false;
+	}
+	return NULL == ATOMIC_loadPtr(TOP(stack));
+}
+
+bool LOCKFREESTACK_isFull(LockFreeStack* stack) {
+	if (NULL == stack) {
+		return false;
+	}
+	return ATOMIC_loadU32(&stack->length_) >= stack->capacity_;
+}
+
+s16 LOCKFREESTACK_push(LockFreeStack* stack, void* data, u16 bytes) {
+	if (NULL == stack) {
+		return kErrorCode_NullStackPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	HazardRecord* record = HAZARD_acquire();
+	if (NULL == record) {
+		return kErrorCode_InsertionFailed;
+	}
+	// the place is booked before the node is linked, so the capacity is never exceeded
+	if (ATOMIC_addU32(&stack->length_, 1) >= stack->capacity_) {
+		ATOMIC_addU32(&stack->length_, -1);
+		return kErrorCode_InsertionFailed;
+	}
+	MemoryNode* node = HAZARD_takeNode(record);
+	if (NULL == node) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		ATOMIC_addU32(&stack->length_, -1);
+		return kErrorCode_NullMemoryNode;
+	}
+	node->ops_->setData(node, data, bytes);
+	MemoryNode* top = NULL;
+	do {
+		top = ATOMIC_loadPtr(TOP(stack));
+		ATOMIC_storePtr(NEXT(node), top);
+	} while (!ATOMIC_casPtr(TOP(stack), top, node));
+	return kErrorCode_Ok;
+}
+
+void* LOCKFREESTACK_pop(LockFreeStack* stack) {
+	if (NULL == stack) {
+		return NULL;
+	}
+	HazardRecord* record = HAZARD_acquire();
+	if (NULL == record) {
+		return NULL;
+	}
+	MemoryNode* top = NULL;
+	for (;;) {
+		top = ATOMIC_loadPtr(TOP(stack));
+		if (NULL == top) {
+			HAZARD_protect(record, 0, NULL);
+			return NULL;
+		}
+		// the node can only be read once it is protected and still on the top
+		HAZARD_protect(record, 0, top);
+		if (top != ATOMIC_loadPtr(TOP(stack))) {
+			continue;
+		}
+		if (ATOMIC_casPtr(TOP(stack), top, ATOMIC_loadPtr(NEXT(top)))) {
+			break;
+		}
+	}
+	HAZARD_protect(record, 0, NULL);
+	void* data = top->ops_->data(top);
+	ATOMIC_addU32(&stack->length_, -1);
+	HAZARD_retire(record, top);
+	return data;
+}
+
+void LOCKFREESTACK_print(LockFreeStack* stack) {
+	printf("	[LockFreeStack Info] Address: ");
+	if (NULL == stack) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", stack);
+	printf("	[LockFreeStack Info] Length: %d\n", stack->length_);
+	printf("	[LockFreeStack Info] Capacity: %d\n", stack->capacity_);
+
+	u16 i = 0;
+	for (MemoryNode* node = stack->top_; NULL != node; node = node->ops_->getNext(node)) {
+		printf("		[LockFreeStack Info] Storage #%d\n", i++);
+		node->ops_->print(node);
+	}
+	printf("\n");
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "common_def.h"
 #include "adt_movable_head_vector.h"
@@ -8,28 +9,32 @@
 #include "ABGS_MemoryManager/abgs_memory_manager.h"
 
 //MovableHeadVector Declarations
-static s16 MOVABLE_HEAD_VECTOR_destroy(MovableHeadVector* vector);            
-static s16 MOVABLE_HEAD_VECTOR_softReset(MovableHeadVector* vector);          
-static s16 MOVABLE_HEAD_VECTOR_reset(MovableHeadVector* vector);              
-static s16 MOVABLE_HEAD_VECTOR_resize(MovableHeadVector* vector, u16 new_size)
-static s16 MOVABLE_HEAD_VECTOR_capacity(MovableHeadVector* vector);           
-static s16 MOVABLE_HEAD_VECTOR_length(MovableHeadVector* vector);             
+static s16 MOVABLE_HEAD_VECTOR_destroy(MovableHeadVector* vector);
+static s16 MOVABLE_HEAD_VECTOR_softReset(MovableHeadVector* vector);
+static s16 MOVABLE_HEAD_VECTOR_reset(MovableHeadVector* vector);
+static s16 MOVABLE_HEAD_VECTOR_resize(MovableHeadVector* vector, u16 new_size);
+static u16 MOVABLE_HEAD_VECTOR_capacity(MovableHeadVector* vector);
+static u16 MOVABLE_HEAD_VECTOR_length(MovableHeadVector* vector);
 static bool MOVABLE_HEAD_VECTOR_isEmpty(MovableHeadVector* vector);
 static bool MOVABLE_HEAD_VECTOR_isFull(MovableHeadVector* vector);
 static void* MOVABLE_HEAD_VECTOR_first(MovableHeadVector* vector);
-static void* MOVABLE_HEAD_VECTOR_last(MovableHeadVector* vector); 
-static void* MOVABLE_HEAD_VECTOR_at(MovableHeadVector* vector, u16 position);  
-static s16 MOVABLE_HEAD_VECTOR_insertFirst(MovableHeadVector* vector, void* data, u16 bytes);           
-static s16 MOVABLE_HEAD_VECTOR_insertLast(MovableHeadVector* vector, void* data, u16 bytes);            
+static void* MOVABLE_HEAD_VECTOR_last(MovableHeadVector* vector);
+static void* MOVABLE_HEAD_VECTOR_at(MovableHeadVector* vector, u16 position);
+static s16 MOVABLE_HEAD_VECTOR_insertFirst(MovableHeadVector* vector, void* data, u16 bytes);
+static s16 MOVABLE_HEAD_VECTOR_insertLast(MovableHeadVector* vector, void* data, u16 bytes);
 static s16 MOVABLE_HEAD_VECTOR_insertAt(MovableHeadVector* vector, void* data, u16 bytes, u16 position);
-static void* MOVABLE_HEAD_VECTOR_extractFirst(MovableHeadVector* vector);             
-static void* MOVABLE_HEAD_VECTOR_extractLast(MovableHeadVector* vector);              
-static void* MOVABLE_HEAD_VECTOR_extractAt(MovableHeadVector* vector, u16 position);  
-static s16 MOVABLE_HEAD_VECTOR_concat(MovableHeadVector* vector, MovableHeadVector* vector_src); 
-static s16 MOVABLE_HEAD_VECTOR_traverse(MovableHeadVector* vector, void(*callback)(MemoryNode*)); 
+static void* MOVABLE_HEAD_VECTOR_extractFirst(MovableHeadVector* vector);
+static void* MOVABLE_HEAD_VECTOR_extractLast(MovableHeadVector* vector);
+static void* MOVABLE_HEAD_VECTOR_extractAt(MovableHeadVector* vector, u16 position);
+static s16 MOVABLE_HEAD_VECTOR_concat(MovableHeadVector* vector, MovableHeadVector* vector_src);
+static s16 MOVABLE_HEAD_VECTOR_traverse(MovableHeadVector* vector, void(*callback)(MemoryNode*));
+static s16 MOVABLE_HEAD_VECTOR_traverseEx(MovableHeadVector* vector, s16(*callback)(MemoryNode*, void*), void* ctx);
+static s16 MOVABLE_HEAD_VECTOR_traverseBatch(MovableHeadVector* vector, s16(*callback)(MemoryNode**, u16, void*), void* ctx);
 static void MOVABLE_HEAD_VECTOR_print(MovableHeadVector* vector);
+static s16 MOVABLE_HEAD_VECTOR_moveCursor(MovableHeadVector* vector, u16 position);
+static u16 MOVABLE_HEAD_VECTOR_cursor(MovableHeadVector* vector);
 
-struct circular_vector_ops_s vector_ops = { .destroy = MOVABLE_HEAD_VECTOR_destroy,
+struct movable_head_vector_ops_s movable_head_vector_ops = { .destroy = MOVABLE_HEAD_VECTOR_destroy,
 								  .softReset = MOVABLE_HEAD_VECTOR_softReset,
 								  .reset = MOVABLE_HEAD_VECTOR_reset,
 								  .resize = MOVABLE_HEAD_VECTOR_resize,
@@ -48,15 +53,63 @@ struct circular_vector_ops_s vector_ops = { .destroy = MOVABLE_HEAD_VECTOR_destr
 								  .extractAt = MOVABLE_HEAD_VECTOR_extractAt,
 								  .concat = MOVABLE_HEAD_VECTOR_concat,
 								  .traverse = MOVABLE_HEAD_VECTOR_traverse,
-								  .print = MOVABLE_HEAD_VECTOR_print
+								  .traverseEx = MOVABLE_HEAD_VECTOR_traverseEx,
+								  .traverseBatch = MOVABLE_HEAD_VECTOR_traverseBatch,
+								  .print = MOVABLE_HEAD_VECTOR_print,
+								  .moveCursor = MOVABLE_HEAD_VECTOR_moveCursor,
+								  .cursor = MOVABLE_HEAD_VECTOR_cursor
 
 };
 
-CircularVector* MOVABLE_HEAD_VECTOR_create(u16 capacity) {
+// Number of free slots between the two halves in gap buffer mode
+static u16 MOVABLE_HEAD_VECTOR_gapSize(MovableHeadVector* vector) {
+	return vector->gap_end_ - vector->gap_start_;
+}
+
+// Translates a logical position into a slot of the storage
+static u16 MOVABLE_HEAD_VECTOR_slot(MovableHeadVector* vector, u16 position) {
+	if (kMovableHeadVectorMode_GapBuffer == vector->mode_) {
+		if (position < vector->gap_start_) {
+			return position;
+		}
+		return position + MOVABLE_HEAD_VECTOR_gapSize(vector);
+	}
+	return vector->head_ + position;
+}
+
+// Moves the gap in front of position, shifting only the elements in between
+static void MOVABLE_HEAD_VECTOR_moveGap(MovableHeadVector* vector, u16 position) {
+	if (position < vector->gap_start_) {
+		u16 moved = vector->gap_start_ - position;
+		memmove(&vector->storage_[vector->gap_end_ - moved], &vector->storage_[position], sizeof(MemoryNode) * moved);
+		vector->gap_start_ -= moved;
+		vector->gap_end_ -= moved;
+	}
+	else if (position > vector->gap_start_) {
+		u16 moved = position - vector->gap_start_;
+		memmove(&vector->storage_[vector->gap_start_], &vector->storage_[vector->gap_end_], sizeof(MemoryNode) * moved);
+		vector->gap_start_ += moved;
+		vector->gap_end_ += moved;
+	}
+}
+
+// Leaves the vector empty with the free space placed as its mode expects
+static void MOVABLE_HEAD_VECTOR_clear(MovableHeadVector* vector) {
+	vector->head_ = 0;
+	vector->tail_ = 0;
+	vector->gap_start_ = 0;
+	vector->gap_end_ = vector->capacity_;
+}
+
+MovableHeadVector* MOVABLE_HEAD_VECTOR_create(u16 capacity) {
+	return MOVABLE_HEAD_VECTOR_createWithMode(capacity, kMovableHeadVectorMode_Contiguous);
+}
+
+MovableHeadVector* MOVABLE_HEAD_VECTOR_createWithMode(u16 capacity, MovableHeadVectorMode mode) {
 	if (capacity == 0) {
 		return NULL;
 	}
- MovableHeadVector* new_vector = (MovableHeadVector*)MM->malloc(sizeof(MovableHeadVector));
+	MovableHeadVector* new_vector = (MovableHeadVector*)MM->malloc(sizeof(MovableHeadVector));
 	if (NULL == new_vector) {
 #ifdef VERBOSE_
 		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
@@ -68,14 +121,14 @@ CircularVector* MOVABLE_HEAD_VECTOR_create(u16 capacity) {
 #ifdef VERBOSE_
 		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
 #endif
-  MM->free(new_vector);
+		MM->free(new_vector);
 		return NULL;
 	}
 	new_vector->storage_ = node;
-	new_vector->head_ = 0;
-	new_vector->tail_ = 0;
 	new_vector->capacity_ = capacity;
-	new_vector->ops_ = &vector_ops;
+	new_vector->mode_ = mode;
+	new_vector->ops_ = &movable_head_vector_ops;
+	MOVABLE_HEAD_VECTOR_clear(new_vector);
 	for (u16 i = 0; i < capacity; ++i) {
 		MEMNODE_createLite(&new_vector->storage_[i]);
 	}
@@ -86,15 +139,14 @@ s16 MOVABLE_HEAD_VECTOR_destroy(MovableHeadVector* vector) {
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-
-	if (vector->storage_ == NULL) {
-		return kErrorCode_NullMemoryNode;
+	if (vector->storage_ != NULL) {
+		u16 length = vector->ops_->length(vector);
+		for (u16 i = 0; i < length; ++i) {
+			u16 slot = MOVABLE_HEAD_VECTOR_slot(vector, i);
+			vector->storage_[slot].ops_->reset(&vector->storage_[slot]);
+		}
+		MM->free(vector->storage_);
 	}
-	for (u16 i = 0; i < MOVABLE_HEAD_VECTOR_capacity(vector); ++i) {
-		vector->storage_->ops_->reset(&vector->storage_[i]);
-	}
-
-	MM->free(vector->storage_);
 	MM->free(vector);
 
 	return kErrorCode_Ok;
@@ -104,33 +156,37 @@ s16 MOVABLE_HEAD_VECTOR_softReset(MovableHeadVector* vector) {
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-	if (vector->storage_) {
+	if (vector->storage_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-	for (u16 i = 0; i < vector->ops_->length(vector); ++i) {
-		vector->storage_[i].ops_->softReset(&vector->storage_[i]);
+	u16 length = vector->ops_->length(vector);
+	for (u16 i = 0; i < length; ++i) {
+		u16 slot = MOVABLE_HEAD_VECTOR_slot(vector, i);
+		vector->storage_[slot].ops_->softReset(&vector->storage_[slot]);
 	}
+	MOVABLE_HEAD_VECTOR_clear(vector);
 	return kErrorCode_Ok;
 }
 
-u16 MOVABLE_HEAD_VECTOR_reset(MovableHeadVector* vector) {
+s16 MOVABLE_HEAD_VECTOR_reset(MovableHeadVector* vector) {
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
 	if (vector->storage_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-	for (u16 i = 0; i < vector->tail_; ++i) {
-		vector->storage_[i].ops_->softReset(&vector->storage_[i]);
+	u16 length = vector->ops_->length(vector);
+	for (u16 i = 0; i < length; ++i) {
+		u16 slot = MOVABLE_HEAD_VECTOR_slot(vector, i);
+		vector->storage_[slot].ops_->reset(&vector->storage_[slot]);
 	}
-	vector->tail_ = 0;
+	MOVABLE_HEAD_VECTOR_clear(vector);
 
 	return kErrorCode_Ok;
 }
 
-/* START DIABOLIK DEVELOPMENT */
 s16 MOVABLE_HEAD_VECTOR_resize(MovableHeadVector* vector, u16 new_size) {
-  // parameter control
+	// parameter control
 	if (NULL == vector) {
 		return kErrorCode_NullVectorPointer;
 	}
@@ -140,60 +196,76 @@ s16 MOVABLE_HEAD_VECTOR_resize(MovableHeadVector* vector, u16 new_size) {
 	if (0 == new_size) {
 		return kErrorCode_InvalidValue;
 	}
- // new node and reserved memory check
- MemoryNode* node = (MemoryNode*)MM->malloc(sizeof(MemoryNode) * new_size);
- if (node == NULL) {
+	if (new_size == vector->capacity_) {
+		return kErrorCode_Ok;
+	}
+	// new node and reserved memory check
+	MemoryNode* node = (MemoryNode*)MM->malloc(sizeof(MemoryNode) * new_size);
+	if (node == NULL) {
 #ifdef VERBOSE_
-   printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
 #endif
-   return kErrorCode_NullMemoryAllocation;
-}
- //data copied to the new node
- for (u16 i = 0; i < new_size; ++i) {
-   if (i < vector->ops_->length(vector)) {
-     *(node + i) = vector->storage_[i];
-   }
-   else {
-     MEMNODE_createLite(&*(node + i));
-   }
- }
- // free excess data
- if (vector->ops_->length(vector) > new_size) {
-   for (u16 i = new_size; i < vector->ops_->length(vector); ++i) {
-     vector->storage_[i].ops_->reset(&vector->storage_[i]);
-   }
-   vector->tail_ = new_size;
- }
-
- vector->capacity_ = new_size;
- MM->free(vector->storage_);
- vector->storage_ = node;
- return kErrorCode_Ok;
+		return kErrorCode_NullMemoryAllocation;
+	}
+	// data copied to the new node starting at 0, free space goes to the end
+	u16 length = vector->ops_->length(vector);
+	u16 new_length = length < new_size ? length : new_size;
+	for (u16 i = 0; i < new_size; ++i) {
+		if (i < new_length) {
+			*(node + i) = vector->storage_[MOVABLE_HEAD_VECTOR_slot(vector, i)];
+		}
+		else {
+			MEMNODE_createLite(&*(node + i));
+		}
+	}
+	// free excess data
+	for (u16 i = new_length; i < length; ++i) {
+		u16 slot = MOVABLE_HEAD_VECTOR_slot(vector, i);
+		vector->storage_[slot].ops_->reset(&vector->storage_[slot]);
+	}
+
+	MM->free(vector->storage_);
+	vector->storage_ = node;
+	vector->capacity_ = new_size;
+	vector->head_ = 0;
+	vector->tail_ = new_length;
+	vector->gap_start_ = new_length;
+	vector->gap_end_ = new_size;
+	return kErrorCode_Ok;
 }
 
-s16 MOVABLE_HEAD_VECTOR_capacity(MovableHeadVector* vector) {
+u16 MOVABLE_HEAD_VECTOR_capacity(MovableHeadVector* vector) {
 	if (NULL == vector) {
-		return kErrorCode_NullVectorPointer;
+		return 0;
 	}
 	return vector->capacity_;
 }
 
-s16 MOVABLE_HEAD_VECTOR_length(MovableHeadVector* vector) {
+u16 MOVABLE_HEAD_VECTOR_length(MovableHeadVector* vector) {
 	if (NULL == vector) {
-		return kErrorCode_NullVectorPointer;
+		return 0;
+	}
+	if (kMovableHeadVectorMode_GapBuffer == vector->mode_) {
+		return vector->capacity_ - MOVABLE_HEAD_VECTOR_gapSize(vector);
 	}
-	return vector->tail_;
+	return vector->tail_ - vector->head_;
 }
 
 bool MOVABLE_HEAD_VECTOR_isEmpty(MovableHeadVector* vector) {
 	if (vector != NULL) {
-		return vector->tail_ == 0;
+		return vector->ops_->length(vector) == 0;
+	}
+	else {
+		return false;
 	}
 }
 
 bool MOVABLE_HEAD_VECTOR_isFull(MovableHeadVector* vector) {
 	if (NULL != vector) {
-		return MOVABLE_HEAD_VECTOR_capacity(vector) == MOVABLE_HEAD_VECTOR_length(vector);
+		return vector->ops_->length(vector) == vector->capacity_;
+	}
+	else {
+		return false;
 	}
 }
 //////////////////////////////
@@ -201,31 +273,17 @@ void* MOVABLE_HEAD_VECTOR_first(MovableHeadVector* vector) {
 	if (vector == NULL) {
 		return NULL;
 	}
-	if (vector->storage_ == NULL) {
-		return NULL;
-	}
-	if (vector->storage_[0].ops_->data(&vector->storage_[0]) == NULL) {
-		return NULL;
-	}
-	return vector->storage_[0].ops_->data(&vector->storage_[0]);
+	return vector->ops_->at(vector, 0);
 }
 
 void* MOVABLE_HEAD_VECTOR_last(MovableHeadVector* vector) {
 	if (vector == NULL) {
 		return NULL;
 	}
-	if (vector->storage_ == NULL) {
-		return NULL;
-	}
-	if (VECTOR_length(vector) < 1) {
-		return NULL;
-	}
-	u16 i = MOVABLE_HEAD_VECTOR_length(vector) - 1;
-	if (vector->storage_[i].ops_->data(&vector->storage_[i]) == NULL) {
+	if (vector->ops_->isEmpty(vector)) {
 		return NULL;
 	}
-	return vector->storage_[i].ops_->data(&vector->storage_[i]);
-
+	return vector->ops_->at(vector, vector->ops_->length(vector) - 1);
 }
 
 void* MOVABLE_HEAD_VECTOR_at(MovableHeadVector* vector, u16 position) {
@@ -235,129 +293,80 @@ void* MOVABLE_HEAD_VECTOR_at(MovableHeadVector* vector, u16 position) {
 	if (vector->storage_ == NULL) {
 		return NULL;
 	}
-	if (vector->storage_[position].ops_->data(&vector->storage_[position]) == NULL) {
-		return NULL;
-	}
-	if (position >= MOVABLE_HEAD_VECTOR_length(vector)) {
+	if (position >= vector->ops_->length(vector)) {
 		return NULL;
 	}
-	return vector->storage_[position].ops_->data(&vector->storage_[position]);
+	u16 slot = MOVABLE_HEAD_VECTOR_slot(vector, position);
+	return vector->storage_[slot].ops_->data(&vector->storage_[slot]);
 }
 
 s16 MOVABLE_HEAD_VECTOR_insertFirst(MovableHeadVector* vector, void* data, u16 bytes) {
-	if (vector == NULL) {
-		return kErrorCode_NullVectorPointer;
-	}
-	if (MOVABLE_HEAD_VECTOR_isFull(vector)) {
-		return kErrorCode_InsertionFailed;
-	}
-	if (data == NULL) {
-		return kErrorCode_NullPointer;
-	}
-	if (vector->storage_ == NULL) {
-		return kErrorCode_NullMemoryNode;
-	}
-
-	for (u16 i = MOVABLE_HEAD_VECTOR_length(vector); i > 0; --i) {
-		vector->storage_[i].ops_->setData(&vector->storage_[i],
-			vector->storage_[i - 1].data_,
-			vector->storage_[i - 1].size_);
-
-	}
-	vector->storage_[0].ops_->setData(&vector->storage_[0], data, bytes);
-
-	vector->tail_++;
-	return kErrorCode_Ok;
+	return MOVABLE_HEAD_VECTOR_insertAt(vector, data, bytes, 0);
 }
 
 s16 MOVABLE_HEAD_VECTOR_insertLast(MovableHeadVector* vector, void* data, u16 bytes) {
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-	if (MOVABLE_HEAD_VECTOR_isFull(vector)) {
-		return kErrorCode_InsertionFailed;
-	}
-	if (data == NULL) {
-		return kErrorCode_NullPointer;
-	}
-	if (vector->storage_ == NULL) {
-		return kErrorCode_NullMemoryNode;
-	}
-	u16 i = MOVABLE_HEAD_VECTOR_length(vector);
-	vector->storage_[i].ops_->setData(&vector->storage_[i], data, bytes);
-	vector->tail_++;
-	return kErrorCode_Ok;
+	return MOVABLE_HEAD_VECTOR_insertAt(vector, data, bytes, vector->ops_->length(vector));
 }
 
 s16 MOVABLE_HEAD_VECTOR_insertAt(MovableHeadVector* vector, void* data, u16 bytes, u16 position) {
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-	if (MOVABLE_HEAD_VECTOR_isFull(vector)) {
+	if (vector->ops_->isFull(vector)) {
 		return kErrorCode_InsertionFailed;
 	}
 	if (data == NULL) {
-		return kErrorCode_NullMemoryNode;
+		return kErrorCode_NullPointer;
 	}
 	if (vector->storage_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-
-	for (u16 i = MOVABLE_HEAD_VECTOR_length(vector); i > position; --i) {
-		vector->storage_[i].ops_->setData(&vector->storage_[i],
-			vector->storage_[i - 1].data_,
-			vector->storage_[i - 1].size_);
-
-	}
-	vector->storage_[position].ops_->setData(&vector->storage_[position], data, bytes);
-	vector->tail_++;
+	u16 length = vector->ops_->length(vector);
+	if (position > length) {
+		position = length;
+	}
+	if (kMovableHeadVectorMode_GapBuffer == vector->mode_) {
+		// the new element takes the first slot of the gap
+		MOVABLE_HEAD_VECTOR_moveGap(vector, position);
+		vector->storage_[vector->gap_start_].ops_->setData(&vector->storage_[vector->gap_start_], data, bytes);
+		vector->gap_start_++;
+		return kErrorCode_Ok;
+	}
+	// shift the shorter side, the head can only go left if there is room before it
+	bool move_head = (vector->head_ > 0) && (position < (length - position) || vector->tail_ == vector->capacity_);
+	if (move_head) {
+		memmove(&vector->storage_[vector->head_ - 1], &vector->storage_[vector->head_], sizeof(MemoryNode) * position);
+		vector->head_--;
+	}
+	else {
+		if (vector->tail_ == vector->capacity_) {
+			// no room at either end, only possible with head_ == 0 and a full vector
+			return kErrorCode_InsertionFailed;
+		}
+		memmove(&vector->storage_[vector->head_ + position + 1], &vector->storage_[vector->head_ + position],
+			sizeof(MemoryNode) * (length - position));
+		vector->tail_++;
+	}
+	u16 slot = vector->head_ + position;
+	vector->storage_[slot].ops_->setData(&vector->storage_[slot], data, bytes);
 	return kErrorCode_Ok;
 }
 
 void* MOVABLE_HEAD_VECTOR_extractFirst(MovableHeadVector* vector) {
-	if (vector == NULL) {
-		return NULL;
-	}
- if (vector->ops_->isEmpty(&vector)) {
-   return NULL;
- }
-	if (vector->storage_ == NULL) {
-		return NULL;
-	}
-	if (vector->storage_[0].ops_->data(&vector->storage_[0]) == NULL) {
-		return NULL;
-	}
-	void* tmp_data_ = vector->storage_[0].ops_->data(&vector->storage_[0]);
-	u16 j = MOVABLE_HEAD_VECTOR_length(vector) - 1;
-	for (u16 i = 0; i < j; ++i) {
-		vector->storage_[i].ops_->setData(&vector->storage_[i],
-			vector->storage_[i + 1].ops_->data(&vector->storage_[i + 1]),
-			vector->storage_[i + 1].ops_->size(&vector->storage_[i + 1]));
-	}
-	vector->storage_[j + 1].ops_->softReset(&vector->storage_[j + 1]);
-	vector->tail_--;
-	return tmp_data_;
+	return MOVABLE_HEAD_VECTOR_extractAt(vector, 0);
 }
 
 void* MOVABLE_HEAD_VECTOR_extractLast(MovableHeadVector* vector) {
 	if (vector == NULL) {
 		return NULL;
 	}
- if (vector->ops_->isEmpty(&vector)) {
-   return NULL;
- }
-	if (vector->storage_ == NULL) {
-		return NULL;
-	}
-	u16 i = MOVABLE_HEAD_VECTOR_length(vector) - 1;
-	if (vector->storage_[i].ops_->data(&vector->storage_[i]) == NULL) {
+	if (vector->ops_->isEmpty(vector)) {
 		return NULL;
 	}
-	void* tmp_data = vector->storage_[i].ops_->data(&vector->storage_[i]);
-
-	vector->storage_[i].ops_->softReset(&vector->storage_[i]);
-	vector->tail_--;
-	return tmp_data;
+	return MOVABLE_HEAD_VECTOR_extractAt(vector, vector->ops_->length(vector) - 1);
 }
 
 
@@ -365,62 +374,70 @@ void* MOVABLE_HEAD_VECTOR_extractAt(MovableHeadVector* vector, u16 position) {
 	if (vector == NULL) {
 		return NULL;
 	}
- if (vector->ops_->isEmpty(&vector)) {
-   return NULL;
- }
+	if (vector->ops_->isEmpty(vector)) {
+		return NULL;
+	}
 	if (vector->storage_ == NULL) {
 		return NULL;
 	}
-	if (vector->storage_[position].ops_->data(&vector->storage_[position]) == NULL) {
+	u16 length = vector->ops_->length(vector);
+	if (position >= length) {
 		return NULL;
 	}
-	void* tmp_data = vector->storage_[position].ops_->data(&vector->storage_[position]);
-	u16 j = MOVABLE_HEAD_VECTOR_length(vector) - 1;
-	for (u16 i = position; i < j; ++i) {
-		vector->storage_[i].ops_->setData(&vector->storage_[i],
-			vector->storage_[i + 1].ops_->data(&vector->storage_[i + 1]),
-			vector->storage_[i + 1].ops_->size(&vector->storage_[i + 1]));
+	void* tmp_data = NULL;
+	if (kMovableHeadVectorMode_GapBuffer == vector->mode_) {
+		// the extracted element is the first one after the gap, the gap grows over it
+		MOVABLE_HEAD_VECTOR_moveGap(vector, position);
+		tmp_data = vector->storage_[vector->gap_end_].ops_->data(&vector->storage_[vector->gap_end_]);
+		vector->storage_[vector->gap_end_].ops_->softReset(&vector->storage_[vector->gap_end_]);
+		vector->gap_end_++;
+		return tmp_data;
+	}
+	u16 slot = vector->head_ + position;
+	tmp_data = vector->storage_[slot].ops_->data(&vector->storage_[slot]);
+	// close the hole moving the shorter side
+	if (position < (length - position - 1)) {
+		memmove(&vector->storage_[vector->head_ + 1], &vector->storage_[vector->head_], sizeof(MemoryNode) * position);
+		vector->storage_[vector->head_].ops_->softReset(&vector->storage_[vector->head_]);
+		vector->head_++;
+	}
+	else {
+		memmove(&vector->storage_[slot], &vector->storage_[slot + 1], sizeof(MemoryNode) * (length - position - 1));
+		vector->tail_--;
+		vector->storage_[vector->tail_].ops_->softReset(&vector->storage_[vector->tail_]);
 	}
-	vector->storage_[j + 1].ops_->softReset(&vector->storage_[j + 1]);
-	vector->tail_--;
 	return tmp_data;
 }
 
 s16 MOVABLE_HEAD_VECTOR_concat(MovableHeadVector* vector, MovableHeadVector* vector_src) {
-  // parameter control
+	// parameter control
 	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector->storage_) {
 		return kErrorCode_NullMemoryNode;
 	}
- if (NULL == vector->storage_) {
-   return kErrorCode_NullMemoryNode;
- }
 	if (NULL == vector_src) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector_src->storage_) {
 		return kErrorCode_NullMemoryNode;
 	}
- if (NULL == vector_src->storage_) {
-   return kErrorCode_NullMemoryNode;
- }
- // change tail vector and capacity
- u16 new_tail = vector->ops_->length(vector) + vector_src->ops_->length(vector_src);
- u16 new_capacity = vector->ops_->capacity(vector) + vector_src->ops_->capacity(vector_src);
- vector->ops_->resize(vector, new_capacity);
- // if the second vector is empty there is nothing to copy
- if (vector_src->ops_->isEmpty(&vector_src)) {
-   if (vector->ops_->isEmpty(&vector)) {
-     return kErrorCode_Ok;
-   }
-   return kErrorCode_Ok;
- }
- // data from the second vector copied to the first
- u16 j = 0;
- for (u16 i = vector->ops_->length(vector); i < new_tail; ++i) {
-   vector->storage_->ops_->memCopy(vector->storage_ + i,
-     vector_src->storage_[j].ops_->data(vector_src->storage_ + j),
-     vector_src->storage_[j].ops_->size(vector_src->storage_ + j));
-   j++;
- }
- vector->tail_ = new_tail;
- vector->capacity_ = new_capacity;
+	// change capacity, resize also leaves all the free space at the end
+	u16 new_capacity = vector->capacity_ + vector_src->capacity_;
+	s16 error_type = vector->ops_->resize(vector, new_capacity);
+	if (kErrorCode_Ok != error_type) {
+		return error_type;
+	}
+	// data from the second vector copied to the first
+	u16 src_length = vector_src->ops_->length(vector_src);
+	for (u16 i = 0; i < src_length; ++i) {
+		MemoryNode* src_node = &vector_src->storage_[MOVABLE_HEAD_VECTOR_slot(vector_src, i)];
+		MemoryNode* dst_node = &vector->storage_[vector->tail_];
+		dst_node->ops_->memCopy(dst_node, src_node->ops_->data(src_node), src_node->ops_->size(src_node));
+		vector->tail_++;
+		vector->gap_start_++;
+	}
 
 	return kErrorCode_Ok;
 }
@@ -429,38 +446,115 @@ s16 MOVABLE_HEAD_VECTOR_traverse(MovableHeadVector* vector, void(*callback)(Memo
 	if (vector == NULL) {
 		return kErrorCode_NullVectorPointer;
 	}
-
 	if (vector->storage_ == NULL) {
 		return kErrorCode_NullMemoryNode;
 	}
-	for (u16 i = 0; i < vector->tail_; ++i) {
-		callback(&vector->storage_[i]);
+	u16 length = vector->ops_->length(vector);
+	for (u16 i = 0; i < length; ++i) {
+		callback(&vector->storage_[MOVABLE_HEAD_VECTOR_slot(vector, i)]);
 	}
 
 	return kErrorCode_Ok;
 }
 
+s16 MOVABLE_HEAD_VECTOR_traverseEx(MovableHeadVector* vector, s16(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector->storage_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	u16 length = vector->ops_->length(vector);
+	for (u16 i = 0; i < length; ++i) {
+		if (kTraverse_Stop == callback(&vector->storage_[MOVABLE_HEAD_VECTOR_slot(vector, i)], ctx)) {
+			break;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 MOVABLE_HEAD_VECTOR_traverseBatch(MovableHeadVector* vector, s16(*callback)(MemoryNode**, u16, void*), void* ctx) {
+	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector->storage_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode* batch[kTraverseBatchLength];
+	u16 count = 0;
+	u16 length = vector->ops_->length(vector);
+	for (u16 i = 0; i < length; ++i) {
+		batch[count++] = &vector->storage_[MOVABLE_HEAD_VECTOR_slot(vector, i)];
+		if (kTraverseBatchLength == count || i + 1 == length) {
+			if (kTraverse_Stop == callback(batch, count, ctx)) {
+				break;
+			}
+			count = 0;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
 void MOVABLE_HEAD_VECTOR_print(MovableHeadVector* vector) {
 	printf("	[Vector Info] Address: ");
 	if (NULL == vector) {
-		return printf(" NULL");
+		printf(" NULL\n");
+		return;
 	}
 	printf("%p\n", vector);
 
-	printf("	[Vector Info] Head: %d\n", vector->head_);
-	printf("	[Vector Info] Tail: %d\n", vector->tail_);
-	printf("	[Vector Info] Length: %d\n", vector->tail_);
+	if (kMovableHeadVectorMode_GapBuffer == vector->mode_) {
+		printf("	[Vector Info] Gap: [%d, %d)\n", vector->gap_start_, vector->gap_end_);
+	}
+	else {
+		printf("	[Vector Info] Head: %d\n", vector->head_);
+		printf("	[Vector Info] Tail: %d\n", vector->tail_);
+	}
+	printf("	[Vector Info] Length: %d\n", vector->ops_->length(vector));
 	printf("	[Vector Info] Capacity: %d\n", vector->capacity_);
 
 	printf("	[Vector Info] Address: ");
 	if (NULL == vector->storage_) {
-		return printf(" NULL");
+		printf(" NULL\n");
+		return;
 	}
 	printf("%p\n", vector->storage_);
 
-	for (int i = 0; i < vector->tail_; ++i) {
+	u16 length = vector->ops_->length(vector);
+	for (u16 i = 0; i < length; ++i) {
 		printf("	[Vector Info] Storage #%d\n", i);
-		vector->storage_->ops_->print(&vector->storage_[i]);
+		vector->storage_->ops_->print(&vector->storage_[MOVABLE_HEAD_VECTOR_slot(vector, i)]);
 	}
 	printf("\n");
-}
\ No newline at end of file
+}
+
+s16 MOVABLE_HEAD_VECTOR_moveCursor(MovableHeadVector* vector, u16 position) {
+	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector->storage_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (kMovableHeadVectorMode_GapBuffer != vector->mode_) {
+		return kErrorCode_InvalidValue;
+	}
+	u16 length = vector->ops_->length(vector);
+	MOVABLE_HEAD_VECTOR_moveGap(vector, position > length ? length : position);
+	return kErrorCode_Ok;
+}
+
+u16 MOVABLE_HEAD_VECTOR_cursor(MovableHeadVector* vector) {
+	if (NULL == vector) {
+		return 0;
+	}
+	if (kMovableHeadVectorMode_GapBuffer != vector->mode_) {
+		return 0;
+	}
+	return vector->gap_start_;
+}
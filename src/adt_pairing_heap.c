@@ -0,0 +1,425 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_pairing_heap.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//PairingHeap Declarations
+static s16 PAIRINGHEAP_destroy(PairingHeap* heap);
+static s16 PAIRINGHEAP_softReset(PairingHeap* heap);
+static s16 PAIRINGHEAP_reset(PairingHeap* heap);
+static u16 PAIRINGHEAP_capacity(PairingHeap* heap);
+static u16 PAIRINGHEAP_length(PairingHeap* heap);
+static bool PAIRINGHEAP_isEmpty(PairingHeap* heap);
+static bool PAIRINGHEAP_isFull(PairingHeap* heap);
+static void* PAIRINGHEAP_top(PairingHeap* heap);
+static s32 PAIRINGHEAP_topKey(PairingHeap* heap);
+static s16 PAIRINGHEAP_insert(PairingHeap* heap, void* data, u16 bytes, s32 key, PairingHeapNode** handle);
+static s16 PAIRINGHEAP_decreaseKey(PairingHeap* heap, PairingHeapNode* handle, s32 key);
+static s16 PAIRINGHEAP_meld(PairingHeap* heap, PairingHeap* heap_src);
+static void* PAIRINGHEAP_pop(PairingHeap* heap);
+static void* PAIRINGHEAP_erase(PairingHeap* heap, PairingHeapNode* handle);
+static s16 PAIRINGHEAP_traverse(PairingHeap* heap, void(*callback)(MemoryNode*));
+static void PAIRINGHEAP_print(PairingHeap* heap);
+
+struct pairing_heap_ops_s pairing_heap_ops = { .destroy = PAIRINGHEAP_destroy,
+												.softReset = PAIRINGHEAP_softReset,
+												.reset = PAIRINGHEAP_reset,
+												.capacity = PAIRINGHEAP_capacity,
+												.length = PAIRINGHEAP_length,
+												.isEmpty = PAIRINGHEAP_isEmpty,
+												.isFull = PAIRINGHEAP_isFull,
+												.top = PAIRINGHEAP_top,
+												.topKey = PAIRINGHEAP_topKey,
+												.insert = PAIRINGHEAP_insert,
+												.decreaseKey = PAIRINGHEAP_decreaseKey,
+												.meld = PAIRINGHEAP_meld,
+												.pop = PAIRINGHEAP_pop,
+												.erase = PAIRINGHEAP_erase,
+												.traverse = PAIRINGHEAP_traverse,
+												.print = PAIRINGHEAP_print
+};
+
+PairingHeap* PAIRINGHEAP_create(u16 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	PairingHeap* heap = (PairingHeap*)MM->malloc(sizeof(PairingHeap));
+	if (NULL == heap) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	heap->root_ = NULL;
+	heap->blocks_ = NULL;
+	heap->free_ = NULL;
+	heap->free_last_ = NULL;
+	heap->length_ = 0;
+	heap->capacity_ = capacity;
+	heap->ops_ = &pairing_heap_ops;
+	return heap;
+}
+
+// Gives a node back to the pool
+static void PAIRINGHEAP_release(PairingHeap* heap, PairingHeapNode* node) {
+	node->data_ = NULL;
+	node->size_ = 0;
+	node->child_ = NULL;
+	node->prev_ = NULL;
+	node->sibling_ = heap->free_;
+	if (NULL == heap->free_) {
+		heap->free_last_ = node;
+	}
+	heap->free_ = node;
+}
+
+// Takes a node from the pool, allocating a new block when it is empty
+static PairingHeapNode* PAIRINGHEAP_take(PairingHeap* heap) {
+	if (NULL == heap->free_) {
+		PairingHeapBlock* block = (PairingHeapBlock*)MM->malloc(sizeof(PairingHeapBlock));
+		if (NULL == block) {
+#ifdef VERBOSE_
+			printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+			return NULL;
+		}
+		block->next_ = heap->blocks_;
+		heap->blocks_ = block;
+		for (u16 i = kPairingHeapBlockLength; i > 0; --i) {
+			PAIRINGHEAP_release(heap, &block->nodes_[i - 1]);
+		}
+	}
+	PairingHeapNode* node = heap->free_;
+	heap->free_ = node->sibling_;
+	if (NULL == heap->free_) {
+		heap->free_last_ = NULL;
+	}
+	node->sibling_ = NULL;
+	return node;
+}
+
+// Joins two trees, the root with the greater key becomes the first child of the other
+static PairingHeapNode* PAIRINGHEAP_link(PairingHeapNode* a, PairingHeapNode* b) {
+	if (NULL == a) {
+		return b;
+	}
+	if (NULL == b) {
+		return a;
+	}
+	if (b->key_ < a->key_) {
+		PairingHeapNode* swap = a;
+		a = b;
+		b = swap;
+	}
+	b->sibling_ = a->child_;
+	if (NULL != a->child_) {
+		a->child_->prev_ = b;
+	}
+	b->prev_ = a;
+	a->child_ = b;
+	a->sibling_ = NULL;
+	a->prev_ = NULL;
+	return a;
+}
+
+// Joins a chain of siblings into one tree: pairs left to right, then folds the
+// pairs right to left
+static PairingHeapNode* PAIRINGHEAP_mergePairs(PairingHeapNode* first) {
+	PairingHeapNode* pairs = NULL;
+	while (NULL != first) {
+		PairingHeapNode* a = first;
+		PairingHeapNode* b = a->sibling_;
+		first = NULL != b ? b->sibling_ : NULL;
+		a->sibling_ = NULL;
+		a->prev_ = NULL;
+		if (NULL != b) {
+			b->sibling_ = NULL;
+			b->prev_ = NULL;
+		}
+		// the pairs are chained through sibling_ in reverse order
+		PairingHeapNode* pair = PAIRINGHEAP_link(a, b);
+		pair->sibling_ = pairs;
+		pairs = pair;
+	}
+	PairingHeapNode* root = NULL;
+	while (NULL != pairs) {
+		PairingHeapNode* next = pairs->sibling_;
+		pairs->sibling_ = NULL;
+		root = PAIRINGHEAP_link(root, pairs);
+		pairs = next;
+	}
+	return root;
+}
+
+// Detaches a node that is not the root, with its subtree, from its parent
+static void PAIRINGHEAP_cut(PairingHeapNode* node) {
+	if (node->prev_->child_ == node) {
+		node->prev_->child_ = node->sibling_;
+	}
+	else {
+		node->prev_->sibling_ = node->sibling_;
+	}
+	if (NULL != node->sibling_) {
+		node->sibling_->prev_ = node->prev_;
+	}
+	node->sibling_ = NULL;
+	node->prev_ = NULL;
+}
+
+// Empties the heap, freeing the data of every element when hard is true. The
+// pool is walked by blocks, the nodes with data are the elements
+static void PAIRINGHEAP_clear(PairingHeap* heap, bool hard) {
+	heap->free_ = NULL;
+	heap->free_last_ = NULL;
+	for (PairingHeapBlock* block = heap->blocks_; NULL != block; block = block->next_) {
+		for (u16 i = kPairingHeapBlockLength; i > 0; --i) {
+			PairingHeapNode* node = &block->nodes_[i - 1];
+			if (hard && NULL != node->data_) {
+				MM->free(node->data_);
+			}
+			PAIRINGHEAP_release(heap, node);
+		}
+	}
+	heap->root_ = NULL;
+	heap->length_ = 0;
+}
+
+s16 PAIRINGHEAP_destroy(PairingHeap* heap) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	PAIRINGHEAP_clear(heap, true);
+	PairingHeapBlock* block = heap->blocks_;
+	while (NULL != block) {
+		PairingHeapBlock* next = block->next_;
+		MM->free(block);
+		block = next;
+	}
+	MM->free(heap);
+	return kErrorCode_Ok;
+}
+
+s16 PAIRINGHEAP_softReset(PairingHeap* heap) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	PAIRINGHEAP_clear(heap, false);
+	return kErrorCode_Ok;
+}
+
+s16 PAIRINGHEAP_reset(PairingHeap* heap) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	PAIRINGHEAP_clear(heap, true);
+	return kErrorCode_Ok;
+}
+
+u16 PAIRINGHEAP_capacity(PairingHeap* heap) {
+	if (NULL == heap) {
+		return 0;
+	}
+	return heap->capacity_;
+}
+
+u16 PAIRINGHEAP_length(PairingHeap* heap) {
+	if (NULL == heap) {
+		return 0;
+	}
+	return heap->length_;
+}
+
+bool PAIRINGHEAP_isEmpty(PairingHeap* heap) {
+	if (NULL == heap) {
+		return false;
+	}
+	return 0 == heap->length_;
+}
+
+bool PAIRINGHEAP_isFull(PairingHeap* heap) {
+	if (NULL == heap) {
+		return false;
+	}
+	return heap->length_ >= heap->capacity_;
+}
+
+void* PAIRINGHEAP_top(PairingHeap* heap) {
+	if (NULL == heap || NULL == heap->root_) {
+		return NULL;
+	}
+	return heap->root_->data_;
+}
+
+s32 PAIRINGHEAP_topKey(PairingHeap* heap) {
+	if (NULL == heap || NULL == heap->root_) {
+		return 0;
+	}
+	return heap->root_->key_;
+}
+
+s16 PAIRINGHEAP_insert(PairingHeap* heap, void* data, u16 bytes, s32 key, PairingHeapNode** handle) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	if (heap->length_ >= heap->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	PairingHeapNode* node = PAIRINGHEAP_take(heap);
+	if (NULL == node) {
+		return kErrorCode_NullMemoryAllocation;
+	}
+	node->data_ = data;
+	node->size_ = bytes;
+	node->key_ = key;
+	heap->root_ = PAIRINGHEAP_link(heap->root_, node);
+	heap->length_++;
+	if (NULL != handle) {
+		*handle = node;
+	}
+	return kErrorCode_Ok;
+}
+
+s16 PAIRINGHEAP_decreaseKey(PairingHeap* heap, PairingHeapNode* handle, s32 key) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	if (NULL == handle || NULL == handle->data_) {
+		return kErrorCode_NullPointer;
+	}
+	if (key > handle->key_) {
+		return kErrorCode_InvalidValue;
+	}
+	handle->key_ = key;
+	if (handle != heap->root_) {
+		PAIRINGHEAP_cut(handle);
+		heap->root_ = PAIRINGHEAP_link(heap->root_, handle);
+	}
+	return kErrorCode_Ok;
+}
+
+s16 PAIRINGHEAP_meld(PairingHeap* heap, PairingHeap* heap_src) {
+	if (NULL == heap || NULL == heap_src) {
+		return kErrorCode_NullHeapPointer;
+	}
+	if (heap == heap_src) {
+		return kErrorCode_InvalidValue;
+	}
+	if ((u32)heap->length_ + heap_src->length_ > heap->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	heap->root_ = PAIRINGHEAP_link(heap->root_, heap_src->root_);
+	heap->length_ += heap_src->length_;
+	// the nodes of heap_src now live in the pool of the heap
+	if (NULL != heap_src->blocks_) {
+		PairingHeapBlock* last = heap_src->blocks_;
+		while (NULL != last->next_) {
+			last = last->next_;
+		}
+		last->next_ = heap->blocks_;
+		heap->blocks_ = heap_src->blocks_;
+	}
+	if (NULL != heap_src->free_) {
+		heap_src->free_last_->sibling_ = heap->free_;
+		if (NULL == heap->free_) {
+			heap->free_last_ = heap_src->free_last_;
+		}
+		heap->free_ = heap_src->free_;
+	}
+	heap_src->root_ = NULL;
+	heap_src->blocks_ = NULL;
+	heap_src->free_ = NULL;
+	heap_src->free_last_ = NULL;
+	heap_src->length_ = 0;
+	return kErrorCode_Ok;
+}
+
+void* PAIRINGHEAP_pop(PairingHeap* heap) {
+	if (NULL == heap || NULL == heap->root_) {
+		return NULL;
+	}
+	PairingHeapNode* root = heap->root_;
+	void* data = root->data_;
+	heap->root_ = PAIRINGHEAP_mergePairs(root->child_);
+	PAIRINGHEAP_release(heap, root);
+	heap->length_--;
+	return data;
+}
+
+void* PAIRINGHEAP_erase(PairingHeap* heap, PairingHeapNode* handle) {
+	if (NULL == heap || NULL == handle || NULL == handle->data_) {
+		return NULL;
+	}
+	if (handle == heap->root_) {
+		return PAIRINGHEAP_pop(heap);
+	}
+	void* data = handle->data_;
+	PAIRINGHEAP_cut(handle);
+	heap->root_ = PAIRINGHEAP_link(heap->root_, PAIRINGHEAP_mergePairs(handle->child_));
+	PAIRINGHEAP_release(heap, handle);
+	heap->length_--;
+	return data;
+}
+
+s16 PAIRINGHEAP_traverse(PairingHeap* heap, void(*callback)(MemoryNode*)) {
+	if (NULL == heap) {
+		return kErrorCode_NullHeapPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+	for (PairingHeapBlock* block = heap->blocks_; NULL != block; block = block->next_) {
+		for (u16 i = 0; i < kPairingHeapBlockLength; ++i) {
+			PairingHeapNode* element = &block->nodes_[i];
+			if (NULL == element->data_) {
+				continue;
+			}
+			node.data_ = element->data_;
+			node.size_ = element->size_;
+			callback(&node);
+			element->data_ = node.data_;
+			element->size_ = node.size_;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+void PAIRINGHEAP_print(PairingHeap* heap) {
+	printf("	[PairingHeap Info] Address: ");
+	if (NULL == heap) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", heap);
+	printf("	[PairingHeap Info] Length: %d\n", heap->length_);
+	printf("	[PairingHeap Info] Capacity: %d\n", heap->capacity_);
+	printf("	[PairingHeap Info] Top key: %d\n", PAIRINGHEAP_topKey(heap));
+
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+	u16 i = 0;
+	for (PairingHeapBlock* block = heap->blocks_; NULL != block; block = block->next_) {
+		for (u16 n = 0; n < kPairingHeapBlockLength; ++n) {
+			PairingHeapNode* element = &block->nodes_[n];
+			if (NULL == element->data_) {
+				continue;
+			}
+			printf("		[PairingHeap Info] Storage #%d Key: %d (node %p)\n", i++, element->key_, element);
+			node.data_ = element->data_;
+			node.size_ = element->size_;
+			node.ops_->print(&node);
+		}
+	}
+	printf("\n");
+}
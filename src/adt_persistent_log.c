@@ -0,0 +1,493 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "common_def.h"
+#include "adt_persistent_log.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//PersistentLog Declarations
+static s16 PERSISTENT_LOG_destroy(PersistentLog* log);
+static s16 PERSISTENT_LOG_reset(PersistentLog* log);
+static u16 PERSISTENT_LOG_capacity(PersistentLog* log);
+static u16 PERSISTENT_LOG_length(PersistentLog* log);
+static bool PERSISTENT_LOG_isEmpty(PersistentLog* log);
+static bool PERSISTENT_LOG_isFull(PersistentLog* log);
+static void* PERSISTENT_LOG_first(PersistentLog* log);
+static void* PERSISTENT_LOG_last(PersistentLog* log);
+static void* PERSISTENT_LOG_at(PersistentLog* log, u16 position);
+static s16 PERSISTENT_LOG_insertLast(PersistentLog* log, void* data, u16 bytes);
+static void* PERSISTENT_LOG_extractFirst(PersistentLog* log);
+static s16 PERSISTENT_LOG_traverse(PersistentLog* log, void(*callback)(MemoryNode*));
+static s16 PERSISTENT_LOG_traverseEx(PersistentLog* log, s16(*callback)(MemoryNode*, void*), void* ctx);
+static void PERSISTENT_LOG_print(PersistentLog* log);
+static s16 PERSISTENT_LOG_flush(PersistentLog* log);
+static u16 PERSISTENT_LOG_recordSize(PersistentLog* log);
+static s16 PERSISTENT_LOG_next(PersistentLog* log, u64* sequence, void* dst);
+
+struct persistent_log_ops_s persistent_log_ops = { .destroy = PERSISTENT_LOG_destroy,
+								  .reset = PERSISTENT_LOG_reset,
+								  .capacity = PERSISTENT_LOG_capacity,
+								  .length = PERSISTENT_LOG_length,
+								  .isEmpty = PERSISTENT_LOG_isEmpty,
+								  .isFull = PERSISTENT_LOG_isFull,
+								  .first = PERSISTENT_LOG_first,
+								  .last = PERSISTENT_LOG_last,
+								  .at = PERSISTENT_LOG_at,
+								  .insertLast = PERSISTENT_LOG_insertLast,
+								  .extractFirst = PERSISTENT_LOG_extractFirst,
+								  .traverse = PERSISTENT_LOG_traverse,
+								  .traverseEx = PERSISTENT_LOG_traverseEx,
+								  .print = PERSISTENT_LOG_print,
+								  .flush = PERSISTENT_LOG_flush,
+								  .recordSize = PERSISTENT_LOG_recordSize,
+								  .next = PERSISTENT_LOG_next
+};
+
+// Platform layer: maps the whole file, a new (empty) file is first grown to size
+// and created tells the caller its header still has to be written
+#ifdef _WIN32
+static s16 PERSISTENT_LOG_mapFile(PersistentLog* log, const char* path, u32 size, bool writable, bool* created) {
+	log->file_ = CreateFileA(path, writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+		FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, writable ? OPEN_ALWAYS : OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL, NULL);
+	if (INVALID_HANDLE_VALUE == log->file_) {
+		return kErrorCode_File;
+	}
+	// an existing file is always mapped whole, only new files take the requested size
+	DWORD file_size = GetFileSize(log->file_, NULL);
+	*created = 0 != size && 0 == file_size;
+	if (!*created) {
+		size = file_size;
+	}
+	if (size < kPersistentLogHeaderSize) {
+		CloseHandle(log->file_);
+		return kErrorCode_File;
+	}
+	log->mapping_ = CreateFileMappingA(log->file_, NULL, writable ? PAGE_READWRITE : PAGE_READONLY, 0, size, NULL);
+	if (NULL == log->mapping_) {
+		CloseHandle(log->file_);
+		return kErrorCode_File;
+	}
+	void* view = MapViewOfFile(log->mapping_, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+	if (NULL == view) {
+		CloseHandle(log->mapping_);
+		CloseHandle(log->file_);
+		return kErrorCode_File;
+	}
+	log->header_ = (PersistentLogHeader*)view;
+	log->mapping_size_ = size;
+	return kErrorCode_Ok;
+}
+
+static void PERSISTENT_LOG_unmapFile(PersistentLog* log) {
+	UnmapViewOfFile((void*)log->header_);
+	CloseHandle(log->mapping_);
+	CloseHandle(log->file_);
+}
+
+static s16 PERSISTENT_LOG_sync(PersistentLog* log) {
+	if (!FlushViewOfFile((void*)log->header_, log->mapping_size_) || !FlushFileBuffers(log->file_)) {
+		return kErrorCode_File;
+	}
+	return kErrorCode_Ok;
+}
+#else
+static s16 PERSISTENT_LOG_mapFile(PersistentLog* log, const char* path, u32 size, bool writable, bool* created) {
+	log->file_ = open(path, writable ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+	if (log->file_ < 0) {
+		return kErrorCode_File;
+	}
+	struct stat info;
+	if (0 != fstat(log->file_, &info)) {
+		close(log->file_);
+		return kErrorCode_File;
+	}
+	// an existing file is always mapped whole, only new files take the requested size
+	*created = 0 != size && 0 == info.st_size;
+	if (!*created) {
+		size = (u32)info.st_size;
+	}
+	else if (0 != ftruncate(log->file_, size)) {
+		close(log->file_);
+		return kErrorCode_File;
+	}
+	if (size < kPersistentLogHeaderSize) {
+		close(log->file_);
+		return kErrorCode_File;
+	}
+	void* view = mmap(NULL, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, log->file_, 0);
+	if (MAP_FAILED == view) {
+		close(log->file_);
+		return kErrorCode_File;
+	}
+	log->header_ = (PersistentLogHeader*)view;
+	log->mapping_size_ = size;
+	return kErrorCode_Ok;
+}
+
+static void PERSISTENT_LOG_unmapFile(PersistentLog* log) {
+	munmap((void*)log->header_, log->mapping_size_);
+	close(log->file_);
+}
+
+static s16 PERSISTENT_LOG_sync(PersistentLog* log) {
+	if (0 != msync((void*)log->header_, log->mapping_size_, MS_SYNC)) {
+		return kErrorCode_File;
+	}
+	return kErrorCode_Ok;
+}
+#endif
+
+// head_ and tail_ are shared with the readers of other processes. They are read
+// and written in one piece, also on 32-bit targets: a load orders the reads after
+// it, a store orders the writes before it. The loads never write, so they also
+// work on the read only mapping of a reader
+static u64 PERSISTENT_LOG_loadCursor(volatile u64* cursor) {
+#ifdef _WIN32
+	return (u64)ReadAcquire64((volatile LONG64*)cursor);
+#else
+	return atomic_load_explicit((_Atomic(u64)*)cursor, memory_order_acquire);
+#endif
+}
+
+static void PERSISTENT_LOG_storeCursor(volatile u64* cursor, u64 value) {
+#ifdef _WIN32
+	WriteRelease64((volatile LONG64*)cursor, (LONG64)value);
+#else
+	atomic_store_explicit((_Atomic(u64)*)cursor, value, memory_order_release);
+#endif
+}
+
+// Full barrier, no read or write crosses it
+static void PERSISTENT_LOG_fence() {
+#ifdef _WIN32
+	MemoryBarrier();
+#else
+	atomic_thread_fence(memory_order_seq_cst);
+#endif
+}
+
+// Record that holds the given sequence
+static u8* PERSISTENT_LOG_record(PersistentLog* log, u64 sequence) {
+	return log->records_ + (u32)(sequence % log->header_->capacity_) * log->header_->record_size_;
+}
+
+// Sequences of the oldest record and of the next one. head is read first, so
+// tail - head never goes negative, and a writer that moved on in between is
+// clamped back to a full log
+static void PERSISTENT_LOG_bounds(PersistentLog* log, u64* head, u64* tail) {
+	*head = PERSISTENT_LOG_loadCursor(&log->header_->head_);
+	*tail = PERSISTENT_LOG_loadCursor(&log->header_->tail_);
+	if (*tail - *head > log->header_->capacity_) {
+		*head = *tail - log->header_->capacity_;
+	}
+}
+
+static PersistentLog* PERSISTENT_LOG_map(const char* path, u16 record_size, u16 capacity, u16 flush_interval, bool writable) {
+	if (NULL == path) {
+		return NULL;
+	}
+	PersistentLog* new_log = (PersistentLog*)MM->malloc(sizeof(PersistentLog));
+	if (NULL == new_log) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	// readers take the geometry from the file itself
+	u32 size = writable ? kPersistentLogHeaderSize + (u32)record_size * capacity : 0;
+	bool created = false;
+	if (kErrorCode_Ok != PERSISTENT_LOG_mapFile(new_log, path, size, writable, &created)) {
+#ifdef VERBOSE_
+		printf("Error: [%s] cannot map the file %s\n", __FUNCTION__, path);
+#endif
+		MM->free(new_log);
+		return NULL;
+	}
+	volatile PersistentLogHeader* header = new_log->header_;
+	if (created) {
+		// only a file this open grew from empty gets a header, ftruncate/CreateFileMapping
+		// left it zero filled. Any other file is checked as it is and never written
+		header->record_size_ = record_size;
+		header->capacity_ = capacity;
+		PERSISTENT_LOG_storeCursor(&header->head_, 0);
+		PERSISTENT_LOG_storeCursor(&header->tail_, 0);
+		header->magic_ = kPersistentLogMagic;
+	}
+	bool valid = kPersistentLogMagic == header->magic_ && 0 != header->record_size_ && 0 != header->capacity_ &&
+		new_log->mapping_size_ >= kPersistentLogHeaderSize + (u32)header->record_size_ * header->capacity_;
+	if (writable) {
+		valid = valid && record_size == header->record_size_ && capacity == header->capacity_;
+	}
+	if (!valid) {
+#ifdef VERBOSE_
+		printf("Error: [%s] %s is not a log with this geometry\n", __FUNCTION__, path);
+#endif
+		PERSISTENT_LOG_unmapFile(new_log);
+		MM->free(new_log);
+		return NULL;
+	}
+	new_log->records_ = (u8*)header + kPersistentLogHeaderSize;
+	new_log->flush_interval_ = flush_interval;
+	new_log->pending_ = 0;
+	new_log->read_only_ = !writable;
+	new_log->ops_ = &persistent_log_ops;
+	return new_log;
+}
+
+PersistentLog* PERSISTENT_LOG_open(const char* path, u16 record_size, u16 capacity, u16 flush_interval) {
+	if (0 == record_size || 0 == capacity) {
+		return NULL;
+	}
+	return PERSISTENT_LOG_map(path, record_size, capacity, flush_interval, true);
+}
+
+PersistentLog* PERSISTENT_LOG_openReader(const char* path) {
+	return PERSISTENT_LOG_map(path, 0, 0, 0, false);
+}
+
+s16 PERSISTENT_LOG_destroy(PersistentLog* log) {
+	if (NULL == log) {
+		return kErrorCode_NullPointer;
+	}
+	s16 error_type = kErrorCode_Ok;
+	if (!log->read_only_) {
+		error_type = PERSISTENT_LOG_sync(log);
+	}
+	PERSISTENT_LOG_unmapFile(log);
+	MM->free(log);
+	return error_type;
+}
+
+s16 PERSISTENT_LOG_flush(PersistentLog* log) {
+	if (NULL == log) {
+		return kErrorCode_NullPointer;
+	}
+	if (log->read_only_) {
+		return kErrorCode_Ok;
+	}
+	log->pending_ = 0;
+	return PERSISTENT_LOG_sync(log);
+}
+
+s16 PERSISTENT_LOG_reset(PersistentLog* log) {
+	if (NULL == log) {
+		return kErrorCode_NullPointer;
+	}
+	if (log->read_only_) {
+		return kErrorCode_File;
+	}
+	PERSISTENT_LOG_storeCursor(&log->header_->head_, PERSISTENT_LOG_loadCursor(&log->header_->tail_));
+	return log->ops_->flush(log);
+}
+
+u16 PERSISTENT_LOG_capacity(PersistentLog* log) {
+	if (NULL == log) {
+		return 0;
+	}
+	return log->header_->capacity_;
+}
+
+u16 PERSISTENT_LOG_length(PersistentLog* log) {
+	if (NULL == log) {
+		return 0;
+	}
+	u64 head, tail;
+	PERSISTENT_LOG_bounds(log, &head, &tail);
+	return (u16)(tail - head);
+}
+
+u16 PERSISTENT_LOG_recordSize(PersistentLog* log) {
+	if (NULL == log) {
+		return 0;
+	}
+	return log->header_->record_size_;
+}
+
+bool PERSISTENT_LOG_isEmpty(PersistentLog* log) {
+	if (NULL == log) {
+		return false;
+	}
+	return 0 == log->ops_->length(log);
+}
+
+bool PERSISTENT_LOG_isFull(PersistentLog* log) {
+	if (NULL == log) {
+		return false;
+	}
+	return log->ops_->length(log) == log->header_->capacity_;
+}
+
+void* PERSISTENT_LOG_first(PersistentLog* log) {
+	return PERSISTENT_LOG_at(log, 0);
+}
+
+void* PERSISTENT_LOG_last(PersistentLog* log) {
+	if (NULL == log) {
+		return NULL;
+	}
+	if (log->ops_->isEmpty(log)) {
+		return NULL;
+	}
+	return PERSISTENT_LOG_at(log, log->ops_->length(log) - 1);
+}
+
+void* PERSISTENT_LOG_at(PersistentLog* log, u16 position) {
+	if (NULL == log) {
+		return NULL;
+	}
+	u64 head, tail;
+	PERSISTENT_LOG_bounds(log, &head, &tail);
+	if (position >= tail - head) {
+		return NULL;
+	}
+	return PERSISTENT_LOG_record(log, head + position);
+}
+
+s16 PERSISTENT_LOG_insertLast(PersistentLog* log, void* data, u16 bytes) {
+	if (NULL == log) {
+		return kErrorCode_NullPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (log->read_only_) {
+		return kErrorCode_File;
+	}
+	if (bytes > log->header_->record_size_) {
+		return kErrorCode_InvalidValue;
+	}
+	volatile PersistentLogHeader* header = log->header_;
+	u64 head, sequence;
+	PERSISTENT_LOG_bounds(log, &head, &sequence);
+	// the oldest record leaves the log before its slot is written: a reader that
+	// sees any byte of the new record also sees the new head and drops its copy
+	if (sequence - head == header->capacity_) {
+		PERSISTENT_LOG_storeCursor(&header->head_, head + 1);
+		PERSISTENT_LOG_fence();
+	}
+	u8* record = PERSISTENT_LOG_record(log, sequence);
+	memcpy(record, data, bytes);
+	memset(record + bytes, 0, header->record_size_ - bytes);
+	// publish the record only once it is complete
+	PERSISTENT_LOG_storeCursor(&header->tail_, sequence + 1);
+
+	if (0 != log->flush_interval_ && ++log->pending_ >= log->flush_interval_) {
+		return log->ops_->flush(log);
+	}
+	return kErrorCode_Ok;
+}
+
+void* PERSISTENT_LOG_extractFirst(PersistentLog* log) {
+	if (NULL == log) {
+		return NULL;
+	}
+	if (log->read_only_) {
+		return NULL;
+	}
+	u64 head, tail;
+	PERSISTENT_LOG_bounds(log, &head, &tail);
+	if (head == tail) {
+		return NULL;
+	}
+	// the slot is only written again by the next insertLast of this process
+	PERSISTENT_LOG_storeCursor(&log->header_->head_, head + 1);
+	return PERSISTENT_LOG_record(log, head);
+}
+
+s16 PERSISTENT_LOG_traverse(PersistentLog* log, void(*callback)(MemoryNode*)) {
+	if (NULL == log) {
+		return kErrorCode_NullPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+	node.size_ = log->header_->record_size_;
+	u64 head, tail;
+	PERSISTENT_LOG_bounds(log, &head, &tail);
+	for (u64 sequence = head; sequence < tail; ++sequence) {
+		node.data_ = PERSISTENT_LOG_record(log, sequence);
+		callback(&node);
+	}
+	return kErrorCode_Ok;
+}
+
+s16 PERSISTENT_LOG_traverseEx(PersistentLog* log, s16(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == log) {
+		return kErrorCode_NullPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode node;
+	MEMNODE_createLite(&node);
+	node.size_ = log->header_->record_size_;
+	u64 head, tail;
+	PERSISTENT_LOG_bounds(log, &head, &tail);
+	for (u64 sequence = head; sequence < tail; ++sequence) {
+		node.data_ = PERSISTENT_LOG_record(log, sequence);
+		if (kTraverse_Stop == callback(&node, ctx)) {
+			break;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 PERSISTENT_LOG_next(PersistentLog* log, u64* sequence, void* dst) {
+	if (NULL == log) {
+		return kErrorCode_NullPointer;
+	}
+	if (NULL == sequence || NULL == dst) {
+		return kErrorCode_NullPointer;
+	}
+	for (;;) {
+		u64 head, tail;
+		PERSISTENT_LOG_bounds(log, &head, &tail);
+		if (*sequence < head) {
+			*sequence = head;
+		}
+		if (*sequence >= tail) {
+			return kErrorCode_ExtractionFailed;
+		}
+		memcpy(dst, PERSISTENT_LOG_record(log, *sequence), log->header_->record_size_);
+		// the writer moves head past a slot before writing it again, so while head
+		// hasn't passed the sequence the copy is whole
+		PERSISTENT_LOG_fence();
+		if (PERSISTENT_LOG_loadCursor(&log->header_->head_) <= *sequence) {
+			(*sequence)++;
+			return kErrorCode_Ok;
+		}
+	}
+}
+
+void PERSISTENT_LOG_print(PersistentLog* log) {
+	printf("	[Log Info] Address: ");
+	if (NULL == log) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", log);
+	printf("	[Log Info] Mode: %s\n", log->read_only_ ? "reader" : "writer");
+	printf("	[Log Info] Head: %llu\n", (unsigned long long)PERSISTENT_LOG_loadCursor(&log->header_->head_));
+	printf("	[Log Info] Tail: %llu\n", (unsigned long long)PERSISTENT_LOG_loadCursor(&log->header_->tail_));
+	printf("	[Log Info] Length: %d\n", log->ops_->length(log));
+	printf("	[Log Info] Capacity: %d\n", log->header_->capacity_);
+	printf("	[Log Info] Record size: %d\n", log->header_->record_size_);
+	printf("	[Log Info] Flush interval: %d (pending %d)\n", log->flush_interval_, log->pending_);
+	printf("\n");
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "common_def.h"
 #include "adt_queue.h"
@@ -19,9 +20,32 @@ static void* QUEUE_front(Queue* queue);
 static void* QUEUE_back(Queue* queue);
 static s16 QUEUE_enqueue(Queue* queue, void* data, u16 bytes);
 static void* QUEUE_dequeue(Queue* queue, u16 position);
+static u16 QUEUE_enqueueMany(Queue* queue, void** data, u16* sizes, u16 count);
+static u16 QUEUE_dequeueMany(Queue* queue, void** out_ptrs, u16* out_sizes, u16 max);
 static s16 QUEUE_concat(Queue* queue, Queue* queue_src);
+static s16 QUEUE_traverseEx(Queue* queue, s16(*callback)(MemoryNode*, void*), void* ctx);
+static s16 QUEUE_traverseBatch(Queue* queue, s16(*callback)(MemoryNode**, u16, void*), void* ctx);
 static void QUEUE_print(Queue* queue);
 
+//Queue on a ring buffer Declarations
+static s16 QUEUE_RING_destroy(Queue* queue);
+static s16 QUEUE_RING_reset(Queue* queue);
+static s16 QUEUE_RING_resize(Queue* queue, u16 new_size);
+static u16 QUEUE_RING_capacity(Queue* queue);
+static u16 QUEUE_RING_length(Queue* queue);
+static bool QUEUE_RING_isEmpty(Queue* queue);
+static bool QUEUE_RING_isFull(Queue* queue);
+static void* QUEUE_RING_front(Queue* queue);
+static void* QUEUE_RING_back(Queue* queue);
+static s16 QUEUE_RING_enqueue(Queue* queue, void* data, u16 bytes);
+static void* QUEUE_RING_dequeue(Queue* queue, u16 position);
+static u16 QUEUE_RING_enqueueMany(Queue* queue, void** data, u16* sizes, u16 count);
+static u16 QUEUE_RING_dequeueMany(Queue* queue, void** out_ptrs, u16* out_sizes, u16 max);
+static s16 QUEUE_RING_concat(Queue* queue, Queue* queue_src);
+static s16 QUEUE_RING_traverseEx(Queue* queue, s16(*callback)(MemoryNode*, void*), void* ctx);
+static s16 QUEUE_RING_traverseBatch(Queue* queue, s16(*callback)(MemoryNode**, u16, void*), void* ctx);
+static void QUEUE_RING_print(Queue* queue);
+
 struct queue_ops_s queue_ops = { .destroy = QUEUE_destroy,
 								  .reset = QUEUE_reset,
 								  .resize = QUEUE_resize,
@@ -33,11 +57,81 @@ struct queue_ops_s queue_ops = { .destroy = QUEUE_destroy,
 								  .back = QUEUE_back,
 								  .enqueue = QUEUE_enqueue,
 								  .dequeue = QUEUE_dequeue,
+								  .enqueueMany = QUEUE_enqueueMany,
+								  .dequeueMany = QUEUE_dequeueMany,
 								  .concat = QUEUE_concat,
+								  .traverseEx = QUEUE_traverseEx,
+								  .traverseBatch = QUEUE_traverseBatch,
 								  .print = QUEUE_print
 };
 
+struct queue_ops_s queue_ring_ops = { .destroy = QUEUE_RING_destroy,
+								  .reset = QUEUE_RING_reset,
+								  .resize = QUEUE_RING_resize,
+								  .capacity = QUEUE_RING_capacity,
+								  .length = QUEUE_RING_length,
+								  .isEmpty = QUEUE_RING_isEmpty,
+								  .isFull = QUEUE_RING_isFull,
+								  .front = QUEUE_RING_front,
+								  .back = QUEUE_RING_back,
+								  .enqueue = QUEUE_RING_enqueue,
+								  .dequeue = QUEUE_RING_dequeue,
+								  .enqueueMany = QUEUE_RING_enqueueMany,
+								  .dequeueMany = QUEUE_RING_dequeueMany,
+								  .concat = QUEUE_RING_concat,
+								  .traverseEx = QUEUE_RING_traverseEx,
+								  .traverseBatch = QUEUE_RING_traverseBatch,
+								  .print = QUEUE_RING_print
+};
+
+// State of QUEUE_copyBack while a concat copies between different storages
+typedef struct {
+	Queue* queue;
+	s16 error_type;
+} QueueCopy;
+
+// Enqueues a copy of the node's data at the back of the queue in ctx
+static s16 QUEUE_copyBack(MemoryNode* node, void* ctx) {
+	QueueCopy* copy = (QueueCopy*)ctx;
+	u16 bytes = node->ops_->size(node);
+	void* data = MM->malloc(bytes);
+	if (NULL == data) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		copy->error_type = kErrorCode_NullMemoryAllocation;
+		return kTraverse_Stop;
+	}
+	memcpy(data, node->ops_->data(node), bytes);
+	copy->error_type = copy->queue->ops_->enqueue(copy->queue, data, bytes);
+	if (kErrorCode_Ok != copy->error_type) {
+		MM->free(data);
+		return kTraverse_Stop;
+	}
+	return kTraverse_Continue;
+}
+
+// Concat of two queues on different storages: grows the capacity like the storages'
+// own concat does and enqueues copies of the source elements one by one
+static s16 QUEUE_concatCopy(Queue* queue, Queue* queue_src) {
+	u16 new_capacity = queue->ops_->capacity(queue) + queue_src->ops_->capacity(queue_src);
+	s16 error_type = queue->ops_->resize(queue, new_capacity);
+	if (kErrorCode_Ok != error_type) {
+		return error_type;
+	}
+	if (queue_src->ops_->isEmpty(queue_src)) {
+		return kErrorCode_Ok;
+	}
+	QueueCopy copy = { .queue = queue, .error_type = kErrorCode_Ok };
+	queue_src->ops_->traverseEx(queue_src, QUEUE_copyBack, &copy);
+	return copy.error_type;
+}
+
 Queue* QUEUE_create(u16 capacity) {
+	return QUEUE_createWithStorage(capacity, kQueueStorage_List);
+}
+
+Queue* QUEUE_createWithStorage(u16 capacity, QueueStorage storage) {
 	if (capacity == 0) {
 		return NULL;
 	}
@@ -48,16 +142,24 @@ Queue* QUEUE_create(u16 capacity) {
 #endif
 		return NULL;
 	}
-	List* list = LIST_create(capacity);
-	if (NULL == list) {
+	new_queue->storage_ = NULL;
+	new_queue->ring_ = NULL;
+	new_queue->kind_ = storage;
+	if (kQueueStorage_Ring == storage) {
+		new_queue->ring_ = CIRCULAR_VECTOR_create(capacity);
+		new_queue->ops_ = &queue_ring_ops;
+	}
+	else {
+		new_queue->storage_ = LIST_create(capacity);
+		new_queue->ops_ = &queue_ops;
+	}
+	if (NULL == new_queue->storage_ && NULL == new_queue->ring_) {
 #ifdef VERBOSE_
 		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
-		MM->free(new_queue);
 #endif
+		MM->free(new_queue);
 		return NULL;
 	}
-	new_queue->storage_ = list;
-	new_queue->ops_ = &queue_ops;
 
 	return new_queue;
 }
@@ -194,6 +296,26 @@ void* QUEUE_dequeue(Queue* queue, u16 position) {
 	return queue->storage_->ops_->extractFirst(queue->storage_);
 }
 
+u16 QUEUE_enqueueMany(Queue* queue, void** data, u16* sizes, u16 count) {
+	if (NULL == queue) {
+		return 0;
+	}
+	if (NULL == queue->storage_) {
+		return 0;
+	}
+	return queue->storage_->ops_->insertLastMany(queue->storage_, data, sizes, count);
+}
+
+u16 QUEUE_dequeueMany(Queue* queue, void** out_ptrs, u16* out_sizes, u16 max) {
+	if (NULL == queue) {
+		return 0;
+	}
+	if (NULL == queue->storage_) {
+		return 0;
+	}
+	return queue->storage_->ops_->extractFirstMany(queue->storage_, out_ptrs, out_sizes, max);
+}
+
 s16 QUEUE_concat(Queue* queue, Queue* queue_src) {
 	if (NULL == queue) {
 		return kErrorCode_NullQueuePointer;
@@ -204,12 +326,41 @@ s16 QUEUE_concat(Queue* queue, Queue* queue_src) {
 	if (NULL == queue_src) {
 		return kErrorCode_NullQueuePointer;
 	}
+	if (kQueueStorage_List != queue_src->kind_) {
+		return QUEUE_concatCopy(queue, queue_src);
+	}
 	if (NULL == queue_src->storage_) {
 		return kErrorCode_NullListPointer;
 	}
 	return queue->storage_->ops_->concat(queue->storage_, queue_src->storage_);
 }
 
+s16 QUEUE_traverseEx(Queue* queue, s16(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == queue->storage_) {
+		return kErrorCode_NullListPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	return queue->storage_->ops_->traverseEx(queue->storage_, callback, ctx);
+}
+
+s16 QUEUE_traverseBatch(Queue* queue, s16(*callback)(MemoryNode**, u16, void*), void* ctx) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == queue->storage_) {
+		return kErrorCode_NullListPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	return queue->storage_->ops_->traverseBatch(queue->storage_, callback, ctx);
+}
+
 void QUEUE_print(Queue* queue) {
 	printf("	[Queue Info] Address: ");
 	if (NULL == queue) {
@@ -226,4 +377,256 @@ void QUEUE_print(Queue* queue) {
 	}
 	printf("%p\n", queue->storage_);
 	queue->storage_->ops_->print(queue->storage_);
-}
\ No newline at end of file
+}
+
+s16 QUEUE_RING_destroy(Queue* queue) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL != queue->ring_) {
+		queue->ring_->ops_->destroy(queue->ring_);
+	}
+	MM->free(queue);
+
+	return kErrorCode_Ok;
+}
+
+s16 QUEUE_RING_reset(Queue* queue) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == queue->ring_) {
+		return kErrorCode_NullVectorPointer;
+	}
+	queue->ring_->ops_->reset(queue->ring_);
+
+	return kErrorCode_Ok;
+}
+
+s16 QUEUE_RING_resize(Queue* queue, u16 new_size) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == queue->ring_) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (0 == new_size) {
+		return kErrorCode_InvalidValue;
+	}
+	if (queue->ops_->capacity(queue) == new_size) {
+		return kErrorCode_Ok;
+	}
+	return queue->ring_->ops_->resize(queue->ring_, new_size);
+}
+
+u16 QUEUE_RING_capacity(Queue* queue) {
+	if (NULL == queue) {
+		return 0;
+	}
+	if (NULL == queue->ring_) {
+		return 0;
+	}
+	return queue->ring_->ops_->capacity(queue->ring_);
+}
+
+u16 QUEUE_RING_length(Queue* queue) {
+	if (NULL == queue) {
+		return 0;
+	}
+	if (NULL == queue->ring_) {
+		return 0;
+	}
+	return queue->ring_->ops_->length(queue->ring_);
+}
+
+bool QUEUE_RING_isEmpty(Queue* queue) {
+	if (NULL == queue) {
+		return false;
+	}
+	if (NULL == queue->ring_) {
+		return false;
+	}
+	return queue->ring_->ops_->isEmpty(queue->ring_);
+}
+
+bool QUEUE_RING_isFull(Queue* queue) {
+	if (NULL == queue) {
+		return false;
+	}
+	if (NULL == queue->ring_) {
+		return false;
+	}
+	return queue->ring_->ops_->isFull(queue->ring_);
+}
+
+void* QUEUE_RING_front(Queue* queue) {
+	if (NULL == queue) {
+		return NULL;
+	}
+	if (NULL == queue->ring_) {
+		return NULL;
+	}
+	return queue->ring_->ops_->first(queue->ring_);
+}
+
+void* QUEUE_RING_back(Queue* queue) {
+	if (NULL == queue) {
+		return NULL;
+	}
+	if (NULL == queue->ring_) {
+		return NULL;
+	}
+	return queue->ring_->ops_->last(queue->ring_);
+}
+
+s16 QUEUE_RING_enqueue(Queue* queue, void* data, u16 bytes) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == queue->ring_) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	return queue->ring_->ops_->insertLast(queue->ring_, data, bytes);
+}
+
+void* QUEUE_RING_dequeue(Queue* queue, u16 position) {
+	if (NULL == queue) {
+		return NULL;
+	}
+	if (NULL == queue->ring_) {
+		return NULL;
+	}
+	return queue->ring_->ops_->extractFirst(queue->ring_);
+}
+
+u16 QUEUE_RING_enqueueMany(Queue* queue, void** data, u16* sizes, u16 count) {
+	if (NULL == queue) {
+		return 0;
+	}
+	if (NULL == queue->ring_) {
+		return 0;
+	}
+	if (NULL == data || NULL == sizes) {
+		return 0;
+	}
+	// the nodes are built on the stack a span at a time and pushMany copies
+	// every span into the ring in at most two segments
+	MemoryNode span[kTraverseBatchLength];
+	u16 inserted = 0;
+	while (inserted < count) {
+		u16 length = 0;
+		while (length < kTraverseBatchLength && inserted + length < count &&
+			NULL != data[inserted + length] && 0 != sizes[inserted + length]) {
+			MEMNODE_createLite(&span[length]);
+			span[length].ops_->setData(&span[length], data[inserted + length], sizes[inserted + length]);
+			length++;
+		}
+		if (0 == length) {
+			break;
+		}
+		u16 pushed = queue->ring_->ops_->pushMany(queue->ring_, span, length);
+		inserted += pushed;
+		if (pushed < length) {
+			break;
+		}
+	}
+	return inserted;
+}
+
+u16 QUEUE_RING_dequeueMany(Queue* queue, void** out_ptrs, u16* out_sizes, u16 max) {
+	if (NULL == queue) {
+		return 0;
+	}
+	if (NULL == queue->ring_) {
+		return 0;
+	}
+	if (NULL == out_ptrs) {
+		return 0;
+	}
+	// popMany copies a span out of the ring in at most two segments
+	MemoryNode span[kTraverseBatchLength];
+	u16 extracted = 0;
+	while (extracted < max) {
+		u16 wanted = max - extracted < kTraverseBatchLength ? max - extracted : kTraverseBatchLength;
+		u16 popped = queue->ring_->ops_->popMany(queue->ring_, span, wanted);
+		for (u16 i = 0; i < popped; ++i) {
+			out_ptrs[extracted + i] = span[i].data_;
+			if (NULL != out_sizes) {
+				out_sizes[extracted + i] = span[i].size_;
+			}
+		}
+		extracted += popped;
+		if (popped < wanted) {
+			break;
+		}
+	}
+	return extracted;
+}
+
+s16 QUEUE_RING_concat(Queue* queue, Queue* queue_src) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == queue->ring_) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == queue_src) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (kQueueStorage_Ring != queue_src->kind_) {
+		return QUEUE_concatCopy(queue, queue_src);
+	}
+	if (NULL == queue_src->ring_) {
+		return kErrorCode_NullVectorPointer;
+	}
+	return queue->ring_->ops_->concat(queue->ring_, queue_src->ring_);
+}
+
+s16 QUEUE_RING_traverseEx(Queue* queue, s16(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == queue->ring_) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	return queue->ring_->ops_->traverseEx(queue->ring_, callback, ctx);
+}
+
+s16 QUEUE_RING_traverseBatch(Queue* queue, s16(*callback)(MemoryNode**, u16, void*), void* ctx) {
+	if (NULL == queue) {
+		return kErrorCode_NullQueuePointer;
+	}
+	if (NULL == queue->ring_) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	return queue->ring_->ops_->traverseBatch(queue->ring_, callback, ctx);
+}
+
+void QUEUE_RING_print(Queue* queue) {
+	printf("	[Queue Info] Address: ");
+	if (NULL == queue) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", queue);
+
+	printf("	[Queue Info] Ring buffer address: ");
+	if (NULL == queue->ring_) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", queue->ring_);
+	queue->ring_->ops_->print(queue->ring_);
+}
@@ -0,0 +1,427 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "common_def.h"
+#include "adt_skip_list.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//SkipList Declarations
+static s16 SKIPLIST_destroy(SkipList* list);
+static s16 SKIPLIST_softReset(SkipList* list);
+static s16 SKIPLIST_reset(SkipList* list);
+static s16 SKIPLIST_resize(SkipList* list, u16 new_size);
+static u16 SKIPLIST_capacity(SkipList* list);
+static u16 SKIPLIST_length(SkipList* list);
+static bool SKIPLIST_isEmpty(SkipList* list);
+static bool SKIPLIST_isFull(SkipList* list);
+static void* SKIPLIST_first(SkipList* list);
+static void* SKIPLIST_last(SkipList* list);
+static void* SKIPLIST_at(SkipList* list, u16 position);
+static s16 SKIPLIST_insertFirst(SkipList* list, void* data, u16 bytes);
+static s16 SKIPLIST_insertLast(SkipList* list, void* data, u16 bytes);
+static s16 SKIPLIST_insertAt(SkipList* list, void* data, u16 bytes, u16 position);
+static void* SKIPLIST_extractFirst(SkipList* list);
+static void* SKIPLIST_extractLast(SkipList* list);
+static void* SKIPLIST_extractAt(SkipList* list, u16 position);
+static s16 SKIPLIST_concat(SkipList* list, SkipList* list_src);
+static s16 SKIPLIST_traverse(SkipList* list, void(*callback)(MemoryNode*));
+static void SKIPLIST_print(SkipList* list);
+
+struct skip_list_ops_s skip_list_ops = { .destroy = SKIPLIST_destroy,
+										  .softReset = SKIPLIST_softReset,
+										  .reset = SKIPLIST_reset,
+										  .resize = SKIPLIST_resize,
+										  .capacity = SKIPLIST_capacity,
+										  .length = SKIPLIST_length,
+										  .isEmpty = SKIPLIST_isEmpty,
+										  .isFull = SKIPLIST_isFull,
+										  .first = SKIPLIST_first,
+										  .last = SKIPLIST_last,
+										  .at = SKIPLIST_at,
+										  .insertFirst = SKIPLIST_insertFirst,
+										  .insertLast = SKIPLIST_insertLast,
+										  .insertAt = SKIPLIST_insertAt,
+										  .extractFirst = SKIPLIST_extractFirst,
+										  .extractLast = SKIPLIST_extractLast,
+										  .extractAt = SKIPLIST_extractAt,
+										  .concat = SKIPLIST_concat,
+										  .traverse = SKIPLIST_traverse,
+										  .print = SKIPLIST_print
+};
+
+// Level of a new node: each extra level has a 1/4 chance (xorshift32)
+static u8 SKIPLIST_randomLevel(SkipList* list) {
+	u32 x = list->seed_;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	list->seed_ = x;
+	u8 level = 1;
+	while (level < kSkipListMaxLevel && 0 == (x & 3)) {
+		x >>= 2;
+		level++;
+	}
+	return level;
+}
+
+// Allocates a node with the given number of levels and an empty payload
+static SkipListNode* SKIPLIST_newNode(u8 level) {
+	SkipListNode* node = (SkipListNode*)MM->malloc(sizeof(SkipListNode) + sizeof(SkipListLink) * level);
+	if (NULL == node) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	MEMNODE_createLite(&node->node_);
+	node->level_ = level;
+	for (u8 i = 0; i < level; ++i) {
+		node->links_[i].next_ = NULL;
+		node->links_[i].span_ = 1;
+	}
+	return node;
+}
+
+// Fills update with the last node of every level that sits before position,
+// and rank with the number of elements up to each of them.
+// A link to NULL spans up to length + 1, as if there was one more element
+static void SKIPLIST_findPrev(SkipList* list, u16 position, SkipListNode** update, u32* rank) {
+	SkipListNode* node = list->head_;
+	u32 traversed = 0;
+	for (s16 l = list->level_ - 1; l >= 0; --l) {
+		while (NULL != node->links_[l].next_ && traversed + node->links_[l].span_ <= position) {
+			traversed += node->links_[l].span_;
+			node = node->links_[l].next_;
+		}
+		update[l] = node;
+		rank[l] = traversed;
+	}
+}
+
+// Links an already filled node at the given position (<= length)
+static void SKIPLIST_link(SkipList* list, SkipListNode* new_node, u16 position) {
+	SkipListNode* update[kSkipListMaxLevel];
+	u32 rank[kSkipListMaxLevel];
+	SKIPLIST_findPrev(list, position, update, rank);
+	// new top levels start at the sentinel, spanning the whole list
+	for (u8 l = list->level_; l < new_node->level_; ++l) {
+		update[l] = list->head_;
+		rank[l] = 0;
+		list->head_->links_[l].next_ = NULL;
+		list->head_->links_[l].span_ = list->length_ + 1;
+	}
+	if (new_node->level_ > list->level_) {
+		list->level_ = new_node->level_;
+	}
+	for (u8 l = 0; l < new_node->level_; ++l) {
+		SkipListLink* link = &update[l]->links_[l];
+		new_node->links_[l].next_ = link->next_;
+		new_node->links_[l].span_ = link->span_ - (position - rank[l]);
+		link->next_ = new_node;
+		link->span_ = position - rank[l] + 1;
+	}
+	// links passing over the new node skip one more position
+	for (u8 l = new_node->level_; l < list->level_; ++l) {
+		update[l]->links_[l].span_++;
+	}
+	if (NULL == new_node->links_[0].next_) {
+		list->tail_ = new_node;
+	}
+	list->length_++;
+}
+
+// Frees every node, resetting their data when hard is true
+static void SKIPLIST_clear(SkipList* list, bool hard) {
+	SkipListNode* node = list->head_->links_[0].next_;
+	while (NULL != node) {
+		SkipListNode* next = node->links_[0].next_;
+		if (hard) {
+			node->node_.ops_->reset(&node->node_);
+		}
+		MM->free(node);
+		node = next;
+	}
+	for (u8 l = 0; l < kSkipListMaxLevel; ++l) {
+		list->head_->links_[l].next_ = NULL;
+		list->head_->links_[l].span_ = 1;
+	}
+	list->tail_ = NULL;
+	list->length_ = 0;
+	list->level_ = 1;
+}
+
+SkipList* SKIPLIST_create(u16 capacity) {
+	return SKIPLIST_createWithSeed(capacity, (u32)time(NULL));
+}
+
+SkipList* SKIPLIST_createWithSeed(u16 capacity, u32 seed) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	SkipList* list = (SkipList*)MM->malloc(sizeof(SkipList));
+	if (NULL == list) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	list->head_ = SKIPLIST_newNode(kSkipListMaxLevel);
+	if (NULL == list->head_) {
+		MM->free(list);
+		return NULL;
+	}
+	list->tail_ = NULL;
+	list->length_ = 0;
+	list->capacity_ = capacity;
+	list->level_ = 1;
+	// xorshift never leaves 0
+	list->seed_ = 0 == seed ? 0x9E3779B9 : seed;
+	list->ops_ = &skip_list_ops;
+	return list;
+}
+
+s16 SKIPLIST_destroy(SkipList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullSkipListPointer;
+	}
+	SKIPLIST_clear(list, true);
+	MM->free(list->head_);
+	MM->free(list);
+	return kErrorCode_Ok;
+}
+
+s16 SKIPLIST_softReset(SkipList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullSkipListPointer;
+	}
+	SKIPLIST_clear(list, false);
+	return kErrorCode_Ok;
+}
+
+s16 SKIPLIST_reset(SkipList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullSkipListPointer;
+	}
+	SKIPLIST_clear(list, true);
+	return kErrorCode_Ok;
+}
+
+s16 SKIPLIST_resize(SkipList* list, u16 new_size) {
+	if (NULL == list) {
+		return kErrorCode_NullSkipListPointer;
+	}
+	if (0 == new_size) {
+		return kErrorCode_InvalidValue;
+	}
+	while (list->length_ > new_size) {
+		MM->free(SKIPLIST_extractLast(list));
+	}
+	list->capacity_ = new_size;
+	return kErrorCode_Ok;
+}
+
+u16 SKIPLIST_capacity(SkipList* list) {
+	if (NULL == list) {
+		return 0;
+	}
+	return list->capacity_;
+}
+
+u16 SKIPLIST_length(SkipList* list) {
+	if (NULL == list) {
+		return 0;
+	}
+	return list->length_;
+}
+
+bool SKIPLIST_isEmpty(SkipList* list) {
+	if (NULL == list) {
+		return false;
+	}
+	return 0 == list->length_;
+}
+
+bool SKIPLIST_isFull(SkipList* list) {
+	if (NULL == list) {
+		return false;
+	}
+	return list->length_ >= list->capacity_;
+}
+
+void* SKIPLIST_first(SkipList* list) {
+	if (NULL == list) {
+		return NULL;
+	}
+	SkipListNode* node = list->head_->links_[0].next_;
+	if (NULL == node) {
+		return NULL;
+	}
+	return node->node_.ops_->data(&node->node_);
+}
+
+void* SKIPLIST_last(SkipList* list) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (NULL == list->tail_) {
+		return NULL;
+	}
+	return list->tail_->node_.ops_->data(&list->tail_->node_);
+}
+
+void* SKIPLIST_at(SkipList* list, u16 position) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (position >= list->length_) {
+		return NULL;
+	}
+	// the element at position is the one reached after position + 1 steps
+	SkipListNode* node = list->head_;
+	u32 traversed = 0;
+	for (s16 l = list->level_ - 1; l >= 0 && traversed <= position; --l) {
+		while (NULL != node->links_[l].next_ && traversed + node->links_[l].span_ <= (u32)position + 1) {
+			traversed += node->links_[l].span_;
+			node = node->links_[l].next_;
+		}
+	}
+	return node->node_.ops_->data(&node->node_);
+}
+
+s16 SKIPLIST_insertFirst(SkipList* list, void* data, u16 bytes) {
+	return SKIPLIST_insertAt(list, data, bytes, 0);
+}
+
+s16 SKIPLIST_insertLast(SkipList* list, void* data, u16 bytes) {
+	if (NULL == list) {
+		return kErrorCode_NullSkipListPointer;
+	}
+	return SKIPLIST_insertAt(list, data, bytes, list->length_);
+}
+
+s16 SKIPLIST_insertAt(SkipList* list, void* data, u16 bytes, u16 position) {
+	if (NULL == list) {
+		return kErrorCode_NullSkipListPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	if (list->length_ >= list->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	if (position > list->length_) {
+		position = list->length_;
+	}
+	SkipListNode* new_node = SKIPLIST_newNode(SKIPLIST_randomLevel(list));
+	if (NULL == new_node) {
+		return kErrorCode_NullMemoryAllocation;
+	}
+	new_node->node_.ops_->setData(&new_node->node_, data, bytes);
+	SKIPLIST_link(list, new_node, position);
+	return kErrorCode_Ok;
+}
+
+void* SKIPLIST_extractFirst(SkipList* list) {
+	return SKIPLIST_extractAt(list, 0);
+}
+
+void* SKIPLIST_extractLast(SkipList* list) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (0 == list->length_) {
+		return NULL;
+	}
+	return SKIPLIST_extractAt(list, list->length_ - 1);
+}
+
+void* SKIPLIST_extractAt(SkipList* list, u16 position) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (position >= list->length_) {
+		return NULL;
+	}
+	SkipListNode* update[kSkipListMaxLevel];
+	u32 rank[kSkipListMaxLevel];
+	SKIPLIST_findPrev(list, position, update, rank);
+	SkipListNode* node = update[0]->links_[0].next_;
+	for (u8 l = 0; l < list->level_; ++l) {
+		SkipListLink* link = &update[l]->links_[l];
+		if (link->next_ == node) {
+			link->span_ += node->links_[l].span_ - 1;
+			link->next_ = node->links_[l].next_;
+		}
+		else {
+			link->span_--;
+		}
+	}
+	while (list->level_ > 1 && NULL == list->head_->links_[list->level_ - 1].next_) {
+		list->level_--;
+	}
+	if (list->tail_ == node) {
+		list->tail_ = update[0] == list->head_ ? NULL : update[0];
+	}
+	list->length_--;
+	void* data = node->node_.ops_->data(&node->node_);
+	MM->free(node);
+	return data;
+}
+
+s16 SKIPLIST_concat(SkipList* list, SkipList* list_src) {
+	if (NULL == list || NULL == list_src) {
+		return kErrorCode_NullSkipListPointer;
+	}
+	list->capacity_ += list_src->capacity_;
+	for (SkipListNode* src = list_src->head_->links_[0].next_; NULL != src; src = src->links_[0].next_) {
+		SkipListNode* new_node = SKIPLIST_newNode(SKIPLIST_randomLevel(list));
+		if (NULL == new_node) {
+			return kErrorCode_NullMemoryAllocation;
+		}
+		s16 error_type = new_node->node_.ops_->memCopy(&new_node->node_, src->node_.data_, src->node_.size_);
+		if (kErrorCode_Ok != error_type) {
+			MM->free(new_node);
+			return error_type;
+		}
+		SKIPLIST_link(list, new_node, list->length_);
+	}
+	return kErrorCode_Ok;
+}
+
+s16 SKIPLIST_traverse(SkipList* list, void(*callback)(MemoryNode*)) {
+	if (NULL == list) {
+		return kErrorCode_NullSkipListPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	for (SkipListNode* node = list->head_->links_[0].next_; NULL != node; node = node->links_[0].next_) {
+		callback(&node->node_);
+	}
+	return kErrorCode_Ok;
+}
+
+void SKIPLIST_print(SkipList* list) {
+	printf("	[SkipList Info] Address: ");
+	if (NULL == list) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", list);
+	printf("	[SkipList Info] Length: %d\n", list->length_);
+	printf("	[SkipList Info] Capacity: %d\n", list->capacity_);
+	printf("	[SkipList Info] Levels: %d\n", list->level_);
+
+	u16 i = 0;
+	for (SkipListNode* node = list->head_->links_[0].next_; NULL != node; node = node->links_[0].next_) {
+		printf("	[SkipList Info] Storage #%d (levels %d)\n", i++, node->level_);
+		node->node_.ops_->print(&node->node_);
+	}
+	printf("\n");
+}
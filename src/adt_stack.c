@@ -20,6 +20,8 @@ static void* STACK_top(Stack* stack);
 static s16 STACK_push(Stack* stack, void* data, u16 bytes);
 static void* STACK_pop(Stack* stack);
 static s16 STACK_concat(Stack* stack, Stack* stack_src);
+static s16 STACK_traverseEx(Stack* stack, s16(*callback)(MemoryNode*, void*), void* ctx);
+static s16 STACK_traverseBatch(Stack* stack, s16(*callback)(MemoryNode**, u16, void*), void* ctx);
 static void STACK_print(Stack* stack);
 
 struct stack_ops_s stack_ops = { .destroy = STACK_destroy,
@@ -34,6 +36,8 @@ struct stack_ops_s stack_ops = { .destroy = STACK_destroy,
 								  .push = STACK_push,
 								  .pop = STACK_pop,
 								  .concat = STACK_concat,
+								  .traverseEx = STACK_traverseEx,
+								  .traverseBatch = STACK_traverseBatch,
 								  .print = STACK_print
 
 };
@@ -162,7 +166,7 @@ void * STACK_top(Stack * stack) {
 	if (NULL == stack->storage_) {
 		return NULL;
 	}
-	return stack->storage_->ops_->last(stack->storage_);
+	return STACK_topFast(stack);
 }
 
 s16 STACK_push(Stack* stack, void* data, u16 bytes) {
@@ -172,7 +176,7 @@ s16 STACK_push(Stack* stack, void* data, u16 bytes) {
 	if (NULL == stack->storage_) {
 		return kErrorCode_NullVectorPointer;
 	}
-	if (stack->storage_->ops_->isFull(stack->storage_)) {
+	if (stack->storage_->tail_ >= stack->storage_->capacity_) {
 		return kErrorCode_InsertionFailed;
 	}
 	if (NULL == data) {
@@ -181,24 +185,18 @@ s16 STACK_push(Stack* stack, void* data, u16 bytes) {
 	if (0 == bytes) {
 		return kErrorCode_InvalidValue;
 	}
-	return stack->storage_->ops_->insertLast(stack->storage_, data, bytes);
+	return STACK_pushFast(stack, data, bytes);
 }
 
 void* STACK_pop(Stack* stack) {
 	if (stack == NULL) {
 		return NULL;
 	}
-	if (stack->ops_ == NULL) {
-		return NULL;
-	}
-	if (stack->ops_->isEmpty(stack)) {
-		return NULL;
-	}
 	if (stack->storage_ == NULL) {
 		return NULL;
 	}
 
-	return stack->storage_->ops_->extractLast(stack->storage_);
+	return STACK_popFast(stack);
 }
 
 s16 STACK_concat(Stack * stack, Stack * stack_src)
@@ -220,6 +218,32 @@ s16 STACK_concat(Stack * stack, Stack * stack_src)
 	return result;
 }
 
+s16 STACK_traverseEx(Stack* stack, s16(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == stack) {
+		return kErrorCode_NullStackPointer;
+	}
+	if (NULL == stack->storage_) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	return stack->storage_->ops_->traverseEx(stack->storage_, callback, ctx);
+}
+
+s16 STACK_traverseBatch(Stack* stack, s16(*callback)(MemoryNode**, u16, void*), void* ctx) {
+	if (NULL == stack) {
+		return kErrorCode_NullStackPointer;
+	}
+	if (NULL == stack->storage_) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	return stack->storage_->ops_->traverseBatch(stack->storage_, callback, ctx);
+}
+
 void STACK_print(Stack* stack) {
 	printf("	[Stack Info] Address: ");
 	if (NULL == stack) {
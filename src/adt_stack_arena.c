@@ -0,0 +1,223 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_stack_arena.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//StackArena Declarations
+static s16 STACKARENA_destroy(StackArena* arena);
+static s16 STACKARENA_reset(StackArena* arena);
+static s16 STACKARENA_trim(StackArena* arena);
+static u32 STACKARENA_used(StackArena* arena);
+static u32 STACKARENA_reserved(StackArena* arena);
+static void* STACKARENA_alloc(StackArena* arena, u16 bytes);
+static void* STACKARENA_copy(StackArena* arena, void* src, u16 bytes);
+static StackArenaMark STACKARENA_mark(StackArena* arena);
+static s16 STACKARENA_release(StackArena* arena, StackArenaMark mark);
+static void STACKARENA_print(StackArena* arena);
+
+struct stack_arena_ops_s stack_arena_ops = { .destroy = STACKARENA_destroy,
+											.reset = STACKARENA_reset,
+											.trim = STACKARENA_trim,
+											.used = STACKARENA_used,
+											.reserved = STACKARENA_reserved,
+											.alloc = STACKARENA_alloc,
+											.copy = STACKARENA_copy,
+											.mark = STACKARENA_mark,
+											.release = STACKARENA_release,
+											.print = STACKARENA_print
+};
+
+// Allocates a block of size bytes that starts start bytes into the arena
+static StackArenaBlock* STACKARENA_createBlock(u32 size, u32 start) {
+	StackArenaBlock* block = (StackArenaBlock*)MM->malloc(sizeof(StackArenaBlock) + size);
+	if (NULL == block) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	block->next_ = NULL;
+	block->size_ = size;
+	block->start_ = start;
+	block->memory_ = (u8*)(block + 1);
+	return block;
+}
+
+// Frees block and every block after it
+static void STACKARENA_freeBlocks(StackArenaBlock* block) {
+	while (NULL != block) {
+		StackArenaBlock* next = block->next_;
+		MM->free(block);
+		block = next;
+	}
+}
+
+// Bytes to skip from offset of block so the next allocation is aligned
+static u32 STACKARENA_padding(StackArenaBlock* block, u32 offset) {
+	size_t address = (size_t)(block->memory_ + offset);
+	return (u32)((kStackArenaAlignment - (address & (kStackArenaAlignment - 1))) & (kStackArenaAlignment - 1));
+}
+
+StackArena* STACKARENA_create(u32 block_size) {
+	if (0 == block_size) {
+		return NULL;
+	}
+	StackArena* arena = (StackArena*)MM->malloc(sizeof(StackArena));
+	if (NULL == arena) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	arena->first_ = STACKARENA_createBlock(block_size, 0);
+	if (NULL == arena->first_) {
+		MM->free(arena);
+		return NULL;
+	}
+	arena->current_ = arena->first_;
+	arena->offset_ = 0;
+	arena->block_size_ = block_size;
+	arena->ops_ = &stack_arena_ops;
+	return arena;
+}
+
+s16 STACKARENA_destroy(StackArena* arena) {
+	if (NULL == arena) {
+		return kErrorCode_NullArenaPointer;
+	}
+	STACKARENA_freeBlocks(arena->first_);
+	MM->free(arena);
+	return kErrorCode_Ok;
+}
+
+s16 STACKARENA_reset(StackArena* arena) {
+	if (NULL == arena) {
+		return kErrorCode_NullArenaPointer;
+	}
+	arena->current_ = arena->first_;
+	arena->offset_ = 0;
+	return kErrorCode_Ok;
+}
+
+s16 STACKARENA_trim(StackArena* arena) {
+	if (NULL == arena) {
+		return kErrorCode_NullArenaPointer;
+	}
+	STACKARENA_freeBlocks(arena->current_->next_);
+	arena->current_->next_ = NULL;
+	return kErrorCode_Ok;
+}
+
+u32 STACKARENA_used(StackArena* arena) {
+	if (NULL == arena) {
+		return 0;
+	}
+	return arena->current_->start_ + arena->offset_;
+}
+
+u32 STACKARENA_reserved(StackArena* arena) {
+	if (NULL == arena) {
+		return 0;
+	}
+	u32 reserved = 0;
+	for (StackArenaBlock* block = arena->first_; NULL != block; block = block->next_) {
+		reserved += block->size_;
+	}
+	return reserved;
+}
+
+void* STACKARENA_alloc(StackArena* arena, u16 bytes) {
+	if (NULL == arena || 0 == bytes) {
+		return NULL;
+	}
+	StackArenaBlock* block = arena->current_;
+	u32 padding = STACKARENA_padding(block, arena->offset_);
+	if (arena->offset_ + padding + bytes > block->size_) {
+		// the next block is used again when it is large enough, otherwise the empty
+		// blocks are replaced by one that is
+		u32 needed = bytes + kStackArenaAlignment - 1;
+		StackArenaBlock* next = block->next_;
+		if (NULL == next || next->size_ < needed) {
+			next = STACKARENA_createBlock(needed > arena->block_size_ ? needed : arena->block_size_,
+				block->start_ + block->size_);
+			if (NULL == next) {
+				return NULL;
+			}
+			STACKARENA_freeBlocks(block->next_);
+			block->next_ = next;
+		}
+		arena->current_ = next;
+		arena->offset_ = 0;
+		block = next;
+		padding = STACKARENA_padding(block, 0);
+	}
+	void* memory = block->memory_ + arena->offset_ + padding;
+	arena->offset_ += padding + bytes;
+	return memory;
+}
+
+void* STACKARENA_copy(StackArena* arena, void* src, u16 bytes) {
+	if (NULL == src) {
+		return NULL;
+	}
+	void* memory = STACKARENA_alloc(arena, bytes);
+	if (NULL != memory) {
+		memcpy(memory, src, bytes);
+	}
+	return memory;
+}
+
+StackArenaMark STACKARENA_mark(StackArena* arena) {
+	StackArenaMark mark;
+	mark.block_ = NULL;
+	mark.offset_ = 0;
+	if (NULL != arena) {
+		mark.block_ = arena->current_;
+		mark.offset_ = arena->offset_;
+	}
+	return mark;
+}
+
+s16 STACKARENA_release(StackArena* arena, StackArenaMark mark) {
+	if (NULL == arena) {
+		return kErrorCode_NullArenaPointer;
+	}
+	if (NULL == mark.block_) {
+		return kErrorCode_InvalidValue;
+	}
+	// the block of the mark has to be in use still, a trim may have freed it
+	StackArenaBlock* block = arena->first_;
+	while (mark.block_ != block && arena->current_ != block) {
+		block = block->next_;
+	}
+	if (mark.block_ != block || block->start_ + mark.offset_ > STACKARENA_used(arena)) {
+		return kErrorCode_InvalidValue;
+	}
+	arena->current_ = mark.block_;
+	arena->offset_ = mark.offset_;
+	return kErrorCode_Ok;
+}
+
+void STACKARENA_print(StackArena* arena) {
+	printf("	[StackArena Info] Address: ");
+	if (NULL == arena) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", arena);
+	printf("	[StackArena Info] Used: %u\n", STACKARENA_used(arena));
+	printf("	[StackArena Info] Reserved: %u\n", STACKARENA_reserved(arena));
+	printf("	[StackArena Info] Block size: %u\n", arena->block_size_);
+
+	u16 i = 0;
+	for (StackArenaBlock* block = arena->first_; NULL != block; block = block->next_) {
+		printf("		[StackArena Info] Block #%d Address: %p Start: %u Size: %u%s\n",
+			i++, block, block->start_, block->size_, block == arena->current_ ? " (top)" : "");
+	}
+	printf("\n");
+}
@@ -0,0 +1,481 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_atomic.h"
+#include "adt_task_scheduler.h"
+
+#ifndef _WIN32
+#include <sched.h>
+#endif
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//TaskScheduler Declarations
+static s16 TASKSCHEDULER_destroy(TaskScheduler* scheduler);
+static u16 TASKSCHEDULER_workers(TaskScheduler* scheduler);
+static s16 TASKSCHEDULER_spawn(TaskScheduler* scheduler, TaskGroup* group, void(*function)(void*), void* arg);
+static s16 TASKSCHEDULER_sync(TaskScheduler* scheduler, TaskGroup* group);
+static s16 TASKSCHEDULER_parallelFor(TaskScheduler* scheduler, u32 begin, u32 end, u32 grain, void(*body)(u32, u32, void*), void* ctx);
+static void TASKSCHEDULER_print(TaskScheduler* scheduler);
+
+struct task_scheduler_ops_s task_scheduler_ops = { .destroy = TASKSCHEDULER_destroy,
+													.workers = TASKSCHEDULER_workers,
+													.spawn = TASKSCHEDULER_spawn,
+													.sync = TASKSCHEDULER_sync,
+													.parallelFor = TASKSCHEDULER_parallelFor,
+													.print = TASKSCHEDULER_print
+};
+
+// Worker run by the calling thread, NULL if it is not a worker
+static ADT_THREAD_LOCAL SchedulerWorker* scheduler_thread_worker = NULL;
+
+// Lets another thread run while there's nothing to do
+static void TASKSCHEDULER_yield() {
+#ifdef _WIN32
+	SwitchToThread();
+#else
+	sched_yield();
+#endif
+}
+
+static void TASKSCHEDULER_lock(TaskScheduler* scheduler) {
+#ifdef _WIN32
+	AcquireSRWLockExclusive(&scheduler->lock_);
+#else
+	pthread_mutex_lock(&scheduler->lock_);
+#endif
+}
+
+static void TASKSCHEDULER_unlock(TaskScheduler* scheduler) {
+#ifdef _WIN32
+	ReleaseSRWLockExclusive(&scheduler->lock_);
+#else
+	pthread_mutex_unlock(&scheduler->lock_);
+#endif
+}
+
+// Wakes one sleeping worker up, or all of them
+static void TASKSCHEDULER_wake(TaskScheduler* scheduler, bool all) {
+	// the task was pushed before sleepers_ is read; a worker going to sleep
+	// counts itself before it looks for tasks one last time, so one of the two sees the other
+	ATOMIC_fence();
+	if (0 == ATOMIC_loadU32(&scheduler->sleepers_)) {
+		return;
+	}
+	TASKSCHEDULER_lock(scheduler);
+#ifdef _WIN32
+	if (all) {
+		WakeAllConditionVariable(&scheduler->wake_);
+	}
+	else {
+		WakeConditionVariable(&scheduler->wake_);
+	}
+#else
+	if (all) {
+		pthread_cond_broadcast(&scheduler->wake_);
+	}
+	else {
+		pthread_cond_signal(&scheduler->wake_);
+	}
+#endif
+	TASKSCHEDULER_unlock(scheduler);
+}
+
+// Worker of the calling thread if it belongs to the scheduler, NULL otherwise
+static SchedulerWorker* TASKSCHEDULER_current(TaskScheduler* scheduler) {
+	SchedulerWorker* worker = scheduler_thread_worker;
+	if (NULL == worker || worker->scheduler_ != scheduler) {
+		return NULL;
+	}
+	return worker;
+}
+
+// Takes a task from the cache of the worker, or from MM when it is empty
+static SchedulerTask* TASKSCHEDULER_takeTask(SchedulerWorker* worker) {
+	SchedulerTask* task = worker->cache_;
+	if (NULL == task) {
+		task = (SchedulerTask*)MM->malloc(sizeof(SchedulerTask));
+		if (NULL == task) {
+#ifdef VERBOSE_
+			printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		}
+		return task;
+	}
+	worker->cache_ = task->next_;
+	worker->cache_length_--;
+	return task;
+}
+
+// Keeps a finished task in the cache of the worker, or frees it once the cache is full
+static void TASKSCHEDULER_recycleTask(SchedulerWorker* worker, SchedulerTask* task) {
+	if (worker->cache_length_ >= kSchedulerTaskCacheLimit) {
+		MM->free(task);
+		return;
+	}
+	task->next_ = worker->cache_;
+	worker->cache_ = task;
+	worker->cache_length_++;
+}
+
+static void TASKSCHEDULER_run(SchedulerWorker* worker, SchedulerTask* task);
+
+// Queues a task in the deque of the worker, or runs it when the deque is full
+static void TASKSCHEDULER_queue(SchedulerWorker* worker, SchedulerTask* task) {
+	ATOMIC_addU32(&task->group_->pending_, 1);
+	if (kErrorCode_Ok != worker->deque_->ops_->push(worker->deque_, task)) {
+		TASKSCHEDULER_run(worker, task);
+		return;
+	}
+	TASKSCHEDULER_wake(worker->scheduler_, false);
+}
+
+// Calls body over [begin, end), handing the upper halves to the deque while the
+// range is longer than grain. If no task can be allocated the rest runs here
+static void TASKSCHEDULER_runRange(SchedulerWorker* worker, TaskGroup* group, void(*body)(u32, u32, void*), void* ctx, u32 begin, u32 end, u32 grain) {
+	while (end - begin > grain) {
+		SchedulerTask* task = TASKSCHEDULER_takeTask(worker);
+		if (NULL == task) {
+			break;
+		}
+		u32 middle = begin + (end - begin) / 2;
+		task->function_ = NULL;
+		task->arg_ = NULL;
+		task->body_ = body;
+		task->ctx_ = ctx;
+		task->begin_ = middle;
+		task->end_ = end;
+		task->grain_ = grain;
+		task->group_ = group;
+		TASKSCHEDULER_queue(worker, task);
+		end = middle;
+	}
+	body(begin, end, ctx);
+}
+
+// Runs a task and marks it finished in its group
+static void TASKSCHEDULER_run(SchedulerWorker* worker, SchedulerTask* task) {
+	TaskGroup* group = task->group_;
+	if (NULL != task->body_) {
+		TASKSCHEDULER_runRange(worker, group, task->body_, task->ctx_, task->begin_, task->end_, task->grain_);
+	}
+	else {
+		task->function_(task->arg_);
+	}
+	TASKSCHEDULER_recycleTask(worker, task);
+	ATOMIC_addU32(&group->pending_, -1);
+}
+
+// Next task for the worker: the newest of its own, or the oldest of a random victim
+static SchedulerTask* TASKSCHEDULER_find(SchedulerWorker* worker) {
+	SchedulerTask* task = (SchedulerTask*)worker->deque_->ops_->pop(worker->deque_);
+	if (NULL != task) {
+		return task;
+	}
+	TaskScheduler* scheduler = worker->scheduler_;
+	for (u16 tries = 1; tries < scheduler->workers_length_; ++tries) {
+		// xorshift, every worker has its own seed
+		worker->seed_ ^= worker->seed_ << 13;
+		worker->seed_ ^= worker->seed_ >> 17;
+		worker->seed_ ^= worker->seed_ << 5;
+		SchedulerWorker* victim = &scheduler->workers_[worker->seed_ % scheduler->workers_length_];
+		if (victim == worker) {
+			continue;
+		}
+		task = (SchedulerTask*)victim->deque_->ops_->steal(victim->deque_);
+		if (NULL != task) {
+			return task;
+		}
+	}
+	return NULL;
+}
+
+// Looks for a task in every deque, its own first and then the others in order.
+// A steal that loses the race for the top is tried again while the victim
+// still has tasks, so NULL means every deque was seen empty
+static SchedulerTask* TASKSCHEDULER_findAny(SchedulerWorker* worker) {
+	SchedulerTask* task = (SchedulerTask*)worker->deque_->ops_->pop(worker->deque_);
+	if (NULL != task) {
+		return task;
+	}
+	TaskScheduler* scheduler = worker->scheduler_;
+	for (u16 i = 0; i < scheduler->workers_length_; ++i) {
+		SchedulerWorker* victim = &scheduler->workers_[i];
+		if (victim == worker) {
+			continue;
+		}
+		while (!victim->deque_->ops_->isEmpty(victim->deque_)) {
+			task = (SchedulerTask*)victim->deque_->ops_->steal(victim->deque_);
+			if (NULL != task) {
+				return task;
+			}
+		}
+	}
+	return NULL;
+}
+
+// Puts an idle worker to sleep until a task is queued or the scheduler is
+// stopped. Returns a task found on the way, NULL after waking up
+static SchedulerTask* TASKSCHEDULER_sleep(SchedulerWorker* worker) {
+	TaskScheduler* scheduler = worker->scheduler_;
+	TASKSCHEDULER_lock(scheduler);
+	ATOMIC_addU32(&scheduler->sleepers_, 1);
+	ATOMIC_fence();
+	// a task queued before the worker counted itself didn't wake anybody up,
+	// so every deque is checked, not just a few random victims
+	SchedulerTask* task = TASKSCHEDULER_findAny(worker);
+	if (NULL == task && ATOMIC_loadU32(&scheduler->running_)) {
+#ifdef _WIN32
+		SleepConditionVariableSRW(&scheduler->wake_, &scheduler->lock_, INFINITE, 0);
+#else
+		pthread_cond_wait(&scheduler->wake_, &scheduler->lock_);
+#endif
+	}
+	ATOMIC_addU32(&scheduler->sleepers_, -1);
+	TASKSCHEDULER_unlock(scheduler);
+	return task;
+}
+
+// Loop of the threads of the workers but 0
+#ifdef _WIN32
+static DWORD WINAPI TASKSCHEDULER_threadMain(LPVOID param) {
+#else
+static void* TASKSCHEDULER_threadMain(void* param) {
+#endif
+	SchedulerWorker* worker = (SchedulerWorker*)param;
+	scheduler_thread_worker = worker;
+	u16 idle_rounds = 0;
+	while (ATOMIC_loadU32(&worker->scheduler_->running_)) {
+		SchedulerTask* task = TASKSCHEDULER_find(worker);
+		if (NULL == task && ++idle_rounds >= kSchedulerIdleRounds) {
+			task = TASKSCHEDULER_sleep(worker);
+			idle_rounds = 0;
+		}
+		if (NULL != task) {
+			TASKSCHEDULER_run(worker, task);
+			idle_rounds = 0;
+		}
+		else {
+			TASKSCHEDULER_yield();
+		}
+	}
+	scheduler_thread_worker = NULL;
+	return 0;
+}
+
+// Starts the thread of a worker, returns true when it did
+static bool TASKSCHEDULER_startThread(SchedulerWorker* worker) {
+#ifdef _WIN32
+	worker->thread_ = CreateThread(NULL, 0, TASKSCHEDULER_threadMain, worker, 0, NULL);
+	return NULL != worker->thread_;
+#else
+	return 0 == pthread_create(&worker->thread_, NULL, TASKSCHEDULER_threadMain, worker);
+#endif
+}
+
+// Waits for the thread of a worker to finish
+static void TASKSCHEDULER_joinThread(SchedulerWorker* worker) {
+#ifdef _WIN32
+	WaitForSingleObject(worker->thread_, INFINITE);
+	CloseHandle(worker->thread_);
+#else
+	pthread_join(worker->thread_, NULL);
+#endif
+}
+
+// Stops the threads of the first started workers and frees everything. No
+// thread may be running tasks of the scheduler anymore
+static void TASKSCHEDULER_release(TaskScheduler* scheduler, u16 started) {
+	ATOMIC_storeU32(&scheduler->running_, 0);
+	TASKSCHEDULER_wake(scheduler, true);
+	for (u16 i = 1; i < started; ++i) {
+		TASKSCHEDULER_joinThread(&scheduler->workers_[i]);
+	}
+	for (u16 i = 0; i < scheduler->workers_length_; ++i) {
+		SchedulerWorker* worker = &scheduler->workers_[i];
+		if (NULL == worker->deque_) {
+			continue;
+		}
+		SchedulerTask* task = NULL;
+		while (NULL != (task = (SchedulerTask*)worker->deque_->ops_->pop(worker->deque_))) {
+			MM->free(task);
+		}
+		while (NULL != worker->cache_) {
+			task = worker->cache_;
+			worker->cache_ = task->next_;
+			MM->free(task);
+		}
+		worker->deque_->ops_->destroy(worker->deque_);
+	}
+	if (scheduler_thread_worker == &scheduler->workers_[0]) {
+		scheduler_thread_worker = NULL;
+	}
+#ifndef _WIN32
+	pthread_cond_destroy(&scheduler->wake_);
+	pthread_mutex_destroy(&scheduler->lock_);
+#endif
+	MM->free(scheduler->workers_);
+	MM->free(scheduler);
+}
+
+TaskScheduler* TASKSCHEDULER_create(u16 workers) {
+	if (0 == workers || workers > kSchedulerMaxWorkers || NULL != scheduler_thread_worker) {
+		return NULL;
+	}
+	TaskScheduler* scheduler = (TaskScheduler*)MM->malloc(sizeof(TaskScheduler));
+	if (NULL == scheduler) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	scheduler->workers_ = (SchedulerWorker*)MM->malloc(sizeof(SchedulerWorker) * workers);
+	if (NULL == scheduler->workers_) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		MM->free(scheduler);
+		return NULL;
+	}
+	scheduler->workers_length_ = workers;
+	scheduler->running_ = 1;
+	scheduler->sleepers_ = 0;
+#ifdef _WIN32
+	InitializeSRWLock(&scheduler->lock_);
+	InitializeConditionVariable(&scheduler->wake_);
+#else
+	pthread_mutex_init(&scheduler->lock_, NULL);
+	pthread_cond_init(&scheduler->wake_, NULL);
+#endif
+	scheduler->ops_ = &task_scheduler_ops;
+	bool created = true;
+	for (u16 i = 0; i < workers; ++i) {
+		SchedulerWorker* worker = &scheduler->workers_[i];
+		worker->deque_ = WORKSTEALINGDEQUE_create(kSchedulerDequeCapacity);
+		worker->cache_ = NULL;
+		worker->cache_length_ = 0;
+		worker->index_ = i;
+		worker->seed_ = (u32)i * 2654435761u + 1;
+		worker->scheduler_ = scheduler;
+		created = created && NULL != worker->deque_;
+	}
+	if (!created) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		TASKSCHEDULER_release(scheduler, 0);
+		return NULL;
+	}
+	scheduler_thread_worker = &scheduler->workers_[0];
+	for (u16 i = 1; i < workers; ++i) {
+		if (!TASKSCHEDULER_startThread(&scheduler->workers_[i])) {
+#ifdef VERBOSE_
+			printf("Error: [%s] couldn't start the thread of worker %d\n", __FUNCTION__, i);
+#endif
+			TASKSCHEDULER_release(scheduler, i);
+			return NULL;
+		}
+	}
+	return scheduler;
+}
+
+s16 TASKSCHEDULER_destroy(TaskScheduler* scheduler) {
+	if (NULL == scheduler) {
+		return kErrorCode_NullSchedulerPointer;
+	}
+	TASKSCHEDULER_release(scheduler, scheduler->workers_length_);
+	return kErrorCode_Ok;
+}
+
+u16 TASKSCHEDULER_workers(TaskScheduler* scheduler) {
+	if (NULL == scheduler) {
+		return 0;
+	}
+	return scheduler->workers_length_;
+}
+
+s16 TASKSCHEDULER_spawn(TaskScheduler* scheduler, TaskGroup* group, void(*function)(void*), void* arg) {
+	if (NULL == scheduler) {
+		return kErrorCode_NullSchedulerPointer;
+	}
+	if (NULL == group || NULL == function) {
+		return kErrorCode_NullPointer;
+	}
+	SchedulerWorker* worker = TASKSCHEDULER_current(scheduler);
+	if (NULL == worker) {
+		return kErrorCode_InvalidValue;
+	}
+	SchedulerTask* task = TASKSCHEDULER_takeTask(worker);
+	if (NULL == task) {
+		return kErrorCode_NullMemoryAllocation;
+	}
+	task->function_ = function;
+	task->arg_ = arg;
+	task->body_ = NULL;
+	task->ctx_ = NULL;
+	task->group_ = group;
+	TASKSCHEDULER_queue(worker, task);
+	return kErrorCode_Ok;
+}
+
+s16 TASKSCHEDULER_sync(TaskScheduler* scheduler, TaskGroup* group) {
+	if (NULL == scheduler) {
+		return kErrorCode_NullSchedulerPointer;
+	}
+	if (NULL == group) {
+		return kErrorCode_NullPointer;
+	}
+	SchedulerWorker* worker = TASKSCHEDULER_current(scheduler);
+	if (NULL == worker) {
+		return kErrorCode_InvalidValue;
+	}
+	// the worker helps instead of blocking, which also runs the tasks of the group
+	while (0 != ATOMIC_loadU32(&group->pending_)) {
+		SchedulerTask* task = TASKSCHEDULER_find(worker);
+		if (NULL != task) {
+			TASKSCHEDULER_run(worker, task);
+		}
+		else {
+			TASKSCHEDULER_yield();
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 TASKSCHEDULER_parallelFor(TaskScheduler* scheduler, u32 begin, u32 end, u32 grain, void(*body)(u32, u32, void*), void* ctx) {
+	if (NULL == scheduler) {
+		return kErrorCode_NullSchedulerPointer;
+	}
+	if (NULL == body) {
+		return kErrorCode_NullPointer;
+	}
+	SchedulerWorker* worker = TASKSCHEDULER_current(scheduler);
+	if (NULL == worker) {
+		return kErrorCode_InvalidValue;
+	}
+	if (begin >= end) {
+		return kErrorCode_Ok;
+	}
+	TaskGroup group = { 0 };
+	TASKSCHEDULER_runRange(worker, &group, body, ctx, begin, end, 0 == grain ? 1 : grain);
+	return TASKSCHEDULER_sync(scheduler, &group);
+}
+
+void TASKSCHEDULER_print(TaskScheduler* scheduler) {
+	printf("	[TaskScheduler Info] Address: ");
+	if (NULL == scheduler) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", scheduler);
+	printf("	[TaskScheduler Info] Workers: %d\n", scheduler->workers_length_);
+	printf("	[TaskScheduler Info] Running: %u\n", scheduler->running_);
+	printf("	[TaskScheduler Info] Sleeping workers: %u\n", ATOMIC_loadU32(&scheduler->sleepers_));
+	// the workers keep running, only what can be read atomically is printed
+	for (u16 i = 0; i < scheduler->workers_length_; ++i) {
+		SchedulerWorker* worker = &scheduler->workers_[i];
+		printf("		[TaskScheduler Info] Worker #%d Waiting tasks: %d\n", i, worker->deque_->ops_->length(worker->deque_));
+	}
+	printf("\n");
+}
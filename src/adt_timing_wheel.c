@@ -0,0 +1,344 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_timing_wheel.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//TimingWheel Declarations
+static s16 TIMINGWHEEL_destroy(TimingWheel* wheel);
+static s16 TIMINGWHEEL_softReset(TimingWheel* wheel);
+static s16 TIMINGWHEEL_reset(TimingWheel* wheel);
+static u32 TIMINGWHEEL_capacity(TimingWheel* wheel);
+static u32 TIMINGWHEEL_length(TimingWheel* wheel);
+static bool TIMINGWHEEL_isEmpty(TimingWheel* wheel);
+static bool TIMINGWHEEL_isFull(TimingWheel* wheel);
+static u32 TIMINGWHEEL_now(TimingWheel* wheel);
+static s16 TIMINGWHEEL_schedule(TimingWheel* wheel, void* data, u16 bytes, u32 delay, TimingWheelTimer** handle);
+static void* TIMINGWHEEL_cancel(TimingWheel* wheel, TimingWheelTimer* handle);
+static u32 TIMINGWHEEL_advance(TimingWheel* wheel, u32 ticks, void(*callback)(MemoryNode*, void*), void* ctx);
+static void TIMINGWHEEL_print(TimingWheel* wheel);
+
+struct timing_wheel_ops_s timing_wheel_ops = { .destroy = TIMINGWHEEL_destroy,
+												.softReset = TIMINGWHEEL_softReset,
+												.reset = TIMINGWHEEL_reset,
+												.capacity = TIMINGWHEEL_capacity,
+												.length = TIMINGWHEEL_length,
+												.isEmpty = TIMINGWHEEL_isEmpty,
+												.isFull = TIMINGWHEEL_isFull,
+												.now = TIMINGWHEEL_now,
+												.schedule = TIMINGWHEEL_schedule,
+												.cancel = TIMINGWHEEL_cancel,
+												.advance = TIMINGWHEEL_advance,
+												.print = TIMINGWHEEL_print
+};
+
+// Farthest tick the wheel can tell apart, later timers wait at the top and are placed again
+#define kTimingWheelMaxDelay ((u32)((1ull << (kTimingWheelSlotBits * kTimingWheelLevels)) - 1))
+
+// Empties a bucket: its node points to itself
+static void TIMINGWHEEL_emptyBucket(MemoryNode* bucket) {
+	bucket->next_ = bucket;
+	bucket->prev_ = bucket;
+}
+
+// Links node at the end of bucket
+static void TIMINGWHEEL_link(MemoryNode* bucket, MemoryNode* node) {
+	node->next_ = bucket;
+	node->prev_ = bucket->prev_;
+	bucket->prev_->next_ = node;
+	bucket->prev_ = node;
+}
+
+// Takes node out of whatever bucket it is in
+static void TIMINGWHEEL_unlink(MemoryNode* node) {
+	node->prev_->next_ = node->next_;
+	node->next_->prev_ = node->prev_;
+	node->next_ = NULL;
+	node->prev_ = NULL;
+}
+
+// Moves every node of bucket to the empty bucket dst
+static void TIMINGWHEEL_moveBucket(MemoryNode* bucket, MemoryNode* dst) {
+	if (bucket->next_ == bucket) {
+		return;
+	}
+	dst->next_ = bucket->next_;
+	dst->prev_ = bucket->prev_;
+	dst->next_->prev_ = dst;
+	dst->prev_->next_ = dst;
+	TIMINGWHEEL_emptyBucket(bucket);
+}
+
+// Gives a timer back to the pool
+static void TIMINGWHEEL_release(TimingWheel* wheel, TimingWheelTimer* timer) {
+	timer->node_.data_ = NULL;
+	timer->node_.size_ = 0;
+	timer->node_.prev_ = NULL;
+	timer->node_.next_ = (MemoryNode*)wheel->free_;
+	wheel->free_ = timer;
+}
+
+// Takes a timer from the pool, allocating a new block when it is empty
+static TimingWheelTimer* TIMINGWHEEL_take(TimingWheel* wheel) {
+	if (NULL == wheel->free_) {
+		TimingWheelBlock* block = (TimingWheelBlock*)MM->malloc(sizeof(TimingWheelBlock));
+		if (NULL == block) {
+#ifdef VERBOSE_
+			printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+			return NULL;
+		}
+		block->next_ = wheel->blocks_;
+		wheel->blocks_ = block;
+		for (u16 i = kTimingWheelBlockLength; i > 0; --i) {
+			MEMNODE_createLite(&block->timers_[i - 1].node_);
+			TIMINGWHEEL_release(wheel, &block->timers_[i - 1]);
+		}
+	}
+	TimingWheelTimer* timer = wheel->free_;
+	wheel->free_ = (TimingWheelTimer*)timer->node_.next_;
+	timer->node_.next_ = NULL;
+	return timer;
+}
+
+// Puts a timer in the bucket of the lowest level that reaches its tick
+static void TIMINGWHEEL_place(TimingWheel* wheel, TimingWheelTimer* timer) {
+	u32 delay = timer->expires_ - wheel->now_;
+	u32 expires = timer->expires_;
+	if (delay > kTimingWheelMaxDelay) {
+		// too far, it waits as far as the wheel reaches and is placed again from there
+		expires = wheel->now_ + kTimingWheelMaxDelay;
+		delay = kTimingWheelMaxDelay;
+	}
+	u16 level = 0;
+	while (level < kTimingWheelLevels - 1 && (delay >> (kTimingWheelSlotBits * (level + 1))) != 0) {
+		++level;
+	}
+	u16 slot = (expires >> (kTimingWheelSlotBits * level)) & (kTimingWheelSlots - 1);
+	TIMINGWHEEL_link(&wheel->buckets_[level][slot], &timer->node_);
+}
+
+// Places again the timers of the due bucket of level, which belong to lower levels now
+static void TIMINGWHEEL_cascade(TimingWheel* wheel, u16 level) {
+	u16 slot = (wheel->now_ >> (kTimingWheelSlotBits * level)) & (kTimingWheelSlots - 1);
+	MemoryNode due;
+	TIMINGWHEEL_emptyBucket(&due);
+	TIMINGWHEEL_moveBucket(&wheel->buckets_[level][slot], &due);
+	while (due.next_ != &due) {
+		MemoryNode* node = due.next_;
+		TIMINGWHEEL_unlink(node);
+		TIMINGWHEEL_place(wheel, (TimingWheelTimer*)node);
+	}
+}
+
+TimingWheel* TIMINGWHEEL_create(u32 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	TimingWheel* wheel = (TimingWheel*)MM->malloc(sizeof(TimingWheel));
+	if (NULL == wheel) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	for (u16 level = 0; level < kTimingWheelLevels; ++level) {
+		for (u16 slot = 0; slot < kTimingWheelSlots; ++slot) {
+			MEMNODE_createLite(&wheel->buckets_[level][slot]);
+			TIMINGWHEEL_emptyBucket(&wheel->buckets_[level][slot]);
+		}
+	}
+	wheel->now_ = 0;
+	wheel->blocks_ = NULL;
+	wheel->free_ = NULL;
+	wheel->length_ = 0;
+	wheel->capacity_ = capacity;
+	wheel->ops_ = &timing_wheel_ops;
+	return wheel;
+}
+
+// Gives every pending timer back to the pool, freeing its data when hard is true
+static void TIMINGWHEEL_clear(TimingWheel* wheel, bool hard) {
+	for (u16 level = 0; level < kTimingWheelLevels; ++level) {
+		for (u16 slot = 0; slot < kTimingWheelSlots; ++slot) {
+			MemoryNode* bucket = &wheel->buckets_[level][slot];
+			while (bucket->next_ != bucket) {
+				MemoryNode* node = bucket->next_;
+				TIMINGWHEEL_unlink(node);
+				if (hard) {
+					MM->free(node->data_);
+				}
+				TIMINGWHEEL_release(wheel, (TimingWheelTimer*)node);
+			}
+		}
+	}
+	wheel->length_ = 0;
+}
+
+s16 TIMINGWHEEL_destroy(TimingWheel* wheel) {
+	if (NULL == wheel) {
+		return kErrorCode_NullTimingWheelPointer;
+	}
+	TIMINGWHEEL_clear(wheel, true);
+	TimingWheelBlock* block = wheel->blocks_;
+	while (NULL != block) {
+		TimingWheelBlock* next = block->next_;
+		MM->free(block);
+		block = next;
+	}
+	MM->free(wheel);
+	return kErrorCode_Ok;
+}
+
+s16 TIMINGWHEEL_softReset(TimingWheel* wheel) {
+	if (NULL == wheel) {
+		return kErrorCode_NullTimingWheelPointer;
+	}
+	TIMINGWHEEL_clear(wheel, false);
+	return kErrorCode_Ok;
+}
+
+s16 TIMINGWHEEL_reset(TimingWheel* wheel) {
+	if (NULL == wheel) {
+		return kErrorCode_NullTimingWheelPointer;
+	}
+	TIMINGWHEEL_clear(wheel, true);
+	return kErrorCode_Ok;
+}
+
+u32 TIMINGWHEEL_capacity(TimingWheel* wheel) {
+	if (NULL == wheel) {
+		return 0;
+	}
+	return wheel->capacity_;
+}
+
+u32 TIMINGWHEEL_length(TimingWheel* wheel) {
+	if (NULL == wheel) {
+		return 0;
+	}
+	return wheel->length_;
+}
+
+bool TIMINGWHEEL_isEmpty(TimingWheel* wheel) {
+	if (NULL == wheel) {
+		return false;
+	}
+	return 0 == wheel->length_;
+}
+
+bool TIMINGWHEEL_isFull(TimingWheel* wheel) {
+	if (NULL == wheel) {
+		return false;
+	}
+	return wheel->length_ >= wheel->capacity_;
+}
+
+u32 TIMINGWHEEL_now(TimingWheel* wheel) {
+	if (NULL == wheel) {
+		return 0;
+	}
+	return wheel->now_;
+}
+
+s16 TIMINGWHEEL_schedule(TimingWheel* wheel, void* data, u16 bytes, u32 delay, TimingWheelTimer** handle) {
+	if (NULL == wheel) {
+		return kErrorCode_NullTimingWheelPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	if (wheel->length_ >= wheel->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	TimingWheelTimer* timer = TIMINGWHEEL_take(wheel);
+	if (NULL == timer) {
+		return kErrorCode_NullMemoryAllocation;
+	}
+	timer->node_.data_ = data;
+	timer->node_.size_ = bytes;
+	timer->expires_ = wheel->now_ + (0 == delay ? 1 : delay);
+	TIMINGWHEEL_place(wheel, timer);
+	++wheel->length_;
+	if (NULL != handle) {
+		*handle = timer;
+	}
+	return kErrorCode_Ok;
+}
+
+void* TIMINGWHEEL_cancel(TimingWheel* wheel, TimingWheelTimer* handle) {
+	if (NULL == wheel || NULL == handle || NULL == handle->node_.data_) {
+		return NULL;
+	}
+	void* data = handle->node_.data_;
+	TIMINGWHEEL_unlink(&handle->node_);
+	TIMINGWHEEL_release(wheel, handle);
+	--wheel->length_;
+	return data;
+}
+
+u32 TIMINGWHEEL_advance(TimingWheel* wheel, u32 ticks, void(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == wheel || NULL == callback) {
+		return 0;
+	}
+	u32 fired = 0;
+	MemoryNode due;
+	TIMINGWHEEL_emptyBucket(&due);
+	for (u32 tick = 0; tick < ticks; ++tick) {
+		++wheel->now_;
+		// a level turns once per turn of the one below, when that one is back at slot 0
+		for (u16 level = 1; level < kTimingWheelLevels; ++level) {
+			if ((wheel->now_ & ((1u << (kTimingWheelSlotBits * level)) - 1)) != 0) {
+				break;
+			}
+			TIMINGWHEEL_cascade(wheel, level);
+		}
+		// everything in the bucket of level 0 fires now. It is taken out first
+		// so the callback can schedule into it for the next turn
+		TIMINGWHEEL_moveBucket(&wheel->buckets_[0][wheel->now_ & (kTimingWheelSlots - 1)], &due);
+		while (due.next_ != &due) {
+			TimingWheelTimer* timer = (TimingWheelTimer*)due.next_;
+			MemoryNode node;
+			MEMNODE_createLite(&node);
+			node.data_ = timer->node_.data_;
+			node.size_ = timer->node_.size_;
+			TIMINGWHEEL_unlink(&timer->node_);
+			TIMINGWHEEL_release(wheel, timer);
+			--wheel->length_;
+			++fired;
+			callback(&node, ctx);
+		}
+	}
+	return fired;
+}
+
+void TIMINGWHEEL_print(TimingWheel* wheel) {
+	printf("	[TimingWheel Info] Address: ");
+	if (NULL == wheel) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", wheel);
+	printf("	[TimingWheel Info] Length: %u\n", wheel->length_);
+	printf("	[TimingWheel Info] Capacity: %u\n", wheel->capacity_);
+	printf("	[TimingWheel Info] Now: %u\n", wheel->now_);
+
+	u32 i = 0;
+	for (u16 level = 0; level < kTimingWheelLevels; ++level) {
+		for (u16 slot = 0; slot < kTimingWheelSlots; ++slot) {
+			MemoryNode* bucket = &wheel->buckets_[level][slot];
+			for (MemoryNode* node = bucket->next_; node != bucket; node = node->next_) {
+				printf("		[TimingWheel Info] Storage #%u Level: %d Slot: %d Expires: %u\n",
+					i++, level, slot, ((TimingWheelTimer*)node)->expires_);
+				node->ops_->print(node);
+			}
+		}
+	}
+	printf("\n");
+}
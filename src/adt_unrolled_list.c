@@ -0,0 +1,445 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_def.h"
+#include "adt_unrolled_list.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//UnrolledList Declarations
+static s16 UNROLLEDLIST_destroy(UnrolledList* list);
+static s16 UNROLLEDLIST_softReset(UnrolledList* list);
+static s16 UNROLLEDLIST_reset(UnrolledList* list);
+static s16 UNROLLEDLIST_resize(UnrolledList* list, u16 new_size);
+static u16 UNROLLEDLIST_capacity(UnrolledList* list);
+static u16 UNROLLEDLIST_length(UnrolledList* list);
+static bool UNROLLEDLIST_isEmpty(UnrolledList* list);
+static bool UNROLLEDLIST_isFull(UnrolledList* list);
+static void* UNROLLEDLIST_first(UnrolledList* list);
+static void* UNROLLEDLIST_last(UnrolledList* list);
+static void* UNROLLEDLIST_at(UnrolledList* list, u16 position);
+static s16 UNROLLEDLIST_insertFirst(UnrolledList* list, void* data, u16 bytes);
+static s16 UNROLLEDLIST_insertLast(UnrolledList* list, void* data, u16 bytes);
+static s16 UNROLLEDLIST_insertAt(UnrolledList* list, void* data, u16 bytes, u16 position);
+static void* UNROLLEDLIST_extractFirst(UnrolledList* list);
+static void* UNROLLEDLIST_extractLast(UnrolledList* list);
+static void* UNROLLEDLIST_extractAt(UnrolledList* list, u16 position);
+static s16 UNROLLEDLIST_concat(UnrolledList* list, UnrolledList* list_src);
+static s16 UNROLLEDLIST_traverse(UnrolledList* list, void(*callback)(MemoryNode*));
+static void UNROLLEDLIST_print(UnrolledList* list);
+
+struct unrolled_list_ops_s unrolled_list_ops = { .destroy = UNROLLEDLIST_destroy,
+												  .softReset = UNROLLEDLIST_softReset,
+												  .reset = UNROLLEDLIST_reset,
+												  .resize = UNROLLEDLIST_resize,
+												  .capacity = UNROLLEDLIST_capacity,
+												  .length = UNROLLEDLIST_length,
+												  .isEmpty = UNROLLEDLIST_isEmpty,
+												  .isFull = UNROLLEDLIST_isFull,
+												  .first = UNROLLEDLIST_first,
+												  .last = UNROLLEDLIST_last,
+												  .at = UNROLLEDLIST_at,
+												  .insertFirst = UNROLLEDLIST_insertFirst,
+												  .insertLast = UNROLLEDLIST_insertLast,
+												  .insertAt = UNROLLEDLIST_insertAt,
+												  .extractFirst = UNROLLEDLIST_extractFirst,
+												  .extractLast = UNROLLEDLIST_extractLast,
+												  .extractAt = UNROLLEDLIST_extractAt,
+												  .concat = UNROLLEDLIST_concat,
+												  .traverse = UNROLLEDLIST_traverse,
+												  .print = UNROLLEDLIST_print
+};
+
+// Allocates an empty chunk and links it after prev (before the head if prev is NULL)
+static UnrolledListChunk* UNROLLEDLIST_linkChunk(UnrolledList* list, UnrolledListChunk* prev) {
+	UnrolledListChunk* chunk = (UnrolledListChunk*)MM->malloc(sizeof(UnrolledListChunk) + sizeof(MemoryNode) * list->chunk_size_);
+	if (NULL == chunk) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	chunk->count_ = 0;
+	chunk->prev_ = prev;
+	chunk->next_ = NULL == prev ? list->head_ : prev->next_;
+	if (NULL == chunk->prev_) {
+		list->head_ = chunk;
+	}
+	else {
+		chunk->prev_->next_ = chunk;
+	}
+	if (NULL == chunk->next_) {
+		list->tail_ = chunk;
+	}
+	else {
+		chunk->next_->prev_ = chunk;
+	}
+	list->chunks_++;
+	return chunk;
+}
+
+// Unlinks and frees a chunk, its slots must be already empty or moved
+static void UNROLLEDLIST_unlinkChunk(UnrolledList* list, UnrolledListChunk* chunk) {
+	if (NULL == chunk->prev_) {
+		list->head_ = chunk->next_;
+	}
+	else {
+		chunk->prev_->next_ = chunk->next_;
+	}
+	if (NULL == chunk->next_) {
+		list->tail_ = chunk->prev_;
+	}
+	else {
+		chunk->next_->prev_ = chunk->prev_;
+	}
+	list->chunks_--;
+	MM->free(chunk);
+}
+
+// Chunk holding the element at position (< length), walking whole chunks
+// from the nearest end. offset receives the slot inside the chunk
+static UnrolledListChunk* UNROLLEDLIST_locate(UnrolledList* list, u16 position, u16* offset) {
+	UnrolledListChunk* chunk = NULL;
+	if (position < list->length_ / 2) {
+		chunk = list->head_;
+		while (position >= chunk->count_) {
+			position -= chunk->count_;
+			chunk = chunk->next_;
+		}
+		*offset = position;
+	}
+	else {
+		// elements from position to the end
+		u16 remaining = list->length_ - position;
+		chunk = list->tail_;
+		while (remaining > chunk->count_) {
+			remaining -= chunk->count_;
+			chunk = chunk->prev_;
+		}
+		*offset = chunk->count_ - remaining;
+	}
+	return chunk;
+}
+
+// Opens an empty slot at position (<= length) and returns it. A full chunk
+// is split in two halves, except at the ends where a new chunk is started
+static MemoryNode* UNROLLEDLIST_openSlot(UnrolledList* list, u16 position) {
+	UnrolledListChunk* chunk = NULL;
+	u16 offset = 0;
+	if (position == list->length_) {
+		chunk = list->tail_;
+		if (NULL == chunk || chunk->count_ == list->chunk_size_) {
+			chunk = UNROLLEDLIST_linkChunk(list, list->tail_);
+		}
+		if (NULL == chunk) {
+			return NULL;
+		}
+		offset = chunk->count_;
+	}
+	else if (0 == position && list->head_->count_ == list->chunk_size_) {
+		chunk = UNROLLEDLIST_linkChunk(list, NULL);
+		if (NULL == chunk) {
+			return NULL;
+		}
+	}
+	else {
+		chunk = UNROLLEDLIST_locate(list, position, &offset);
+		if (chunk->count_ == list->chunk_size_) {
+			UnrolledListChunk* new_chunk = UNROLLEDLIST_linkChunk(list, chunk);
+			if (NULL == new_chunk) {
+				return NULL;
+			}
+			u16 half = chunk->count_ / 2;
+			new_chunk->count_ = chunk->count_ - half;
+			memcpy(new_chunk->slots_, &chunk->slots_[half], sizeof(MemoryNode) * new_chunk->count_);
+			chunk->count_ = half;
+			if (offset > half) {
+				chunk = new_chunk;
+				offset -= half;
+			}
+		}
+	}
+	memmove(&chunk->slots_[offset + 1], &chunk->slots_[offset], sizeof(MemoryNode) * (chunk->count_ - offset));
+	chunk->count_++;
+	list->length_++;
+	MemoryNode* node = &chunk->slots_[offset];
+	MEMNODE_createLite(node);
+	return node;
+}
+
+// Frees every chunk, resetting the data of the elements when hard is true
+static void UNROLLEDLIST_clear(UnrolledList* list, bool hard) {
+	while (NULL != list->head_) {
+		if (hard) {
+			for (u16 i = 0; i < list->head_->count_; ++i) {
+				list->head_->slots_[i].ops_->reset(&list->head_->slots_[i]);
+			}
+		}
+		UNROLLEDLIST_unlinkChunk(list, list->head_);
+	}
+	list->length_ = 0;
+}
+
+UnrolledList* UNROLLEDLIST_create(u16 capacity) {
+	return UNROLLEDLIST_createWithChunkSize(capacity, kUnrolledListChunkSize);
+}
+
+UnrolledList* UNROLLEDLIST_createWithChunkSize(u16 capacity, u16 chunk_size) {
+	if (0 == capacity || chunk_size < 2) {
+		return NULL;
+	}
+	UnrolledList* list = (UnrolledList*)MM->malloc(sizeof(UnrolledList));
+	if (NULL == list) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	list->head_ = NULL;
+	list->tail_ = NULL;
+	list->length_ = 0;
+	list->capacity_ = capacity;
+	list->chunk_size_ = chunk_size;
+	list->chunks_ = 0;
+	list->ops_ = &unrolled_list_ops;
+	return list;
+}
+
+s16 UNROLLEDLIST_destroy(UnrolledList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullUnrolledListPointer;
+	}
+	UNROLLEDLIST_clear(list, true);
+	MM->free(list);
+	return kErrorCode_Ok;
+}
+
+s16 UNROLLEDLIST_softReset(UnrolledList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullUnrolledListPointer;
+	}
+	UNROLLEDLIST_clear(list, false);
+	return kErrorCode_Ok;
+}
+
+s16 UNROLLEDLIST_reset(UnrolledList* list) {
+	if (NULL == list) {
+		return kErrorCode_NullUnrolledListPointer;
+	}
+	UNROLLEDLIST_clear(list, true);
+	return kErrorCode_Ok;
+}
+
+s16 UNROLLEDLIST_resize(UnrolledList* list, u16 new_size) {
+	if (NULL == list) {
+		return kErrorCode_NullUnrolledListPointer;
+	}
+	if (0 == new_size) {
+		return kErrorCode_InvalidValue;
+	}
+	while (list->length_ > new_size) {
+		MM->free(UNROLLEDLIST_extractLast(list));
+	}
+	list->capacity_ = new_size;
+	return kErrorCode_Ok;
+}
+
+u16 UNROLLEDLIST_capacity(UnrolledList* list) {
+	if (NULL == list) {
+		return 0;
+	}
+	return list->capacity_;
+}
+
+u16 UNROLLEDLIST_length(UnrolledList* list) {
+	if (NULL == list) {
+		return 0;
+	}
+	return list->length_;
+}
+
+bool UNROLLEDLIST_isEmpty(UnrolledList* list) {
+	if (NULL == list) {
+		return false;
+	}
+	return 0 == list->length_;
+}
+
+bool UNROLLEDLIST_isFull(UnrolledList* list) {
+	if (NULL == list) {
+		return false;
+	}
+	return list->length_ >= list->capacity_;
+}
+
+void* UNROLLEDLIST_first(UnrolledList* list) {
+	if (NULL == list || NULL == list->head_) {
+		return NULL;
+	}
+	return list->head_->slots_[0].ops_->data(&list->head_->slots_[0]);
+}
+
+void* UNROLLEDLIST_last(UnrolledList* list) {
+	if (NULL == list || NULL == list->tail_) {
+		return NULL;
+	}
+	MemoryNode* node = &list->tail_->slots_[list->tail_->count_ - 1];
+	return node->ops_->data(node);
+}
+
+void* UNROLLEDLIST_at(UnrolledList* list, u16 position) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (position >= list->length_) {
+		return NULL;
+	}
+	u16 offset = 0;
+	UnrolledListChunk* chunk = UNROLLEDLIST_locate(list, position, &offset);
+	return chunk->slots_[offset].ops_->data(&chunk->slots_[offset]);
+}
+
+s16 UNROLLEDLIST_insertFirst(UnrolledList* list, void* data, u16 bytes) {
+	return UNROLLEDLIST_insertAt(list, data, bytes, 0);
+}
+
+s16 UNROLLEDLIST_insertLast(UnrolledList* list, void* data, u16 bytes) {
+	if (NULL == list) {
+		return kErrorCode_NullUnrolledListPointer;
+	}
+	return UNROLLEDLIST_insertAt(list, data, bytes, list->length_);
+}
+
+s16 UNROLLEDLIST_insertAt(UnrolledList* list, void* data, u16 bytes, u16 position) {
+	if (NULL == list) {
+		return kErrorCode_NullUnrolledListPointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	if (0 == bytes) {
+		return kErrorCode_InvalidValue;
+	}
+	if (list->length_ >= list->capacity_) {
+		return kErrorCode_InsertionFailed;
+	}
+	if (position > list->length_) {
+		position = list->length_;
+	}
+	MemoryNode* node = UNROLLEDLIST_openSlot(list, position);
+	if (NULL == node) {
+		return kErrorCode_NullMemoryAllocation;
+	}
+	return node->ops_->setData(node, data, bytes);
+}
+
+void* UNROLLEDLIST_extractFirst(UnrolledList* list) {
+	return UNROLLEDLIST_extractAt(list, 0);
+}
+
+void* UNROLLEDLIST_extractLast(UnrolledList* list) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (0 == list->length_) {
+		return NULL;
+	}
+	return UNROLLEDLIST_extractAt(list, list->length_ - 1);
+}
+
+void* UNROLLEDLIST_extractAt(UnrolledList* list, u16 position) {
+	if (NULL == list) {
+		return NULL;
+	}
+	if (position >= list->length_) {
+		return NULL;
+	}
+	u16 offset = 0;
+	UnrolledListChunk* chunk = UNROLLEDLIST_locate(list, position, &offset);
+	void* data = chunk->slots_[offset].ops_->data(&chunk->slots_[offset]);
+	chunk->count_--;
+	list->length_--;
+	memmove(&chunk->slots_[offset], &chunk->slots_[offset + 1], sizeof(MemoryNode) * (chunk->count_ - offset));
+	if (0 == chunk->count_) {
+		UNROLLEDLIST_unlinkChunk(list, chunk);
+		return data;
+	}
+	// a chunk under a quarter full joins a neighbour it fits in; waiting
+	// that long keeps an insert/extract pair from splitting and merging again
+	if (chunk->count_ >= list->chunk_size_ / 4) {
+		return data;
+	}
+	UnrolledListChunk* next = chunk->next_;
+	UnrolledListChunk* prev = chunk->prev_;
+	if (NULL != next && chunk->count_ + next->count_ <= list->chunk_size_) {
+		memcpy(&chunk->slots_[chunk->count_], next->slots_, sizeof(MemoryNode) * next->count_);
+		chunk->count_ += next->count_;
+		UNROLLEDLIST_unlinkChunk(list, next);
+	}
+	else if (NULL != prev && prev->count_ + chunk->count_ <= list->chunk_size_) {
+		memcpy(&prev->slots_[prev->count_], chunk->slots_, sizeof(MemoryNode) * chunk->count_);
+		prev->count_ += chunk->count_;
+		UNROLLEDLIST_unlinkChunk(list, chunk);
+	}
+	return data;
+}
+
+s16 UNROLLEDLIST_concat(UnrolledList* list, UnrolledList* list_src) {
+	if (NULL == list || NULL == list_src) {
+		return kErrorCode_NullUnrolledListPointer;
+	}
+	list->capacity_ += list_src->capacity_;
+	for (UnrolledListChunk* chunk = list_src->head_; NULL != chunk; chunk = chunk->next_) {
+		for (u16 i = 0; i < chunk->count_; ++i) {
+			MemoryNode* node = UNROLLEDLIST_openSlot(list, list->length_);
+			if (NULL == node) {
+				return kErrorCode_NullMemoryAllocation;
+			}
+			s16 error_type = node->ops_->memCopy(node, chunk->slots_[i].data_, chunk->slots_[i].size_);
+			if (kErrorCode_Ok != error_type) {
+				// leave no empty slot at the end
+				UNROLLEDLIST_extractLast(list);
+				return error_type;
+			}
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 UNROLLEDLIST_traverse(UnrolledList* list, void(*callback)(MemoryNode*)) {
+	if (NULL == list) {
+		return kErrorCode_NullUnrolledListPointer;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	for (UnrolledListChunk* chunk = list->head_; NULL != chunk; chunk = chunk->next_) {
+		for (u16 i = 0; i < chunk->count_; ++i) {
+			callback(&chunk->slots_[i]);
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+void UNROLLEDLIST_print(UnrolledList* list) {
+	printf("	[UnrolledList Info] Address: ");
+	if (NULL == list) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", list);
+	printf("	[UnrolledList Info] Length: %d\n", list->length_);
+	printf("	[UnrolledList Info] Capacity: %d\n", list->capacity_);
+	printf("	[UnrolledList Info] Chunks: %d of %d slots\n", list->chunks_, list->chunk_size_);
+
+	u16 position = 0;
+	for (UnrolledListChunk* chunk = list->head_; NULL != chunk; chunk = chunk->next_) {
+		for (u16 i = 0; i < chunk->count_; ++i) {
+			printf("	[UnrolledList Info] Storage #%d\n", position++);
+			chunk->slots_[i].ops_->print(&chunk->slots_[i]);
+		}
+	}
+	printf("\n");
+}
@@ -27,6 +27,8 @@ static void* VECTOR_extractLast(Vector* vector);
 static void* VECTOR_extractAt(Vector* vector, u16 position);  
 static s16 VECTOR_concat(Vector* vector, Vector* vector_src); 
 static s16 VECTOR_traverse(Vector* vector, void(*callback)(MemoryNode*)); 
+static s16 VECTOR_traverseEx(Vector* vector, s16(*callback)(MemoryNode*, void*), void* ctx);
+static s16 VECTOR_traverseBatch(Vector* vector, s16(*callback)(MemoryNode**, u16, void*), void* ctx);
 static void VECTOR_print(Vector* vector);
 
 struct vector_ops_s vector_ops = { .destroy = VECTOR_destroy,
@@ -48,6 +50,8 @@ struct vector_ops_s vector_ops = { .destroy = VECTOR_destroy,
 								  .extractAt = VECTOR_extractAt,
 								  .concat = VECTOR_concat,
 								  .traverse = VECTOR_traverse,
+								  .traverseEx = VECTOR_traverseEx,
+								  .traverseBatch = VECTOR_traverseBatch,
 								  .print = VECTOR_print
 
 };
@@ -450,6 +454,48 @@ s16 VECTOR_traverse(Vector* vector, void(*callback)(MemoryNode*)) {
 	return kErrorCode_Ok;
 }
 
+s16 VECTOR_traverseEx(Vector* vector, s16(*callback)(MemoryNode*, void*), void* ctx) {
+	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector->storage_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	for (u16 i = 0; i < vector->tail_; ++i) {
+		if (kTraverse_Stop == callback(&vector->storage_[i], ctx)) {
+			break;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
+s16 VECTOR_traverseBatch(Vector* vector, s16(*callback)(MemoryNode**, u16, void*), void* ctx) {
+	if (NULL == vector) {
+		return kErrorCode_NullVectorPointer;
+	}
+	if (NULL == vector->storage_) {
+		return kErrorCode_NullMemoryNode;
+	}
+	if (NULL == callback) {
+		return kErrorCode_NullPointer;
+	}
+	MemoryNode* batch[kTraverseBatchLength];
+	u16 count = 0;
+	for (u16 i = 0; i < vector->tail_; ++i) {
+		batch[count++] = &vector->storage_[i];
+		if (kTraverseBatchLength == count || i + 1 == vector->tail_) {
+			if (kTraverse_Stop == callback(batch, count, ctx)) {
+				break;
+			}
+			count = 0;
+		}
+	}
+	return kErrorCode_Ok;
+}
+
 void VECTOR_print(Vector* vector) {
 	printf("	[Vector Info] Address: ");
 	if (NULL == vector) {
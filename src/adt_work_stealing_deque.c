@@ -0,0 +1,187 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common_def.h"
+#include "adt_atomic.h"
+#include "adt_work_stealing_deque.h"
+
+
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+//WorkStealingDeque Declarations
+static s16 WORKSTEALINGDEQUE_destroy(WorkStealingDeque* deque);
+static u16 WORKSTEALINGDEQUE_capacity(WorkStealingDeque* deque);
+static u16 WORKSTEALINGDEQUE_length(WorkStealingDeque* deque);
+static bool WORKSTEALINGDEQUE_isEmpty(WorkStealingDeque* deque);
+static bool WORKSTEALINGDEQUE_isFull(WorkStealingDeque* deque);
+static s16 WORKSTEALINGDEQUE_push(WorkStealingDeque* deque, void* data);
+static void* WORKSTEALINGDEQUE_pop(WorkStealingDeque* deque);
+static void* WORKSTEALINGDEQUE_steal(WorkStealingDeque* deque);
+static void WORKSTEALINGDEQUE_print(WorkStealingDeque* deque);
+
+struct work_stealing_deque_ops_s work_stealing_deque_ops = { .destroy = WORKSTEALINGDEQUE_destroy,
+															.capacity = WORKSTEALINGDEQUE_capacity,
+															.length = WORKSTEALINGDEQUE_length,
+															.isEmpty = WORKSTEALINGDEQUE_isEmpty,
+															.isFull = WORKSTEALINGDEQUE_isFull,
+															.push = WORKSTEALINGDEQUE_push,
+															.pop = WORKSTEALINGDEQUE_pop,
+															.steal = WORKSTEALINGDEQUE_steal,
+															.print = WORKSTEALINGDEQUE_print
+};
+
+// Shared slot of an index, read and written atomically
+#define SLOT(deque, index) (&(deque)->slots_[(index) & (deque)->mask_])
+
+WorkStealingDeque* WORKSTEALINGDEQUE_create(u16 capacity) {
+	if (0 == capacity) {
+		return NULL;
+	}
+	// the slot of an index is found with a mask
+	u32 size = 1;
+	while (size < capacity && size < kWorkStealingDequeMaxCapacity) {
+		size <<= 1;
+	}
+	WorkStealingDeque* deque = (WorkStealingDeque*)MM->malloc(sizeof(WorkStealingDeque));
+	if (NULL == deque) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		return NULL;
+	}
+	deque->slots_ = (void* volatile*)MM->malloc(sizeof(void*) * size);
+	if (NULL == deque->slots_) {
+#ifdef VERBOSE_
+		printf("Error: [%s] not enough memory available\n", __FUNCTION__);
+#endif
+		MM->free(deque);
+		return NULL;
+	}
+	for (u32 i = 0; i < size; ++i) {
+		deque->slots_[i] = NULL;
+	}
+	deque->mask_ = size - 1;
+	deque->top_ = 0;
+	deque->bottom_ = 0;
+	deque->ops_ = &work_stealing_deque_ops;
+	return deque;
+}
+
+s16 WORKSTEALINGDEQUE_destroy(WorkStealingDeque* deque) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	MM->free((void*)deque->slots_);
+	MM->free(deque);
+	return kErrorCode_Ok;
+}
+
+u16 WORKSTEALINGDEQUE_capacity(WorkStealingDeque* deque) {
+	if (NULL == deque) {
+		return 0;
+	}
+	return (u16)(deque->mask_ + 1);
+}
+
+u16 WORKSTEALINGDEQUE_length(WorkStealingDeque* deque) {
+	if (NULL == deque) {
+		return 0;
+	}
+	// a pop in progress can leave bottom_ one behind top_
+	s32 length = (s32)(ATOMIC_loadU32(&deque->bottom_) - ATOMIC_loadU32(&deque->top_));
+	return length > 0 ? (u16)length : 0;
+}
+
+bool WORKSTEALINGDEQUE_isEmpty(WorkStealingDeque* deque) {
+	if (NULL == deque) {
+		return false;
+	}
+	return 0 == WORKSTEALINGDEQUE_length(deque);
+}
+
+bool WORKSTEALINGDEQUE_isFull(WorkStealingDeque* deque) {
+	if (NULL == deque) {
+		return false;
+	}
+	return WORKSTEALINGDEQUE_length(deque) > deque->mask_;
+}
+
+s16 WORKSTEALINGDEQUE_push(WorkStealingDeque* deque, void* data) {
+	if (NULL == deque) {
+		return kErrorCode_NullDequePointer;
+	}
+	if (NULL == data) {
+		return kErrorCode_NullPointer;
+	}
+	u32 bottom = deque->bottom_;
+	// top_ only grows, an old value can only make the deque look fuller
+	if (bottom - ATOMIC_loadU32(&deque->top_) > deque->mask_) {
+		return kErrorCode_InsertionFailed;
+	}
+	ATOMIC_storePtr(SLOT(deque, bottom), data);
+	// the element is written before the thieves can see it
+	ATOMIC_storeU32(&deque->bottom_, bottom + 1);
+	return kErrorCode_Ok;
+}
+
+void* WORKSTEALINGDEQUE_pop(WorkStealingDeque* deque) {
+	if (NULL == deque) {
+		return NULL;
+	}
+	u32 bottom = deque->bottom_ - 1;
+	// the bottom element is booked before top_ is read, so a thief that reads
+	// top_ afterwards sees one element less
+	ATOMIC_storeU32(&deque->bottom_, bottom);
+	u32 top = ATOMIC_loadU32(&deque->top_);
+	s32 length = (s32)(bottom - top);
+	if (length < 0) {
+		ATOMIC_storeU32(&deque->bottom_, top);
+		return NULL;
+	}
+	void* data = ATOMIC_loadPtr(SLOT(deque, bottom));
+	if (length > 0) {
+		return data;
+	}
+	// last element: the owner races the thieves for it on top_
+	if (!ATOMIC_casU32(&deque->top_, top, top + 1)) {
+		data = NULL;
+	}
+	ATOMIC_storeU32(&deque->bottom_, top + 1);
+	return data;
+}
+
+void* WORKSTEALINGDEQUE_steal(WorkStealingDeque* deque) {
+	if (NULL == deque) {
+		return NULL;
+	}
+	u32 top = ATOMIC_loadU32(&deque->top_);
+	u32 bottom = ATOMIC_loadU32(&deque->bottom_);
+	if ((s32)(bottom - top) <= 0) {
+		return NULL;
+	}
+	// the slot is read before the claim, once top_ moves the owner may reuse it
+	void* data = ATOMIC_loadPtr(SLOT(deque, top));
+	if (!ATOMIC_casU32(&deque->top_, top, top + 1)) {
+		return NULL;
+	}
+	return data;
+}
+
+void WORKSTEALINGDEQUE_print(WorkStealingDeque* deque) {
+	printf("	[WorkStealingDeque Info] Address: ");
+	if (NULL == deque) {
+		printf(" NULL\n");
+		return;
+	}
+	printf("%p\n", deque);
+	printf("	[WorkStealingDeque Info] Top: %u\n", deque->top_);
+	printf("	[WorkStealingDeque Info] Bottom: %u\n", deque->bottom_);
+	printf("	[WorkStealingDeque Info] Length: %d\n", WORKSTEALINGDEQUE_length(deque));
+	printf("	[WorkStealingDeque Info] Capacity: %u\n", deque->mask_ + 1);
+
+	u16 i = 0;
+	for (u32 index = deque->top_; index != deque->bottom_; ++index) {
+		printf("		[WorkStealingDeque Info] Storage #%d (slot %u): %p\n", i++, index & deque->mask_, deque->slots_[index & deque->mask_]);
+	}
+	printf("\n");
+}
@@ -8,6 +8,7 @@
 #include <windows.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include "ABGS_MemoryManager/abgs_memory_manager.h"
 #include "ABGS_MemoryManager/abgs_platform_types.h"
@@ -17,6 +18,18 @@
 #include "adt_queue.h"
 #include "adt_stack.h"
 #include "adt_dllist.h"
+#include "adt_skip_list.h"
+#include "adt_unrolled_list.h"
+#include "adt_hazard.h"
+#include "adt_lockfree_stack.h"
+#include "adt_lockfree_queue.h"
+#include "adt_heap.h"
+#include "adt_pairing_heap.h"
+#include "adt_task_scheduler.h"
+#include "adt_blocking_queue.h"
+#include "adt_elimination_stack.h"
+#include "adt_timing_wheel.h"
+#include "adt_stack_arena.h"
 
 const u32 repetitions = 10000;
 
@@ -31,6 +44,95 @@ List* list2;
 DList* dlist;
 Queue* queue;
 Stack* stack;
+SkipList* skip_list;
+UnrolledList* unrolled_list;
+
+// elements moved by every call of the batched queue benchmarks
+#define kQueueBatchLength 32
+
+// elements visited by the traverse benchmarks
+u32 visited_nodes = 0;
+
+void VisitNode(MemoryNode* node) {
+  visited_nodes++;
+}
+
+s16 VisitSpan(MemoryNode** nodes, u16 count, void* ctx) {
+  visited_nodes += count;
+  return kTraverse_Continue;
+}
+
+// bytes read from the data of the elements by the prefetch benchmarks
+u32 touched_bytes = 0;
+
+void TouchNode(MemoryNode* node) {
+  touched_bytes += ((u8*)node->data_)[0];
+}
+
+// blocks allocated between the elements of the prefetch benchmarks, so their
+// nodes and data end up scattered across the heap
+void* scattered_filler[10000];
+
+// priorities of the heap benchmarks, the data of every element points at its key
+s32 heap_keys[10000];
+
+s16 CompareKeys(MemoryNode* a, MemoryNode* b) {
+  s32 key_a = *(s32*)a->data_;
+  s32 key_b = *(s32*)b->data_;
+  return key_a < key_b ? -1 : (key_a > key_b ? 1 : 0);
+}
+
+// square grid of the pathfinding benchmarks, a quarter of the cells are walls
+#define kGridSide 100
+#define kGridCells (kGridSide * kGridSide)
+#define kPathfindingRuns 20
+
+u8 grid_walls[kGridCells];
+// data of the elements of the open sets: the index of every cell
+u16 grid_cells[kGridCells];
+s32 grid_cost[kGridCells];
+u8 grid_closed[kGridCells];
+PairingHeapNode* grid_handles[kGridCells];
+
+// threads of the multi-threaded benchmarks go 1, 2, 4... up to this
+#define kMaxBenchmarkThreads 8
+// threads of the contention benchmark go 1, 2, 4... up to this, as many as
+// the hazard pointers allow
+#define kMaxContentionThreads 64
+
+// values added up by the scheduler benchmarks
+#define kParallelValues 1000000
+u32 parallel_values[kParallelValues];
+volatile u32 parallel_sum = 0;
+
+// round trips between two threads through a pair of blocking queues
+#define kWakeupRoundTrips 10000
+BlockingQueue* ping_queue;
+BlockingQueue* pong_queue;
+
+// pending timers of the timing wheel benchmark go 1000, 10000... up to this
+#define kMaxPendingTimers 100000
+// ticks timed for every number of pending timers
+#define kWheelTicks 10000
+// timers are scheduled up to this many ticks ahead
+#define kTimerSpread (1 << 20)
+u32 timer_ticks[kMaxPendingTimers];
+u32 timers_fired = 0;
+
+// frames of the arena benchmark, every one inserts repetitions payloads into a List
+#define kArenaFrames 20
+// bytes of the blocks of the arena benchmark
+#define kArenaBlockSize (64 * 1024)
+
+LockFreeStack* lockfree_stack;
+LockFreeQueue* lockfree_queue;
+// Queue shared behind a lock, to compare with the lock-free one
+Queue* locked_queue;
+CRITICAL_SECTION locked_queue_lock;
+EliminationStack* elimination_stack;
+// Stack shared behind a lock, to compare with the elimination one
+Stack* locked_stack;
+CRITICAL_SECTION locked_stack_lock;
 
 void TESTBASE_generateDataForComparative() {
 
@@ -59,6 +161,8 @@ void TESTBASE_generateDataForComparative() {
   dlist = DLIST_create(repetitions);
   queue = QUEUE_create(repetitions);
   stack = STACK_create(repetitions);
+  skip_list = SKIPLIST_createWithSeed(repetitions, 1);
+  unrolled_list = UNROLLEDLIST_create(repetitions);
 }
 
 void TestVector() {
@@ -148,6 +252,31 @@ void TestVector() {
   printf("Average time: %f ms\n", average_time);
 
 
+  //  Vector Traverse  /////////////////////////////////////////////////////////////////////
+  visited_nodes = 0;
+  QueryPerformanceCounter(&time_start);
+  vector1->ops_->traverse(vector1, VisitNode);
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nVector Traverse\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  Vector Traverse Batch  /////////////////////////////////////////////////////////////////////
+  visited_nodes = 0;
+  QueryPerformanceCounter(&time_start);
+  vector1->ops_->traverseBatch(vector1, VisitSpan, NULL);
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nVector Traverse Batch\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+
   printf("\n Start extractFirst to Vector1 for %d elemenst.", repetitions);
   QueryPerformanceCounter(&time_start);
   for (u32 rep = 0; rep < repetitions; ++rep) {
@@ -303,6 +432,59 @@ void TestList() {
   average_time = elapsed_time / repetitions;
   printf("Average time: %f ms\n", average_time);
 
+  //  List Traverse  /////////////////////////////////////////////////////////////////////
+  visited_nodes = 0;
+  QueryPerformanceCounter(&time_start);
+  list->ops_->traverse(list, VisitNode);
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nList Traverse\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  List Traverse Batch  /////////////////////////////////////////////////////////////////////
+  visited_nodes = 0;
+  QueryPerformanceCounter(&time_start);
+  list->ops_->traverseBatch(list, VisitSpan, NULL);
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nList Traverse Batch\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  List At (sequential)  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    list->ops_->at(list, rep);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nList At (sequential)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  List Cursor (sequential)  /////////////////////////////////////////////////////////////////////
+  ListCursor cursor;
+  QueryPerformanceCounter(&time_start);
+  list->ops_->cursorBegin(list, &cursor);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    list->ops_->cursorGet(&cursor);
+    list->ops_->cursorNext(&cursor);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nList Cursor (sequential)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
 
   //  List Extract Last  /////////////////////////////////////////////////////////////////////
   QueryPerformanceCounter(&time_start);
@@ -423,6 +605,65 @@ void TestDList() {
   average_time = elapsed_time / repetitions;
   printf("Average time: %f ms\n", average_time);
 
+  //  DList At (sequential)  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    dlist->ops_->at(dlist, rep);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nDList At (sequential)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  DList At (random)  /////////////////////////////////////////////////////////////////////
+  srand(1);
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    dlist->ops_->at(dlist, rand() % repetitions);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nDList At (random)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  DList At (nearby)  /////////////////////////////////////////////////////////////////////
+  // random walk of +-8 positions around the previous access
+  u32 position = repetitions / 2;
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    position = (position + repetitions + (rand() % 17) - 8) % repetitions;
+    dlist->ops_->at(dlist, position);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nDList At (nearby)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  DList Cursor (sequential)  /////////////////////////////////////////////////////////////////////
+  DListCursor cursor;
+  QueryPerformanceCounter(&time_start);
+  dlist->ops_->cursorBegin(dlist, &cursor);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    dlist->ops_->cursorGet(&cursor);
+    dlist->ops_->cursorNext(&cursor);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nDList Cursor (sequential)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
 
   //  DList Extract Last  /////////////////////////////////////////////////////////////////////
   QueryPerformanceCounter(&time_start);
@@ -459,6 +700,147 @@ void TestDList() {
   printf("\n Destroy DList : Exited with error code %d", error_type);
 }
 
+void TestSkipList() {
+  LARGE_INTEGER frequency;				// ticks per second
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+  double average_time;
+
+
+  // Frequency: ticks per second
+  QueryPerformanceFrequency(&frequency);
+  printf("\n\n\n -----  Start SkipList Comparative  -----\n\n");
+  // same positions on every run
+  srand(1);
+
+  //  SkipList Insert At (random)  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    skip_list->ops_->insertAt(skip_list, data1[rep], 4, rand() % (rep + 1));
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nSkipList Insert At (random)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  SkipList At (random)  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    skip_list->ops_->at(skip_list, rand() % repetitions);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nSkipList At (random)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  SkipList Extract At (random)  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    skip_list->ops_->extractAt(skip_list, rand() % (repetitions - rep));
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nSkipList Extract At (random)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  // SkipList Destroy
+  s16 error_type;
+  error_type = skip_list->ops_->destroy(skip_list);
+  printf("\n Destroy SkipList : Exited with error code %d", error_type);
+}
+
+void TestUnrolledList() {
+  LARGE_INTEGER frequency;				// ticks per second
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+  double average_time;
+
+
+  // Frequency: ticks per second
+  QueryPerformanceFrequency(&frequency);
+  printf("\n\n\n -----  Start UnrolledList Comparative  -----\n\n");
+
+  //  UnrolledList Insert Last  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    unrolled_list->ops_->insertLast(unrolled_list, data1[rep], 4);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nUnrolledList Insert Last\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  UnrolledList Traverse  /////////////////////////////////////////////////////////////////////
+  visited_nodes = 0;
+  QueryPerformanceCounter(&time_start);
+  unrolled_list->ops_->traverse(unrolled_list, VisitNode);
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nUnrolledList Traverse\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  UnrolledList Extract At (middle)  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    unrolled_list->ops_->extractAt(unrolled_list, (repetitions - rep) / 2);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nUnrolledList Extract At (middle)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  UnrolledList Insert At (middle)  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    unrolled_list->ops_->insertAt(unrolled_list, data1[rep], 4, rep / 2);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nUnrolledList Insert At (middle)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  UnrolledList At (random)  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    unrolled_list->ops_->at(unrolled_list, rand() % repetitions);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nUnrolledList At (random)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  // UnrolledList Destroy
+  s16 error_type;
+  // data1 is freed by FreeData
+  unrolled_list->ops_->softReset(unrolled_list);
+  error_type = unrolled_list->ops_->destroy(unrolled_list);
+  printf("\n Destroy UnrolledList : Exited with error code %d", error_type);
+}
+
 void TestQueue() {
   LARGE_INTEGER frequency;				// ticks per second
   LARGE_INTEGER  time_start, time_end;    // ticks in interval
@@ -529,10 +911,77 @@ void TestQueue() {
   average_time = elapsed_time / repetitions;
   printf("Average time: %f ms\n", average_time);
 
+  //  Ring Queue Enqueue ///////////////////////////////////////////////////
+  Queue* ring_queue = QUEUE_createWithStorage(repetitions, kQueueStorage_Ring);
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    ring_queue->ops_->enqueue(ring_queue, data1[rep], 4);
+  }
+  QueryPerformanceCounter(&time_end);
+
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nRing Queue Enqueue\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  Ring Queue Dequeue /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    ring_queue->ops_->dequeue(ring_queue, 0);
+  }
+  QueryPerformanceCounter(&time_end);
+
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nRing Queue Dequeue\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  Queue Enqueue Many + Dequeue Many  /////////////////////////////////////////////////////////////////////
+  Queue* batch_queues[] = { queue, ring_queue };
+  const char* batch_names[] = { "Queue", "Ring Queue" };
+  void* batch_out[kQueueBatchLength];
+  u16 batch_sizes[kQueueBatchLength];
+  for (u16 i = 0; i < kQueueBatchLength; ++i) {
+    batch_sizes[i] = 4;
+  }
+  for (u16 i = 0; i < 2; ++i) {
+    QueryPerformanceCounter(&time_start);
+    for (u32 rep = 0; rep + kQueueBatchLength <= repetitions; rep += kQueueBatchLength) {
+      batch_queues[i]->ops_->enqueueMany(batch_queues[i], &data1[rep], batch_sizes, kQueueBatchLength);
+    }
+    QueryPerformanceCounter(&time_end);
+
+    elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+    printf("\n%s Enqueue Many (%d per call)\n", batch_names[i], kQueueBatchLength);
+    printf("Elapsed time: %f ms\n", elapsed_time);
+
+    average_time = elapsed_time / repetitions;
+    printf("Average time: %f ms\n", average_time);
+
+    QueryPerformanceCounter(&time_start);
+    for (u32 rep = 0; rep + kQueueBatchLength <= repetitions; rep += kQueueBatchLength) {
+      batch_queues[i]->ops_->dequeueMany(batch_queues[i], batch_out, batch_sizes, kQueueBatchLength);
+    }
+    QueryPerformanceCounter(&time_end);
+
+    elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+    printf("\n%s Dequeue Many (%d per call)\n", batch_names[i], kQueueBatchLength);
+    printf("Elapsed time: %f ms\n", elapsed_time);
+
+    average_time = elapsed_time / repetitions;
+    printf("Average time: %f ms\n", average_time);
+  }
+
   // Queue Destroy  /////////////////////////////////////////////
   s16 error_type;
   error_type = queue->ops_->destroy(queue);
   printf("\n Destroy Queue : Exited with error code %d", error_type);
+  error_type = ring_queue->ops_->destroy(ring_queue);
+  printf("\n Destroy Ring Queue : Exited with error code %d", error_type);
 }
 
 void TestStack() {
@@ -576,26 +1025,774 @@ void TestStack() {
   average_time = elapsed_time / repetitions;
   printf("Average time: %f ms\n", average_time);
 
-  //  Stack Top  /////////////////////////////////////////////////////////////////////
+  //  Stack Push Fast ///////////////////////////////////////////////////
   QueryPerformanceCounter(&time_start);
   for (u32 rep = 0; rep < repetitions; ++rep) {
-    stack->ops_->top(stack);
+    STACK_pushFast(stack, data1[rep], 4);
   }
-
   QueryPerformanceCounter(&time_end);
 
   elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
-  printf("\nStack Top\n");
+  printf("\nStack Push Fast\n");
   printf("Elapsed time: %f ms\n", elapsed_time);
 
   average_time = elapsed_time / repetitions;
   printf("Average time: %f ms\n", average_time);
 
+  //  Stack Pop Fast /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    STACK_popFast(stack);
+  }
+  QueryPerformanceCounter(&time_end);
+
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nStack Pop Fast\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
 
-  //  Stack Destroy  ////////////////////////////////////////////////
-  s16 error_type;
-  error_type = stack->ops_->destroy(stack);
-  printf("\n Destroy Stack : Exited with error code %d", error_type);
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  Stack Top  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    stack->ops_->top(stack);
+  }
+
+  QueryPerformanceCounter(&time_end);
+
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nStack Top\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+
+  //  Stack Destroy  ////////////////////////////////////////////////
+  s16 error_type;
+  error_type = stack->ops_->destroy(stack);
+  printf("\n Destroy Stack : Exited with error code %d", error_type);
+}
+
+// Times pushing every key and popping them all back from a heap
+void BenchmarkHeap(const char* name, Heap* heap, LARGE_INTEGER frequency) {
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    heap->ops_->push(heap, &heap_keys[rep], sizeof(s32), heap_keys[rep]);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\n%s Push (random keys)\n", name);
+  printf("Elapsed time: %f ms\n", elapsed_time);
+  printf("Average time: %f ms\n", elapsed_time / repetitions);
+
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    heap->ops_->pop(heap);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\n%s Pop\n", name);
+  printf("Elapsed time: %f ms\n", elapsed_time);
+  printf("Average time: %f ms\n", elapsed_time / repetitions);
+}
+
+void TestHeap() {
+  LARGE_INTEGER frequency;				// ticks per second
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+  double average_time;
+
+  // Frequency: ticks per second
+  QueryPerformanceFrequency(&frequency);
+  printf("\n\n\n -----  Start Heap Comparative  -----\n\n");
+  // same keys on every run
+  srand(1);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    heap_keys[rep] = rand();
+  }
+
+  Heap* binary_heap = HEAP_createWithKeys(repetitions, 2);
+  Heap* quaternary_heap = HEAP_createWithKeys(repetitions, 4);
+  Heap* compare_heap = HEAP_create(repetitions, 4, CompareKeys);
+  BenchmarkHeap("Heap (arity 2, keys)", binary_heap, frequency);
+  BenchmarkHeap("Heap (arity 4, keys)", quaternary_heap, frequency);
+  BenchmarkHeap("Heap (arity 4, comparator)", compare_heap, frequency);
+
+  //  Heap Heapify  /////////////////////////////////////////////////////////////////////
+  MemoryNode* nodes = MM->malloc(sizeof(MemoryNode) * repetitions);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    MEMNODE_createLite(&nodes[rep]);
+    nodes[rep].ops_->setData(&nodes[rep], &heap_keys[rep], sizeof(s32));
+  }
+  QueryPerformanceCounter(&time_start);
+  quaternary_heap->ops_->heapify(quaternary_heap, nodes, heap_keys, repetitions);
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nHeap (arity 4, keys) Heapify\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+  quaternary_heap->ops_->softReset(quaternary_heap);
+  MM->free(nodes);
+
+  //  Sorted List Insert (random keys)  /////////////////////////////////////////////////////////////////////
+  // the same work done by walking a List to keep it sorted
+  List* sorted_list = LIST_create(repetitions);
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    u16 position = 0;
+    for (MemoryNode* node = sorted_list->head_; NULL != node && *(s32*)node->data_ < heap_keys[rep]; node = node->next_) {
+      position++;
+    }
+    sorted_list->ops_->insertAt(sorted_list, &heap_keys[rep], sizeof(s32), position);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nSorted List Insert (random keys)\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  //  Sorted List Extract First  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    sorted_list->ops_->extractFirst(sorted_list);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nSorted List Extract First\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / repetitions;
+  printf("Average time: %f ms\n", average_time);
+
+  // Heap Destroy, the keys are not owned by the heaps
+  s16 error_type;
+  error_type = binary_heap->ops_->destroy(binary_heap);
+  printf("\n Destroy Heap (arity 2) : Exited with error code %d", error_type);
+  error_type = quaternary_heap->ops_->destroy(quaternary_heap);
+  printf("\n Destroy Heap (arity 4) : Exited with error code %d", error_type);
+  error_type = compare_heap->ops_->destroy(compare_heap);
+  printf("\n Destroy Heap (comparator) : Exited with error code %d", error_type);
+  error_type = sorted_list->ops_->destroy(sorted_list);
+  printf("\n Destroy Sorted List : Exited with error code %d", error_type);
+}
+
+// Manhattan distance between two cells, the heuristic of the searches
+s32 GridDistance(u16 a, u16 b) {
+  s32 dx = (s32)(a % kGridSide) - (s32)(b % kGridSide);
+  s32 dy = (s32)(a / kGridSide) - (s32)(b / kGridSide);
+  return (dx < 0 ? -dx : dx) + (dy < 0 ? -dy : dy);
+}
+
+// Writes the open cells next to cell, returns how many there are
+u16 GridNeighbours(u16 cell, u16* neighbours) {
+  u16 count = 0;
+  u16 x = cell % kGridSide;
+  u16 y = cell / kGridSide;
+  if (x > 0 && !grid_walls[cell - 1]) neighbours[count++] = cell - 1;
+  if (x < kGridSide - 1 && !grid_walls[cell + 1]) neighbours[count++] = cell + 1;
+  if (y > 0 && !grid_walls[cell - kGridSide]) neighbours[count++] = cell - kGridSide;
+  if (y < kGridSide - 1 && !grid_walls[cell + kGridSide]) neighbours[count++] = cell + kGridSide;
+  return count;
+}
+
+void GridClear() {
+  for (u32 i = 0; i < kGridCells; ++i) {
+    grid_cost[i] = 0x7FFFFFFF;
+    grid_closed[i] = 0;
+    grid_handles[i] = NULL;
+  }
+}
+
+// A* keeping one element per cell in the open set, lowering its key when a
+// shorter path is found. Returns the cost of the path, -1 if there's none
+s32 PathfindPairingHeap(PairingHeap* open, u16 start, u16 goal) {
+  u16 neighbours[4];
+  GridClear();
+  grid_cost[start] = 0;
+  open->ops_->insert(open, &grid_cells[start], sizeof(u16), GridDistance(start, goal), &grid_handles[start]);
+  while (!open->ops_->isEmpty(open)) {
+    u16 cell = *(u16*)open->ops_->pop(open);
+    grid_handles[cell] = NULL;
+    if (cell == goal) {
+      open->ops_->softReset(open);
+      return grid_cost[cell];
+    }
+    grid_closed[cell] = 1;
+    u16 count = GridNeighbours(cell, neighbours);
+    for (u16 n = 0; n < count; ++n) {
+      u16 next = neighbours[n];
+      s32 cost = grid_cost[cell] + 1;
+      if (grid_closed[next] || cost >= grid_cost[next]) {
+        continue;
+      }
+      grid_cost[next] = cost;
+      if (NULL == grid_handles[next]) {
+        open->ops_->insert(open, &grid_cells[next], sizeof(u16), cost + GridDistance(next, goal), &grid_handles[next]);
+      }
+      else {
+        open->ops_->decreaseKey(open, grid_handles[next], cost + GridDistance(next, goal));
+      }
+    }
+  }
+  return -1;
+}
+
+// A* pushing a new element every time a shorter path to a cell is found, and
+// skipping the old ones when they are popped
+s32 PathfindLazyHeap(Heap* open, u16 start, u16 goal) {
+  u16 neighbours[4];
+  GridClear();
+  grid_cost[start] = 0;
+  open->ops_->push(open, &grid_cells[start], sizeof(u16), GridDistance(start, goal));
+  while (!open->ops_->isEmpty(open)) {
+    u16 cell = *(u16*)open->ops_->pop(open);
+    if (grid_closed[cell]) {
+      continue;
+    }
+    if (cell == goal) {
+      open->ops_->softReset(open);
+      return grid_cost[cell];
+    }
+    grid_closed[cell] = 1;
+    u16 count = GridNeighbours(cell, neighbours);
+    for (u16 n = 0; n < count; ++n) {
+      u16 next = neighbours[n];
+      s32 cost = grid_cost[cell] + 1;
+      if (grid_closed[next] || cost >= grid_cost[next]) {
+        continue;
+      }
+      grid_cost[next] = cost;
+      open->ops_->push(open, &grid_cells[next], sizeof(u16), cost + GridDistance(next, goal));
+    }
+  }
+  return -1;
+}
+
+void TestPathfinding() {
+  LARGE_INTEGER frequency;				// ticks per second
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+  double average_time;
+  u16 starts[kPathfindingRuns];
+  u16 goals[kPathfindingRuns];
+  s32 total_cost = 0;
+
+  // Frequency: ticks per second
+  QueryPerformanceFrequency(&frequency);
+  printf("\n\n\n -----  Start Pathfinding Comparative  -----\n\n");
+  // same grid and searches on every run
+  srand(1);
+  for (u32 i = 0; i < kGridCells; ++i) {
+    grid_cells[i] = (u16)i;
+    grid_walls[i] = 0 == rand() % 4;
+  }
+  for (u16 run = 0; run < kPathfindingRuns; ++run) {
+    starts[run] = rand() % kGridCells;
+    goals[run] = rand() % kGridCells;
+    grid_walls[starts[run]] = 0;
+    grid_walls[goals[run]] = 0;
+  }
+  PairingHeap* pairing_heap = PAIRINGHEAP_create(kGridCells);
+  // a cell can be pushed once per neighbour
+  Heap* lazy_heap = HEAP_createWithKeys(4 * kGridCells, 2);
+
+  //  Pairing Heap A* (decrease-key)  /////////////////////////////////////////////////////////////////////
+  QueryPerformanceCounter(&time_start);
+  for (u16 run = 0; run < kPathfindingRuns; ++run) {
+    total_cost += PathfindPairingHeap(pairing_heap, starts[run], goals[run]);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nPairing Heap A* (decrease-key), %d searches on a %dx%d grid\n", kPathfindingRuns, kGridSide, kGridSide);
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / kPathfindingRuns;
+  printf("Average time: %f ms\n", average_time);
+  printf("Total cost of the paths: %d\n", total_cost);
+
+  //  Heap A* (lazy deletion)  /////////////////////////////////////////////////////////////////////
+  total_cost = 0;
+  QueryPerformanceCounter(&time_start);
+  for (u16 run = 0; run < kPathfindingRuns; ++run) {
+    total_cost += PathfindLazyHeap(lazy_heap, starts[run], goals[run]);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nHeap A* (lazy deletion), %d searches on a %dx%d grid\n", kPathfindingRuns, kGridSide, kGridSide);
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / kPathfindingRuns;
+  printf("Average time: %f ms\n", average_time);
+  printf("Total cost of the paths: %d\n", total_cost);
+
+  // Pathfinding Destroy, the cells are not owned by the heaps
+  s16 error_type;
+  error_type = pairing_heap->ops_->destroy(pairing_heap);
+  printf("\n Destroy Pairing Heap : Exited with error code %d", error_type);
+  error_type = lazy_heap->ops_->destroy(lazy_heap);
+  printf("\n Destroy Heap : Exited with error code %d", error_type);
+}
+
+// Data of the element index of a scattered list, allocated after a filler block of random size
+void* ScatteredData(u32 index) {
+  scattered_filler[index] = MM->malloc(64 + rand() % 512);
+  u8* my_str = MM->malloc(8);
+  if (NULL == my_str) {
+    printf("Error: [%s] not enough memory available i = %d\n", __FUNCTION__, index);
+    return NULL;
+  }
+  sprintf(my_str, "%d", index % 10);
+  return my_str;
+}
+
+void TestPrefetch() {
+  LARGE_INTEGER frequency;				// ticks per second
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+  double average_time;
+  // distances compared, 0 disables the prefetch
+  u16 distances[] = { 0, 1, 2, 4, 8, 16 };
+
+  printf("\n\n\n -----  Start Prefetch Comparative  -----\n\n");
+  QueryPerformanceFrequency(&frequency);
+
+  // random positions leave the order of the elements unrelated to their addresses
+  List* scattered_list = LIST_create(repetitions);
+  DList* scattered_dlist = DLIST_create(repetitions);
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    scattered_list->ops_->insertAt(scattered_list, ScatteredData(rep), 8, rand() % (rep + 1));
+  }
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    MM->free(scattered_filler[rep]);
+  }
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    scattered_dlist->ops_->insertAt(scattered_dlist, ScatteredData(rep), 8, rand() % (rep + 1));
+  }
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    MM->free(scattered_filler[rep]);
+  }
+
+  //  Scattered List Traverse  /////////////////////////////////////////////////////////////////////
+  scattered_list->ops_->traverse(scattered_list, TouchNode);
+  for (u16 i = 0; i < sizeof(distances) / sizeof(distances[0]); ++i) {
+    scattered_list->ops_->setPrefetchDistance(scattered_list, distances[i]);
+    touched_bytes = 0;
+    QueryPerformanceCounter(&time_start);
+    scattered_list->ops_->traverse(scattered_list, TouchNode);
+    QueryPerformanceCounter(&time_end);
+    elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+    printf("\nScattered List Traverse (prefetch distance %d)\n", distances[i]);
+    printf("Elapsed time: %f ms\n", elapsed_time);
+
+    average_time = elapsed_time / repetitions;
+    printf("Average time: %f ms\n", average_time);
+  }
+
+  //  Scattered DList Traverse  /////////////////////////////////////////////////////////////////////
+  scattered_dlist->ops_->traverse(scattered_dlist, TouchNode);
+  for (u16 i = 0; i < sizeof(distances) / sizeof(distances[0]); ++i) {
+    scattered_dlist->ops_->setPrefetchDistance(scattered_dlist, distances[i]);
+    touched_bytes = 0;
+    QueryPerformanceCounter(&time_start);
+    scattered_dlist->ops_->traverse(scattered_dlist, TouchNode);
+    QueryPerformanceCounter(&time_end);
+    elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+    printf("\nScattered DList Traverse (prefetch distance %d)\n", distances[i]);
+    printf("Elapsed time: %f ms\n", elapsed_time);
+
+    average_time = elapsed_time / repetitions;
+    printf("Average time: %f ms\n", average_time);
+  }
+
+  //  Scattered Destroy  ////////////////////////////////////////////////
+  s16 error_type;
+  error_type = scattered_list->ops_->destroy(scattered_list);
+  printf("\n Destroy Scattered List : Exited with error code %d", error_type);
+  error_type = scattered_dlist->ops_->destroy(scattered_dlist);
+  printf("\n Destroy Scattered DList : Exited with error code %d", error_type);
+}
+
+DWORD WINAPI LockFreeStackWorker(LPVOID param) {
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    lockfree_stack->ops_->push(lockfree_stack, data1[rep], 4);
+    lockfree_stack->ops_->pop(lockfree_stack);
+  }
+  HAZARD_release();
+  return 0;
+}
+
+DWORD WINAPI LockFreeQueueWorker(LPVOID param) {
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    lockfree_queue->ops_->enqueue(lockfree_queue, data1[rep], 4);
+    lockfree_queue->ops_->dequeue(lockfree_queue);
+  }
+  HAZARD_release();
+  return 0;
+}
+
+DWORD WINAPI LockedQueueWorker(LPVOID param) {
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    EnterCriticalSection(&locked_queue_lock);
+    locked_queue->ops_->enqueue(locked_queue, data1[rep], 4);
+    LeaveCriticalSection(&locked_queue_lock);
+    EnterCriticalSection(&locked_queue_lock);
+    locked_queue->ops_->dequeue(locked_queue, 0);
+    LeaveCriticalSection(&locked_queue_lock);
+  }
+  return 0;
+}
+
+DWORD WINAPI EliminationStackWorker(LPVOID param) {
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    elimination_stack->ops_->push(elimination_stack, data1[rep], 4);
+    elimination_stack->ops_->pop(elimination_stack);
+  }
+  HAZARD_release();
+  return 0;
+}
+
+DWORD WINAPI LockedStackWorker(LPVOID param) {
+  for (u32 rep = 0; rep < repetitions; ++rep) {
+    EnterCriticalSection(&locked_stack_lock);
+    locked_stack->ops_->push(locked_stack, data1[rep], 4);
+    LeaveCriticalSection(&locked_stack_lock);
+    EnterCriticalSection(&locked_stack_lock);
+    locked_stack->ops_->pop(locked_stack);
+    LeaveCriticalSection(&locked_stack_lock);
+  }
+  return 0;
+}
+
+// Runs worker on several threads at the same time and prints the time they took
+void RunThreads(const char* name, LPTHREAD_START_ROUTINE worker, u16 threads) {
+  LARGE_INTEGER frequency;				// ticks per second
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+  double average_time;
+  HANDLE handles[kMaxContentionThreads];
+
+  QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&time_start);
+  for (u16 i = 0; i < threads; ++i) {
+    handles[i] = CreateThread(NULL, 0, worker, NULL, 0, NULL);
+  }
+  WaitForMultipleObjects(threads, handles, TRUE, INFINITE);
+  QueryPerformanceCounter(&time_end);
+  for (u16 i = 0; i < threads; ++i) {
+    CloseHandle(handles[i]);
+  }
+
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\n%s (%d threads)\n", name, threads);
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  // every thread inserts and extracts repetitions elements
+  average_time = elapsed_time / (2.0 * repetitions * threads);
+  printf("Average time: %f ms\n", average_time);
+}
+
+// Adds up a piece of parallel_values, with some work per value
+void SumValues(u32 begin, u32 end, void* ctx) {
+  u32 sum = 0;
+  for (u32 i = begin; i < end; ++i) {
+    sum += (parallel_values[i] * parallel_values[i]) % 7;
+  }
+  ATOMIC_addU32(&parallel_sum, sum);
+}
+
+void TestScheduler() {
+  LARGE_INTEGER frequency;				// ticks per second
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+
+  QueryPerformanceFrequency(&frequency);
+  printf("\n\n\n -----  Start Task Scheduler Comparative  -----\n\n");
+  for (u32 i = 0; i < kParallelValues; ++i) {
+    parallel_values[i] = i;
+  }
+
+  //  Serial Sum  /////////////////////////////////////////////////////////////////////
+  parallel_sum = 0;
+  QueryPerformanceCounter(&time_start);
+  SumValues(0, kParallelValues, NULL);
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nSerial Sum of %d values\n", kParallelValues);
+  printf("Elapsed time: %f ms\n", elapsed_time);
+  printf("Sum: %u\n", parallel_sum);
+
+  //  Scheduler Parallel For Sum  /////////////////////////////////////////////////////////////////////
+  for (u16 workers = 1; workers <= kMaxBenchmarkThreads; workers *= 2) {
+    TaskScheduler* scheduler = TASKSCHEDULER_create(workers);
+    parallel_sum = 0;
+    QueryPerformanceCounter(&time_start);
+    scheduler->ops_->parallelFor(scheduler, 0, kParallelValues, 4096, SumValues, NULL);
+    QueryPerformanceCounter(&time_end);
+    elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+    printf("\nScheduler Parallel For Sum of %d values (%d workers)\n", kParallelValues, workers);
+    printf("Elapsed time: %f ms\n", elapsed_time);
+    printf("Sum: %u\n", parallel_sum);
+
+    s16 error_type;
+    error_type = scheduler->ops_->destroy(scheduler);
+    printf("\n Destroy Task Scheduler : Exited with error code %d", error_type);
+  }
+}
+
+// Sends back every element of ping_queue through pong_queue until ping_queue is closed
+DWORD WINAPI EchoWorker(LPVOID param) {
+  void* data;
+  while (NULL != (data = ping_queue->ops_->dequeueWait(ping_queue, kBlockingQueueWaitForever))) {
+    pong_queue->ops_->enqueueWait(pong_queue, data, 4);
+  }
+  return 0;
+}
+
+void TestBlockingQueue() {
+  LARGE_INTEGER frequency;				// ticks per second
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+  double average_time;
+  u32 spins[] = { 0, 100, kBlockingQueueDefaultSpins, 10000 };
+
+  QueryPerformanceFrequency(&frequency);
+  printf("\n\n\n -----  Start Blocking Queue Comparative  -----\n\n");
+
+  //  Ping-Pong Wakeup Latency  /////////////////////////////////////////////////////////////////////
+  // every trip wakes up the other thread twice, so it measures what a sleeping
+  // consumer takes to notice a new element
+  for (u16 i = 0; i < sizeof(spins) / sizeof(spins[0]); ++i) {
+    ping_queue = BLOCKINGQUEUE_create(1);
+    pong_queue = BLOCKINGQUEUE_create(1);
+    ping_queue->ops_->setSpins(ping_queue, spins[i]);
+    pong_queue->ops_->setSpins(pong_queue, spins[i]);
+    HANDLE echo = CreateThread(NULL, 0, EchoWorker, NULL, 0, NULL);
+
+    QueryPerformanceCounter(&time_start);
+    for (u32 trip = 0; trip < kWakeupRoundTrips; ++trip) {
+      ping_queue->ops_->enqueueWait(ping_queue, data1[trip % repetitions], 4);
+      pong_queue->ops_->dequeueWait(pong_queue, kBlockingQueueWaitForever);
+    }
+    QueryPerformanceCounter(&time_end);
+    ping_queue->ops_->close(ping_queue);
+    WaitForMultipleObjects(1, &echo, TRUE, INFINITE);
+    CloseHandle(echo);
+
+    elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+    printf("\nBlockingQueue Ping-Pong (%u spins before sleeping)\n", spins[i]);
+    printf("Elapsed time: %f ms\n", elapsed_time);
+
+    average_time = elapsed_time / (2.0 * kWakeupRoundTrips);
+    printf("Average wakeup time: %f ms\n", average_time);
+
+    ping_queue->ops_->destroy(ping_queue);
+    pong_queue->ops_->destroy(pong_queue);
+  }
+}
+
+void CountTimer(MemoryNode* node, void* ctx) {
+  timers_fired++;
+}
+
+void TestTimingWheel() {
+  LARGE_INTEGER frequency;				// ticks per second
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+  double average_time;
+
+  // Frequency: ticks per second
+  QueryPerformanceFrequency(&frequency);
+  printf("\n\n\n -----  Start Timing Wheel Comparative  -----\n\n");
+  // same ticks on every run
+  srand(1);
+  for (u32 i = 0; i < kMaxPendingTimers; ++i) {
+    timer_ticks[i] = 1 + (((u32)rand() << 15) ^ (u32)rand()) % kTimerSpread;
+  }
+
+  // the cost of a tick should not grow with the pending timers
+  for (u32 pending = 1000; pending <= kMaxPendingTimers; pending *= 10) {
+    TimingWheel* wheel = TIMINGWHEEL_create(pending);
+
+    //  Timing Wheel Schedule  /////////////////////////////////////////////////////////////////////
+    QueryPerformanceCounter(&time_start);
+    for (u32 i = 0; i < pending; ++i) {
+      wheel->ops_->schedule(wheel, &timer_ticks[i], sizeof(u32), timer_ticks[i], NULL);
+    }
+    QueryPerformanceCounter(&time_end);
+    elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+    printf("\nTiming Wheel Schedule (%u timers)\n", pending);
+    printf("Elapsed time: %f ms\n", elapsed_time);
+
+    average_time = elapsed_time / pending;
+    printf("Average time: %f ms\n", average_time);
+
+    //  Timing Wheel Advance  /////////////////////////////////////////////////////////////////////
+    timers_fired = 0;
+    QueryPerformanceCounter(&time_start);
+    for (u32 tick = 0; tick < kWheelTicks; ++tick) {
+      wheel->ops_->advance(wheel, 1, CountTimer, NULL);
+    }
+    QueryPerformanceCounter(&time_end);
+    elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+    printf("\nTiming Wheel Advance (%u timers, %u fired)\n", pending, timers_fired);
+    printf("Elapsed time: %f ms\n", elapsed_time);
+
+    average_time = elapsed_time / kWheelTicks;
+    printf("Average time: %f ms\n", average_time);
+
+    // the ticks are not owned by the wheel
+    wheel->ops_->softReset(wheel);
+    wheel->ops_->destroy(wheel);
+
+    //  List Scan  /////////////////////////////////////////////////////////////////////
+    // the same ticks kept in a List that is walked on every tick, as far as a List holds
+    if (pending > 0xFFFF) {
+      continue;
+    }
+    List* timer_list = LIST_create((u16)pending);
+    for (u32 i = 0; i < pending; ++i) {
+      timer_list->ops_->insertLast(timer_list, &timer_ticks[i], sizeof(u32));
+    }
+    timers_fired = 0;
+    QueryPerformanceCounter(&time_start);
+    for (u32 tick = 1; tick <= kWheelTicks; ++tick) {
+      for (MemoryNode* node = timer_list->head_; NULL != node; node = node->next_) {
+        if (*(u32*)node->data_ == tick) {
+          timers_fired++;
+        }
+      }
+    }
+    QueryPerformanceCounter(&time_end);
+    elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+    printf("\nList Scan (%u timers, %u fired)\n", pending, timers_fired);
+    printf("Elapsed time: %f ms\n", elapsed_time);
+
+    average_time = elapsed_time / kWheelTicks;
+    printf("Average time: %f ms\n", average_time);
+
+    timer_list->ops_->softReset(timer_list);
+    timer_list->ops_->destroy(timer_list);
+  }
+}
+
+void TestStackArena() {
+  LARGE_INTEGER frequency;				// ticks per second
+  LARGE_INTEGER  time_start, time_end;    // ticks in interval
+  double elapsed_time = 0.0f;
+  double average_time;
+
+  // Frequency: ticks per second
+  QueryPerformanceFrequency(&frequency);
+  printf("\n\n\n -----  Start Stack Arena Comparative  -----\n\n");
+  List* frame_list = LIST_create(repetitions);
+
+  //  Frame with Memory Manager  /////////////////////////////////////////////////////////////////////
+  // every payload is allocated on its own and freed by the reset at the end of the frame
+  QueryPerformanceCounter(&time_start);
+  for (u32 frame = 0; frame < kArenaFrames; ++frame) {
+    for (u32 rep = 0; rep < repetitions; ++rep) {
+      void* payload = MM->malloc(4);
+      memcpy(payload, data1[rep], 4);
+      frame_list->ops_->insertLast(frame_list, payload, 4);
+    }
+    frame_list->ops_->reset(frame_list);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nList Frame with Memory Manager\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / (kArenaFrames * repetitions);
+  printf("Average time: %f ms\n", average_time);
+
+  //  Frame with Stack Arena  /////////////////////////////////////////////////////////////////////
+  // the payloads come from the arena, the frame ends with a softReset and one release
+  StackArena* arena = STACKARENA_create(kArenaBlockSize);
+  QueryPerformanceCounter(&time_start);
+  for (u32 frame = 0; frame < kArenaFrames; ++frame) {
+    StackArenaMark mark = arena->ops_->mark(arena);
+    for (u32 rep = 0; rep < repetitions; ++rep) {
+      frame_list->ops_->insertLast(frame_list, arena->ops_->copy(arena, data1[rep], 4), 4);
+    }
+    frame_list->ops_->softReset(frame_list);
+    arena->ops_->release(arena, mark);
+  }
+  QueryPerformanceCounter(&time_end);
+  elapsed_time = (time_end.QuadPart - time_start.QuadPart) * 1000000.0f / frequency.QuadPart;
+  printf("\nList Frame with Stack Arena\n");
+  printf("Elapsed time: %f ms\n", elapsed_time);
+
+  average_time = elapsed_time / (kArenaFrames * repetitions);
+  printf("Average time: %f ms\n", average_time);
+
+  // Stack Arena Destroy  ////////////////////////////////////////////////
+  s16 error_type;
+  error_type = arena->ops_->destroy(arena);
+  printf("\n Destroy Stack Arena : Exited with error code %d", error_type);
+  error_type = frame_list->ops_->destroy(frame_list);
+  printf("\n Destroy Frame List : Exited with error code %d", error_type);
+}
+
+void TestLockFree() {
+  printf("\n\n\n -----  Start Lock-Free Comparative  -----\n\n");
+  lockfree_stack = LOCKFREESTACK_create(repetitions);
+  lockfree_queue = LOCKFREEQUEUE_create(repetitions);
+  locked_queue = QUEUE_create(repetitions);
+  InitializeCriticalSection(&locked_queue_lock);
+
+  for (u16 threads = 1; threads <= kMaxBenchmarkThreads; threads *= 2) {
+    RunThreads("LockFreeStack Push + Pop", LockFreeStackWorker, threads);
+    RunThreads("LockFreeQueue Enqueue + Dequeue", LockFreeQueueWorker, threads);
+    RunThreads("Queue with lock Enqueue + Dequeue", LockedQueueWorker, threads);
+  }
+
+  // LockFree Destroy  ////////////////////////////////////////////////
+  s16 error_type;
+  error_type = lockfree_stack->ops_->destroy(lockfree_stack);
+  printf("\n Destroy LockFreeStack : Exited with error code %d", error_type);
+  error_type = lockfree_queue->ops_->destroy(lockfree_queue);
+  printf("\n Destroy LockFreeQueue : Exited with error code %d", error_type);
+  error_type = locked_queue->ops_->destroy(locked_queue);
+  printf("\n Destroy Queue with lock : Exited with error code %d", error_type);
+  DeleteCriticalSection(&locked_queue_lock);
+  HAZARD_destroy();
+}
+
+void TestContention() {
+  printf("\n\n\n -----  Start Contention Comparative  -----\n\n");
+  elimination_stack = ELIMINATIONSTACK_create(repetitions);
+  lockfree_stack = LOCKFREESTACK_create(repetitions);
+  locked_stack = STACK_create(repetitions);
+  InitializeCriticalSection(&locked_stack_lock);
+
+  // every thread pushes and pops on the same top, the more threads the more
+  // pairs meet in the elimination array instead
+  for (u16 threads = 1; threads <= kMaxContentionThreads; threads *= 2) {
+    RunThreads("EliminationStack Push + Pop", EliminationStackWorker, threads);
+    printf("Eliminated pairs: %u\n", elimination_stack->ops_->eliminated(elimination_stack));
+    RunThreads("LockFreeStack Push + Pop", LockFreeStackWorker, threads);
+    RunThreads("Stack with lock Push + Pop", LockedStackWorker, threads);
+  }
+
+  // Contention Destroy  ////////////////////////////////////////////////
+  s16 error_type;
+  error_type = elimination_stack->ops_->destroy(elimination_stack);
+  printf("\n Destroy EliminationStack : Exited with error code %d", error_type);
+  error_type = lockfree_stack->ops_->destroy(lockfree_stack);
+  printf("\n Destroy LockFreeStack : Exited with error code %d", error_type);
+  error_type = locked_stack->ops_->destroy(locked_stack);
+  printf("\n Destroy Stack with lock : Exited with error code %d", error_type);
+  DeleteCriticalSection(&locked_stack_lock);
+  HAZARD_destroy();
 }
 
 void FreeData() {
@@ -619,8 +1816,19 @@ void calculateTimeForFunction() {
   TestVector();
   TestList();
   TestDList();
+  TestSkipList();
+  TestUnrolledList();
   TestQueue();
   TestStack();
+  TestHeap();
+  TestPathfinding();
+  TestTimingWheel();
+  TestStackArena();
+  TestPrefetch();
+  TestLockFree();
+  TestContention();
+  TestScheduler();
+  TestBlockingQueue();
   FreeData();
 }
 
@@ -11,6 +11,7 @@
 
 #include "ABGS_MemoryManager/abgs_memory_manager.h"
 #include "common_def.h"
+#include "adt_memory_node.h"
 
 #define _TEST_PRINT_DATA
 
@@ -246,3 +247,28 @@ void TESTBASE_printFunctionResult(void *address, u8 *msg, s16 error_type) {
   printf("\n");
   MM->free(error_msg);
 }
+
+// Counters handed as ctx to the traverseEx and traverseBatch callbacks below
+typedef struct {
+  // nodes visited so far
+  u16 visited;
+  // nodes after which the traversal stops
+  u16 stop_at;
+  // spans handed to the batch callback
+  u16 spans;
+} TraverseCounters;
+
+s16 TESTBASE_countUntil(MemoryNode *node, void *ctx) {
+  (void)node;
+  TraverseCounters *counters = (TraverseCounters *)ctx;
+  counters->visited++;
+  return counters->visited >= counters->stop_at ? kTraverse_Stop : kTraverse_Continue;
+}
+
+s16 TESTBASE_countSpansUntil(MemoryNode **nodes, u16 count, void *ctx) {
+  (void)nodes;
+  TraverseCounters *counters = (TraverseCounters *)ctx;
+  counters->visited += count;
+  counters->spans++;
+  return counters->visited >= counters->stop_at ? kTraverse_Stop : kTraverse_Continue;
+}
@@ -0,0 +1,249 @@
+// test_blocking_queue.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for blocking queue ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_blocking_queue.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kCapacityBlockingQueue1 = 8;
+const u16 kCapacityBlockingQueue2 = 3;
+// elements moved by the producer thread
+const u16 kProducedElements = 2000;
+
+// sums of the values the producer sent and the consumer got
+u32 produced_sum = 0;
+u32 consumed_sum = 0;
+
+// Enqueues kProducedElements values into the queue, waiting when it is full, and closes it
+#ifdef _WIN32
+DWORD WINAPI Producer(LPVOID param) {
+#else
+void* Producer(void* param) {
+#endif
+	BlockingQueue *queue = (BlockingQueue *)param;
+	for (u16 i = 0; i < kProducedElements; ++i) {
+		u32 *value = (u32 *)MM->malloc(sizeof(u32));
+		*value = i;
+		produced_sum += i;
+		if (kErrorCode_Ok != queue->ops_->enqueueWait(queue, value, sizeof(u32))) {
+			MM->free(value);
+		}
+	}
+	queue->ops_->close(queue);
+	return 0;
+}
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+	// as long as queue_1
+	void *batch[8];
+
+	TESTBASE_generateDataForTest();
+
+	// queue created just to have a reference to the operations
+	BlockingQueue *bq = NULL;
+	bq = BLOCKINGQUEUE_create(1);
+	if (NULL == bq) {
+		printf("\n create returned a null node in queue for ops");
+		return -1;
+	}
+	// queues to work with
+	BlockingQueue *queue_1 = NULL;
+	BlockingQueue *queue_2 = NULL;
+	queue_1 = BLOCKINGQUEUE_create(kCapacityBlockingQueue1);
+	if (NULL == queue_1) {
+		printf("\n create returned a null node in queue_1\n");
+		return -1;
+	}
+	queue_2 = BLOCKINGQUEUE_create(kCapacityBlockingQueue2);
+	if (NULL == queue_2) {
+		printf("\n create returned a null node in queue_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Mem Node: %zu\n", sizeof(MemoryNode));
+	printf("  + queue_1: %zu\n", sizeof(*queue_1));
+
+	printf("\n\n# Test Try Enqueue\n");
+	error_type = bq->ops_->tryEnqueue(queue_2, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"tryEnqueue queue_2", error_type);
+	TestData.single_ptr_data_1 = NULL;
+	error_type = bq->ops_->tryEnqueue(queue_2, TestData.single_ptr_data_2, kSingleSizeData2);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"tryEnqueue queue_2", error_type);
+	TestData.single_ptr_data_2 = NULL;
+	error_type = bq->ops_->enqueueWait(queue_2, TestData.single_ptr_data_3, kSingleSizeData3);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"enqueueWait queue_2", error_type);
+	TestData.single_ptr_data_3 = NULL;
+	error_type = bq->ops_->tryEnqueue(queue_2, TestData.single_ptr_data_4, kSingleSizeData4);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"tryEnqueue queue_2 (NOT VALID, full)", error_type);
+	if (kErrorCode_InsertionFailed != error_type)
+		printf("  ==> ERROR: tryEnqueue into a full queue_2 didn't fail\n");
+	if (!bq->ops_->isFull(queue_2))
+		printf("  ==> ERROR: queue_2 is not full\n");
+	printf("queue_2:\n");
+	bq->ops_->print(queue_2);
+
+	printf("\n\n# Test Dequeue Wait\n");
+	// first in, first out
+	for (u16 i = 0; i < kCapacityBlockingQueue1; ++i) {
+		bq->ops_->tryEnqueue(queue_1, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+	}
+	for (s16 i = 0; i < 3; ++i) {
+		data = bq->ops_->dequeueWait(queue_1, 0);
+		if (NULL == data || (s16)atoi((char *)data) != i) {
+			printf("  ==> ERROR: dequeueWait queue_1 didn't return \"%d\"\n", i);
+			break;
+		}
+		MM->free(data);
+	}
+	if (kCapacityBlockingQueue1 - 3 != bq->ops_->length(queue_1))
+		printf("  ==> ERROR: length queue_1 is %d\n", bq->ops_->length(queue_1));
+
+	printf("\n\n# Test Drain\n");
+	if (2 != bq->ops_->drain(queue_1, batch, 2, 0))
+		printf("  ==> ERROR: drain of 2 elements from queue_1 didn't return 2\n");
+	if (3 != atoi((char *)batch[0]) || 4 != atoi((char *)batch[1]))
+		printf("  ==> ERROR: drain queue_1 didn't return \"3\" and \"4\"\n");
+	MM->free(batch[0]);
+	MM->free(batch[1]);
+	if (3 != bq->ops_->drain(queue_1, batch, kCapacityBlockingQueue1, kBlockingQueueWaitForever))
+		printf("  ==> ERROR: drain of the rest of queue_1 didn't return 3\n");
+	for (u16 i = 0; i < 3; ++i) {
+		MM->free(batch[i]);
+	}
+	if (!bq->ops_->isEmpty(queue_1))
+		printf("  ==> ERROR: queue_1 is not empty\n");
+
+	printf("\n\n# Test Timeout\n");
+	// nothing comes, so the wait ends empty handed once the time runs out
+	data = bq->ops_->dequeueWait(queue_1, 20);
+	if (NULL != data)
+		printf("  ==> ERROR: dequeueWait from an empty queue_1 is not NULL\n");
+	if (0 != bq->ops_->drain(queue_1, batch, kCapacityBlockingQueue1, 20))
+		printf("  ==> ERROR: drain from an empty queue_1 is not 0\n");
+
+	printf("\n\n# Test Producer and Consumer\n");
+	// the producer fills queue_1 faster than it's read, so both sides have to wait
+	for (u16 spins = 0; spins <= kBlockingQueueDefaultSpins; spins += kBlockingQueueDefaultSpins) {
+		BlockingQueue *pipe = BLOCKINGQUEUE_create(kCapacityBlockingQueue1);
+		bq->ops_->setSpins(pipe, spins);
+		produced_sum = 0;
+		consumed_sum = 0;
+		u16 consumed = 0;
+#ifdef _WIN32
+		HANDLE producer = CreateThread(NULL, 0, Producer, pipe, 0, NULL);
+#else
+		pthread_t producer;
+		pthread_create(&producer, NULL, Producer, pipe);
+#endif
+		for (;;) {
+			u16 count = bq->ops_->drain(pipe, batch, 3, kBlockingQueueWaitForever);
+			if (0 == count) {
+				break;
+			}
+			for (u16 i = 0; i < count; ++i) {
+				consumed_sum += *(u32 *)batch[i];
+				MM->free(batch[i]);
+			}
+			consumed += count;
+		}
+#ifdef _WIN32
+		WaitForSingleObject(producer, INFINITE);
+		CloseHandle(producer);
+#else
+		pthread_join(producer, NULL);
+#endif
+		if (kProducedElements != consumed || produced_sum != consumed_sum)
+			printf("  ==> ERROR: consumer got %d elements adding %u, expected %d adding %u (%u spins)\n",
+				consumed, consumed_sum, kProducedElements, produced_sum, spins);
+		if (!bq->ops_->isClosed(pipe))
+			printf("  ==> ERROR: the pipe is not closed\n");
+		bq->ops_->destroy(pipe);
+	}
+
+	printf("\n\n# Test Close\n");
+	error_type = bq->ops_->close(queue_2);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"close queue_2", error_type);
+	error_type = bq->ops_->tryEnqueue(queue_2, TestData.single_ptr_data_4, kSingleSizeData4);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"tryEnqueue queue_2 (NOT VALID, closed)", error_type);
+	error_type = bq->ops_->enqueueWait(queue_2, TestData.single_ptr_data_4, kSingleSizeData4);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"enqueueWait queue_2 (NOT VALID, closed)", error_type);
+	if (kErrorCode_QueueClosed != error_type)
+		printf("  ==> ERROR: enqueueWait into a closed queue_2 didn't fail\n");
+	// the elements left are still handed out, then the waits return at once
+	data = bq->ops_->dequeueWait(queue_2, kBlockingQueueWaitForever);
+	if (NULL == data)
+		printf("  ==> ERROR: dequeueWait from a closed queue_2 lost its elements\n");
+	MM->free(data);
+	if (2 != bq->ops_->drain(queue_2, batch, kCapacityBlockingQueue1, kBlockingQueueWaitForever))
+		printf("  ==> ERROR: drain of a closed queue_2 didn't return its 2 elements\n");
+	MM->free(batch[0]);
+	MM->free(batch[1]);
+	data = bq->ops_->dequeueWait(queue_2, kBlockingQueueWaitForever);
+	if (NULL != data)
+		printf("  ==> ERROR: dequeueWait from a closed and empty queue_2 is not NULL\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = bq->ops_->destroy(queue_2);
+	queue_2 = NULL;
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"destroy queue_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	queue_2 = BLOCKINGQUEUE_create(0);
+	if (NULL != queue_2) {
+		printf("ERROR: trying to create queue_2 with 0 capacity\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Enqueue\n");
+	data = TestData.single_ptr_big_data;
+	error_type = bq->ops_->enqueueWait(queue_2, data, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"enqueueWait queue_2 (NOT VALID)", error_type);
+	error_type = bq->ops_->tryEnqueue(queue_2, data, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"tryEnqueue queue_2 (NOT VALID)", error_type);
+	error_type = bq->ops_->enqueueWait(queue_1, NULL, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(queue_1, (u8 *)"enqueueWait queue_1 NULL data (NOT VALID)", error_type);
+	error_type = bq->ops_->tryEnqueue(queue_1, data, 0);
+	TESTBASE_printFunctionResult(queue_1, (u8 *)"tryEnqueue queue_1 0 bytes (NOT VALID)", error_type);
+
+	printf("\n\n# Test Dequeue\n");
+	data = bq->ops_->dequeueWait(queue_2, kBlockingQueueWaitForever);
+	if (NULL != data)
+		printf("ERROR: trying to dequeueWait from a NULL queue\n");
+	if (0 != bq->ops_->drain(queue_2, batch, 1, 0))
+		printf("ERROR: trying to drain a NULL queue\n");
+	if (0 != bq->ops_->drain(queue_1, NULL, 1, 0))
+		printf("ERROR: trying to drain into a NULL array\n");
+
+	printf("\n\n# Test Close and Destroy\n");
+	error_type = bq->ops_->close(queue_2);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"close queue_2 (NOT VALID)", error_type);
+	error_type = bq->ops_->destroy(queue_2);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"destroy queue_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = bq->ops_->destroy(queue_1);
+	TESTBASE_printFunctionResult(queue_1, (u8 *)"destroy queue_1", error_type);
+	error_type = bq->ops_->destroy(bq);
+	TESTBASE_printFunctionResult(bq, (u8 *)"destroy BlockingQueue Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+
+	return 0;
+}
@@ -348,6 +348,80 @@ int main() {
 	printf("vector_3:\n");
 	v->ops_->print(vector_3);
 
+	printf("\n\n# Test PushMany\n");
+	CircularVector *vector_4 = CIRCULAR_VECTOR_create(4);
+	if (NULL == vector_4) {
+		printf("\n create returned a null node in vector_4\n");
+		return -1;
+	}
+	// move the head forward so the bulk copy has to wrap around
+	v->ops_->insertLast(vector_4, TESTBASE_generateDataString("w"), 2);
+	v->ops_->insertLast(vector_4, TESTBASE_generateDataString("x"), 2);
+	v->ops_->insertLast(vector_4, TESTBASE_generateDataString("y"), 2);
+	MM->free(v->ops_->extractFirst(vector_4));
+	MM->free(v->ops_->extractFirst(vector_4));
+	MemoryNode bulk_nodes[5];
+	for (u16 i = 0; i < 5; ++i) {
+		MEMNODE_createLite(&bulk_nodes[i]);
+		bulk_nodes[i].ops_->setData(&bulk_nodes[i], TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+	}
+	u16 moved = v->ops_->pushMany(vector_4, bulk_nodes, 5);
+	if (3 != moved) {
+		printf("  ==> ERROR: pushMany moved %d elements, expected 3 (vector_4)\n", moved);
+	}
+	for (u16 i = moved; i < 5; ++i) {
+		bulk_nodes[i].ops_->reset(&bulk_nodes[i]);
+	}
+	printf("vector_4:\n");
+	v->ops_->print(vector_4);
+
+	printf("\n\n# Test PopMany\n");
+	moved = v->ops_->popMany(vector_4, bulk_nodes, 5);
+	if (4 != moved || false == v->ops_->isEmpty(vector_4)) {
+		printf("  ==> ERROR: popMany moved %d elements, expected 4 (vector_4)\n", moved);
+	}
+	for (u16 i = 0; i < moved; ++i) {
+		printf("popped \"%s\" in vector_4\n", (u8 *)bulk_nodes[i].ops_->data(&bulk_nodes[i]));
+		bulk_nodes[i].ops_->reset(&bulk_nodes[i]);
+	}
+	error_type = v->ops_->destroy(vector_4);
+	TESTBASE_printFunctionResult(vector_4, (u8 *)"destroy vector_4", error_type);
+
+	printf("\n\n# Test Overwrite Mode\n");
+	CircularVector *ring = CIRCULAR_VECTOR_createWithMode(3, kCircularVectorMode_Overwrite);
+	if (NULL == ring) {
+		printf("\n create returned a null node in ring\n");
+		return -1;
+	}
+	for (u16 i = 0; i < 5; ++i) {
+		error_type = v->ops_->insertLast(ring, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+		TESTBASE_printFunctionResult(ring, (u8 *)"insertLast ring (overwrite)", error_type);
+	}
+	MemoryNode evicted;
+	error_type = v->ops_->insertLastEvict(ring, TESTBASE_generateDataIntegerAsString(5), kMaxIntegerChars, &evicted);
+	TESTBASE_printFunctionResult(ring, (u8 *)"insertLastEvict ring", error_type);
+	if (NULL == evicted.ops_->data(&evicted))
+		printf("ERROR: insertLastEvict didn't return the oldest element\n");
+	else
+		printf("evicted \"%s\" from ring\n", (u8 *)evicted.ops_->data(&evicted));
+	evicted.ops_->reset(&evicted);
+
+	printf("\n\n# Test Iterator\n");
+	CircularVectorIterator iterator;
+	v->ops_->iteratorBegin(ring, &iterator);
+	// overwrites the oldest element of the snapshot, the iterator must skip it
+	v->ops_->insertLast(ring, TESTBASE_generateDataIntegerAsString(6), kMaxIntegerChars);
+	u16 visited = 0;
+	for (MemoryNode *node = v->ops_->iteratorNext(&iterator); NULL != node; node = v->ops_->iteratorNext(&iterator)) {
+		printf("ring #%d: \"%s\"\n", visited, (u8 *)node->ops_->data(node));
+		visited++;
+	}
+	if (visited != (v->ops_->capacity(ring) - 1)) {
+		printf("  ==> ERROR: iterator visited %d elements (ring)\n", visited);
+	}
+	error_type = v->ops_->destroy(ring);
+	TESTBASE_printFunctionResult(ring, (u8 *)"destroy ring", error_type);
+
 	printf("\n\n# Test Resize\n");
 	printf("\t vector_1 resize\n");
 	error_type = v->ops_->resize(vector_1, 3);
@@ -359,7 +433,7 @@ int main() {
 
 	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
 	printf("\n\n# Test Create\n");
-	vector_2 = VECTOR_create(0);
+	vector_2 = CIRCULAR_VECTOR_create(0);
 	if (NULL != vector_2) {
 		printf("ERROR: trying to create vector_2 with 0 capacity\n");
 		return -1;
@@ -431,6 +505,34 @@ int main() {
 	TESTBASE_printFunctionResult(vector_3, (u8 *)"destroy vector_3 (NOT VALID)", error_type);
 
 
+	printf("\n\n# Test TraverseEx\n");
+	CircularVector *vector_t = CIRCULAR_VECTOR_create(40);
+	for (u16 i = 0; i < 40; ++i) {
+		v->ops_->insertLast(vector_t, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+	}
+	TraverseCounters counters = { 0, 3, 0 };
+	error_type = v->ops_->traverseEx(vector_t, TESTBASE_countUntil, &counters);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseEx vector_t", error_type);
+	if (3 != counters.visited)
+		printf("  ==> ERROR: traverseEx vector_t visited %d elements instead of stopping at 3\n", counters.visited);
+	counters = (TraverseCounters){ 0, 0xFFFF, 0 };
+	error_type = v->ops_->traverseBatch(vector_t, TESTBASE_countSpansUntil, &counters);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseBatch vector_t", error_type);
+	if (40 != counters.visited || 2 != counters.spans)
+		printf("  ==> ERROR: traverseBatch vector_t visited %d elements in %d spans\n", counters.visited, counters.spans);
+	counters = (TraverseCounters){ 0, 1, 0 };
+	error_type = v->ops_->traverseBatch(vector_t, TESTBASE_countSpansUntil, &counters);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseBatch vector_t", error_type);
+	if (1 != counters.spans)
+		printf("  ==> ERROR: traverseBatch vector_t didn't stop after the first span\n");
+	error_type = v->ops_->traverseEx(vector_t, NULL, NULL);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseEx vector_t NULL (NOT VALID)", error_type);
+	error_type = v->ops_->traverseBatch(NULL, TESTBASE_countSpansUntil, &counters);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"traverseBatch NULL (NOT VALID)", error_type);
+	error_type = v->ops_->destroy(vector_t);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"destroy vector_t", error_type);
+
+
 	// Work is done, clean the system
 	error_type = v->ops_->destroy(vector_1);
 	TESTBASE_printFunctionResult(vector_1, (u8 *)"destroy vector_1", error_type);
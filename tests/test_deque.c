@@ -0,0 +1,255 @@
+// test_deque.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for deque ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_deque.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kCapacityDeque1 = 200;
+const u16 kCapacityDeque2 = 5;
+
+// Checks that the nodes of a span are contiguous, then counts them
+s16 DEQUETEST_checkSpan(MemoryNode **nodes, u16 count, void *ctx) {
+	for (u16 i = 1; i < count; ++i) {
+		if (nodes[i] != nodes[i - 1] + 1) {
+			printf("  ==> ERROR: traverseBatch handed a span that is not contiguous\n");
+			break;
+		}
+	}
+	return TESTBASE_countSpansUntil(nodes, count, ctx);
+}
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+
+	TESTBASE_generateDataForTest();
+
+	// deque created just to have a reference to the operations
+	Deque *d = NULL;
+	d = DEQUE_create(1);
+	if (NULL == d) {
+		printf("\n create returned a null node in deque for ops");
+		return -1;
+	}
+	// deques to work with
+	Deque *deque_1 = NULL;
+	Deque *deque_2 = NULL;
+	deque_1 = DEQUE_create(kCapacityDeque1);
+	if (NULL == deque_1) {
+		printf("\n create returned a null node in deque_1\n");
+		return -1;
+	}
+	deque_2 = DEQUE_create(kCapacityDeque2);
+	if (NULL == deque_2) {
+		printf("\n create returned a null node in deque_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Mem Node: %zu\n", sizeof(MemoryNode));
+	printf("  + deque_1: %zu\n", sizeof(*deque_1));
+	printf("	+ block: %zu\n", sizeof(MemoryNode) * kDequeBlockSize);
+
+	printf("\n\n# Test Insert\n");
+	// both ends cross several blocks and force the map to grow
+	for (u16 i = 0; i < 40; ++i) {
+		error_type = d->ops_->insertLast(deque_1, TESTBASE_generateDataIntegerAsString(40 + i), kMaxIntegerChars);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(deque_1, (u8 *)"insertLast deque_1", error_type);
+		error_type = d->ops_->insertFirst(deque_1, TESTBASE_generateDataIntegerAsString(39 - i), kMaxIntegerChars);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(deque_1, (u8 *)"insertFirst deque_1", error_type);
+	}
+	for (u16 i = 0; i < 80; ++i) {
+		data = d->ops_->at(deque_1, i);
+		if (NULL == data || (u16)atoi((char *)data) != i) {
+			printf("  ==> ERROR: at deque_1 (position %d)\n", i);
+			break;
+		}
+	}
+	error_type = d->ops_->insertAt(deque_1, TESTBASE_generateDataIntegerAsString(1000), kMaxIntegerChars, 10);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"insertAt deque_1 (position 10)", error_type);
+	error_type = d->ops_->insertAt(deque_1, TESTBASE_generateDataIntegerAsString(2000), kMaxIntegerChars, 70);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"insertAt deque_1 (position 70)", error_type);
+
+	printf("\n\n# Test Stable Address\n");
+	MemoryNode *middle = NULL;
+	data = d->ops_->at(deque_1, 41);
+	for (u16 i = 0; i < deque_1->map_size_ && NULL == middle; ++i) {
+		if (deque_1->blocks_[i] != NULL) {
+			for (u16 j = 0; j < kDequeBlockSize; ++j) {
+				if (deque_1->blocks_[i][j].data_ == data) {
+					middle = &deque_1->blocks_[i][j];
+				}
+			}
+		}
+	}
+	for (u16 i = 0; i < 16; ++i) {
+		d->ops_->insertFirst(deque_1, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+		d->ops_->insertLast(deque_1, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+	}
+	if (NULL == middle || middle->data_ != data)
+		printf("  ==> ERROR: insertFirst/insertLast moved an element of deque_1\n");
+
+	printf("\n\n# Test Extract\n");
+	for (u16 i = 0; i < 16; ++i) {
+		MM->free(d->ops_->extractFirst(deque_1));
+		MM->free(d->ops_->extractLast(deque_1));
+	}
+	data = d->ops_->extractAt(deque_1, 10);
+	if (NULL == data || 0 != strcmp((char *)data, "1000"))
+		printf("  ==> ERROR: extractAt deque_1 (position 10) didn't return \"1000\"\n");
+	MM->free(data);
+	data = d->ops_->extractAt(deque_1, 69);
+	if (NULL == data || 0 != strcmp((char *)data, "2000"))
+		printf("  ==> ERROR: extractAt deque_1 (position 69) didn't return \"2000\"\n");
+	MM->free(data);
+	data = d->ops_->extractFirst(deque_1);
+	if (NULL == data || 0 != strcmp((char *)data, "0"))
+		printf("  ==> ERROR: extractFirst deque_1 didn't return \"0\"\n");
+	MM->free(data);
+	data = d->ops_->extractLast(deque_1);
+	if (NULL == data || 0 != strcmp((char *)data, "79"))
+		printf("  ==> ERROR: extractLast deque_1 didn't return \"79\"\n");
+	MM->free(data);
+
+	printf("\n\n# Test Length\n");
+	if (78 != d->ops_->length(deque_1))
+		printf("  ==> ERROR: length deque_1 is %d\n", d->ops_->length(deque_1));
+
+	printf("\n\n# Test Concat\n");
+	d->ops_->insertLast(deque_2, TestData.single_ptr_data_1, kSingleSizeData1);
+	TestData.single_ptr_data_1 = NULL;
+	d->ops_->insertLast(deque_2, TestData.single_ptr_data_2, kSingleSizeData2);
+	TestData.single_ptr_data_2 = NULL;
+	error_type = d->ops_->concat(deque_1, deque_2);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"concat deque_1 + deque_2", error_type);
+	if (80 != d->ops_->length(deque_1) || (kCapacityDeque1 + kCapacityDeque2) != d->ops_->capacity(deque_1))
+		printf("  ==> ERROR: concat deque_1 + deque_2 length %d\n", d->ops_->length(deque_1));
+	printf("deque_2:\n");
+	d->ops_->print(deque_2);
+
+	printf("\n\n# Test Resize\n");
+	error_type = d->ops_->resize(deque_1, 3);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"resize deque_1", error_type);
+	error_type = d->ops_->insertLast(deque_1, TestData.single_ptr_data_3, kSingleSizeData3);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"insertLast deque_1 (NOT VALID, full)", error_type);
+	printf("deque_1:\n");
+	d->ops_->print(deque_1);
+
+	printf("\n\n# Test Reset\n");
+	error_type = d->ops_->reset(deque_2);
+	TESTBASE_printFunctionResult(deque_2, (u8 *)"reset deque_2", error_type);
+	if (!d->ops_->isEmpty(deque_2))
+		printf("  ==> ERROR: deque_2 is not empty after reset\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = d->ops_->destroy(deque_2);
+	deque_2 = NULL;
+	TESTBASE_printFunctionResult(deque_2, (u8 *)"destroy deque_2", error_type);
+
+	MM->status();
+
+	printf("\n\n# Test TraverseEx\n");
+	// 3 elements in front of the first block of 16, then 40 more: spans of 3, 16, 16 and 8
+	Deque *deque_t = DEQUE_create(43);
+	for (u16 i = 0; i < 40; ++i) {
+		d->ops_->insertLast(deque_t, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+	}
+	for (u16 i = 0; i < 3; ++i) {
+		d->ops_->insertFirst(deque_t, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+	}
+	TraverseCounters counters = { 0, 5, 0 };
+	error_type = d->ops_->traverseEx(deque_t, TESTBASE_countUntil, &counters);
+	TESTBASE_printFunctionResult(deque_t, (u8 *)"traverseEx deque_t", error_type);
+	if (5 != counters.visited)
+		printf("  ==> ERROR: traverseEx deque_t visited %d elements instead of stopping at 5\n", counters.visited);
+	counters = (TraverseCounters){ 0, 0xFFFF, 0 };
+	d->ops_->traverseEx(deque_t, TESTBASE_countUntil, &counters);
+	if (43 != counters.visited)
+		printf("  ==> ERROR: traverseEx deque_t visited %d elements instead of 43\n", counters.visited);
+	counters = (TraverseCounters){ 0, 0xFFFF, 0 };
+	error_type = d->ops_->traverseBatch(deque_t, DEQUETEST_checkSpan, &counters);
+	TESTBASE_printFunctionResult(deque_t, (u8 *)"traverseBatch deque_t", error_type);
+	if (43 != counters.visited || 4 != counters.spans)
+		printf("  ==> ERROR: traverseBatch deque_t visited %d elements in %d spans\n", counters.visited, counters.spans);
+	counters = (TraverseCounters){ 0, 1, 0 };
+	error_type = d->ops_->traverseBatch(deque_t, DEQUETEST_checkSpan, &counters);
+	TESTBASE_printFunctionResult(deque_t, (u8 *)"traverseBatch deque_t", error_type);
+	if (1 != counters.spans || 3 != counters.visited)
+		printf("  ==> ERROR: traverseBatch deque_t didn't stop after the first span\n");
+	error_type = d->ops_->traverseEx(deque_t, NULL, NULL);
+	TESTBASE_printFunctionResult(deque_t, (u8 *)"traverseEx deque_t NULL (NOT VALID)", error_type);
+	error_type = d->ops_->traverseBatch(NULL, TESTBASE_countSpansUntil, &counters);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"traverseBatch NULL (NOT VALID)", error_type);
+	error_type = d->ops_->destroy(deque_t);
+	TESTBASE_printFunctionResult(deque_t, (u8 *)"destroy deque_t", error_type);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	deque_2 = DEQUE_create(0);
+	if (NULL != deque_2) {
+		printf("ERROR: trying to create deque_2 with 0 capacity\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Insert\n");
+	data = TestData.single_ptr_big_data;
+	error_type = d->ops_->insertFirst(deque_2, data, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(deque_2, (u8 *)"insertFirst deque_2 (NOT VALID)", error_type);
+	error_type = d->ops_->insertLast(deque_2, data, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(deque_2, (u8 *)"insertLast deque_2 (NOT VALID)", error_type);
+	error_type = d->ops_->insertAt(deque_2, data, kSingleSizeBigData, 1);
+	TESTBASE_printFunctionResult(deque_2, (u8 *)"insertAt deque_2 (NOT VALID)", error_type);
+
+	printf("\n\n# Test First\n");
+	data = d->ops_->first(deque_2);
+	if (NULL != data)
+		printf("ERROR: First in deque_2 is not NULL\n");
+	data = d->ops_->at(deque_2, 1);
+	if (NULL != data)
+		printf("ERROR: At in deque_2 is not NULL\n");
+	data = d->ops_->last(deque_2);
+	if (NULL != data)
+		printf("ERROR: Last in deque_2 is not NULL\n");
+
+	printf("\n\n# Test Extract\n");
+	data = d->ops_->extractFirst(deque_2);
+	if (NULL != data)
+		printf("ERROR: trying to extractFirst from a NULL deque\n");
+	data = d->ops_->extractAt(d, 0);
+	if (NULL != data)
+		printf("ERROR: trying to extractAt from an empty deque\n");
+
+	printf("\n\n# Test Concat\n");
+	error_type = d->ops_->concat(deque_1, deque_2);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"concat deque_1 + deque_2 (NOT VALID)", error_type);
+
+	printf("\n\n# Test Destroy\n");
+	error_type = d->ops_->destroy(deque_2);
+	TESTBASE_printFunctionResult(deque_2, (u8 *)"destroy deque_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = d->ops_->destroy(deque_1);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"destroy deque_1", error_type);
+	error_type = d->ops_->destroy(d);
+	TESTBASE_printFunctionResult(d, (u8 *)"destroy Deque Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,227 @@
+// test_elimination_stack.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for elimination stack ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#include "adt_hazard.h"
+#include "adt_elimination_stack.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kCapacityEliminationStack1 = 200;
+const u16 kCapacityEliminationStack2 = 3;
+// threads pushing and popping stack_1 at the same time
+#define kContentionThreads 8
+// push and pop pairs of every thread
+const u16 kContentionPairs = 5000;
+
+EliminationStack *shared_stack = NULL;
+// values popped by every thread, added up
+u32 popped_sum[kContentionThreads];
+
+// Pushes its index and pops, kContentionPairs times
+#ifdef _WIN32
+DWORD WINAPI PushPop(LPVOID param) {
+#else
+void* PushPop(void* param) {
+#endif
+	u32 *index = (u32 *)param;
+	for (u16 i = 0; i < kContentionPairs; ++i) {
+		shared_stack->ops_->push(shared_stack, index, sizeof(u32));
+		u32 *value = (u32 *)shared_stack->ops_->pop(shared_stack);
+		if (NULL != value) {
+			popped_sum[*index] += *value;
+		}
+	}
+	HAZARD_release();
+	return 0;
+}
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+
+	TESTBASE_generateDataForTest();
+
+	// stack created just to have a reference to the operations
+	EliminationStack *es = NULL;
+	es = ELIMINATIONSTACK_create(1);
+	if (NULL == es) {
+		printf("\n create returned a null node in stack for ops");
+		return -1;
+	}
+	// stacks to work with
+	EliminationStack *stack_1 = NULL;
+	EliminationStack *stack_2 = NULL;
+	stack_1 = ELIMINATIONSTACK_create(kCapacityEliminationStack1);
+	if (NULL == stack_1) {
+		printf("\n create returned a null node in stack_1\n");
+		return -1;
+	}
+	stack_2 = ELIMINATIONSTACK_create(kCapacityEliminationStack2);
+	if (NULL == stack_2) {
+		printf("\n create returned a null node in stack_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Mem Node: %zu\n", sizeof(MemoryNode));
+	printf("  + stack_1: %zu\n", sizeof(*stack_1));
+	printf("  + Hazard record: %zu\n", sizeof(HazardRecord));
+
+	printf("\n\n# Test Push\n");
+	for (u16 i = 0; i < 100; ++i) {
+		error_type = es->ops_->push(stack_1, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(stack_1, (u8 *)"push stack_1", error_type);
+	}
+	if (100 != es->ops_->length(stack_1))
+		printf("  ==> ERROR: length stack_1 is %d\n", es->ops_->length(stack_1));
+	error_type = es->ops_->push(stack_2, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2", error_type);
+	TestData.single_ptr_data_1 = NULL;
+	error_type = es->ops_->push(stack_2, TestData.single_ptr_data_2, kSingleSizeData2);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2", error_type);
+	TestData.single_ptr_data_2 = NULL;
+	error_type = es->ops_->push(stack_2, TestData.single_ptr_data_3, kSingleSizeData3);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2", error_type);
+	TestData.single_ptr_data_3 = NULL;
+	error_type = es->ops_->push(stack_2, TestData.single_ptr_data_4, kSingleSizeData4);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2 (NOT VALID, full)", error_type);
+	if (!es->ops_->isFull(stack_2))
+		printf("  ==> ERROR: stack_2 is not full\n");
+	printf("stack_2:\n");
+	es->ops_->print(stack_2);
+
+	printf("\n\n# Test Pop\n");
+	// last in, first out
+	for (s16 i = 99; i >= 0; --i) {
+		data = es->ops_->pop(stack_1);
+		if (NULL == data || (s16)atoi((char *)data) != i) {
+			printf("  ==> ERROR: pop stack_1 didn't return \"%d\"\n", i);
+			break;
+		}
+		MM->free(data);
+	}
+	data = es->ops_->pop(stack_1);
+	if (NULL != data)
+		printf("  ==> ERROR: pop from an empty stack_1 is not NULL\n");
+	if (!es->ops_->isEmpty(stack_1))
+		printf("  ==> ERROR: stack_1 is not empty\n");
+
+	printf("\n\n# Test Node Reuse\n");
+	// popped nodes are reclaimed by the thread and pushed again
+	for (u16 rep = 0; rep < 1000; ++rep) {
+		es->ops_->push(stack_1, TestData.single_ptr_big_data, kSingleSizeBigData);
+		if (TestData.single_ptr_big_data != es->ops_->pop(stack_1)) {
+			printf("  ==> ERROR: pop stack_1 didn't return the pushed data\n");
+			break;
+		}
+	}
+	if (!es->ops_->isEmpty(stack_1))
+		printf("  ==> ERROR: stack_1 is not empty after the reuse\n");
+	if (0 == HAZARD_acquire()->cache_length_)
+		printf("  ==> ERROR: no popped node was reclaimed\n");
+
+	printf("\n\n# Test Contention\n");
+	// every pair leaves the stack as it was, so everything pushed comes out
+	// again, from the top or straight from a push in the elimination array
+	shared_stack = stack_1;
+	u32 indices[kContentionThreads];
+	u32 expected_sum = 0;
+#ifdef _WIN32
+	HANDLE threads[kContentionThreads];
+#else
+	pthread_t threads[kContentionThreads];
+#endif
+	for (u32 t = 0; t < kContentionThreads; ++t) {
+		indices[t] = t;
+		popped_sum[t] = 0;
+		expected_sum += t * kContentionPairs;
+#ifdef _WIN32
+		threads[t] = CreateThread(NULL, 0, PushPop, &indices[t], 0, NULL);
+#else
+		pthread_create(&threads[t], NULL, PushPop, &indices[t]);
+#endif
+	}
+	u32 total_sum = 0;
+	for (u32 t = 0; t < kContentionThreads; ++t) {
+#ifdef _WIN32
+		WaitForSingleObject(threads[t], INFINITE);
+		CloseHandle(threads[t]);
+#else
+		pthread_join(threads[t], NULL);
+#endif
+		total_sum += popped_sum[t];
+	}
+	// a pop can find the stack empty while another thread's push is halfway,
+	// what is left behind is popped now
+	u32 *left = NULL;
+	while (NULL != (left = (u32 *)es->ops_->pop(stack_1))) {
+		total_sum += *left;
+	}
+	if (expected_sum != total_sum)
+		printf("  ==> ERROR: the threads popped values adding %u instead of %u\n", total_sum, expected_sum);
+	if (!es->ops_->isEmpty(stack_1) || 0 != es->ops_->length(stack_1))
+		printf("  ==> ERROR: stack_1 is not empty after the contention\n");
+	printf("Eliminated pairs: %u\n", es->ops_->eliminated(stack_1));
+
+	printf("\n\n# Test Destroy\n");
+	error_type = es->ops_->destroy(stack_2);
+	stack_2 = NULL;
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"destroy stack_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	stack_2 = ELIMINATIONSTACK_create(0);
+	if (NULL != stack_2) {
+		printf("ERROR: trying to create stack_2 with 0 capacity\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Push\n");
+	data = TestData.single_ptr_big_data;
+	error_type = es->ops_->push(stack_2, data, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2 (NOT VALID)", error_type);
+	error_type = es->ops_->push(stack_1, NULL, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(stack_1, (u8 *)"push stack_1 NULL data (NOT VALID)", error_type);
+	error_type = es->ops_->push(stack_1, data, 0);
+	TESTBASE_printFunctionResult(stack_1, (u8 *)"push stack_1 0 bytes (NOT VALID)", error_type);
+
+	printf("\n\n# Test Pop\n");
+	data = es->ops_->pop(stack_2);
+	if (NULL != data)
+		printf("ERROR: trying to pop from a NULL stack\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = es->ops_->destroy(stack_2);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"destroy stack_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = es->ops_->destroy(stack_1);
+	TESTBASE_printFunctionResult(stack_1, (u8 *)"destroy stack_1", error_type);
+	error_type = es->ops_->destroy(es);
+	TESTBASE_printFunctionResult(es, (u8 *)"destroy EliminationStack Operations", error_type);
+	HAZARD_release();
+	HAZARD_destroy();
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,263 @@
+// test_heap.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for heap ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_heap.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kCapacityHeap1 = 200;
+const u16 kCapacityHeap2 = 3;
+const u16 kHeapElements = 100;
+
+// Orders elements holding integers written as strings, lowest first
+s16 HEAPTEST_compareIntegers(MemoryNode *a, MemoryNode *b) {
+	s32 value_a = atoi((char *)a->ops_->data(a));
+	s32 value_b = atoi((char *)b->ops_->data(b));
+	return value_a < value_b ? -1 : (value_a > value_b ? 1 : 0);
+}
+
+// Pops every element of the heap checking that they come out in order
+void HEAPTEST_popInOrder(Heap *heap, u8 *name, u16 expected) {
+	s32 previous = -1;
+	u16 popped = 0;
+	void *data = NULL;
+	while (NULL != (data = heap->ops_->pop(heap))) {
+		s32 value = atoi((char *)data);
+		if (value < previous)
+			printf("  ==> ERROR: pop %s returned %d after %d\n", name, value, previous);
+		previous = value;
+		MM->free(data);
+		popped++;
+	}
+	if (expected != popped)
+		printf("  ==> ERROR: %d elements popped from %s instead of %d\n", popped, name, expected);
+}
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+
+	TESTBASE_generateDataForTest();
+
+	// heap created just to have a reference to the operations
+	Heap *hp = NULL;
+	hp = HEAP_createWithKeys(1, 2);
+	if (NULL == hp) {
+		printf("\n create returned a null node in heap for ops");
+		return -1;
+	}
+	// heaps to work with
+	Heap *heap_1 = NULL;
+	Heap *heap_2 = NULL;
+	Heap *heap_3 = NULL;
+	heap_1 = HEAP_createWithKeys(kCapacityHeap1, 2);
+	if (NULL == heap_1) {
+		printf("\n create returned a null node in heap_1\n");
+		return -1;
+	}
+	heap_2 = HEAP_createWithKeys(kCapacityHeap2, 4);
+	if (NULL == heap_2) {
+		printf("\n create returned a null node in heap_2\n");
+		return -1;
+	}
+	heap_3 = HEAP_create(kCapacityHeap1, 4, HEAPTEST_compareIntegers);
+	if (NULL == heap_3) {
+		printf("\n create returned a null node in heap_3\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Mem Node: %zu\n", sizeof(MemoryNode));
+	printf("  + heap_1: %zu\n", sizeof(*heap_1));
+
+	printf("\n\n# Test Push\n");
+	// keys are the values, pushed in a scrambled order
+	for (u16 i = 0; i < kHeapElements; ++i) {
+		u16 value = (i * 37) % kHeapElements;
+		error_type = hp->ops_->push(heap_1, TESTBASE_generateDataIntegerAsString(value), kMaxIntegerChars, value);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(heap_1, (u8 *)"push heap_1", error_type);
+		if (0 != hp->ops_->topKey(heap_1))
+			printf("  ==> ERROR: topKey heap_1 is %d\n", hp->ops_->topKey(heap_1));
+	}
+	if (kHeapElements != hp->ops_->length(heap_1))
+		printf("  ==> ERROR: length heap_1 is %d\n", hp->ops_->length(heap_1));
+	if (0 != atoi((char *)hp->ops_->top(heap_1)))
+		printf("  ==> ERROR: top heap_1 is not \"0\"\n");
+	error_type = hp->ops_->push(heap_2, TestData.single_ptr_data_1, kSingleSizeData1, 30);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"push heap_2", error_type);
+	TestData.single_ptr_data_1 = NULL;
+	error_type = hp->ops_->push(heap_2, TestData.single_ptr_data_2, kSingleSizeData2, 10);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"push heap_2", error_type);
+	TestData.single_ptr_data_2 = NULL;
+	error_type = hp->ops_->push(heap_2, TestData.single_ptr_data_3, kSingleSizeData3, 20);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"push heap_2", error_type);
+	TestData.single_ptr_data_3 = NULL;
+	error_type = hp->ops_->push(heap_2, TestData.single_ptr_data_4, kSingleSizeData4, 0);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"push heap_2 (NOT VALID, full)", error_type);
+	if (!hp->ops_->isFull(heap_2))
+		printf("  ==> ERROR: heap_2 is not full\n");
+	if (10 != hp->ops_->topKey(heap_2))
+		printf("  ==> ERROR: topKey heap_2 is %d\n", hp->ops_->topKey(heap_2));
+	printf("heap_2:\n");
+	hp->ops_->print(heap_2);
+
+	printf("\n\n# Test Pop\n");
+	// lowest key first
+	for (u16 i = 0; i < kHeapElements; ++i) {
+		data = hp->ops_->pop(heap_1);
+		if (NULL == data || atoi((char *)data) != i) {
+			printf("  ==> ERROR: pop heap_1 didn't return \"%d\"\n", i);
+			break;
+		}
+		MM->free(data);
+	}
+	data = hp->ops_->pop(heap_1);
+	if (NULL != data)
+		printf("  ==> ERROR: pop from an empty heap_1 is not NULL\n");
+	if (!hp->ops_->isEmpty(heap_1))
+		printf("  ==> ERROR: heap_1 is not empty\n");
+
+	printf("\n\n# Test Comparator\n");
+	for (u16 i = 0; i < kHeapElements; ++i) {
+		u16 value = (i * 61) % kHeapElements;
+		error_type = hp->ops_->push(heap_3, TESTBASE_generateDataIntegerAsString(value), kMaxIntegerChars, 0);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(heap_3, (u8 *)"push heap_3", error_type);
+	}
+	if (0 != atoi((char *)hp->ops_->top(heap_3)))
+		printf("  ==> ERROR: top heap_3 is not \"0\"\n");
+	if (0 != hp->ops_->topKey(heap_3))
+		printf("  ==> ERROR: topKey heap_3 uses a comparator and is not 0\n");
+	HEAPTEST_popInOrder(heap_3, (u8 *)"heap_3", kHeapElements);
+
+	printf("\n\n# Test Heapify\n");
+	{
+		MemoryNode *nodes = (MemoryNode *)MM->malloc(sizeof(MemoryNode) * kHeapElements);
+		s32 *keys = (s32 *)MM->malloc(sizeof(s32) * kHeapElements);
+		for (u16 i = 0; i < kHeapElements; ++i) {
+			// repeated values on purpose
+			u16 value = (kHeapElements - i) % 40;
+			MEMNODE_createLite(&nodes[i]);
+			nodes[i].ops_->setData(&nodes[i], TESTBASE_generateDataIntegerAsString(value), kMaxIntegerChars);
+			keys[i] = value;
+		}
+		// half pushed, half heapified on top of them
+		for (u16 i = 0; i < kHeapElements / 2; ++i) {
+			hp->ops_->push(heap_1, nodes[i].data_, nodes[i].size_, keys[i]);
+		}
+		error_type = hp->ops_->heapify(heap_1, &nodes[kHeapElements / 2], &keys[kHeapElements / 2], kHeapElements / 2);
+		TESTBASE_printFunctionResult(heap_1, (u8 *)"heapify heap_1", error_type);
+		if (kHeapElements != hp->ops_->length(heap_1))
+			printf("  ==> ERROR: length heap_1 is %d\n", hp->ops_->length(heap_1));
+		HEAPTEST_popInOrder(heap_1, (u8 *)"heap_1", kHeapElements);
+
+		for (u16 i = 0; i < kHeapElements; ++i) {
+			nodes[i].ops_->setData(&nodes[i], TESTBASE_generateDataIntegerAsString(keys[i]), kMaxIntegerChars);
+		}
+		error_type = hp->ops_->heapify(heap_3, nodes, NULL, kHeapElements);
+		TESTBASE_printFunctionResult(heap_3, (u8 *)"heapify heap_3", error_type);
+		HEAPTEST_popInOrder(heap_3, (u8 *)"heap_3", kHeapElements);
+
+		error_type = hp->ops_->heapify(heap_2, nodes, keys, kHeapElements);
+		TESTBASE_printFunctionResult(heap_2, (u8 *)"heapify heap_2 (NOT VALID, doesn't fit)", error_type);
+		MM->free(nodes);
+		MM->free(keys);
+	}
+
+	printf("\n\n# Test Resize\n");
+	for (u16 i = 0; i < 10; ++i) {
+		hp->ops_->push(heap_1, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars, i);
+	}
+	error_type = hp->ops_->resize(heap_1, 5);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"resize heap_1 to 5", error_type);
+	if (5 != hp->ops_->length(heap_1) || 5 != hp->ops_->capacity(heap_1))
+		printf("  ==> ERROR: heap_1 length %d capacity %d\n", hp->ops_->length(heap_1), hp->ops_->capacity(heap_1));
+	if (0 != hp->ops_->topKey(heap_1))
+		printf("  ==> ERROR: resize heap_1 lost the top\n");
+	HEAPTEST_popInOrder(heap_1, (u8 *)"heap_1", 5);
+	error_type = hp->ops_->resize(heap_1, kCapacityHeap1);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"resize heap_1 to the original capacity", error_type);
+
+	printf("\n\n# Test Reset\n");
+	error_type = hp->ops_->reset(heap_2);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"reset heap_2", error_type);
+	if (!hp->ops_->isEmpty(heap_2))
+		printf("  ==> ERROR: heap_2 is not empty\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = hp->ops_->destroy(heap_2);
+	heap_2 = NULL;
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"destroy heap_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	heap_2 = HEAP_createWithKeys(0, 2);
+	if (NULL != heap_2) {
+		printf("ERROR: trying to create heap_2 with 0 capacity\n");
+		return -1;
+	}
+	heap_2 = HEAP_createWithKeys(kCapacityHeap2, 3);
+	if (NULL != heap_2) {
+		printf("ERROR: trying to create heap_2 with arity 3\n");
+		return -1;
+	}
+	heap_2 = HEAP_create(kCapacityHeap2, 2, NULL);
+	if (NULL != heap_2) {
+		printf("ERROR: trying to create heap_2 without comparator\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Push\n");
+	data = TestData.single_ptr_big_data;
+	error_type = hp->ops_->push(heap_2, data, kSingleSizeBigData, 0);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"push heap_2 (NOT VALID)", error_type);
+	error_type = hp->ops_->push(heap_1, NULL, kSingleSizeBigData, 0);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"push heap_1 NULL data (NOT VALID)", error_type);
+	error_type = hp->ops_->push(heap_1, data, 0, 0);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"push heap_1 0 bytes (NOT VALID)", error_type);
+
+	printf("\n\n# Test Heapify\n");
+	error_type = hp->ops_->heapify(heap_1, NULL, NULL, 1);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"heapify heap_1 NULL nodes (NOT VALID)", error_type);
+
+	printf("\n\n# Test Pop\n");
+	data = hp->ops_->pop(heap_2);
+	if (NULL != data)
+		printf("ERROR: trying to pop from a NULL heap\n");
+
+	printf("\n\n# Test Resize\n");
+	error_type = hp->ops_->resize(heap_1, 0);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"resize heap_1 to 0 (NOT VALID)", error_type);
+
+	printf("\n\n# Test Destroy\n");
+	error_type = hp->ops_->destroy(heap_2);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"destroy heap_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = hp->ops_->destroy(heap_1);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"destroy heap_1", error_type);
+	error_type = hp->ops_->destroy(heap_3);
+	TESTBASE_printFunctionResult(heap_3, (u8 *)"destroy heap_3", error_type);
+	error_type = hp->ops_->destroy(hp);
+	TESTBASE_printFunctionResult(hp, (u8 *)"destroy Heap Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,211 @@
+// test_intrusive_dllist.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for intrusive double list ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_intrusive_dllist.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kCapacityIntrusiveDList1 = 20;
+const u16 kCapacityIntrusiveDList2 = 5;
+
+// Record of the caller, the list links it through link_
+typedef struct record_s {
+	u16 id_;
+	IntrusiveLink link_;
+} Record;
+
+Record records[10];
+u16 traversed_ids = 0;
+
+void RECORDS_sum(IntrusiveLink *link) {
+	traversed_ids += INTRUSIVE_ENTRY(link, Record, link_)->id_;
+}
+
+// Compares the ids of the records in the list with the expected ones
+void RECORDS_check(IntrusiveDList *list, const char *expected) {
+	char ids[64] = "";
+	char id[8];
+	for (u16 i = 0; i < list->ops_->length(list); ++i) {
+		sprintf(id, 0 == i ? "%d" : " %d", INTRUSIVE_ENTRY(list->ops_->at(list, i), Record, link_)->id_);
+		strcat(ids, id);
+	}
+	if (0 != strcmp(ids, expected))
+		printf("  ==> ERROR: records are \"%s\" instead of \"%s\"\n", ids, expected);
+}
+
+int main() {
+	s16 error_type = 0;
+	IntrusiveLink *link = NULL;
+
+	TESTBASE_generateDataForTest();
+	for (u16 i = 0; i < 10; ++i) {
+		records[i].id_ = i;
+	}
+
+	// list created just to have a reference to the operations
+	IntrusiveDList *il = NULL;
+	il = INTRUSIVEDLIST_create(1);
+	if (NULL == il) {
+		printf("\n create returned a null node in list for ops");
+		return -1;
+	}
+	// lists to work with
+	IntrusiveDList *list_1 = NULL;
+	IntrusiveDList *list_2 = NULL;
+	list_1 = INTRUSIVEDLIST_create(kCapacityIntrusiveDList1);
+	if (NULL == list_1) {
+		printf("\n create returned a null node in list_1\n");
+		return -1;
+	}
+	list_2 = INTRUSIVEDLIST_create(kCapacityIntrusiveDList2);
+	if (NULL == list_2) {
+		printf("\n create returned a null node in list_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Link: %zu\n", sizeof(IntrusiveLink));
+	printf("  + list_1: %zu\n", sizeof(*list_1));
+
+	printf("\n\n# Test Insert\n");
+	MM->status();
+	for (u16 i = 2; i < 8; ++i) {
+		error_type = il->ops_->insertLast(list_1, &records[i].link_);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(list_1, (u8 *)"insertLast list_1", error_type);
+	}
+	error_type = il->ops_->insertFirst(list_1, &records[1].link_);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertFirst list_1", error_type);
+	error_type = il->ops_->insertAt(list_1, &records[0].link_, 0);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertAt list_1 (position 0)", error_type);
+	error_type = il->ops_->insertAt(list_1, &records[9].link_, 100);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertAt list_1 (past the end)", error_type);
+	error_type = il->ops_->insertAt(list_1, &records[8].link_, 8);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertAt list_1 (position 8)", error_type);
+	// no node was allocated for the records
+	MM->status();
+	RECORDS_check(list_1, "0 1 2 3 4 5 6 7 8 9");
+	if (&records[9].link_ != il->ops_->last(list_1))
+		printf("  ==> ERROR: last list_1 is not record 9\n");
+
+	printf("\n\n# Test Traverse\n");
+	error_type = il->ops_->traverse(list_1, RECORDS_sum);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"traverse list_1", error_type);
+	if (45 != traversed_ids)
+		printf("  ==> ERROR: traverse list_1 visited ids adding %d\n", traversed_ids);
+
+	printf("\n\n# Test Extract\n");
+	link = il->ops_->extractAt(list_1, 7);
+	if (&records[7].link_ != link)
+		printf("  ==> ERROR: extractAt list_1 (position 7) is not record 7\n");
+	link = il->ops_->extractFirst(list_1);
+	if (&records[0].link_ != link)
+		printf("  ==> ERROR: extractFirst list_1 is not record 0\n");
+	link = il->ops_->extractLast(list_1);
+	if (&records[9].link_ != link || &records[8].link_ != il->ops_->last(list_1))
+		printf("  ==> ERROR: extractLast list_1 is not record 9\n");
+	RECORDS_check(list_1, "1 2 3 4 5 6 8");
+	il->ops_->insertLast(list_1, &records[9].link_);
+
+	printf("\n\n# Test Extract Record\n");
+	// a record at hand leaves the list without walking it
+	error_type = il->ops_->extract(list_1, &records[5].link_);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"extract list_1 (record 5)", error_type);
+	error_type = il->ops_->extract(list_1, &records[1].link_);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"extract list_1 (record 1)", error_type);
+	if (6 != il->ops_->length(list_1) || &records[2].link_ != il->ops_->first(list_1))
+		printf("  ==> ERROR: extract list_1 left %d records\n", il->ops_->length(list_1));
+	RECORDS_check(list_1, "2 3 4 6 8 9");
+	// a record extracted twice is refused, and the list is left untouched
+	error_type = il->ops_->extract(list_1, &records[5].link_);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"extract list_1 (record 5 again, NOT VALID)", error_type);
+	if (kErrorCode_ExtractionFailed != error_type)
+		printf("  ==> ERROR: extract list_1 took record 5 twice\n");
+	RECORDS_check(list_1, "2 3 4 6 8 9");
+	il->ops_->insertAt(list_1, &records[5].link_, 3);
+	il->ops_->insertFirst(list_1, &records[1].link_);
+	RECORDS_check(list_1, "1 2 3 4 5 6 8 9");
+
+	printf("\n\n# Test Concat\n");
+	il->ops_->insertLast(list_2, &records[7].link_);
+	error_type = il->ops_->concat(list_1, list_2);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"concat list_1 + list_2", error_type);
+	if (!il->ops_->isEmpty(list_2) || ((kCapacityIntrusiveDList1 + kCapacityIntrusiveDList2) != il->ops_->capacity(list_1)))
+		printf("  ==> ERROR: concat list_1 + list_2 didn't move the records\n");
+	error_type = il->ops_->concat(list_1, list_1);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"concat list_1 + list_1 (NOT VALID)", error_type);
+	printf("list_1:\n");
+	il->ops_->print(list_1);
+
+	printf("\n\n# Test Resize\n");
+	error_type = il->ops_->resize(list_1, 3);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"resize list_1", error_type);
+	error_type = il->ops_->insertLast(list_1, &records[9].link_);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertLast list_1 (NOT VALID, full)", error_type);
+	if (&records[3].link_ != il->ops_->last(list_1) || NULL != il->ops_->last(list_1)->next_)
+		printf("  ==> ERROR: resize list_1 didn't cut after record 3\n");
+
+	printf("\n\n# Test Reset\n");
+	error_type = il->ops_->reset(list_1);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"reset list_1", error_type);
+	if (!il->ops_->isEmpty(list_1) || NULL != records[1].link_.next_)
+		printf("  ==> ERROR: list_1 is not empty after reset\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = il->ops_->destroy(list_2);
+	list_2 = NULL;
+	TESTBASE_printFunctionResult(list_2, (u8 *)"destroy list_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	list_2 = INTRUSIVEDLIST_create(0);
+	if (NULL != list_2) {
+		printf("ERROR: trying to create list_2 with 0 capacity\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Insert\n");
+	error_type = il->ops_->insertFirst(list_2, &records[0].link_);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"insertFirst list_2 (NOT VALID)", error_type);
+	error_type = il->ops_->insertLast(list_1, NULL);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertLast list_1 NULL link (NOT VALID)", error_type);
+
+	printf("\n\n# Test Extract\n");
+	link = il->ops_->extractFirst(list_2);
+	if (NULL != link)
+		printf("ERROR: trying to extractFirst from a NULL list\n");
+	link = il->ops_->extractLast(list_1);
+	if (NULL != link)
+		printf("ERROR: trying to extractLast from an empty list\n");
+	error_type = il->ops_->extract(list_2, &records[0].link_);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"extract list_2 (NOT VALID)", error_type);
+
+	printf("\n\n# Test Destroy\n");
+	error_type = il->ops_->destroy(list_2);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"destroy list_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = il->ops_->destroy(list_1);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"destroy list_1", error_type);
+	error_type = il->ops_->destroy(il);
+	TESTBASE_printFunctionResult(il, (u8 *)"destroy IntrusiveDList Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
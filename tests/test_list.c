@@ -18,6 +18,12 @@ const u16 kCapacityList1 = 30;
 const u16 kCapacityList2 = 5;
 const u16 kCapacityList3 = 2;
 
+u16 traversed_bytes = 0;
+
+void NODES_sum(MemoryNode *node) {
+  traversed_bytes += node->ops_->size(node);
+}
+
 int main() {
   s16 error_type = 0;
 
@@ -345,6 +351,141 @@ int main() {
   printf("list_3:\n");
   ls->ops_->print(list_3);
 
+  printf("\n\n# Test Cursor\n");
+  List *list_4 = LIST_create(8);
+  ListCursor cursor;
+  ls->ops_->cursorBegin(list_4, &cursor);
+  // the whole list is built through the cursor: 0 1 2 3
+  for (u16 i = 0; i < 4; ++i) {
+    error_type = ls->ops_->cursorInsertBefore(&cursor, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+    TESTBASE_printFunctionResult(list_4, (u8 *)"cursorInsertBefore list_4", error_type);
+  }
+  ls->ops_->cursorBegin(list_4, &cursor);
+  ls->ops_->cursorNext(&cursor);
+  error_type = ls->ops_->cursorInsertAfter(&cursor, TESTBASE_generateDataIntegerAsString(9), kMaxIntegerChars);
+  TESTBASE_printFunctionResult(list_4, (u8 *)"cursorInsertAfter list_4 (position 1)", error_type);
+  data = ls->ops_->cursorNext(&cursor);
+  if (NULL == data || 0 != strcmp((char *)data, "9"))
+    printf("  ==> ERROR: cursorNext list_4 didn't reach \"9\"\n");
+  MM->free(ls->ops_->cursorErase(&cursor));
+  data = ls->ops_->cursorPrev(&cursor);
+  if (NULL == data || 0 != strcmp((char *)data, "1"))
+    printf("  ==> ERROR: cursorPrev list_4 didn't return \"1\"\n");
+  MM->free(ls->ops_->cursorErase(&cursor));
+  data = ls->ops_->cursorGet(&cursor);
+  if (NULL == data || 0 != strcmp((char *)data, "2"))
+    printf("  ==> ERROR: cursorErase list_4 didn't move to \"2\"\n");
+  if (3 != ls->ops_->length(list_4))
+    printf("  ==> ERROR: length list_4 is %d after the cursor edits\n", ls->ops_->length(list_4));
+  printf("list_4:\n");
+  ls->ops_->print(list_4);
+  error_type = ls->ops_->cursorBegin(NULL, &cursor);
+  TESTBASE_printFunctionResult(NULL, (u8 *)"cursorBegin NULL (NOT VALID)", error_type);
+  error_type = ls->ops_->destroy(list_4);
+  TESTBASE_printFunctionResult(list_4, (u8 *)"destroy list_4", error_type);
+
+  printf("\n\n# Test Spare Nodes\n");
+  List *list_5 = LIST_create(8);
+  ls->ops_->insertLast(list_5, TESTBASE_generateDataIntegerAsString(0), kMaxIntegerChars);
+  MemoryNode *spare_node = list_5->head_;
+  // queue-like churn keeps reusing the node retired by the extraction
+  for (u16 i = 1; i < 10; ++i) {
+    MM->free(ls->ops_->extractFirst(list_5));
+    ls->ops_->insertLast(list_5, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+  }
+  if (spare_node != list_5->head_ || 0 != list_5->spare_length_)
+    printf("  ==> ERROR: insertLast list_5 didn't reuse the spare node\n");
+  for (u16 i = 1; i < 8; ++i) {
+    ls->ops_->insertLast(list_5, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+  }
+  error_type = ls->ops_->reset(list_5);
+  TESTBASE_printFunctionResult(list_5, (u8 *)"reset list_5", error_type);
+  if (8 != list_5->spare_length_)
+    printf("  ==> ERROR: reset list_5 kept %d spare nodes\n", list_5->spare_length_);
+  error_type = ls->ops_->setSpareLimit(list_5, 2);
+  TESTBASE_printFunctionResult(list_5, (u8 *)"setSpareLimit list_5", error_type);
+  if (2 != list_5->spare_length_)
+    printf("  ==> ERROR: setSpareLimit list_5 kept %d spare nodes\n", list_5->spare_length_);
+  error_type = ls->ops_->trim(list_5);
+  TESTBASE_printFunctionResult(list_5, (u8 *)"trim list_5", error_type);
+  for (u16 i = 0; i < 3; ++i) {
+    ls->ops_->insertLast(list_5, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+  }
+  for (u16 i = 0; i < 3; ++i) {
+    MM->free(ls->ops_->extractLast(list_5));
+  }
+  if (2 != list_5->spare_length_)
+    printf("  ==> ERROR: list_5 holds %d spare nodes over its limit\n", list_5->spare_length_);
+  error_type = ls->ops_->trim(NULL);
+  TESTBASE_printFunctionResult(NULL, (u8 *)"trim NULL (NOT VALID)", error_type);
+  printf("list_5:\n");
+  ls->ops_->print(list_5);
+  error_type = ls->ops_->destroy(list_5);
+  TESTBASE_printFunctionResult(list_5, (u8 *)"destroy list_5", error_type);
+
+  printf("\n\n# Test Insert Many / Extract Many\n");
+  List *list_6 = LIST_create(5);
+  void *many[6];
+  u16 many_sizes[6];
+  for (u16 i = 0; i < 6; ++i) {
+    many[i] = TESTBASE_generateDataIntegerAsString(i);
+    many_sizes[i] = kMaxIntegerChars;
+  }
+  ls->ops_->insertLast(list_6, many[0], many_sizes[0]);
+  if (4 != ls->ops_->insertLastMany(list_6, &many[1], &many_sizes[1], 5))
+    printf("  ==> ERROR: insertLastMany list_6 went past its capacity\n");
+  MM->free(many[5]);
+  if (3 != ls->ops_->extractFirstMany(list_6, many, many_sizes, 3))
+    printf("  ==> ERROR: extractFirstMany list_6 didn't extract 3 elements\n");
+  for (u16 i = 0; i < 3; ++i) {
+    if (i != atoi((char *)many[i]))
+      printf("  ==> ERROR: extractFirstMany list_6 returned %s instead of %d\n", (char *)many[i], i);
+    MM->free(many[i]);
+  }
+  if (2 != ls->ops_->extractFirstMany(list_6, many, NULL, 6) || NULL != list_6->head_ || NULL != list_6->tail_)
+    printf("  ==> ERROR: extractFirstMany list_6 didn't leave it empty\n");
+  // the tail is rebuilt from an empty list with the spare nodes
+  if (2 != ls->ops_->insertLastMany(list_6, many, many_sizes, 2) || list_6->tail_->data_ != many[1])
+    printf("  ==> ERROR: insertLastMany into an empty list_6 failed\n");
+  if (0 != ls->ops_->insertLastMany(NULL, many, many_sizes, 2) || 0 != ls->ops_->extractFirstMany(list_6, NULL, NULL, 2))
+    printf("  ==> ERROR: insertLastMany and extractFirstMany took NULL pointers\n");
+  printf("list_6:\n");
+  ls->ops_->print(list_6);
+  error_type = ls->ops_->destroy(list_6);
+  TESTBASE_printFunctionResult(list_6, (u8 *)"destroy list_6", error_type);
+
+  printf("\n\n# Test Prefetch\n");
+  List *list_p = LIST_create(8);
+  for (u16 i = 0; i < 6; ++i) {
+    ls->ops_->insertLast(list_p, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+  }
+  // the walk must visit every node whether the distance is off, short or past the tail
+  u16 distances[] = { 0, 1, 6, 100 };
+  for (u16 i = 0; i < 4; ++i) {
+    error_type = ls->ops_->setPrefetchDistance(list_p, distances[i]);
+    TESTBASE_printFunctionResult(list_p, (u8 *)"setPrefetchDistance list_p", error_type);
+    traversed_bytes = 0;
+    error_type = ls->ops_->traverse(list_p, NODES_sum);
+    TESTBASE_printFunctionResult(list_p, (u8 *)"traverse list_p", error_type);
+    if (6 * kMaxIntegerChars != traversed_bytes)
+      printf("  ==> ERROR: traverse list_p with distance %d visited %d bytes\n", distances[i], traversed_bytes);
+  }
+  error_type = ls->ops_->setPrefetchDistance(NULL, 2);
+  TESTBASE_printFunctionResult(NULL, (u8 *)"setPrefetchDistance NULL (NOT VALID)", error_type);
+  ls->ops_->setPrefetchDistance(list_p, 2);
+  List *list_q = LIST_create(16);
+  ls->ops_->insertLast(list_q, TESTBASE_generateDataIntegerAsString(9), kMaxIntegerChars);
+  error_type = ls->ops_->concat(list_q, list_p);
+  TESTBASE_printFunctionResult(list_q, (u8 *)"concat list_q list_p", error_type);
+  if (7 != ls->ops_->length(list_q))
+    printf("  ==> ERROR: concat list_q holds %d elements\n", ls->ops_->length(list_q));
+  error_type = ls->ops_->reset(list_p);
+  TESTBASE_printFunctionResult(list_p, (u8 *)"reset list_p", error_type);
+  error_type = ls->ops_->destroy(list_p);
+  TESTBASE_printFunctionResult(list_p, (u8 *)"destroy list_p", error_type);
+  error_type = ls->ops_->destroy(list_q);
+  TESTBASE_printFunctionResult(list_q, (u8 *)"destroy list_q", error_type);
+
   printf("\n\n# Test Resize\n");
   printf("\t list_1 resize\n");
   error_type = ls->ops_->resize(list_1, 3);
@@ -422,6 +563,34 @@ int main() {
   TESTBASE_printFunctionResult(list_3, (u8 *)"destroy list_3 (NOT VALID)", error_type);
 
 
+  printf("\n\n# Test TraverseEx\n");
+  List *list_t = LIST_create(40);
+  for (u16 i = 0; i < 40; ++i) {
+    ls->ops_->insertLast(list_t, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+  }
+  TraverseCounters counters = { 0, 3, 0 };
+  error_type = ls->ops_->traverseEx(list_t, TESTBASE_countUntil, &counters);
+  TESTBASE_printFunctionResult(list_t, (u8 *)"traverseEx list_t", error_type);
+  if (3 != counters.visited)
+    printf("  ==> ERROR: traverseEx list_t visited %d elements instead of stopping at 3\n", counters.visited);
+  counters = (TraverseCounters){ 0, 0xFFFF, 0 };
+  error_type = ls->ops_->traverseBatch(list_t, TESTBASE_countSpansUntil, &counters);
+  TESTBASE_printFunctionResult(list_t, (u8 *)"traverseBatch list_t", error_type);
+  if (40 != counters.visited || 2 != counters.spans)
+    printf("  ==> ERROR: traverseBatch list_t visited %d elements in %d spans\n", counters.visited, counters.spans);
+  counters = (TraverseCounters){ 0, 1, 0 };
+  error_type = ls->ops_->traverseBatch(list_t, TESTBASE_countSpansUntil, &counters);
+  TESTBASE_printFunctionResult(list_t, (u8 *)"traverseBatch list_t", error_type);
+  if (1 != counters.spans)
+    printf("  ==> ERROR: traverseBatch list_t didn't stop after the first span\n");
+  error_type = ls->ops_->traverseEx(list_t, NULL, NULL);
+  TESTBASE_printFunctionResult(list_t, (u8 *)"traverseEx list_t NULL (NOT VALID)", error_type);
+  error_type = ls->ops_->traverseBatch(NULL, TESTBASE_countSpansUntil, &counters);
+  TESTBASE_printFunctionResult(NULL, (u8 *)"traverseBatch NULL (NOT VALID)", error_type);
+  error_type = ls->ops_->destroy(list_t);
+  TESTBASE_printFunctionResult(list_t, (u8 *)"destroy list_t", error_type);
+
+
   // Work is done, clean the system
   error_type = ls->ops_->destroy(list_1);
   TESTBASE_printFunctionResult(list_1, (u8 *)"destroy list_1", error_type);
@@ -0,0 +1,267 @@
+// test_lockfree_queue.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for lock-free queue ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#include "adt_atomic.h"
+#include "adt_hazard.h"
+#include "adt_lockfree_queue.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kCapacityLockFreeQueue1 = 200;
+const u16 kCapacityLockFreeQueue2 = 3;
+// threads enqueueing to and dequeueing from queue_1 at the same time
+#define kProducerThreads 4
+#define kConsumerThreads 4
+// values enqueued by every producer
+#define kProducerValues 5000
+
+LockFreeQueue *shared_queue = NULL;
+// value i is i, every producer enqueues its own run of kProducerValues
+u32 produced_values[kProducerThreads * kProducerValues];
+// values dequeued by all the consumers together
+volatile u32 consumed_values = 0;
+// values dequeued by every consumer, counted and added up
+u32 dequeued_count[kConsumerThreads];
+u32 dequeued_sum[kConsumerThreads];
+// values every consumer got before a smaller one of the same producer
+u32 dequeued_unordered[kConsumerThreads];
+
+// Enqueues its run of values, again and again while the queue is full
+#ifdef _WIN32
+DWORD WINAPI Producer(LPVOID param) {
+#else
+void* Producer(void* param) {
+#endif
+	u32 *values = &produced_values[*(u32 *)param * kProducerValues];
+	for (u32 i = 0; i < kProducerValues; ++i) {
+		while (kErrorCode_Ok != shared_queue->ops_->enqueue(shared_queue, &values[i], sizeof(u32))) {
+			// full, a consumer makes room
+		}
+	}
+	HAZARD_release();
+	return 0;
+}
+
+// Dequeues until every produced value has been dequeued by some consumer. The
+// values of one producer come out in the order they went in
+#ifdef _WIN32
+DWORD WINAPI Consumer(LPVOID param) {
+#else
+void* Consumer(void* param) {
+#endif
+	u32 index = *(u32 *)param;
+	u32 next_value[kProducerThreads];
+	for (u32 p = 0; p < kProducerThreads; ++p) {
+		next_value[p] = p * kProducerValues;
+	}
+	while (kProducerThreads * kProducerValues != ATOMIC_loadU32(&consumed_values)) {
+		u32 *value = (u32 *)shared_queue->ops_->dequeue(shared_queue);
+		if (NULL != value) {
+			u32 producer = *value / kProducerValues;
+			if (*value < next_value[producer]) {
+				dequeued_unordered[index]++;
+			}
+			next_value[producer] = *value + 1;
+			dequeued_count[index]++;
+			dequeued_sum[index] += *value;
+			ATOMIC_addU32(&consumed_values, 1);
+		}
+	}
+	HAZARD_release();
+	return 0;
+}
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+
+	TESTBASE_generateDataForTest();
+
+	// queue created just to have a reference to the operations
+	LockFreeQueue *lq = NULL;
+	lq = LOCKFREEQUEUE_create(1);
+	if (NULL == lq) {
+		printf("\n create returned a null node in queue for ops");
+		return -1;
+	}
+	// queues to work with
+	LockFreeQueue *queue_1 = NULL;
+	LockFreeQueue *queue_2 = NULL;
+	queue_1 = LOCKFREEQUEUE_create(kCapacityLockFreeQueue1);
+	if (NULL == queue_1) {
+		printf("\n create returned a null node in queue_1\n");
+		return -1;
+	}
+	queue_2 = LOCKFREEQUEUE_create(kCapacityLockFreeQueue2);
+	if (NULL == queue_2) {
+		printf("\n create returned a null node in queue_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Mem Node: %zu\n", sizeof(MemoryNode));
+	printf("  + queue_1: %zu\n", sizeof(*queue_1));
+	printf("  + Hazard record: %zu\n", sizeof(HazardRecord));
+
+	printf("\n\n# Test Enqueue\n");
+	for (u16 i = 0; i < 100; ++i) {
+		error_type = lq->ops_->enqueue(queue_1, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(queue_1, (u8 *)"enqueue queue_1", error_type);
+	}
+	if (100 != lq->ops_->length(queue_1))
+		printf("  ==> ERROR: length queue_1 is %d\n", lq->ops_->length(queue_1));
+	error_type = lq->ops_->enqueue(queue_2, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"enqueue queue_2", error_type);
+	TestData.single_ptr_data_1 = NULL;
+	error_type = lq->ops_->enqueue(queue_2, TestData.single_ptr_data_2, kSingleSizeData2);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"enqueue queue_2", error_type);
+	TestData.single_ptr_data_2 = NULL;
+	error_type = lq->ops_->enqueue(queue_2, TestData.single_ptr_data_3, kSingleSizeData3);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"enqueue queue_2", error_type);
+	TestData.single_ptr_data_3 = NULL;
+	error_type = lq->ops_->enqueue(queue_2, TestData.single_ptr_data_4, kSingleSizeData4);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"enqueue queue_2 (NOT VALID, full)", error_type);
+	if (!lq->ops_->isFull(queue_2))
+		printf("  ==> ERROR: queue_2 is not full\n");
+	printf("queue_2:\n");
+	lq->ops_->print(queue_2);
+
+	printf("\n\n# Test Dequeue\n");
+	// first in, first out
+	for (s16 i = 0; i < 100; ++i) {
+		data = lq->ops_->dequeue(queue_1);
+		if (NULL == data || (s16)atoi((char *)data) != i) {
+			printf("  ==> ERROR: dequeue queue_1 didn't return \"%d\"\n", i);
+			break;
+		}
+		MM->free(data);
+	}
+	data = lq->ops_->dequeue(queue_1);
+	if (NULL != data)
+		printf("  ==> ERROR: dequeue from an empty queue_1 is not NULL\n");
+	if (!lq->ops_->isEmpty(queue_1))
+		printf("  ==> ERROR: queue_1 is not empty\n");
+
+	printf("\n\n# Test Node Reuse\n");
+	// dequeued nodes are reclaimed by the thread and enqueued again
+	for (u16 rep = 0; rep < 1000; ++rep) {
+		lq->ops_->enqueue(queue_1, TestData.single_ptr_big_data, kSingleSizeBigData);
+		if (TestData.single_ptr_big_data != lq->ops_->dequeue(queue_1)) {
+			printf("  ==> ERROR: dequeue queue_1 didn't return the enqueued data\n");
+			break;
+		}
+	}
+	if (!lq->ops_->isEmpty(queue_1))
+		printf("  ==> ERROR: queue_1 is not empty after the reuse\n");
+	if (0 == HAZARD_acquire()->cache_length_)
+		printf("  ==> ERROR: no dequeued node was reclaimed\n");
+
+	printf("\n\n# Test Producers and Consumers\n");
+	// queue_1 is full most of the time, every value enqueued is dequeued exactly once
+	shared_queue = queue_1;
+	u32 expected_sum = 0;
+	for (u32 i = 0; i < kProducerThreads * kProducerValues; ++i) {
+		produced_values[i] = i;
+		expected_sum += i;
+	}
+	u32 indices[kProducerThreads + kConsumerThreads];
+#ifdef _WIN32
+	HANDLE threads[kProducerThreads + kConsumerThreads];
+#else
+	pthread_t threads[kProducerThreads + kConsumerThreads];
+#endif
+	for (u32 t = 0; t < kProducerThreads + kConsumerThreads; ++t) {
+		// the consumers are indexed from 0 too
+		indices[t] = t < kProducerThreads ? t : t - kProducerThreads;
+#ifdef _WIN32
+		threads[t] = CreateThread(NULL, 0, t < kProducerThreads ? Producer : Consumer, &indices[t], 0, NULL);
+#else
+		pthread_create(&threads[t], NULL, t < kProducerThreads ? Producer : Consumer, &indices[t]);
+#endif
+	}
+	for (u32 t = 0; t < kProducerThreads + kConsumerThreads; ++t) {
+#ifdef _WIN32
+		WaitForSingleObject(threads[t], INFINITE);
+		CloseHandle(threads[t]);
+#else
+		pthread_join(threads[t], NULL);
+#endif
+	}
+	u32 total_count = 0;
+	u32 total_sum = 0;
+	u32 total_unordered = 0;
+	for (u32 c = 0; c < kConsumerThreads; ++c) {
+		total_count += dequeued_count[c];
+		total_sum += dequeued_sum[c];
+		total_unordered += dequeued_unordered[c];
+	}
+	if (kProducerThreads * kProducerValues != total_count || expected_sum != total_sum)
+		printf("  ==> ERROR: the consumers dequeued %u values adding %u instead of %u adding %u\n",
+			total_count, total_sum, kProducerThreads * kProducerValues, expected_sum);
+	if (0 != total_unordered)
+		printf("  ==> ERROR: %u values were dequeued before older ones of the same producer\n", total_unordered);
+	if (!lq->ops_->isEmpty(queue_1) || 0 != lq->ops_->length(queue_1))
+		printf("  ==> ERROR: queue_1 is not empty after the producers and consumers\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = lq->ops_->destroy(queue_2);
+	queue_2 = NULL;
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"destroy queue_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	queue_2 = LOCKFREEQUEUE_create(0);
+	if (NULL != queue_2) {
+		printf("ERROR: trying to create queue_2 with 0 capacity\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Enqueue\n");
+	data = TestData.single_ptr_big_data;
+	error_type = lq->ops_->enqueue(queue_2, data, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"enqueue queue_2 (NOT VALID)", error_type);
+	error_type = lq->ops_->enqueue(queue_1, NULL, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(queue_1, (u8 *)"enqueue queue_1 NULL data (NOT VALID)", error_type);
+	error_type = lq->ops_->enqueue(queue_1, data, 0);
+	TESTBASE_printFunctionResult(queue_1, (u8 *)"enqueue queue_1 0 bytes (NOT VALID)", error_type);
+
+	printf("\n\n# Test Dequeue\n");
+	data = lq->ops_->dequeue(queue_2);
+	if (NULL != data)
+		printf("ERROR: trying to dequeue from a NULL queue\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = lq->ops_->destroy(queue_2);
+	TESTBASE_printFunctionResult(queue_2, (u8 *)"destroy queue_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = lq->ops_->destroy(queue_1);
+	TESTBASE_printFunctionResult(queue_1, (u8 *)"destroy queue_1", error_type);
+	error_type = lq->ops_->destroy(lq);
+	TESTBASE_printFunctionResult(lq, (u8 *)"destroy LockFreeQueue Operations", error_type);
+	HAZARD_release();
+	HAZARD_destroy();
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,251 @@
+// test_lockfree_stack.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for lock-free stack ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#include "adt_atomic.h"
+#include "adt_hazard.h"
+#include "adt_lockfree_stack.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kCapacityLockFreeStack1 = 200;
+const u16 kCapacityLockFreeStack2 = 3;
+// threads pushing to and popping from stack_1 at the same time
+#define kProducerThreads 4
+#define kConsumerThreads 4
+// values pushed by every producer
+#define kProducerValues 5000
+
+LockFreeStack *shared_stack = NULL;
+// value i is i, every producer pushes its own run of kProducerValues
+u32 produced_values[kProducerThreads * kProducerValues];
+// values popped by all the consumers together
+volatile u32 consumed_values = 0;
+// values popped by every consumer, counted and added up
+u32 popped_count[kConsumerThreads];
+u32 popped_sum[kConsumerThreads];
+
+// Pushes its run of values, again and again while the stack is full
+#ifdef _WIN32
+DWORD WINAPI Producer(LPVOID param) {
+#else
+void* Producer(void* param) {
+#endif
+	u32 *values = &produced_values[*(u32 *)param * kProducerValues];
+	for (u32 i = 0; i < kProducerValues; ++i) {
+		while (kErrorCode_Ok != shared_stack->ops_->push(shared_stack, &values[i], sizeof(u32))) {
+			// full, a consumer makes room
+		}
+	}
+	HAZARD_release();
+	return 0;
+}
+
+// Pops until every produced value has been popped by some consumer
+#ifdef _WIN32
+DWORD WINAPI Consumer(LPVOID param) {
+#else
+void* Consumer(void* param) {
+#endif
+	u32 index = *(u32 *)param;
+	while (kProducerThreads * kProducerValues != ATOMIC_loadU32(&consumed_values)) {
+		u32 *value = (u32 *)shared_stack->ops_->pop(shared_stack);
+		if (NULL != value) {
+			popped_count[index]++;
+			popped_sum[index] += *value;
+			ATOMIC_addU32(&consumed_values, 1);
+		}
+	}
+	HAZARD_release();
+	return 0;
+}
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+
+	TESTBASE_generateDataForTest();
+
+	// stack created just to have a reference to the operations
+	LockFreeStack *ls = NULL;
+	ls = LOCKFREESTACK_create(1);
+	if (NULL == ls) {
+		printf("\n create returned a null node in stack for ops");
+		return -1;
+	}
+	// stacks to work with
+	LockFreeStack *stack_1 = NULL;
+	LockFreeStack *stack_2 = NULL;
+	stack_1 = LOCKFREESTACK_create(kCapacityLockFreeStack1);
+	if (NULL == stack_1) {
+		printf("\n create returned a null node in stack_1\n");
+		return -1;
+	}
+	stack_2 = LOCKFREESTACK_create(kCapacityLockFreeStack2);
+	if (NULL == stack_2) {
+		printf("\n create returned a null node in stack_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Mem Node: %zu\n", sizeof(MemoryNode));
+	printf("  + stack_1: %zu\n", sizeof(*stack_1));
+	printf("  + Hazard record: %zu\n", sizeof(HazardRecord));
+
+	printf("\n\n# Test Push\n");
+	for (u16 i = 0; i < 100; ++i) {
+		error_type = ls->ops_->push(stack_1, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(stack_1, (u8 *)"push stack_1", error_type);
+	}
+	if (100 != ls->ops_->length(stack_1))
+		printf("  ==> ERROR: length stack_1 is %d\n", ls->ops_->length(stack_1));
+	error_type = ls->ops_->push(stack_2, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2", error_type);
+	TestData.single_ptr_data_1 = NULL;
+	error_type = ls->ops_->push(stack_2, TestData.single_ptr_data_2, kSingleSizeData2);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2", error_type);
+	TestData.single_ptr_data_2 = NULL;
+	error_type = ls->ops_->push(stack_2, TestData.single_ptr_data_3, kSingleSizeData3);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2", error_type);
+	TestData.single_ptr_data_3 = NULL;
+	error_type = ls->ops_->push(stack_2, TestData.single_ptr_data_4, kSingleSizeData4);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2 (NOT VALID, full)", error_type);
+	if (!ls->ops_->isFull(stack_2))
+		printf("  ==> ERROR: stack_2 is not full\n");
+	printf("stack_2:\n");
+	ls->ops_->print(stack_2);
+
+	printf("\n\n# Test Pop\n");
+	// last in, first out
+	for (s16 i = 99; i >= 0; --i) {
+		data = ls->ops_->pop(stack_1);
+		if (NULL == data || (s16)atoi((char *)data) != i) {
+			printf("  ==> ERROR: pop stack_1 didn't return \"%d\"\n", i);
+			break;
+		}
+		MM->free(data);
+	}
+	data = ls->ops_->pop(stack_1);
+	if (NULL != data)
+		printf("  ==> ERROR: pop from an empty stack_1 is not NULL\n");
+	if (!ls->ops_->isEmpty(stack_1))
+		printf("  ==> ERROR: stack_1 is not empty\n");
+
+	printf("\n\n# Test Node Reuse\n");
+	// popped nodes are reclaimed by the thread and pushed again
+	for (u16 rep = 0; rep < 1000; ++rep) {
+		ls->ops_->push(stack_1, TestData.single_ptr_big_data, kSingleSizeBigData);
+		if (TestData.single_ptr_big_data != ls->ops_->pop(stack_1)) {
+			printf("  ==> ERROR: pop stack_1 didn't return the pushed data\n");
+			break;
+		}
+	}
+	if (!ls->ops_->isEmpty(stack_1))
+		printf("  ==> ERROR: stack_1 is not empty after the reuse\n");
+	if (0 == HAZARD_acquire()->cache_length_)
+		printf("  ==> ERROR: no popped node was reclaimed\n");
+
+	printf("\n\n# Test Producers and Consumers\n");
+	// stack_1 is full most of the time, every value pushed is popped exactly once
+	shared_stack = stack_1;
+	u32 expected_sum = 0;
+	for (u32 i = 0; i < kProducerThreads * kProducerValues; ++i) {
+		produced_values[i] = i;
+		expected_sum += i;
+	}
+	u32 indices[kProducerThreads + kConsumerThreads];
+#ifdef _WIN32
+	HANDLE threads[kProducerThreads + kConsumerThreads];
+#else
+	pthread_t threads[kProducerThreads + kConsumerThreads];
+#endif
+	for (u32 t = 0; t < kProducerThreads + kConsumerThreads; ++t) {
+		// the consumers are indexed from 0 too
+		indices[t] = t < kProducerThreads ? t : t - kProducerThreads;
+#ifdef _WIN32
+		threads[t] = CreateThread(NULL, 0, t < kProducerThreads ? Producer : Consumer, &indices[t], 0, NULL);
+#else
+		pthread_create(&threads[t], NULL, t < kProducerThreads ? Producer : Consumer, &indices[t]);
+#endif
+	}
+	for (u32 t = 0; t < kProducerThreads + kConsumerThreads; ++t) {
+#ifdef _WIN32
+		WaitForSingleObject(threads[t], INFINITE);
+		CloseHandle(threads[t]);
+#else
+		pthread_join(threads[t], NULL);
+#endif
+	}
+	u32 total_count = 0;
+	u32 total_sum = 0;
+	for (u32 c = 0; c < kConsumerThreads; ++c) {
+		total_count += popped_count[c];
+		total_sum += popped_sum[c];
+	}
+	if (kProducerThreads * kProducerValues != total_count || expected_sum != total_sum)
+		printf("  ==> ERROR: the consumers popped %u values adding %u instead of %u adding %u\n",
+			total_count, total_sum, kProducerThreads * kProducerValues, expected_sum);
+	if (!ls->ops_->isEmpty(stack_1) || 0 != ls->ops_->length(stack_1))
+		printf("  ==> ERROR: stack_1 is not empty after the producers and consumers\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = ls->ops_->destroy(stack_2);
+	stack_2 = NULL;
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"destroy stack_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	stack_2 = LOCKFREESTACK_create(0);
+	if (NULL != stack_2) {
+		printf("ERROR: trying to create stack_2 with 0 capacity\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Push\n");
+	data = TestData.single_ptr_big_data;
+	error_type = ls->ops_->push(stack_2, data, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"push stack_2 (NOT VALID)", error_type);
+	error_type = ls->ops_->push(stack_1, NULL, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(stack_1, (u8 *)"push stack_1 NULL data (NOT VALID)", error_type);
+	error_type = ls->ops_->push(stack_1, data, 0);
+	TESTBASE_printFunctionResult(stack_1, (u8 *)"push stack_1 0 bytes (NOT VALID)", error_type);
+
+	printf("\n\n# Test Pop\n");
+	data = ls->ops_->pop(stack_2);
+	if (NULL != data)
+		printf("ERROR: trying to pop from a NULL stack\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = ls->ops_->destroy(stack_2);
+	TESTBASE_printFunctionResult(stack_2, (u8 *)"destroy stack_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = ls->ops_->destroy(stack_1);
+	TESTBASE_printFunctionResult(stack_1, (u8 *)"destroy stack_1", error_type);
+	error_type = ls->ops_->destroy(ls);
+	TESTBASE_printFunctionResult(ls, (u8 *)"destroy LockFreeStack Operations", error_type);
+	HAZARD_release();
+	HAZARD_destroy();
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -348,6 +348,46 @@ int main() {
 	printf("vector_3:\n");
 	v->ops_->print(vector_3);
 
+	printf("\n\n# Test Gap Buffer\n");
+	MovableHeadVector *text = MOVABLE_HEAD_VECTOR_createWithMode(8, kMovableHeadVectorMode_GapBuffer);
+	if (NULL == text) {
+		printf("\n create returned a null node in text\n");
+		return -1;
+	}
+	// typing at the cursor keeps the gap in place
+	for (u16 i = 0; i < 4; ++i) {
+		error_type = v->ops_->insertAt(text, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars, i);
+		TESTBASE_printFunctionResult(text, (u8 *)"insertAt text (cursor)", error_type);
+	}
+	error_type = v->ops_->insertAt(text, TESTBASE_generateDataIntegerAsString(9), kMaxIntegerChars, 1);
+	TESTBASE_printFunctionResult(text, (u8 *)"insertAt text (position 1)", error_type);
+	data = v->ops_->extractAt(text, 3);
+	if (NULL == data || 0 != strcmp((char *)data, "2"))
+		printf("  ==> ERROR: extractAt text (position 3) didn't return \"2\"\n");
+	MM->free(data);
+	printf("text:\n");
+	v->ops_->print(text);
+
+	printf("\n\n# Test Cursor\n");
+	error_type = v->ops_->moveCursor(text, 0);
+	TESTBASE_printFunctionResult(text, (u8 *)"moveCursor text (position 0)", error_type);
+	if (0 != v->ops_->cursor(text))
+		printf("  ==> ERROR: cursor in text is not 0\n");
+	data = v->ops_->first(text);
+	if (NULL == data || 0 != strcmp((char *)data, "0"))
+		printf("  ==> ERROR: first in text is not \"0\" after moving the cursor\n");
+	data = v->ops_->last(text);
+	if (NULL == data || 0 != strcmp((char *)data, "3"))
+		printf("  ==> ERROR: last in text is not \"3\" after moving the cursor\n");
+	error_type = v->ops_->moveCursor(vector_1, 0);
+	TESTBASE_printFunctionResult(vector_1, (u8 *)"moveCursor vector_1 (NOT VALID)", error_type);
+	error_type = v->ops_->resize(text, 3);
+	TESTBASE_printFunctionResult(text, (u8 *)"resize text", error_type);
+	if (3 != v->ops_->cursor(text))
+		printf("  ==> ERROR: cursor in text is not at the end after resize\n");
+	error_type = v->ops_->destroy(text);
+	TESTBASE_printFunctionResult(text, (u8 *)"destroy text", error_type);
+
 	printf("\n\n# Test Resize\n");
 	printf("\t vector_1 resize\n");
 	error_type = v->ops_->resize(vector_1, 3);
@@ -359,7 +399,7 @@ int main() {
 
 	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
 	printf("\n\n# Test Create\n");
-	vector_2 = VECTOR_create(0);
+	vector_2 = MOVABLE_HEAD_VECTOR_create(0);
 	if (NULL != vector_2) {
 		printf("ERROR: trying to create vector_2 with 0 capacity\n");
 		return -1;
@@ -431,6 +471,34 @@ int main() {
 	TESTBASE_printFunctionResult(vector_3, (u8 *)"destroy vector_3 (NOT VALID)", error_type);
 
 
+	printf("\n\n# Test TraverseEx\n");
+	MovableHeadVector *vector_t = MOVABLE_HEAD_VECTOR_create(40);
+	for (u16 i = 0; i < 40; ++i) {
+		v->ops_->insertLast(vector_t, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+	}
+	TraverseCounters counters = { 0, 3, 0 };
+	error_type = v->ops_->traverseEx(vector_t, TESTBASE_countUntil, &counters);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseEx vector_t", error_type);
+	if (3 != counters.visited)
+		printf("  ==> ERROR: traverseEx vector_t visited %d elements instead of stopping at 3\n", counters.visited);
+	counters = (TraverseCounters){ 0, 0xFFFF, 0 };
+	error_type = v->ops_->traverseBatch(vector_t, TESTBASE_countSpansUntil, &counters);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseBatch vector_t", error_type);
+	if (40 != counters.visited || 2 != counters.spans)
+		printf("  ==> ERROR: traverseBatch vector_t visited %d elements in %d spans\n", counters.visited, counters.spans);
+	counters = (TraverseCounters){ 0, 1, 0 };
+	error_type = v->ops_->traverseBatch(vector_t, TESTBASE_countSpansUntil, &counters);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseBatch vector_t", error_type);
+	if (1 != counters.spans)
+		printf("  ==> ERROR: traverseBatch vector_t didn't stop after the first span\n");
+	error_type = v->ops_->traverseEx(vector_t, NULL, NULL);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseEx vector_t NULL (NOT VALID)", error_type);
+	error_type = v->ops_->traverseBatch(NULL, TESTBASE_countSpansUntil, &counters);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"traverseBatch NULL (NOT VALID)", error_type);
+	error_type = v->ops_->destroy(vector_t);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"destroy vector_t", error_type);
+
+
 	// Work is done, clean the system
 	error_type = v->ops_->destroy(vector_1);
 	TESTBASE_printFunctionResult(vector_1, (u8 *)"destroy vector_1", error_type);
@@ -0,0 +1,247 @@
+// test_pairing_heap.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for pairing heap ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_pairing_heap.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kCapacityPairingHeap1 = 300;
+const u16 kCapacityPairingHeap2 = 3;
+const u16 kPairingHeapElements = 100;
+
+// Pops every element of the heap checking that they come out in order
+void PAIRINGHEAPTEST_popInOrder(PairingHeap *heap, u8 *name, u16 expected) {
+	s32 previous = -1;
+	u16 popped = 0;
+	void *data = NULL;
+	while (!heap->ops_->isEmpty(heap)) {
+		s32 key = heap->ops_->topKey(heap);
+		data = heap->ops_->pop(heap);
+		if (NULL == data || key < previous || key != atoi((char *)data))
+			printf("  ==> ERROR: pop %s returned key %d after %d\n", name, key, previous);
+		previous = key;
+		MM->free(data);
+		popped++;
+	}
+	if (expected != popped)
+		printf("  ==> ERROR: %d elements popped from %s instead of %d\n", popped, name, expected);
+}
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+	PairingHeapNode *handles[100];
+
+	TESTBASE_generateDataForTest();
+
+	// heap created just to have a reference to the operations
+	PairingHeap *ph = NULL;
+	ph = PAIRINGHEAP_create(1);
+	if (NULL == ph) {
+		printf("\n create returned a null node in heap for ops");
+		return -1;
+	}
+	// heaps to work with
+	PairingHeap *heap_1 = NULL;
+	PairingHeap *heap_2 = NULL;
+	PairingHeap *heap_3 = NULL;
+	heap_1 = PAIRINGHEAP_create(kCapacityPairingHeap1);
+	if (NULL == heap_1) {
+		printf("\n create returned a null node in heap_1\n");
+		return -1;
+	}
+	heap_2 = PAIRINGHEAP_create(kCapacityPairingHeap2);
+	if (NULL == heap_2) {
+		printf("\n create returned a null node in heap_2\n");
+		return -1;
+	}
+	heap_3 = PAIRINGHEAP_create(kCapacityPairingHeap1);
+	if (NULL == heap_3) {
+		printf("\n create returned a null node in heap_3\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Pairing Heap Node: %zu\n", sizeof(PairingHeapNode));
+	printf("  + Pairing Heap Block: %zu\n", sizeof(PairingHeapBlock));
+	printf("  + heap_1: %zu\n", sizeof(*heap_1));
+
+	printf("\n\n# Test Insert\n");
+	// keys are the values, inserted in a scrambled order
+	for (u16 i = 0; i < kPairingHeapElements; ++i) {
+		u16 value = (i * 37) % kPairingHeapElements;
+		error_type = ph->ops_->insert(heap_1, TESTBASE_generateDataIntegerAsString(value), kMaxIntegerChars, value, &handles[value]);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(heap_1, (u8 *)"insert heap_1", error_type);
+	}
+	if (kPairingHeapElements != ph->ops_->length(heap_1))
+		printf("  ==> ERROR: length heap_1 is %d\n", ph->ops_->length(heap_1));
+	if (0 != ph->ops_->topKey(heap_1) || 0 != atoi((char *)ph->ops_->top(heap_1)))
+		printf("  ==> ERROR: top heap_1 is not \"0\"\n");
+	error_type = ph->ops_->insert(heap_2, TestData.single_ptr_data_1, kSingleSizeData1, 30, NULL);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"insert heap_2", error_type);
+	TestData.single_ptr_data_1 = NULL;
+	error_type = ph->ops_->insert(heap_2, TestData.single_ptr_data_2, kSingleSizeData2, 10, NULL);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"insert heap_2", error_type);
+	TestData.single_ptr_data_2 = NULL;
+	error_type = ph->ops_->insert(heap_2, TestData.single_ptr_data_3, kSingleSizeData3, 20, NULL);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"insert heap_2", error_type);
+	TestData.single_ptr_data_3 = NULL;
+	error_type = ph->ops_->insert(heap_2, TestData.single_ptr_data_4, kSingleSizeData4, 0, NULL);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"insert heap_2 (NOT VALID, full)", error_type);
+	if (!ph->ops_->isFull(heap_2))
+		printf("  ==> ERROR: heap_2 is not full\n");
+	printf("heap_2:\n");
+	ph->ops_->print(heap_2);
+
+	printf("\n\n# Test Decrease Key\n");
+	// the element 99 goes to the top, raising a key is not allowed
+	error_type = ph->ops_->decreaseKey(heap_1, handles[99], -1);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"decreaseKey heap_1 99 to -1", error_type);
+	if (-1 != ph->ops_->topKey(heap_1) || 99 != atoi((char *)ph->ops_->top(heap_1)))
+		printf("  ==> ERROR: decreaseKey heap_1 didn't move 99 to the top\n");
+	error_type = ph->ops_->decreaseKey(heap_1, handles[0], 5);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"decreaseKey heap_1 0 to 5 (NOT VALID, greater)", error_type);
+	// pop once so there are children to cut, then lower every odd element
+	data = ph->ops_->pop(heap_1);
+	if (NULL == data || 99 != atoi((char *)data))
+		printf("  ==> ERROR: pop heap_1 didn't return \"99\"\n");
+	MM->free(data);
+	for (u16 i = 1; i < kPairingHeapElements - 1; i += 2) {
+		error_type = ph->ops_->decreaseKey(heap_1, handles[i], i - 100);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(heap_1, (u8 *)"decreaseKey heap_1", error_type);
+	}
+	// odd elements first, in order, then the even ones
+	for (u16 i = 1; i < kPairingHeapElements - 1; i += 2) {
+		if (i - 100 != ph->ops_->topKey(heap_1)) {
+			printf("  ==> ERROR: topKey heap_1 is %d instead of %d\n", ph->ops_->topKey(heap_1), i - 100);
+			break;
+		}
+		MM->free(ph->ops_->pop(heap_1));
+	}
+	if (0 != ph->ops_->topKey(heap_1))
+		printf("  ==> ERROR: topKey heap_1 is %d instead of 0\n", ph->ops_->topKey(heap_1));
+
+	printf("\n\n# Test Erase\n");
+	// the even elements are left, erase the multiples of 4 but 0 (the root)
+	for (u16 i = 4; i < kPairingHeapElements; i += 4) {
+		data = ph->ops_->erase(heap_1, handles[i]);
+		if (NULL == data || i != atoi((char *)data)) {
+			printf("  ==> ERROR: erase heap_1 didn't return \"%d\"\n", i);
+			break;
+		}
+		MM->free(data);
+	}
+	data = ph->ops_->erase(heap_1, handles[4]);
+	if (NULL != data)
+		printf("  ==> ERROR: erase heap_1 of an element that already left is not NULL\n");
+	data = ph->ops_->erase(heap_1, handles[0]);
+	if (NULL == data || 0 != atoi((char *)data))
+		printf("  ==> ERROR: erase heap_1 of the root didn't return \"0\"\n");
+	MM->free(data);
+	if (25 != ph->ops_->length(heap_1))
+		printf("  ==> ERROR: length heap_1 is %d\n", ph->ops_->length(heap_1));
+
+	printf("\n\n# Test Meld\n");
+	for (u16 i = 0; i < kPairingHeapElements; ++i) {
+		u16 value = (i * 61) % kPairingHeapElements + 1;
+		ph->ops_->insert(heap_3, TESTBASE_generateDataIntegerAsString(value), kMaxIntegerChars, value, &handles[i]);
+	}
+	error_type = ph->ops_->meld(heap_1, heap_3);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"meld heap_1 with heap_3", error_type);
+	if (125 != ph->ops_->length(heap_1) || !ph->ops_->isEmpty(heap_3))
+		printf("  ==> ERROR: meld heap_1 length %d heap_3 length %d\n", ph->ops_->length(heap_1), ph->ops_->length(heap_3));
+	// handles of heap_3 now belong to heap_1
+	error_type = ph->ops_->decreaseKey(heap_1, handles[50], -5);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"decreaseKey heap_1 of a melded element", error_type);
+	if (-5 != ph->ops_->topKey(heap_1))
+		printf("  ==> ERROR: topKey heap_1 is %d instead of -5\n", ph->ops_->topKey(heap_1));
+	data = ph->ops_->pop(heap_1);
+	MM->free(data);
+	PAIRINGHEAPTEST_popInOrder(heap_1, (u8 *)"heap_1", 124);
+	error_type = ph->ops_->meld(heap_2, heap_2);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"meld heap_2 with itself (NOT VALID)", error_type);
+	// heap_3 keeps working with a new pool
+	error_type = ph->ops_->insert(heap_3, TESTBASE_generateDataIntegerAsString(7), kMaxIntegerChars, 7, NULL);
+	TESTBASE_printFunctionResult(heap_3, (u8 *)"insert heap_3 after meld", error_type);
+	error_type = ph->ops_->meld(heap_2, heap_3);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"meld heap_2 with heap_3 (NOT VALID, doesn't fit)", error_type);
+
+	printf("\n\n# Test Reset\n");
+	error_type = ph->ops_->reset(heap_3);
+	TESTBASE_printFunctionResult(heap_3, (u8 *)"reset heap_3", error_type);
+	if (!ph->ops_->isEmpty(heap_3))
+		printf("  ==> ERROR: heap_3 is not empty\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = ph->ops_->destroy(heap_2);
+	heap_2 = NULL;
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"destroy heap_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	heap_2 = PAIRINGHEAP_create(0);
+	if (NULL != heap_2) {
+		printf("ERROR: trying to create heap_2 with 0 capacity\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Insert\n");
+	data = TestData.single_ptr_big_data;
+	error_type = ph->ops_->insert(heap_2, data, kSingleSizeBigData, 0, NULL);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"insert heap_2 (NOT VALID)", error_type);
+	error_type = ph->ops_->insert(heap_1, NULL, kSingleSizeBigData, 0, NULL);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"insert heap_1 NULL data (NOT VALID)", error_type);
+	error_type = ph->ops_->insert(heap_1, data, 0, 0, NULL);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"insert heap_1 0 bytes (NOT VALID)", error_type);
+
+	printf("\n\n# Test Decrease Key\n");
+	error_type = ph->ops_->decreaseKey(heap_1, NULL, 0);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"decreaseKey heap_1 NULL handle (NOT VALID)", error_type);
+	error_type = ph->ops_->decreaseKey(heap_2, handles[0], 0);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"decreaseKey heap_2 (NOT VALID)", error_type);
+
+	printf("\n\n# Test Meld\n");
+	error_type = ph->ops_->meld(heap_1, heap_2);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"meld heap_1 with NULL (NOT VALID)", error_type);
+
+	printf("\n\n# Test Pop\n");
+	data = ph->ops_->pop(heap_2);
+	if (NULL != data)
+		printf("ERROR: trying to pop from a NULL heap\n");
+	data = ph->ops_->erase(heap_1, NULL);
+	if (NULL != data)
+		printf("ERROR: trying to erase a NULL handle\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = ph->ops_->destroy(heap_2);
+	TESTBASE_printFunctionResult(heap_2, (u8 *)"destroy heap_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = ph->ops_->destroy(heap_1);
+	TESTBASE_printFunctionResult(heap_1, (u8 *)"destroy heap_1", error_type);
+	error_type = ph->ops_->destroy(heap_3);
+	TESTBASE_printFunctionResult(heap_3, (u8 *)"destroy heap_3", error_type);
+	error_type = ph->ops_->destroy(ph);
+	TESTBASE_printFunctionResult(ph, (u8 *)"destroy PairingHeap Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -0,0 +1,263 @@
+// test_persistent_log.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for persistent log ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "adt_persistent_log.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const char *kLogFile = "test_persistent_log.bin";
+const char *kOtherFile = "test_persistent_log_other.bin";
+const u16 kCapacityLog = 4;
+const u16 kRecordSize = 16;
+// records written while the main thread follows the log
+const u32 kFollowRecords = 20000;
+
+PersistentLog *shared_log = NULL;
+
+// Writes kFollowRecords records, every byte of record i holds (u8)i
+#ifdef _WIN32
+DWORD WINAPI Writer(LPVOID param) {
+#else
+void* Writer(void* param) {
+#endif
+	(void)param;
+	u8 record[16];
+	for (u32 i = 0; i < kFollowRecords; ++i) {
+		memset(record, (u8)i, kRecordSize);
+		shared_log->ops_->insertLast(shared_log, record, kRecordSize);
+	}
+	return 0;
+}
+
+// Counts the records handed to traverse
+u16 traversed = 0;
+void PERSISTENTLOGTEST_count(MemoryNode *node) {
+	if (kRecordSize != node->size_)
+		printf("  ==> ERROR: traverse handed a node of %d bytes\n", node->size_);
+	traversed++;
+}
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+
+	TESTBASE_generateDataForTest();
+	remove(kLogFile);
+
+	printf("\n\n# Test Create\n");
+	PersistentLog *log = PERSISTENT_LOG_open(kLogFile, kRecordSize, kCapacityLog, 2);
+	if (NULL == log) {
+		printf("\n open returned a null log\n");
+		return -1;
+	}
+	PersistentLog *reader = PERSISTENT_LOG_openReader(kLogFile);
+	if (NULL == reader) {
+		printf("\n openReader returned a null log\n");
+		return -1;
+	}
+	printf("Size of:\n");
+	printf("  + Log Header: %zu\n", sizeof(PersistentLogHeader));
+	printf("  + log: %zu\n", sizeof(*log));
+
+	printf("\n\n# Test Insert\n");
+	// the log copies the records, so a stack buffer is enough
+	u8 number[16];
+	for (u16 i = 0; i < 3; ++i) {
+		sprintf((char *)number, "%d", i);
+		error_type = log->ops_->insertLast(log, number, kMaxIntegerChars);
+		TESTBASE_printFunctionResult(log, (u8 *)"insertLast log", error_type);
+	}
+	error_type = log->ops_->insertLast(log, TestData.single_ptr_big_data, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(log, (u8 *)"insertLast log (NOT VALID, bigger than a record)", error_type);
+	error_type = reader->ops_->insertLast(reader, number, kMaxIntegerChars);
+	TESTBASE_printFunctionResult(reader, (u8 *)"insertLast reader (NOT VALID)", error_type);
+	printf("log:\n");
+	log->ops_->print(log);
+
+	printf("\n\n# Test Reader\n");
+	// the reader copies the records out
+	u8 record[16];
+	u64 sequence = 0;
+	u16 followed = 0;
+	while (kErrorCode_Ok == reader->ops_->next(reader, &sequence, record)) {
+		printf("reader #%d: \"%s\"\n", followed, (char *)record);
+		followed++;
+	}
+	if (3 != followed)
+		printf("  ==> ERROR: reader followed %d records\n", followed);
+	// the writer laps the reader, which must skip the overwritten records
+	for (u16 i = 3; i < 9; ++i) {
+		sprintf((char *)number, "%d", i);
+		log->ops_->insertLast(log, number, kMaxIntegerChars);
+	}
+	error_type = reader->ops_->next(reader, &sequence, record);
+	if (kErrorCode_Ok != error_type || 0 != strcmp((char *)record, "5"))
+		printf("  ==> ERROR: reader didn't jump to the oldest record \"5\"\n");
+	if (!reader->ops_->isFull(reader))
+		printf("  ==> ERROR: reader doesn't see a full log\n");
+
+	printf("\n\n# Test Traverse\n");
+	error_type = reader->ops_->traverse(reader, PERSISTENTLOGTEST_count);
+	TESTBASE_printFunctionResult(reader, (u8 *)"traverse reader", error_type);
+	if (kCapacityLog != traversed)
+		printf("  ==> ERROR: traverse reader visited %d records\n", traversed);
+
+	printf("\n\n# Test Extract\n");
+	data = log->ops_->extractFirst(log);
+	if (NULL == data || 0 != strcmp((char *)data, "5"))
+		printf("  ==> ERROR: extractFirst log didn't return \"5\"\n");
+	data = reader->ops_->extractFirst(reader);
+	if (NULL != data)
+		printf("  ==> ERROR: extractFirst reader returned a record\n");
+
+	printf("\n\n# Test Reopen\n");
+	error_type = log->ops_->destroy(log);
+	TESTBASE_printFunctionResult(log, (u8 *)"destroy log", error_type);
+	log = PERSISTENT_LOG_open(kLogFile, kRecordSize, kCapacityLog + 1, 0);
+	if (NULL != log)
+		printf("  ==> ERROR: open accepted a log with a different capacity\n");
+	log = PERSISTENT_LOG_open(kLogFile, kRecordSize, kCapacityLog, 0);
+	if (NULL == log) {
+		printf("\n reopen returned a null log\n");
+		return -1;
+	}
+	if (3 != log->ops_->length(log))
+		printf("  ==> ERROR: reopened log has %d records\n", log->ops_->length(log));
+	data = log->ops_->first(log);
+	if (NULL == data || 0 != strcmp((char *)data, "6"))
+		printf("  ==> ERROR: first in the reopened log is not \"6\"\n");
+	data = log->ops_->last(log);
+	if (NULL == data || 0 != strcmp((char *)data, "8"))
+		printf("  ==> ERROR: last in the reopened log is not \"8\"\n");
+
+	printf("\n\n# Test Reset\n");
+	error_type = log->ops_->reset(log);
+	TESTBASE_printFunctionResult(log, (u8 *)"reset log", error_type);
+	if (!reader->ops_->isEmpty(reader))
+		printf("  ==> ERROR: reader doesn't see the reset\n");
+	error_type = log->ops_->flush(log);
+	TESTBASE_printFunctionResult(log, (u8 *)"flush log", error_type);
+
+	printf("\n\n# Test Follow\n");
+	// a writer thread laps the reader over and over: every copy the reader gets is
+	// whole and belongs to the sequence next reports. The last record is never
+	// overwritten, so the reader always gets to it
+	shared_log = log;
+	// next on the empty log only moves the cursor up to the head
+	u64 first_sequence = 0;
+	reader->ops_->next(reader, &first_sequence, record);
+	sequence = first_sequence;
+	u32 copies = 0;
+	u32 torn = 0;
+#ifdef _WIN32
+	HANDLE writer = CreateThread(NULL, 0, Writer, NULL, 0, NULL);
+#else
+	pthread_t writer;
+	pthread_create(&writer, NULL, Writer, NULL);
+#endif
+	while (first_sequence + kFollowRecords != sequence) {
+		if (kErrorCode_Ok == reader->ops_->next(reader, &sequence, record)) {
+			u8 expected = (u8)(sequence - 1 - first_sequence);
+			for (u16 i = 0; i < kRecordSize; ++i) {
+				if (expected != record[i]) {
+					torn++;
+					break;
+				}
+			}
+			copies++;
+		}
+	}
+#ifdef _WIN32
+	WaitForSingleObject(writer, INFINITE);
+	CloseHandle(writer);
+#else
+	pthread_join(writer, NULL);
+#endif
+	if (0 != torn || 0 == copies)
+		printf("  ==> ERROR: reader got %u copies, %u torn, ended at %llu\n", copies, torn,
+			(unsigned long long)(sequence - first_sequence));
+	log->ops_->reset(log);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	PersistentLog *log_2 = NULL;
+	printf("\n\n# Test Create\n");
+	log_2 = PERSISTENT_LOG_open(kLogFile, 0, kCapacityLog, 0);
+	if (NULL != log_2) {
+		printf("ERROR: trying to open a log with 0 record size\n");
+		return -1;
+	}
+	// a file that is not a log is rejected without being written
+	u8 page[8192];
+	memset(page, 0, sizeof(page));
+	FILE *other = fopen(kOtherFile, "wb");
+	fwrite(page, 1, sizeof(page), other);
+	fclose(other);
+	log_2 = PERSISTENT_LOG_open(kOtherFile, 64, 1000, 0);
+	if (NULL != log_2)
+		printf("ERROR: trying to open a zero filled file too small for the log\n");
+	other = fopen(kOtherFile, "rb");
+	size_t read_bytes = fread(page, 1, sizeof(page), other);
+	fclose(other);
+	for (size_t i = 0; i < read_bytes; ++i) {
+		if (0 != page[i]) {
+			printf("ERROR: the failed open wrote into the file at byte %zu\n", i);
+			break;
+		}
+	}
+	if (sizeof(page) != read_bytes)
+		printf("ERROR: the failed open changed the size of the file\n");
+	remove(kOtherFile);
+	log_2 = NULL;
+
+	printf("\n\n# Test Insert\n");
+	error_type = log->ops_->insertLast(log_2, TestData.single_ptr_data_1, kSingleSizeData1);
+	TESTBASE_printFunctionResult(log_2, (u8 *)"insertLast log_2 (NOT VALID)", error_type);
+
+	printf("\n\n# Test First\n");
+	data = log->ops_->first(log_2);
+	if (NULL != data)
+		printf("ERROR: First in log_2 is not NULL\n");
+	data = log->ops_->at(log, 0);
+	if (NULL != data)
+		printf("ERROR: At in an empty log is not NULL\n");
+
+	printf("\n\n# Test Extract\n");
+	data = log->ops_->extractFirst(log);
+	if (NULL != data)
+		printf("ERROR: Extract from an empty log is not NULL\n");
+	error_type = reader->ops_->next(reader, &sequence, NULL);
+	TESTBASE_printFunctionResult(reader, (u8 *)"next reader NULL record (NOT VALID)", error_type);
+
+	printf("\n\n# Test Destroy\n");
+	error_type = log->ops_->destroy(log_2);
+	TESTBASE_printFunctionResult(log_2, (u8 *)"destroy log_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = reader->ops_->destroy(reader);
+	TESTBASE_printFunctionResult(reader, (u8 *)"destroy reader", error_type);
+	error_type = log->ops_->destroy(log);
+	TESTBASE_printFunctionResult(log, (u8 *)"destroy log", error_type);
+	remove(kLogFile);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -369,6 +369,126 @@ int main()
   TESTBASE_printFunctionResult(queue_3, (u8 *)"destroy queue_3 (NOT VALID)", error_type);
 
 
+  printf("\n\n# Test TraverseEx\n");
+  Queue *queue_t = QUEUE_create(40);
+  for (u16 i = 0; i < 40; ++i) {
+    q->ops_->enqueue(queue_t, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+  }
+  TraverseCounters counters = { 0, 3, 0 };
+  error_type = q->ops_->traverseEx(queue_t, TESTBASE_countUntil, &counters);
+  TESTBASE_printFunctionResult(queue_t, (u8 *)"traverseEx queue_t", error_type);
+  if (3 != counters.visited)
+    printf("  ==> ERROR: traverseEx queue_t visited %d elements instead of stopping at 3\n", counters.visited);
+  counters = (TraverseCounters){ 0, 0xFFFF, 0 };
+  error_type = q->ops_->traverseBatch(queue_t, TESTBASE_countSpansUntil, &counters);
+  TESTBASE_printFunctionResult(queue_t, (u8 *)"traverseBatch queue_t", error_type);
+  if (40 != counters.visited || 2 != counters.spans)
+    printf("  ==> ERROR: traverseBatch queue_t visited %d elements in %d spans\n", counters.visited, counters.spans);
+  counters = (TraverseCounters){ 0, 1, 0 };
+  error_type = q->ops_->traverseBatch(queue_t, TESTBASE_countSpansUntil, &counters);
+  TESTBASE_printFunctionResult(queue_t, (u8 *)"traverseBatch queue_t", error_type);
+  if (1 != counters.spans)
+    printf("  ==> ERROR: traverseBatch queue_t didn't stop after the first span\n");
+  error_type = q->ops_->traverseEx(queue_t, NULL, NULL);
+  TESTBASE_printFunctionResult(queue_t, (u8 *)"traverseEx queue_t NULL (NOT VALID)", error_type);
+  error_type = q->ops_->traverseBatch(NULL, TESTBASE_countSpansUntil, &counters);
+  TESTBASE_printFunctionResult(NULL, (u8 *)"traverseBatch NULL (NOT VALID)", error_type);
+  error_type = q->ops_->destroy(queue_t);
+  TESTBASE_printFunctionResult(queue_t, (u8 *)"destroy queue_t", error_type);
+
+
+  printf("\n\n# Test Ring Storage\n");
+  Queue *queue_r = QUEUE_createWithStorage(4, kQueueStorage_Ring);
+  if (NULL == queue_r || NULL != queue_r->storage_ || NULL == queue_r->ring_)
+    printf("  ==> ERROR: QUEUE_createWithStorage didn't build a ring buffer queue\n");
+  // wrap the ring around a few times, the order must stay FIFO
+  for (u16 i = 0; i < 10; ++i) {
+    queue_r->ops_->enqueue(queue_r, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+    if (i >= 2) {
+      u8 *data = queue_r->ops_->dequeue(queue_r, 0);
+      if (atoi((char *)data) != i - 2)
+        printf("  ==> ERROR: dequeue queue_r returned %s instead of %d\n", data, i - 2);
+      MM->free(data);
+    }
+  }
+  printf("front: %s back: %s\n", (char *)queue_r->ops_->front(queue_r), (char *)queue_r->ops_->back(queue_r));
+  queue_r->ops_->enqueue(queue_r, TESTBASE_generateDataIntegerAsString(10), kMaxIntegerChars);
+  queue_r->ops_->enqueue(queue_r, TESTBASE_generateDataIntegerAsString(11), kMaxIntegerChars);
+  if (!queue_r->ops_->isFull(queue_r))
+    printf("  ==> ERROR: queue_r should be full\n");
+  void *extra = TESTBASE_generateDataIntegerAsString(12);
+  error_type = queue_r->ops_->enqueue(queue_r, extra, kMaxIntegerChars);
+  TESTBASE_printFunctionResult(queue_r, (u8 *)"enqueue queue_r full (NOT VALID)", error_type);
+  MM->free(extra);
+  Queue *queue_l = QUEUE_create(2);
+  queue_l->ops_->enqueue(queue_l, TESTBASE_generateDataIntegerAsString(20), kMaxIntegerChars);
+  error_type = queue_r->ops_->concat(queue_r, queue_l);
+  TESTBASE_printFunctionResult(queue_r, (u8 *)"concat queue_r queue_l", error_type);
+  error_type = queue_l->ops_->concat(queue_l, queue_r);
+  TESTBASE_printFunctionResult(queue_l, (u8 *)"concat queue_l queue_r", error_type);
+  if (5 != queue_r->ops_->length(queue_r) || 6 != queue_l->ops_->length(queue_l))
+    printf("  ==> ERROR: concat between storages left lengths %d and %d\n",
+           queue_r->ops_->length(queue_r), queue_l->ops_->length(queue_l));
+  printf("queue_r:\n");
+  queue_r->ops_->print(queue_r);
+  error_type = queue_r->ops_->resize(queue_r, 2);
+  TESTBASE_printFunctionResult(queue_r, (u8 *)"resize queue_r", error_type);
+  error_type = queue_r->ops_->reset(queue_r);
+  TESTBASE_printFunctionResult(queue_r, (u8 *)"reset queue_r", error_type);
+  if (!queue_r->ops_->isEmpty(queue_r) || NULL != queue_r->ops_->dequeue(queue_r, 0))
+    printf("  ==> ERROR: queue_r should be empty after reset\n");
+  error_type = queue_r->ops_->destroy(queue_r);
+  TESTBASE_printFunctionResult(queue_r, (u8 *)"destroy queue_r", error_type);
+  error_type = queue_l->ops_->destroy(queue_l);
+  TESTBASE_printFunctionResult(queue_l, (u8 *)"destroy queue_l", error_type);
+
+
+  printf("\n\n# Test Enqueue Many / Dequeue Many\n");
+  // same batches on both storages, the ring one wraps around on the second round
+  for (u16 kind = 0; kind < 2; ++kind) {
+    Queue *queue_m = QUEUE_createWithStorage(6, 0 == kind ? kQueueStorage_List : kQueueStorage_Ring);
+    void *batch[8];
+    u16 sizes[8];
+    for (u16 round = 0; round < 2; ++round) {
+      for (u16 i = 0; i < 8; ++i) {
+        batch[i] = TESTBASE_generateDataIntegerAsString(round * 10 + i);
+        sizes[i] = kMaxIntegerChars;
+      }
+      // only 6 fit, the last 2 stay with the caller
+      u16 count = queue_m->ops_->enqueueMany(queue_m, batch, sizes, 8);
+      if (6 != count || !queue_m->ops_->isFull(queue_m))
+        printf("  ==> ERROR: enqueueMany queue_m (storage %d) inserted %d elements\n", kind, count);
+      MM->free(batch[6]);
+      MM->free(batch[7]);
+      count = queue_m->ops_->dequeueMany(queue_m, batch, sizes, 4);
+      if (4 != count)
+        printf("  ==> ERROR: dequeueMany queue_m (storage %d) extracted %d elements\n", kind, count);
+      for (u16 i = 0; i < count; ++i) {
+        if (atoi((char *)batch[i]) != round * 10 + i || kMaxIntegerChars != sizes[i])
+          printf("  ==> ERROR: dequeueMany queue_m (storage %d) returned %s instead of %d\n", kind, (char *)batch[i], round * 10 + i);
+        MM->free(batch[i]);
+      }
+      count = queue_m->ops_->dequeueMany(queue_m, batch, NULL, 8);
+      if (2 != count || !queue_m->ops_->isEmpty(queue_m))
+        printf("  ==> ERROR: dequeueMany queue_m (storage %d) didn't empty it\n", kind);
+      for (u16 i = 0; i < count; ++i) {
+        MM->free(batch[i]);
+      }
+    }
+    // a NULL element ends the batch before it
+    batch[0] = TESTBASE_generateDataIntegerAsString(0);
+    batch[1] = NULL;
+    if (1 != queue_m->ops_->enqueueMany(queue_m, batch, sizes, 2))
+      printf("  ==> ERROR: enqueueMany queue_m (storage %d) went past a NULL element\n", kind);
+    if (0 != queue_m->ops_->enqueueMany(queue_m, NULL, sizes, 2) || 0 != queue_m->ops_->dequeueMany(queue_m, NULL, sizes, 2))
+      printf("  ==> ERROR: queue_m (storage %d) took NULL arrays\n", kind);
+    if (0 != queue_m->ops_->enqueueMany(NULL, batch, sizes, 1) || 0 != queue_m->ops_->dequeueMany(NULL, batch, sizes, 1))
+      printf("  ==> ERROR: enqueueMany and dequeueMany worked on a NULL queue\n");
+    error_type = queue_m->ops_->destroy(queue_m);
+    TESTBASE_printFunctionResult(queue_m, (u8 *)"destroy queue_m", error_type);
+  }
+
+
   // Work is done, clean the system
   error_type = q->ops_->destroy(queue_1);
   TESTBASE_printFunctionResult(queue_1, (u8 *)"destroy queue_1", error_type);
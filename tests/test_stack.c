@@ -355,6 +355,62 @@ int main()
   TESTBASE_printFunctionResult(stack_3, (u8 *)"destroy stack_3 (NOT VALID)", error_type);
 
 
+  printf("\n\n# Test TraverseEx\n");
+  Stack *stack_t = STACK_create(40);
+  for (u16 i = 0; i < 40; ++i) {
+    s->ops_->push(stack_t, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+  }
+  TraverseCounters counters = { 0, 3, 0 };
+  error_type = s->ops_->traverseEx(stack_t, TESTBASE_countUntil, &counters);
+  TESTBASE_printFunctionResult(stack_t, (u8 *)"traverseEx stack_t", error_type);
+  if (3 != counters.visited)
+    printf("  ==> ERROR: traverseEx stack_t visited %d elements instead of stopping at 3\n", counters.visited);
+  counters = (TraverseCounters){ 0, 0xFFFF, 0 };
+  error_type = s->ops_->traverseBatch(stack_t, TESTBASE_countSpansUntil, &counters);
+  TESTBASE_printFunctionResult(stack_t, (u8 *)"traverseBatch stack_t", error_type);
+  if (40 != counters.visited || 2 != counters.spans)
+    printf("  ==> ERROR: traverseBatch stack_t visited %d elements in %d spans\n", counters.visited, counters.spans);
+  counters = (TraverseCounters){ 0, 1, 0 };
+  error_type = s->ops_->traverseBatch(stack_t, TESTBASE_countSpansUntil, &counters);
+  TESTBASE_printFunctionResult(stack_t, (u8 *)"traverseBatch stack_t", error_type);
+  if (1 != counters.spans)
+    printf("  ==> ERROR: traverseBatch stack_t didn't stop after the first span\n");
+  error_type = s->ops_->traverseEx(stack_t, NULL, NULL);
+  TESTBASE_printFunctionResult(stack_t, (u8 *)"traverseEx stack_t NULL (NOT VALID)", error_type);
+  error_type = s->ops_->traverseBatch(NULL, TESTBASE_countSpansUntil, &counters);
+  TESTBASE_printFunctionResult(NULL, (u8 *)"traverseBatch NULL (NOT VALID)", error_type);
+  error_type = s->ops_->destroy(stack_t);
+  TESTBASE_printFunctionResult(stack_t, (u8 *)"destroy stack_t", error_type);
+
+
+  printf("\n\n# Test Fast Path\n");
+  Stack *stack_f = STACK_create(3);
+  for (u16 i = 0; i < 3; ++i) {
+    error_type = STACK_pushFast(stack_f, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+    TESTBASE_printFunctionResult(stack_f, (u8 *)"STACK_pushFast stack_f", error_type);
+  }
+  void *extra = TESTBASE_generateDataIntegerAsString(3);
+  error_type = STACK_pushFast(stack_f, extra, kMaxIntegerChars);
+  TESTBASE_printFunctionResult(stack_f, (u8 *)"STACK_pushFast stack_f full (NOT VALID)", error_type);
+  MM->free(extra);
+  if (3 != s->ops_->length(stack_f) || STACK_topFast(stack_f) != s->ops_->top(stack_f))
+    printf("  ==> ERROR: the fast path and the ops of stack_f disagree\n");
+  // the fast path and the ops share the same top
+  u8 *popped = s->ops_->pop(stack_f);
+  if (2 != atoi((char *)popped))
+    printf("  ==> ERROR: pop stack_f returned %s instead of 2\n", popped);
+  MM->free(popped);
+  popped = STACK_popFast(stack_f);
+  if (1 != atoi((char *)popped))
+    printf("  ==> ERROR: STACK_popFast stack_f returned %s instead of 1\n", popped);
+  MM->free(popped);
+  MM->free(STACK_popFast(stack_f));
+  if (NULL != STACK_popFast(stack_f) || NULL != STACK_topFast(stack_f))
+    printf("  ==> ERROR: stack_f should be empty\n");
+  error_type = s->ops_->destroy(stack_f);
+  TESTBASE_printFunctionResult(stack_f, (u8 *)"destroy stack_f", error_type);
+
+
   // Work is done, clean the system
   error_type = s->ops_->destroy(stack_1);
   TESTBASE_printFunctionResult(stack_1, (u8 *)"destroy stack_1", error_type);
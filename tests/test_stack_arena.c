@@ -0,0 +1,225 @@
+// test_stack_arena.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for stack arena ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_stack_arena.h"
+#include "adt_stack.h"
+#include "adt_list.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u32 kBlockSizeStackArena1 = 256;
+const u32 kBlockSizeStackArena2 = 64;
+// payloads of every frame of the frame test
+const u16 kFramePayloads = 40;
+const u16 kFrames = 5;
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+	void *first = NULL;
+	StackArenaMark mark;
+
+	TESTBASE_generateDataForTest();
+
+	// arena created just to have a reference to the operations
+	StackArena *sa = NULL;
+	sa = STACKARENA_create(1);
+	if (NULL == sa) {
+		printf("\n create returned a null node in arena for ops");
+		return -1;
+	}
+	// arenas to work with
+	StackArena *arena_1 = NULL;
+	StackArena *arena_2 = NULL;
+	arena_1 = STACKARENA_create(kBlockSizeStackArena1);
+	if (NULL == arena_1) {
+		printf("\n create returned a null node in arena_1\n");
+		return -1;
+	}
+	arena_2 = STACKARENA_create(kBlockSizeStackArena2);
+	if (NULL == arena_2) {
+		printf("\n create returned a null node in arena_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Stack Arena Block: %zu\n", sizeof(StackArenaBlock));
+	printf("  + Stack Arena Mark: %zu\n", sizeof(StackArenaMark));
+	printf("  + arena_1: %zu\n", sizeof(*arena_1));
+
+	printf("\n\n# Test Alloc\n");
+	// every allocation is aligned and none overlaps the previous one
+	u8 *previous = NULL;
+	for (u16 i = 1; i <= 20; ++i) {
+		u8 *memory = (u8 *)sa->ops_->alloc(arena_1, i);
+		if (NULL == memory || 0 != ((size_t)memory & (kStackArenaAlignment - 1))) {
+			printf("  ==> ERROR: alloc arena_1 of %d bytes returned %p\n", i, memory);
+			break;
+		}
+		memset(memory, i, i);
+		if (NULL != previous && previous[0] != (u8)(i - 1))
+			printf("  ==> ERROR: alloc arena_1 of %d bytes overwrote the previous allocation\n", i);
+		previous = memory;
+	}
+	if (kBlockSizeStackArena1 >= sa->ops_->reserved(arena_1))
+		printf("  ==> ERROR: arena_1 didn't get a second block\n");
+	printf("arena_1:\n");
+	sa->ops_->print(arena_1);
+
+	printf("\n\n# Test Copy\n");
+	data = sa->ops_->copy(arena_2, TestData.single_ptr_data_1, kSingleSizeData1);
+	if (NULL == data || 0 != memcmp(data, TestData.single_ptr_data_1, kSingleSizeData1))
+		printf("  ==> ERROR: copy arena_2 didn't copy the data\n");
+	// larger than a block, it gets a block of its own
+	data = sa->ops_->copy(arena_2, TestData.single_ptr_big_data, kSingleSizeBigData);
+	if (NULL == data || 0 != memcmp(data, TestData.single_ptr_big_data, kSingleSizeBigData))
+		printf("  ==> ERROR: copy arena_2 didn't copy the big data\n");
+	if (kSingleSizeBigData > sa->ops_->reserved(arena_2) - kBlockSizeStackArena2)
+		printf("  ==> ERROR: arena_2 didn't get a block for the big data\n");
+
+	printf("\n\n# Test Mark and Release\n");
+	// what is released is handed out again, from the same place
+	sa->ops_->reset(arena_1);
+	mark = sa->ops_->mark(arena_1);
+	u32 used = sa->ops_->used(arena_1);
+	first = sa->ops_->alloc(arena_1, 100);
+	StackArenaMark inner = sa->ops_->mark(arena_1);
+	for (u16 i = 0; i < 10; ++i) {
+		sa->ops_->alloc(arena_1, 100);
+	}
+	u32 reserved = sa->ops_->reserved(arena_1);
+	error_type = sa->ops_->release(arena_1, inner);
+	TESTBASE_printFunctionResult(arena_1, (u8 *)"release arena_1 inner mark", error_type);
+	data = sa->ops_->alloc(arena_1, 100);
+	if (data <= first)
+		printf("  ==> ERROR: alloc arena_1 after the inner release went below the mark\n");
+	error_type = sa->ops_->release(arena_1, mark);
+	TESTBASE_printFunctionResult(arena_1, (u8 *)"release arena_1 outer mark", error_type);
+	if (used != sa->ops_->used(arena_1))
+		printf("  ==> ERROR: used arena_1 is %u instead of %u\n", sa->ops_->used(arena_1), used);
+	if (first != sa->ops_->alloc(arena_1, 100))
+		printf("  ==> ERROR: alloc arena_1 after the release didn't reuse the memory\n");
+	// the blocks are kept, so the same allocations don't reserve more
+	for (u16 i = 0; i < 10; ++i) {
+		sa->ops_->alloc(arena_1, 100);
+	}
+	if (reserved != sa->ops_->reserved(arena_1))
+		printf("  ==> ERROR: reserved arena_1 grew from %u to %u\n", reserved, sa->ops_->reserved(arena_1));
+	// inner is above the top now
+	sa->ops_->release(arena_1, mark);
+	error_type = sa->ops_->release(arena_1, inner);
+	TESTBASE_printFunctionResult(arena_1, (u8 *)"release arena_1 above the top (NOT VALID)", error_type);
+	if (kErrorCode_InvalidValue != error_type)
+		printf("  ==> ERROR: release arena_1 to a mark above the top didn't fail\n");
+
+	printf("\n\n# Test Frames\n");
+	// the payloads of every frame come from the arena; the containers are emptied
+	// with softReset and the frame ends with one release
+	Stack *frame_stack = STACK_create(kFramePayloads);
+	List *frame_list = LIST_create(kFramePayloads);
+	sa->ops_->reset(arena_1);
+	for (u16 frame = 0; frame < kFrames; ++frame) {
+		mark = sa->ops_->mark(arena_1);
+		for (u16 i = 0; i < kFramePayloads; ++i) {
+			u32 value = frame * kFramePayloads + i;
+			frame_stack->ops_->push(frame_stack, sa->ops_->copy(arena_1, &value, sizeof(u32)), sizeof(u32));
+			frame_list->ops_->insertLast(frame_list, sa->ops_->copy(arena_1, &value, sizeof(u32)), sizeof(u32));
+		}
+		u32 *top = (u32 *)frame_stack->ops_->top(frame_stack);
+		u32 *head = (u32 *)frame_list->ops_->first(frame_list);
+		if (NULL == top || NULL == head || *top != (u32)(frame * kFramePayloads + kFramePayloads - 1) ||
+			*head != (u32)(frame * kFramePayloads))
+			printf("  ==> ERROR: the payloads of frame %d are wrong\n", frame);
+		frame_stack->ops_->softReset(frame_stack);
+		frame_list->ops_->softReset(frame_list);
+		sa->ops_->release(arena_1, mark);
+	}
+	if (reserved != sa->ops_->reserved(arena_1))
+		printf("  ==> ERROR: reserved arena_1 grew from %u to %u with the frames\n", reserved, sa->ops_->reserved(arena_1));
+	frame_stack->ops_->destroy(frame_stack);
+	frame_list->ops_->destroy(frame_list);
+
+	printf("\n\n# Test Trim\n");
+	sa->ops_->reset(arena_1);
+	error_type = sa->ops_->trim(arena_1);
+	TESTBASE_printFunctionResult(arena_1, (u8 *)"trim arena_1", error_type);
+	if (kBlockSizeStackArena1 != sa->ops_->reserved(arena_1))
+		printf("  ==> ERROR: reserved arena_1 is %u after the trim\n", sa->ops_->reserved(arena_1));
+	// a mark in a block the trim freed is refused without touching the block
+	for (u16 i = 0; i < 10; ++i) {
+		sa->ops_->alloc(arena_1, 100);
+	}
+	mark = sa->ops_->mark(arena_1);
+	sa->ops_->reset(arena_1);
+	sa->ops_->trim(arena_1);
+	error_type = sa->ops_->release(arena_1, mark);
+	TESTBASE_printFunctionResult(arena_1, (u8 *)"release arena_1 after the trim (NOT VALID)", error_type);
+	if (kErrorCode_InvalidValue != error_type)
+		printf("  ==> ERROR: release arena_1 to a trimmed block didn't fail\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = sa->ops_->destroy(arena_2);
+	arena_2 = NULL;
+	TESTBASE_printFunctionResult(arena_2, (u8 *)"destroy arena_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	arena_2 = STACKARENA_create(0);
+	if (NULL != arena_2) {
+		printf("ERROR: trying to create arena_2 with 0 block size\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Alloc\n");
+	data = sa->ops_->alloc(arena_2, 10);
+	if (NULL != data)
+		printf("ERROR: trying to alloc from a NULL arena\n");
+	data = sa->ops_->alloc(arena_1, 0);
+	if (NULL != data)
+		printf("ERROR: trying to alloc 0 bytes\n");
+	data = sa->ops_->copy(arena_1, NULL, 10);
+	if (NULL != data)
+		printf("ERROR: trying to copy NULL data\n");
+
+	printf("\n\n# Test Mark and Release\n");
+	mark = sa->ops_->mark(arena_2);
+	if (NULL != mark.block_)
+		printf("ERROR: the mark of a NULL arena is not empty\n");
+	error_type = sa->ops_->release(arena_1, mark);
+	TESTBASE_printFunctionResult(arena_1, (u8 *)"release arena_1 empty mark (NOT VALID)", error_type);
+	error_type = sa->ops_->release(arena_2, mark);
+	TESTBASE_printFunctionResult(arena_2, (u8 *)"release arena_2 (NOT VALID)", error_type);
+
+	printf("\n\n# Test Reset, Trim and Destroy\n");
+	error_type = sa->ops_->reset(arena_2);
+	TESTBASE_printFunctionResult(arena_2, (u8 *)"reset arena_2 (NOT VALID)", error_type);
+	error_type = sa->ops_->trim(arena_2);
+	TESTBASE_printFunctionResult(arena_2, (u8 *)"trim arena_2 (NOT VALID)", error_type);
+	error_type = sa->ops_->destroy(arena_2);
+	TESTBASE_printFunctionResult(arena_2, (u8 *)"destroy arena_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = sa->ops_->destroy(arena_1);
+	TESTBASE_printFunctionResult(arena_1, (u8 *)"destroy arena_1", error_type);
+	error_type = sa->ops_->destroy(sa);
+	TESTBASE_printFunctionResult(sa, (u8 *)"destroy StackArena Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
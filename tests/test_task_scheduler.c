@@ -0,0 +1,217 @@
+// test_task_scheduler.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for the task scheduler
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#ifndef _WIN32
+#include <sched.h>
+#endif
+
+#include "adt_task_scheduler.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kSchedulerWorkers = 4;
+const u32 kSchedulerTasks = 2000;
+const u32 kSchedulerRange = 100000;
+// yields the main thread waits for the other workers before giving up
+const u32 kSchedulerPatience = 1000000;
+// spawns made while the other workers are going to sleep
+const u32 kSchedulerSleepRaces = 3000;
+
+TaskScheduler *scheduler_1 = NULL;
+// tasks that finished, shared by every worker
+volatile u32 finished_tasks = 0;
+// times every index of the parallelFor range was visited
+u8 visited_indices[100000];
+
+void SCHEDULERTEST_countTask(void *arg) {
+	(void)arg;
+	ATOMIC_addU32(&finished_tasks, 1);
+}
+
+// Spawns two children per level down to arg levels, then waits for them
+void SCHEDULERTEST_treeTask(void *arg) {
+	uintptr_t levels = (uintptr_t)arg;
+	ATOMIC_addU32(&finished_tasks, 1);
+	if (0 == levels) {
+		return;
+	}
+	TaskGroup group = { 0 };
+	scheduler_1->ops_->spawn(scheduler_1, &group, SCHEDULERTEST_treeTask, (void *)(levels - 1));
+	scheduler_1->ops_->spawn(scheduler_1, &group, SCHEDULERTEST_treeTask, (void *)(levels - 1));
+	scheduler_1->ops_->sync(scheduler_1, &group);
+}
+
+void SCHEDULERTEST_visitRange(u32 begin, u32 end, void *ctx) {
+	u32 grain = *(u32 *)ctx;
+	if (end - begin > grain)
+		printf("  ==> ERROR: parallelFor gave a piece of %u indices\n", end - begin);
+	for (u32 i = begin; i < end; ++i) {
+		visited_indices[i]++;
+	}
+}
+
+// Lets the other workers run, worker 0 doesn't look for tasks meanwhile
+void SCHEDULERTEST_yield() {
+#ifdef _WIN32
+	SwitchToThread();
+#else
+	sched_yield();
+#endif
+}
+
+int main() {
+	s16 error_type = 0;
+	TaskGroup group = { 0 };
+	u32 grain = 1000;
+
+	TESTBASE_generateDataForTest();
+
+	scheduler_1 = TASKSCHEDULER_create(kSchedulerWorkers);
+	if (NULL == scheduler_1) {
+		printf("\n create returned a null node in scheduler_1\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + scheduler_1: %zu\n", sizeof(*scheduler_1));
+	printf("  + Task: %zu\n", sizeof(SchedulerTask));
+	printf("  + Worker: %zu\n", sizeof(SchedulerWorker));
+
+	printf("\n\n# Test Create\n");
+	if (kSchedulerWorkers != scheduler_1->ops_->workers(scheduler_1))
+		printf("  ==> ERROR: workers scheduler_1 is %d\n", scheduler_1->ops_->workers(scheduler_1));
+	if (NULL != TASKSCHEDULER_create(2))
+		printf("  ==> ERROR: a worker created a second scheduler\n");
+
+	printf("\n\n# Test Spawn and Sync\n");
+	// more tasks than a deque holds, the rest run on the spot
+	for (u32 i = 0; i < kSchedulerTasks; ++i) {
+		error_type = scheduler_1->ops_->spawn(scheduler_1, &group, SCHEDULERTEST_countTask, NULL);
+		if (kErrorCode_Ok != error_type) {
+			TESTBASE_printFunctionResult(scheduler_1, (u8 *)"spawn scheduler_1", error_type);
+			break;
+		}
+	}
+	error_type = scheduler_1->ops_->sync(scheduler_1, &group);
+	TESTBASE_printFunctionResult(scheduler_1, (u8 *)"sync scheduler_1", error_type);
+	if (kSchedulerTasks != finished_tasks || 0 != group.pending_)
+		printf("  ==> ERROR: %u tasks finished instead of %u\n", finished_tasks, kSchedulerTasks);
+
+	printf("\n\n# Test Nested Spawn\n");
+	// 2^11 - 1 tasks, each one waits for its children
+	finished_tasks = 0;
+	scheduler_1->ops_->spawn(scheduler_1, &group, SCHEDULERTEST_treeTask, (void *)(uintptr_t)10);
+	scheduler_1->ops_->sync(scheduler_1, &group);
+	if (2047 != finished_tasks)
+		printf("  ==> ERROR: %u tasks of the tree finished instead of 2047\n", finished_tasks);
+
+	printf("\n\n# Test Parallel For\n");
+	error_type = scheduler_1->ops_->parallelFor(scheduler_1, 0, kSchedulerRange, grain, SCHEDULERTEST_visitRange, &grain);
+	TESTBASE_printFunctionResult(scheduler_1, (u8 *)"parallelFor scheduler_1", error_type);
+	for (u32 i = 0; i < kSchedulerRange; ++i) {
+		if (1 != visited_indices[i]) {
+			printf("  ==> ERROR: index %u was visited %d times\n", i, visited_indices[i]);
+			break;
+		}
+	}
+	error_type = scheduler_1->ops_->parallelFor(scheduler_1, 10, 10, grain, SCHEDULERTEST_visitRange, &grain);
+	TESTBASE_printFunctionResult(scheduler_1, (u8 *)"parallelFor scheduler_1 empty range", error_type);
+
+	printf("\n\n# Test Idle Workers\n");
+	// with nothing to do the other workers go to sleep instead of spinning
+	u32 helpers = kSchedulerWorkers - 1;
+	u32 waited = 0;
+	while (helpers != ATOMIC_loadU32(&scheduler_1->sleepers_) && waited < kSchedulerPatience) {
+		SCHEDULERTEST_yield();
+		waited++;
+	}
+	if (helpers != ATOMIC_loadU32(&scheduler_1->sleepers_))
+		printf("  ==> ERROR: %u workers are sleeping instead of %u\n", scheduler_1->sleepers_, helpers);
+	printf("scheduler_1:\n");
+	scheduler_1->ops_->print(scheduler_1);
+	// worker 0 doesn't sync, so the task only runs if the spawn wakes a worker up
+	finished_tasks = 0;
+	scheduler_1->ops_->spawn(scheduler_1, &group, SCHEDULERTEST_countTask, NULL);
+	for (waited = 0; 0 == ATOMIC_loadU32(&finished_tasks) && waited < kSchedulerPatience; ++waited) {
+		SCHEDULERTEST_yield();
+	}
+	if (1 != finished_tasks)
+		printf("  ==> ERROR: no sleeping worker woke up for the spawned task\n");
+	scheduler_1->ops_->sync(scheduler_1, &group);
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	TaskScheduler *scheduler_2 = NULL;
+	scheduler_2 = TASKSCHEDULER_create(0);
+	if (NULL != scheduler_2) {
+		printf("ERROR: trying to create scheduler_2 with 0 workers\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Spawn and Sync\n");
+	error_type = scheduler_1->ops_->spawn(scheduler_2, &group, SCHEDULERTEST_countTask, NULL);
+	TESTBASE_printFunctionResult(scheduler_2, (u8 *)"spawn scheduler_2 (NOT VALID)", error_type);
+	error_type = scheduler_1->ops_->spawn(scheduler_1, NULL, SCHEDULERTEST_countTask, NULL);
+	TESTBASE_printFunctionResult(scheduler_1, (u8 *)"spawn scheduler_1 NULL group (NOT VALID)", error_type);
+	error_type = scheduler_1->ops_->spawn(scheduler_1, &group, NULL, NULL);
+	TESTBASE_printFunctionResult(scheduler_1, (u8 *)"spawn scheduler_1 NULL function (NOT VALID)", error_type);
+	error_type = scheduler_1->ops_->sync(scheduler_1, NULL);
+	TESTBASE_printFunctionResult(scheduler_1, (u8 *)"sync scheduler_1 NULL group (NOT VALID)", error_type);
+
+	printf("\n\n# Test Parallel For\n");
+	error_type = scheduler_1->ops_->parallelFor(scheduler_1, 0, 10, 1, NULL, NULL);
+	TESTBASE_printFunctionResult(scheduler_1, (u8 *)"parallelFor scheduler_1 NULL body (NOT VALID)", error_type);
+
+	printf("\n\n# Test Destroy\n");
+	error_type = scheduler_1->ops_->destroy(scheduler_2);
+	TESTBASE_printFunctionResult(scheduler_2, (u8 *)"destroy scheduler_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = scheduler_1->ops_->destroy(scheduler_1);
+	TESTBASE_printFunctionResult(scheduler_1, (u8 *)"destroy scheduler_1", error_type);
+
+	printf("\n\n# Test Spawn While Falling Asleep\n");
+	// two workers, so the helper has a single victim to find the tasks in.
+	// Every spawn comes a different number of yields after the previous task
+	// finished, so it lands while the workers are still looking for tasks, are
+	// counting themselves as sleepers or are already asleep. Worker 0 never syncs
+	// in between, another worker has to run every task
+	TaskScheduler *scheduler_3 = TASKSCHEDULER_create(2);
+	u32 stalled = 0;
+	finished_tasks = 0;
+	for (u32 i = 0; i < kSchedulerSleepRaces; ++i) {
+		for (u32 y = 0; y < i % (kSchedulerIdleRounds * 2); ++y) {
+			SCHEDULERTEST_yield();
+		}
+		scheduler_3->ops_->spawn(scheduler_3, &group, SCHEDULERTEST_countTask, NULL);
+		for (waited = 0; i + 1 != ATOMIC_loadU32(&finished_tasks) && waited < kSchedulerPatience; ++waited) {
+			SCHEDULERTEST_yield();
+		}
+		if (i + 1 != ATOMIC_loadU32(&finished_tasks)) {
+			stalled++;
+			scheduler_3->ops_->sync(scheduler_3, &group);
+		}
+	}
+	scheduler_3->ops_->sync(scheduler_3, &group);
+	if (0 != stalled || kSchedulerSleepRaces != finished_tasks)
+		printf("  ==> ERROR: %u of %u tasks waited for worker 0 to sync\n", stalled, kSchedulerSleepRaces);
+	error_type = scheduler_3->ops_->destroy(scheduler_3);
+	TESTBASE_printFunctionResult(scheduler_3, (u8 *)"destroy scheduler_3", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
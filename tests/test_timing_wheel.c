@@ -0,0 +1,241 @@
+// test_timing_wheel.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for timing wheel ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_timing_wheel.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u32 kCapacityTimingWheel1 = 300;
+const u32 kCapacityTimingWheel2 = 3;
+const u16 kTimingWheelElements = 100;
+// times the periodic timer schedules itself again
+const u32 kPeriodicRounds = 50;
+const u32 kPeriod = 70;
+
+// Checks of the timers fired by advance
+typedef struct fired_s {
+	TimingWheel *wheel;
+	u32 count;
+	u32 previous;
+	u32 errors;
+} Fired;
+
+// Every timer carries the tick it should fire at
+u32* TIMINGWHEELTEST_tick(u32 tick) {
+	u32 *data = (u32 *)MM->malloc(sizeof(u32));
+	*data = tick;
+	return data;
+}
+
+// Checks that the timer fires on its tick and after the previous one
+void TIMINGWHEELTEST_check(MemoryNode *node, void *ctx) {
+	Fired *fired = (Fired *)ctx;
+	u32 tick = *(u32 *)node->data_;
+	u32 now = fired->wheel->ops_->now(fired->wheel);
+	if (tick != now || tick < fired->previous) {
+		printf("  ==> ERROR: timer of tick %u fired at tick %u\n", tick, now);
+		fired->errors++;
+	}
+	fired->previous = tick;
+	fired->count++;
+	MM->free(node->data_);
+}
+
+// Schedules itself again kPeriod ticks later until kPeriodicRounds rounds are done
+void TIMINGWHEELTEST_periodic(MemoryNode *node, void *ctx) {
+	Fired *fired = (Fired *)ctx;
+	u32 *tick = (u32 *)node->data_;
+	if (*tick != fired->wheel->ops_->now(fired->wheel)) {
+		printf("  ==> ERROR: periodic timer of tick %u fired at tick %u\n", *tick, fired->wheel->ops_->now(fired->wheel));
+		fired->errors++;
+	}
+	fired->count++;
+	if (fired->count < kPeriodicRounds) {
+		*tick += kPeriod;
+		fired->wheel->ops_->schedule(fired->wheel, tick, sizeof(u32), kPeriod, NULL);
+	} else {
+		MM->free(tick);
+	}
+}
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+	TimingWheelTimer *handles[100];
+	Fired fired;
+
+	TESTBASE_generateDataForTest();
+
+	// wheel created just to have a reference to the operations
+	TimingWheel *tw = NULL;
+	tw = TIMINGWHEEL_create(1);
+	if (NULL == tw) {
+		printf("\n create returned a null node in wheel for ops");
+		return -1;
+	}
+	// wheels to work with
+	TimingWheel *wheel_1 = NULL;
+	TimingWheel *wheel_2 = NULL;
+	wheel_1 = TIMINGWHEEL_create(kCapacityTimingWheel1);
+	if (NULL == wheel_1) {
+		printf("\n create returned a null node in wheel_1\n");
+		return -1;
+	}
+	wheel_2 = TIMINGWHEEL_create(kCapacityTimingWheel2);
+	if (NULL == wheel_2) {
+		printf("\n create returned a null node in wheel_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Timing Wheel Timer: %zu\n", sizeof(TimingWheelTimer));
+	printf("  + Timing Wheel Block: %zu\n", sizeof(TimingWheelBlock));
+	printf("  + wheel_1: %zu\n", sizeof(*wheel_1));
+
+	printf("\n\n# Test Schedule\n");
+	// delays go from the next tick to past the reach of the top level, in a scrambled
+	// order. A delay of 0 fires on the next tick
+	for (u16 i = 0; i < kTimingWheelElements; ++i) {
+		u32 delay = (u32)((i * 37) % kTimingWheelElements);
+		delay = delay * delay * delay * 20 + delay;
+		error_type = tw->ops_->schedule(wheel_1, TIMINGWHEELTEST_tick(0 == delay ? 1 : delay), sizeof(u32), delay, &handles[i]);
+		if (kErrorCode_Ok != error_type) {
+			printf("  ==> ERROR: schedule wheel_1 with delay %u returned %d\n", delay, error_type);
+		}
+	}
+	if (kTimingWheelElements != tw->ops_->length(wheel_1))
+		printf("  ==> ERROR: length wheel_1 is %u\n", tw->ops_->length(wheel_1));
+	error_type = tw->ops_->schedule(wheel_2, TestData.single_ptr_data_1, kSingleSizeData1, 5, NULL);
+	TESTBASE_printFunctionResult(wheel_2, (u8 *)"schedule wheel_2", error_type);
+	TestData.single_ptr_data_1 = NULL;
+	error_type = tw->ops_->schedule(wheel_2, TestData.single_ptr_data_2, kSingleSizeData2, 500, NULL);
+	TESTBASE_printFunctionResult(wheel_2, (u8 *)"schedule wheel_2", error_type);
+	TestData.single_ptr_data_2 = NULL;
+	error_type = tw->ops_->schedule(wheel_2, TestData.single_ptr_data_3, kSingleSizeData3, 50000, NULL);
+	TESTBASE_printFunctionResult(wheel_2, (u8 *)"schedule wheel_2", error_type);
+	TestData.single_ptr_data_3 = NULL;
+	error_type = tw->ops_->schedule(wheel_2, TestData.single_ptr_data_4, kSingleSizeData4, 1, NULL);
+	TESTBASE_printFunctionResult(wheel_2, (u8 *)"schedule wheel_2 (NOT VALID, full)", error_type);
+	if (kErrorCode_InsertionFailed != error_type)
+		printf("  ==> ERROR: schedule into a full wheel_2 didn't fail\n");
+	printf("wheel_2:\n");
+	tw->ops_->print(wheel_2);
+
+	printf("\n\n# Test Cancel\n");
+	// the timers with an odd delay are cancelled, so they never fire
+	u32 cancelled = 0;
+	for (u16 i = 0; i < kTimingWheelElements; ++i) {
+		u32 delay = (u32)((i * 37) % kTimingWheelElements);
+		if (1 == delay % 2) {
+			data = tw->ops_->cancel(wheel_1, handles[i]);
+			if (NULL == data || *(u32 *)data != delay * delay * delay * 20 + delay) {
+				printf("  ==> ERROR: cancel wheel_1 didn't return the timer of delay %u\n", delay);
+			}
+			MM->free(data);
+			handles[i] = NULL;
+			cancelled++;
+		}
+	}
+	if (kTimingWheelElements - cancelled != tw->ops_->length(wheel_1))
+		printf("  ==> ERROR: length wheel_1 is %u after cancelling %u\n", tw->ops_->length(wheel_1), cancelled);
+
+	printf("\n\n# Test Advance\n");
+	// the timers come due in order of tick, through every level
+	fired.wheel = wheel_1;
+	fired.count = 0;
+	fired.previous = 0;
+	fired.errors = 0;
+	if (0 != tw->ops_->advance(wheel_1, 0, TIMINGWHEELTEST_check, &fired))
+		printf("  ==> ERROR: advance wheel_1 by 0 ticks fired timers\n");
+	u32 count = tw->ops_->advance(wheel_1, 100, TIMINGWHEELTEST_check, &fired);
+	count += tw->ops_->advance(wheel_1, 99 * 99 * 99 * 20 + 99, TIMINGWHEELTEST_check, &fired);
+	if (kTimingWheelElements - cancelled != count || count != fired.count || 0 != fired.errors)
+		printf("  ==> ERROR: advance wheel_1 fired %u timers with %u errors, expected %u\n",
+			count, fired.errors, kTimingWheelElements - cancelled);
+	if (!tw->ops_->isEmpty(wheel_1))
+		printf("  ==> ERROR: wheel_1 is not empty\n");
+
+	printf("\n\n# Test Periodic\n");
+	// the callback schedules its own timer again
+	fired.count = 0;
+	fired.errors = 0;
+	tw->ops_->schedule(wheel_1, TIMINGWHEELTEST_tick(tw->ops_->now(wheel_1) + kPeriod), sizeof(u32), kPeriod, NULL);
+	count = tw->ops_->advance(wheel_1, kPeriod * (kPeriodicRounds + 1), TIMINGWHEELTEST_periodic, &fired);
+	if (kPeriodicRounds != count || 0 != fired.errors)
+		printf("  ==> ERROR: the periodic timer fired %u times with %u errors\n", count, fired.errors);
+
+	printf("\n\n# Test Reset\n");
+	for (u16 i = 0; i < kTimingWheelElements; ++i) {
+		tw->ops_->schedule(wheel_1, TIMINGWHEELTEST_tick(0), sizeof(u32), i * 1000, &handles[i]);
+	}
+	error_type = tw->ops_->reset(wheel_1);
+	TESTBASE_printFunctionResult(wheel_1, (u8 *)"reset wheel_1", error_type);
+	if (!tw->ops_->isEmpty(wheel_1))
+		printf("  ==> ERROR: wheel_1 is not empty after the reset\n");
+	// the handles are not pending any more
+	if (NULL != tw->ops_->cancel(wheel_1, handles[0]))
+		printf("  ==> ERROR: cancel wheel_1 of a timer that is not pending returned data\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = tw->ops_->destroy(wheel_2);
+	wheel_2 = NULL;
+	TESTBASE_printFunctionResult(wheel_2, (u8 *)"destroy wheel_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	wheel_2 = TIMINGWHEEL_create(0);
+	if (NULL != wheel_2) {
+		printf("ERROR: trying to create wheel_2 with 0 capacity\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Schedule\n");
+	data = TestData.single_ptr_big_data;
+	error_type = tw->ops_->schedule(wheel_2, data, kSingleSizeBigData, 1, NULL);
+	TESTBASE_printFunctionResult(wheel_2, (u8 *)"schedule wheel_2 (NOT VALID)", error_type);
+	error_type = tw->ops_->schedule(wheel_1, NULL, kSingleSizeBigData, 1, NULL);
+	TESTBASE_printFunctionResult(wheel_1, (u8 *)"schedule wheel_1 NULL data (NOT VALID)", error_type);
+	error_type = tw->ops_->schedule(wheel_1, data, 0, 1, NULL);
+	TESTBASE_printFunctionResult(wheel_1, (u8 *)"schedule wheel_1 0 bytes (NOT VALID)", error_type);
+
+	printf("\n\n# Test Cancel and Advance\n");
+	data = tw->ops_->cancel(wheel_1, NULL);
+	if (NULL != data)
+		printf("ERROR: trying to cancel a NULL handle\n");
+	data = tw->ops_->cancel(wheel_2, handles[0]);
+	if (NULL != data)
+		printf("ERROR: trying to cancel in a NULL wheel\n");
+	if (0 != tw->ops_->advance(wheel_2, 1, TIMINGWHEELTEST_check, &fired))
+		printf("ERROR: trying to advance a NULL wheel\n");
+	if (0 != tw->ops_->advance(wheel_1, 1, NULL, NULL))
+		printf("ERROR: trying to advance with a NULL callback\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = tw->ops_->destroy(wheel_2);
+	TESTBASE_printFunctionResult(wheel_2, (u8 *)"destroy wheel_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = tw->ops_->destroy(wheel_1);
+	TESTBASE_printFunctionResult(wheel_1, (u8 *)"destroy wheel_1", error_type);
+	error_type = tw->ops_->destroy(tw);
+	TESTBASE_printFunctionResult(tw, (u8 *)"destroy TimingWheel Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
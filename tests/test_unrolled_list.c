@@ -0,0 +1,209 @@
+// test_unrolled_list.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for unrolled list ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_unrolled_list.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kCapacityUnrolledList1 = 200;
+const u16 kCapacityUnrolledList2 = 5;
+const u16 kUnrolledListChunkSize1 = 4;
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+
+	TESTBASE_generateDataForTest();
+
+	// list created just to have a reference to the operations
+	UnrolledList *ul = NULL;
+	ul = UNROLLEDLIST_create(1);
+	if (NULL == ul) {
+		printf("\n create returned a null node in unrolled list for ops");
+		return -1;
+	}
+	// lists to work with, small chunks so they split and merge often
+	UnrolledList *list_1 = NULL;
+	UnrolledList *list_2 = NULL;
+	list_1 = UNROLLEDLIST_createWithChunkSize(kCapacityUnrolledList1, kUnrolledListChunkSize1);
+	if (NULL == list_1) {
+		printf("\n create returned a null node in list_1\n");
+		return -1;
+	}
+	list_2 = UNROLLEDLIST_create(kCapacityUnrolledList2);
+	if (NULL == list_2) {
+		printf("\n create returned a null node in list_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + Mem Node: %zu\n", sizeof(MemoryNode));
+	printf("  + list_1: %zu\n", sizeof(*list_1));
+	printf("  + chunk: %zu + %zu per slot\n", sizeof(UnrolledListChunk), sizeof(MemoryNode));
+
+	printf("\n\n# Test Insert\n");
+	// even numbers at the back, then odd numbers in between
+	for (u16 i = 0; i < 50; ++i) {
+		error_type = ul->ops_->insertLast(list_1, TESTBASE_generateDataIntegerAsString(i * 2), kMaxIntegerChars);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(list_1, (u8 *)"insertLast list_1", error_type);
+	}
+	for (u16 i = 0; i < 50; ++i) {
+		error_type = ul->ops_->insertAt(list_1, TESTBASE_generateDataIntegerAsString(i * 2 + 1), kMaxIntegerChars, i * 2 + 1);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(list_1, (u8 *)"insertAt list_1", error_type);
+	}
+	error_type = ul->ops_->insertFirst(list_1, TESTBASE_generateDataIntegerAsString(1000), kMaxIntegerChars);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertFirst list_1", error_type);
+	MM->free(ul->ops_->extractFirst(list_1));
+	for (u16 i = 0; i < 100; ++i) {
+		data = ul->ops_->at(list_1, i);
+		if (NULL == data || (u16)atoi((char *)data) != i) {
+			printf("  ==> ERROR: at list_1 (position %d)\n", i);
+			break;
+		}
+	}
+	data = ul->ops_->last(list_1);
+	if (NULL == data || 0 != strcmp((char *)data, "99"))
+		printf("  ==> ERROR: last list_1 is not \"99\"\n");
+
+	printf("\n\n# Test Extract\n");
+	data = ul->ops_->extractAt(list_1, 50);
+	if (NULL == data || 0 != strcmp((char *)data, "50"))
+		printf("  ==> ERROR: extractAt list_1 (position 50) didn't return \"50\"\n");
+	MM->free(data);
+	data = ul->ops_->at(list_1, 50);
+	if (NULL == data || 0 != strcmp((char *)data, "51"))
+		printf("  ==> ERROR: at list_1 (position 50) after extractAt is not \"51\"\n");
+	data = ul->ops_->extractLast(list_1);
+	if (NULL == data || 0 != strcmp((char *)data, "99"))
+		printf("  ==> ERROR: extractLast list_1 didn't return \"99\"\n");
+	MM->free(data);
+	data = ul->ops_->extractFirst(list_1);
+	if (NULL == data || 0 != strcmp((char *)data, "0"))
+		printf("  ==> ERROR: extractFirst list_1 didn't return \"0\"\n");
+	MM->free(data);
+
+	printf("\n\n# Test Chunks\n");
+	// no chunk is empty and every chunk fits its slots
+	u16 counted = 0;
+	for (UnrolledListChunk *chunk = list_1->head_; NULL != chunk; chunk = chunk->next_) {
+		if (0 == chunk->count_ || chunk->count_ > kUnrolledListChunkSize1)
+			printf("  ==> ERROR: list_1 has a chunk with %d slots in use\n", chunk->count_);
+		counted += chunk->count_;
+	}
+	if (counted != ul->ops_->length(list_1))
+		printf("  ==> ERROR: list_1 chunks hold %d elements\n", counted);
+	for (u16 i = 0; i < 90; ++i) {
+		MM->free(ul->ops_->extractAt(list_1, 3));
+	}
+	if (7 != ul->ops_->length(list_1) || list_1->chunks_ > 3)
+		printf("  ==> ERROR: list_1 keeps %d chunks for %d elements\n", list_1->chunks_, ul->ops_->length(list_1));
+	data = ul->ops_->at(list_1, 3);
+	if (NULL == data || 0 != strcmp((char *)data, "95"))
+		printf("  ==> ERROR: at list_1 (position 3) after merging is not \"95\"\n");
+
+	printf("\n\n# Test Length\n");
+	if (7 != ul->ops_->length(list_1))
+		printf("  ==> ERROR: length list_1 is %d\n", ul->ops_->length(list_1));
+
+	printf("\n\n# Test Concat\n");
+	ul->ops_->insertLast(list_2, TestData.single_ptr_data_1, kSingleSizeData1);
+	TestData.single_ptr_data_1 = NULL;
+	ul->ops_->insertLast(list_2, TestData.single_ptr_data_2, kSingleSizeData2);
+	TestData.single_ptr_data_2 = NULL;
+	error_type = ul->ops_->concat(list_1, list_2);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"concat list_1 + list_2", error_type);
+	if (9 != ul->ops_->length(list_1) || (kCapacityUnrolledList1 + kCapacityUnrolledList2) != ul->ops_->capacity(list_1))
+		printf("  ==> ERROR: concat list_1 + list_2 length %d\n", ul->ops_->length(list_1));
+	printf("list_2:\n");
+	ul->ops_->print(list_2);
+
+	printf("\n\n# Test Resize\n");
+	error_type = ul->ops_->resize(list_1, 3);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"resize list_1", error_type);
+	error_type = ul->ops_->insertLast(list_1, TestData.single_ptr_data_3, kSingleSizeData3);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"insertLast list_1 (NOT VALID, full)", error_type);
+	printf("list_1:\n");
+	ul->ops_->print(list_1);
+
+	printf("\n\n# Test Reset\n");
+	error_type = ul->ops_->reset(list_2);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"reset list_2", error_type);
+	if (!ul->ops_->isEmpty(list_2) || NULL != ul->ops_->last(list_2))
+		printf("  ==> ERROR: list_2 is not empty after reset\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = ul->ops_->destroy(list_2);
+	list_2 = NULL;
+	TESTBASE_printFunctionResult(list_2, (u8 *)"destroy list_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	list_2 = UNROLLEDLIST_create(0);
+	if (NULL != list_2) {
+		printf("ERROR: trying to create list_2 with 0 capacity\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Insert\n");
+	data = TestData.single_ptr_big_data;
+	error_type = ul->ops_->insertFirst(list_2, data, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"insertFirst list_2 (NOT VALID)", error_type);
+	error_type = ul->ops_->insertLast(list_2, data, kSingleSizeBigData);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"insertLast list_2 (NOT VALID)", error_type);
+	error_type = ul->ops_->insertAt(list_2, data, kSingleSizeBigData, 1);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"insertAt list_2 (NOT VALID)", error_type);
+
+	printf("\n\n# Test First\n");
+	data = ul->ops_->first(list_2);
+	if (NULL != data)
+		printf("ERROR: First in list_2 is not NULL\n");
+	data = ul->ops_->at(list_2, 1);
+	if (NULL != data)
+		printf("ERROR: At in list_2 is not NULL\n");
+	data = ul->ops_->last(list_2);
+	if (NULL != data)
+		printf("ERROR: Last in list_2 is not NULL\n");
+
+	printf("\n\n# Test Extract\n");
+	data = ul->ops_->extractFirst(list_2);
+	if (NULL != data)
+		printf("ERROR: trying to extractFirst from a NULL list\n");
+	data = ul->ops_->extractAt(ul, 0);
+	if (NULL != data)
+		printf("ERROR: trying to extractAt from an empty list\n");
+
+	printf("\n\n# Test Concat\n");
+	error_type = ul->ops_->concat(list_1, list_2);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"concat list_1 + list_2 (NOT VALID)", error_type);
+
+	printf("\n\n# Test Destroy\n");
+	error_type = ul->ops_->destroy(list_2);
+	TESTBASE_printFunctionResult(list_2, (u8 *)"destroy list_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = ul->ops_->destroy(list_1);
+	TESTBASE_printFunctionResult(list_1, (u8 *)"destroy list_1", error_type);
+	error_type = ul->ops_->destroy(ul);
+	TESTBASE_printFunctionResult(ul, (u8 *)"destroy UnrolledList Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
@@ -431,6 +431,34 @@ int main() {
 	TESTBASE_printFunctionResult(vector_3, (u8 *)"destroy vector_3 (NOT VALID)", error_type);
 
 
+	printf("\n\n# Test TraverseEx\n");
+	Vector *vector_t = VECTOR_create(40);
+	for (u16 i = 0; i < 40; ++i) {
+		v->ops_->insertLast(vector_t, TESTBASE_generateDataIntegerAsString(i), kMaxIntegerChars);
+	}
+	TraverseCounters counters = { 0, 3, 0 };
+	error_type = v->ops_->traverseEx(vector_t, TESTBASE_countUntil, &counters);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseEx vector_t", error_type);
+	if (3 != counters.visited)
+		printf("  ==> ERROR: traverseEx vector_t visited %d elements instead of stopping at 3\n", counters.visited);
+	counters = (TraverseCounters){ 0, 0xFFFF, 0 };
+	error_type = v->ops_->traverseBatch(vector_t, TESTBASE_countSpansUntil, &counters);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseBatch vector_t", error_type);
+	if (40 != counters.visited || 2 != counters.spans)
+		printf("  ==> ERROR: traverseBatch vector_t visited %d elements in %d spans\n", counters.visited, counters.spans);
+	counters = (TraverseCounters){ 0, 1, 0 };
+	error_type = v->ops_->traverseBatch(vector_t, TESTBASE_countSpansUntil, &counters);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseBatch vector_t", error_type);
+	if (1 != counters.spans)
+		printf("  ==> ERROR: traverseBatch vector_t didn't stop after the first span\n");
+	error_type = v->ops_->traverseEx(vector_t, NULL, NULL);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"traverseEx vector_t NULL (NOT VALID)", error_type);
+	error_type = v->ops_->traverseBatch(NULL, TESTBASE_countSpansUntil, &counters);
+	TESTBASE_printFunctionResult(NULL, (u8 *)"traverseBatch NULL (NOT VALID)", error_type);
+	error_type = v->ops_->destroy(vector_t);
+	TESTBASE_printFunctionResult(vector_t, (u8 *)"destroy vector_t", error_type);
+
+
 	// Work is done, clean the system
 	error_type = v->ops_->destroy(vector_1);
 	TESTBASE_printFunctionResult(vector_1, (u8 *)"destroy vector_1", error_type);
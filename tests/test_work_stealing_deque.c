@@ -0,0 +1,162 @@
+// test_work_stealing_deque.c
+// Escuela Superior de Arte y Tecnologia
+// Algoritmos & Inteligencia Artificial
+// ESAT 2020-2021
+//
+// Test battery for work-stealing deque ADT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adt_work_stealing_deque.h"
+#include "ABGS_MemoryManager/abgs_memory_manager.h"
+
+#include "./../tests/test_base.c"
+
+const u16 kCapacityWorkStealingDeque1 = 200;
+const u16 kCapacityWorkStealingDeque2 = 3;
+
+int main() {
+	s16 error_type = 0;
+	void *data = NULL;
+	u32 values[256];
+
+	TESTBASE_generateDataForTest();
+	for (u16 i = 0; i < 256; ++i) {
+		values[i] = i;
+	}
+
+	// deque created just to have a reference to the operations
+	WorkStealingDeque *wd = NULL;
+	wd = WORKSTEALINGDEQUE_create(1);
+	if (NULL == wd) {
+		printf("\n create returned a null node in deque for ops");
+		return -1;
+	}
+	// deques to work with
+	WorkStealingDeque *deque_1 = NULL;
+	WorkStealingDeque *deque_2 = NULL;
+	deque_1 = WORKSTEALINGDEQUE_create(kCapacityWorkStealingDeque1);
+	if (NULL == deque_1) {
+		printf("\n create returned a null node in deque_1\n");
+		return -1;
+	}
+	deque_2 = WORKSTEALINGDEQUE_create(kCapacityWorkStealingDeque2);
+	if (NULL == deque_2) {
+		printf("\n create returned a null node in deque_2\n");
+		return -1;
+	}
+
+	printf("Size of:\n");
+	printf("  + deque_1: %zu\n", sizeof(*deque_1));
+
+	printf("\n\n# Test Capacity\n");
+	// rounded up to a power of two
+	if (256 != wd->ops_->capacity(deque_1))
+		printf("  ==> ERROR: capacity deque_1 is %d instead of 256\n", wd->ops_->capacity(deque_1));
+	if (4 != wd->ops_->capacity(deque_2))
+		printf("  ==> ERROR: capacity deque_2 is %d instead of 4\n", wd->ops_->capacity(deque_2));
+
+	printf("\n\n# Test Push\n");
+	for (u16 i = 0; i < 100; ++i) {
+		error_type = wd->ops_->push(deque_1, &values[i]);
+		if (kErrorCode_Ok != error_type)
+			TESTBASE_printFunctionResult(deque_1, (u8 *)"push deque_1", error_type);
+	}
+	if (100 != wd->ops_->length(deque_1))
+		printf("  ==> ERROR: length deque_1 is %d\n", wd->ops_->length(deque_1));
+	for (u16 i = 0; i < 4; ++i) {
+		error_type = wd->ops_->push(deque_2, &values[i]);
+		TESTBASE_printFunctionResult(deque_2, (u8 *)"push deque_2", error_type);
+	}
+	error_type = wd->ops_->push(deque_2, &values[4]);
+	TESTBASE_printFunctionResult(deque_2, (u8 *)"push deque_2 (NOT VALID, full)", error_type);
+	if (!wd->ops_->isFull(deque_2))
+		printf("  ==> ERROR: deque_2 is not full\n");
+	printf("deque_2:\n");
+	wd->ops_->print(deque_2);
+
+	printf("\n\n# Test Pop and Steal\n");
+	// the owner takes the newest, the thieves the oldest
+	for (u16 i = 0; i < 50; ++i) {
+		data = wd->ops_->pop(deque_1);
+		if (&values[99 - i] != data) {
+			printf("  ==> ERROR: pop deque_1 didn't return %d\n", 99 - i);
+			break;
+		}
+		data = wd->ops_->steal(deque_1);
+		if (&values[i] != data) {
+			printf("  ==> ERROR: steal deque_1 didn't return %d\n", i);
+			break;
+		}
+	}
+	if (!wd->ops_->isEmpty(deque_1))
+		printf("  ==> ERROR: deque_1 is not empty\n");
+	if (NULL != wd->ops_->pop(deque_1))
+		printf("  ==> ERROR: pop from an empty deque_1 is not NULL\n");
+	if (NULL != wd->ops_->steal(deque_1))
+		printf("  ==> ERROR: steal from an empty deque_1 is not NULL\n");
+	if (0 != wd->ops_->length(deque_1))
+		printf("  ==> ERROR: length deque_1 is %d after a pop from empty\n", wd->ops_->length(deque_1));
+
+	printf("\n\n# Test Wrap Around\n");
+	// the indices go around the circular storage many times
+	while (NULL != wd->ops_->pop(deque_2)) {
+	}
+	for (u16 rep = 0; rep < 1000; ++rep) {
+		wd->ops_->push(deque_2, &values[rep % 256]);
+		wd->ops_->push(deque_2, &values[(rep + 1) % 256]);
+		if (&values[rep % 256] != wd->ops_->steal(deque_2) || &values[(rep + 1) % 256] != wd->ops_->pop(deque_2)) {
+			printf("  ==> ERROR: deque_2 lost the order at %d\n", rep);
+			break;
+		}
+	}
+	if (!wd->ops_->isEmpty(deque_2))
+		printf("  ==> ERROR: deque_2 is not empty\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = wd->ops_->destroy(deque_2);
+	deque_2 = NULL;
+	TESTBASE_printFunctionResult(deque_2, (u8 *)"destroy deque_2", error_type);
+
+	MM->status();
+
+	printf("\n\n---------------- NULL BATTERY ----------------\n\n");
+	printf("\n\n# Test Create\n");
+	deque_2 = WORKSTEALINGDEQUE_create(0);
+	if (NULL != deque_2) {
+		printf("ERROR: trying to create deque_2 with 0 capacity\n");
+		return -1;
+	}
+
+	printf("\n\n# Test Push\n");
+	error_type = wd->ops_->push(deque_2, &values[0]);
+	TESTBASE_printFunctionResult(deque_2, (u8 *)"push deque_2 (NOT VALID)", error_type);
+	error_type = wd->ops_->push(deque_1, NULL);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"push deque_1 NULL data (NOT VALID)", error_type);
+
+	printf("\n\n# Test Pop and Steal\n");
+	if (NULL != wd->ops_->pop(deque_2))
+		printf("ERROR: trying to pop from a NULL deque\n");
+	if (NULL != wd->ops_->steal(deque_2))
+		printf("ERROR: trying to steal from a NULL deque\n");
+
+	printf("\n\n# Test Destroy\n");
+	error_type = wd->ops_->destroy(deque_2);
+	TESTBASE_printFunctionResult(deque_2, (u8 *)"destroy deque_2 (NOT VALID)", error_type);
+
+	// Work is done, clean the system
+	error_type = wd->ops_->destroy(deque_1);
+	TESTBASE_printFunctionResult(deque_1, (u8 *)"destroy deque_1", error_type);
+	error_type = wd->ops_->destroy(wd);
+	TESTBASE_printFunctionResult(wd, (u8 *)"destroy WorkStealingDeque Operations", error_type);
+
+	MM->status();
+	TESTBASE_freeDataForTest();
+	MM->status();
+	printf("Press ENTER to continue\n");
+	getchar();
+	MM->destroy();
+	return 0;
+}
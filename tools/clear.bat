@@ -7,6 +7,26 @@ IF EXIST ..\build\PR2_List rmdir /s /q ..\build\PR2_List
 IF EXIST ..\build\PR3_DLList rmdir /s /q ..\build\PR3_DLList
 IF EXIST ..\build\PR4_Stack rmdir /s /q ..\build\PR4_Stack
 IF EXIST ..\build\PR5_Queue rmdir /s /q ..\build\PR5_Queue
+IF EXIST ..\build\PR6_Comparative rmdir /s /q ..\build\PR6_Comparative
+IF EXIST ..\build\PR7_CircularVector rmdir /s /q ..\build\PR7_CircularVector
+IF EXIST ..\build\PR8_MovableHeadVector rmdir /s /q ..\build\PR8_MovableHeadVector
+IF EXIST ..\build\PR9_PersistentLog rmdir /s /q ..\build\PR9_PersistentLog
+IF EXIST ..\build\PR10_Deque rmdir /s /q ..\build\PR10_Deque
+IF EXIST ..\build\PR11_SkipList rmdir /s /q ..\build\PR11_SkipList
+IF EXIST ..\build\PR12_UnrolledList rmdir /s /q ..\build\PR12_UnrolledList
+IF EXIST ..\build\PR13_IntrusiveList rmdir /s /q ..\build\PR13_IntrusiveList
+IF EXIST ..\build\PR14_IntrusiveDList rmdir /s /q ..\build\PR14_IntrusiveDList
+IF EXIST ..\build\PR15_CompactDList rmdir /s /q ..\build\PR15_CompactDList
+IF EXIST ..\build\PR16_LockFreeStack rmdir /s /q ..\build\PR16_LockFreeStack
+IF EXIST ..\build\PR17_LockFreeQueue rmdir /s /q ..\build\PR17_LockFreeQueue
+IF EXIST ..\build\PR18_Heap rmdir /s /q ..\build\PR18_Heap
+IF EXIST ..\build\PR19_PairingHeap rmdir /s /q ..\build\PR19_PairingHeap
+IF EXIST ..\build\PR20_WorkStealingDeque rmdir /s /q ..\build\PR20_WorkStealingDeque
+IF EXIST ..\build\PR21_TaskScheduler rmdir /s /q ..\build\PR21_TaskScheduler
+IF EXIST ..\build\PR22_BlockingQueue rmdir /s /q ..\build\PR22_BlockingQueue
+IF EXIST ..\build\PR23_EliminationStack rmdir /s /q ..\build\PR23_EliminationStack
+IF EXIST ..\build\PR24_TimingWheel rmdir /s /q ..\build\PR24_TimingWheel
+IF EXIST ..\build\PR25_StackArena rmdir /s /q ..\build\PR25_StackArena
 IF EXIST ..\bin\debug rmdir /s /q ..\bin\debug
 IF EXIST ..\bin\release rmdir /s /q ..\bin\release
 
@@ -52,7 +52,26 @@ solution("DS_ALG_AI1" .. _ACTION)
     "PR3_DLList",
     "PR4_Stack",
     "PR5_Queue",
-    "PR6_Comparative"
+    "PR6_Comparative",
+    "PR7_CircularVector",
+    "PR8_MovableHeadVector",
+    "PR9_PersistentLog",
+    "PR10_Deque",
+    "PR11_SkipList",
+    "PR12_UnrolledList",
+    "PR13_IntrusiveList",
+    "PR14_IntrusiveDList",
+    "PR15_CompactDList",
+    "PR16_LockFreeStack",
+    "PR17_LockFreeQueue",
+    "PR18_Heap",
+    "PR19_PairingHeap",
+    "PR20_WorkStealingDeque",
+    "PR21_TaskScheduler",
+    "PR22_BlockingQueue",
+    "PR23_EliminationStack",
+    "PR24_TimingWheel",
+    "PR25_StackArena"
   }
 
   for i, prj in ipairs(projects_names) do
@@ -118,6 +137,7 @@ solution("DS_ALG_AI1" .. _ACTION)
       path.join(PROJ_DIR, "./include/adt_memory_node.h"),
       path.join(PROJ_DIR, "./src/adt_memory_node.c"),
       path.join(PROJ_DIR, "./include/adt_list.h"),
+      path.join(PROJ_DIR, "./include/adt_prefetch.h"),
       path.join(PROJ_DIR, "./src/adt_list.c"),
       path.join(PROJ_DIR, "./tests/test_list.c"),
    }
@@ -127,6 +147,7 @@ solution("DS_ALG_AI1" .. _ACTION)
       path.join(PROJ_DIR, "./include/adt_memory_node.h"),
       path.join(PROJ_DIR, "./src/adt_memory_node.c"),
       path.join(PROJ_DIR, "./include/adt_dllist.h"),
+      path.join(PROJ_DIR, "./include/adt_prefetch.h"),
       path.join(PROJ_DIR, "./src/adt_dllist.c"),
       path.join(PROJ_DIR, "./tests/test_dllist.c"),
    }
@@ -147,7 +168,10 @@ solution("DS_ALG_AI1" .. _ACTION)
       path.join(PROJ_DIR, "./include/adt_memory_node.h"),
       path.join(PROJ_DIR, "./src/adt_memory_node.c"),
       path.join(PROJ_DIR, "./include/adt_list.h"),
+      path.join(PROJ_DIR, "./include/adt_prefetch.h"),
       path.join(PROJ_DIR, "./src/adt_list.c"),
+      path.join(PROJ_DIR, "./include/adt_circular_vector.h"),
+      path.join(PROJ_DIR, "./src/adt_circular_vector.c"),
       path.join(PROJ_DIR, "./include/adt_queue.h"),
       path.join(PROJ_DIR, "./src/adt_queue.c"),
       path.join(PROJ_DIR, "./tests/test_queue.c"),
@@ -162,11 +186,236 @@ solution("DS_ALG_AI1" .. _ACTION)
       path.join(PROJ_DIR, "./include/adt_stack.h"),
       path.join(PROJ_DIR, "./src/adt_stack.c"),
       path.join(PROJ_DIR, "./include/adt_list.h"),
+      path.join(PROJ_DIR, "./include/adt_prefetch.h"),
       path.join(PROJ_DIR, "./src/adt_list.c"),
       path.join(PROJ_DIR, "./include/adt_dllist.h"),
       path.join(PROJ_DIR, "./src/adt_dllist.c"),
+      path.join(PROJ_DIR, "./include/adt_skip_list.h"),
+      path.join(PROJ_DIR, "./src/adt_skip_list.c"),
+      path.join(PROJ_DIR, "./include/adt_unrolled_list.h"),
+      path.join(PROJ_DIR, "./src/adt_unrolled_list.c"),
+      path.join(PROJ_DIR, "./include/adt_atomic.h"),
+      path.join(PROJ_DIR, "./include/adt_hazard.h"),
+      path.join(PROJ_DIR, "./src/adt_hazard.c"),
+      path.join(PROJ_DIR, "./include/adt_lockfree_stack.h"),
+      path.join(PROJ_DIR, "./src/adt_lockfree_stack.c"),
+      path.join(PROJ_DIR, "./include/adt_lockfree_queue.h"),
+      path.join(PROJ_DIR, "./src/adt_lockfree_queue.c"),
+      path.join(PROJ_DIR, "./include/adt_heap.h"),
+      path.join(PROJ_DIR, "./src/adt_heap.c"),
+      path.join(PROJ_DIR, "./include/adt_pairing_heap.h"),
+      path.join(PROJ_DIR, "./src/adt_pairing_heap.c"),
+      path.join(PROJ_DIR, "./include/adt_work_stealing_deque.h"),
+      path.join(PROJ_DIR, "./src/adt_work_stealing_deque.c"),
+      path.join(PROJ_DIR, "./include/adt_task_scheduler.h"),
+      path.join(PROJ_DIR, "./src/adt_task_scheduler.c"),
+      path.join(PROJ_DIR, "./include/adt_blocking_queue.h"),
+      path.join(PROJ_DIR, "./src/adt_blocking_queue.c"),
+      path.join(PROJ_DIR, "./include/adt_elimination_stack.h"),
+      path.join(PROJ_DIR, "./src/adt_elimination_stack.c"),
+      path.join(PROJ_DIR, "./include/adt_timing_wheel.h"),
+      path.join(PROJ_DIR, "./src/adt_timing_wheel.c"),
+      path.join(PROJ_DIR, "./include/adt_stack_arena.h"),
+      path.join(PROJ_DIR, "./src/adt_stack_arena.c"),
       path.join(PROJ_DIR, "./include/adt_vector.h"),
       path.join(PROJ_DIR, "./src/adt_vector.c"),
+      path.join(PROJ_DIR, "./include/adt_circular_vector.h"),
+      path.join(PROJ_DIR, "./src/adt_circular_vector.c"),
       path.join(PROJ_DIR, "./tests/comparative.c"),
 
+    }
+
+          project "PR7_CircularVector"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_circular_vector.h"),
+      path.join(PROJ_DIR, "./src/adt_circular_vector.c"),
+      path.join(PROJ_DIR, "./tests/test_circular_vector.c"),
+    }
+
+          project "PR8_MovableHeadVector"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_movable_head_vector.h"),
+      path.join(PROJ_DIR, "./src/adt_movable_head_vector.c"),
+      path.join(PROJ_DIR, "./tests/test_movable_head_vector.c"),
+    }
+
+          project "PR9_PersistentLog"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_persistent_log.h"),
+      path.join(PROJ_DIR, "./src/adt_persistent_log.c"),
+      path.join(PROJ_DIR, "./tests/test_persistent_log.c"),
+    }
+
+          project "PR10_Deque"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_deque.h"),
+      path.join(PROJ_DIR, "./src/adt_deque.c"),
+      path.join(PROJ_DIR, "./tests/test_deque.c"),
+    }
+
+          project "PR11_SkipList"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_skip_list.h"),
+      path.join(PROJ_DIR, "./src/adt_skip_list.c"),
+      path.join(PROJ_DIR, "./tests/test_skip_list.c"),
+    }
+
+          project "PR12_UnrolledList"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_unrolled_list.h"),
+      path.join(PROJ_DIR, "./src/adt_unrolled_list.c"),
+      path.join(PROJ_DIR, "./tests/test_unrolled_list.c"),
+    }
+
+          project "PR13_IntrusiveList"
+    files {
+      path.join(PROJ_DIR, "./include/adt_intrusive_list.h"),
+      path.join(PROJ_DIR, "./src/adt_intrusive_list.c"),
+      path.join(PROJ_DIR, "./tests/test_intrusive_list.c"),
+    }
+
+          project "PR14_IntrusiveDList"
+    files {
+      path.join(PROJ_DIR, "./include/adt_intrusive_list.h"),
+      path.join(PROJ_DIR, "./include/adt_intrusive_dllist.h"),
+      path.join(PROJ_DIR, "./src/adt_intrusive_dllist.c"),
+      path.join(PROJ_DIR, "./tests/test_intrusive_dllist.c"),
+    }
+
+          project "PR15_CompactDList"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_compact_dllist.h"),
+      path.join(PROJ_DIR, "./src/adt_compact_dllist.c"),
+      path.join(PROJ_DIR, "./tests/test_compact_dllist.c"),
+    }
+
+          project "PR16_LockFreeStack"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_atomic.h"),
+      path.join(PROJ_DIR, "./include/adt_hazard.h"),
+      path.join(PROJ_DIR, "./src/adt_hazard.c"),
+      path.join(PROJ_DIR, "./include/adt_lockfree_stack.h"),
+      path.join(PROJ_DIR, "./src/adt_lockfree_stack.c"),
+      path.join(PROJ_DIR, "./tests/test_lockfree_stack.c"),
+    }
+
+          project "PR17_LockFreeQueue"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_atomic.h"),
+      path.join(PROJ_DIR, "./include/adt_hazard.h"),
+      path.join(PROJ_DIR, "./src/adt_hazard.c"),
+      path.join(PROJ_DIR, "./include/adt_lockfree_queue.h"),
+      path.join(PROJ_DIR, "./src/adt_lockfree_queue.c"),
+      path.join(PROJ_DIR, "./tests/test_lockfree_queue.c"),
+    }
+
+          project "PR18_Heap"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_heap.h"),
+      path.join(PROJ_DIR, "./src/adt_heap.c"),
+      path.join(PROJ_DIR, "./tests/test_heap.c"),
+    }
+
+          project "PR19_PairingHeap"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_pairing_heap.h"),
+      path.join(PROJ_DIR, "./src/adt_pairing_heap.c"),
+      path.join(PROJ_DIR, "./tests/test_pairing_heap.c"),
+    }
+
+          project "PR20_WorkStealingDeque"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_atomic.h"),
+      path.join(PROJ_DIR, "./include/adt_work_stealing_deque.h"),
+      path.join(PROJ_DIR, "./src/adt_work_stealing_deque.c"),
+      path.join(PROJ_DIR, "./tests/test_work_stealing_deque.c"),
+    }
+
+          project "PR21_TaskScheduler"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_atomic.h"),
+      path.join(PROJ_DIR, "./include/adt_work_stealing_deque.h"),
+      path.join(PROJ_DIR, "./src/adt_work_stealing_deque.c"),
+      path.join(PROJ_DIR, "./include/adt_task_scheduler.h"),
+      path.join(PROJ_DIR, "./src/adt_task_scheduler.c"),
+      path.join(PROJ_DIR, "./tests/test_task_scheduler.c"),
+    }
+
+          project "PR22_BlockingQueue"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_list.h"),
+      path.join(PROJ_DIR, "./src/adt_list.c"),
+      path.join(PROJ_DIR, "./include/adt_circular_vector.h"),
+      path.join(PROJ_DIR, "./src/adt_circular_vector.c"),
+      path.join(PROJ_DIR, "./include/adt_queue.h"),
+      path.join(PROJ_DIR, "./src/adt_queue.c"),
+      path.join(PROJ_DIR, "./include/adt_atomic.h"),
+      path.join(PROJ_DIR, "./include/adt_blocking_queue.h"),
+      path.join(PROJ_DIR, "./src/adt_blocking_queue.c"),
+      path.join(PROJ_DIR, "./tests/test_blocking_queue.c"),
+    }
+
+          project "PR23_EliminationStack"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_atomic.h"),
+      path.join(PROJ_DIR, "./include/adt_hazard.h"),
+      path.join(PROJ_DIR, "./src/adt_hazard.c"),
+      path.join(PROJ_DIR, "./include/adt_elimination_stack.h"),
+      path.join(PROJ_DIR, "./src/adt_elimination_stack.c"),
+      path.join(PROJ_DIR, "./tests/test_elimination_stack.c"),
+    }
+
+          project "PR24_TimingWheel"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_timing_wheel.h"),
+      path.join(PROJ_DIR, "./src/adt_timing_wheel.c"),
+      path.join(PROJ_DIR, "./tests/test_timing_wheel.c"),
+    }
+
+          project "PR25_StackArena"
+    files {
+      path.join(PROJ_DIR, "./include/adt_memory_node.h"),
+      path.join(PROJ_DIR, "./src/adt_memory_node.c"),
+      path.join(PROJ_DIR, "./include/adt_vector.h"),
+      path.join(PROJ_DIR, "./src/adt_vector.c"),
+      path.join(PROJ_DIR, "./include/adt_stack.h"),
+      path.join(PROJ_DIR, "./src/adt_stack.c"),
+      path.join(PROJ_DIR, "./include/adt_list.h"),
+      path.join(PROJ_DIR, "./include/adt_prefetch.h"),
+      path.join(PROJ_DIR, "./src/adt_list.c"),
+      path.join(PROJ_DIR, "./include/adt_stack_arena.h"),
+      path.join(PROJ_DIR, "./src/adt_stack_arena.c"),
+      path.join(PROJ_DIR, "./tests/test_stack_arena.c"),
     }